@@ -0,0 +1,171 @@
+/*
+** ENetHostSoakBenchmark - Keeps a server ENetHost with a thousand peers busy with reliable and unreliable traffic, over loopback
+*/
+
+#include <Nazara/Core/Modules.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Network/Network.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace
+{
+	std::atomic_uint64_t s_allocationCount = 0;
+}
+
+// Count every heap allocation to check the steady state doesn't need any for command queues
+void* operator new(std::size_t size)
+{
+	s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+	if (void* ptr = std::malloc(size))
+		return ptr;
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+int main()
+{
+	constexpr std::size_t ClientHostCount = 10;
+	constexpr std::size_t PeerPerClientHost = 100;
+	constexpr std::size_t PeerCount = ClientHostCount * PeerPerClientHost;
+	constexpr std::size_t WarmupTickCount = 100;
+	constexpr std::size_t TickCount = 1000;
+	constexpr Nz::UInt16 ServerPort = 64288;
+
+	Nz::Modules<Nz::Network> nazara;
+
+	Nz::ENetHost server;
+	if (!server.Create(Nz::NetProtocol::IPv4, ServerPort, PeerCount, 2))
+	{
+		std::cerr << "failed to create server host" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	Nz::IpAddress serverAddress = Nz::IpAddress::LoopbackIpV4;
+	serverAddress.SetPort(ServerPort);
+
+	std::vector<std::unique_ptr<Nz::ENetHost>> clients;
+	std::vector<Nz::ENetPeer*> clientPeers;
+	for (std::size_t i = 0; i < ClientHostCount; ++i)
+	{
+		auto& client = clients.emplace_back(std::make_unique<Nz::ENetHost>());
+		if (!client->Create(Nz::IpAddress::LoopbackIpV4, PeerPerClientHost, 2))
+		{
+			std::cerr << "failed to create client host #" << i << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		for (std::size_t j = 0; j < PeerPerClientHost; ++j)
+			clientPeers.push_back(client->Connect(serverAddress, 2));
+	}
+
+	std::size_t receivedPackets = 0;
+
+	auto ServiceAll = [&]
+	{
+		Nz::ENetEvent event;
+		if (server.Service(&event, 0) > 0)
+		{
+			do
+			{
+				if (event.type == Nz::ENetEventType::Receive)
+				{
+					++receivedPackets;
+
+					// Echo reliable packets back
+					if (event.channelId == 0)
+						event.peer->Send(0, Nz::ENetPacketFlag_Reliable, Nz::NetPacket(1, event.packet->data.GetConstData() + Nz::NetPacket::HeaderSize, event.packet->data.GetDataSize() - Nz::NetPacket::HeaderSize));
+				}
+			}
+			while (server.CheckEvents(&event));
+		}
+
+		for (auto& client : clients)
+		{
+			if (client->Service(&event, 0) > 0)
+			{
+				do
+				{
+					if (event.type == Nz::ENetEventType::Receive)
+						++receivedPackets;
+				}
+				while (client->CheckEvents(&event));
+			}
+		}
+	};
+
+	auto connectionStart = std::chrono::steady_clock::now();
+	for (;;)
+	{
+		ServiceAll();
+
+		std::size_t connectedPeers = 0;
+		for (Nz::ENetPeer* peer : clientPeers)
+		{
+			if (peer->IsConnected())
+				connectedPeers++;
+		}
+
+		if (connectedPeers == PeerCount)
+			break;
+
+		if (std::chrono::steady_clock::now() - connectionStart > std::chrono::seconds(30))
+		{
+			std::cerr << "only " << connectedPeers << " out of " << PeerCount << " peers managed to connect" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	Nz::UInt8 payload[256] = {};
+
+	auto Tick = [&](std::size_t tickIndex)
+	{
+		for (std::size_t i = 0; i < clientPeers.size(); ++i)
+		{
+			std::size_t size = 16 + (tickIndex + i) % 240;
+			clientPeers[i]->Send(0, Nz::ENetPacketFlag_Reliable, Nz::NetPacket(1, payload, size));
+			clientPeers[i]->Send(1, Nz::ENetPacketFlag_Unreliable, Nz::NetPacket(2, payload, size));
+		}
+
+		ServiceAll();
+	};
+
+	// Let every queue and pool reach its steady state size
+	for (std::size_t i = 0; i < WarmupTickCount; ++i)
+		Tick(i);
+
+	receivedPackets = 0;
+	std::uint64_t allocationCount = s_allocationCount.load();
+
+	auto start = std::chrono::steady_clock::now();
+	for (std::size_t i = 0; i < TickCount; ++i)
+		Tick(WarmupTickCount + i);
+	auto end = std::chrono::steady_clock::now();
+
+	allocationCount = s_allocationCount.load() - allocationCount;
+
+	double elapsed = std::chrono::duration<double>(end - start).count();
+
+	std::cout << PeerCount << " peers, " << TickCount << " ticks\n";
+	std::cout << "\ttime per tick:      " << elapsed * 1000.0 / TickCount << "ms\n";
+	std::cout << "\treceived packets/s: " << receivedPackets / elapsed << "\n";
+	std::cout << "\theap allocations:   " << allocationCount << " (" << double(allocationCount) / (TickCount * PeerCount) << " per peer per tick)" << std::endl;
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,143 @@
+/*
+** ForwardFramePipelineBenchmark - Measures the CPU cost of rendering frames with the ForwardFramePipeline, using the null renderer (no GPU work)
+**
+** Usage: ForwardFramePipelineBenchmark [model count] [frame count]
+*/
+
+#include <Nazara/Core/Modules.hpp>
+#include <Nazara/Core/Primitive.hpp>
+#include <Nazara/Graphics/BasicMaterial.hpp>
+#include <Nazara/Graphics/ForwardFramePipeline.hpp>
+#include <Nazara/Graphics/GraphicalMesh.hpp>
+#include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Graphics/Material.hpp>
+#include <Nazara/Graphics/Model.hpp>
+#include <Nazara/Graphics/WorldInstance.hpp>
+#include <Nazara/Graphics/Components/CameraComponent.hpp>
+#include <Nazara/NullRenderer/NullDevice.hpp>
+#include <Nazara/NullRenderer/NullRenderWindow.hpp>
+#include <Nazara/Renderer/RenderFrame.hpp>
+#include <Nazara/Utility/Mesh.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[])
+{
+	std::size_t modelCount = (argc > 1) ? std::stoul(argv[1]) : 10'000;
+	std::size_t frameCount = (argc > 2) ? std::stoul(argv[2]) : 200;
+
+	Nz::Renderer::Config rendererConfig;
+	rendererConfig.preferredAPI = Nz::RenderAPI::Null;
+
+	Nz::Modules<Nz::Graphics> nazara(rendererConfig);
+
+	std::shared_ptr<Nz::NullDevice> device = std::static_pointer_cast<Nz::NullDevice>(Nz::Graphics::Instance()->GetRenderDevice());
+
+	Nz::NullRenderWindow renderTarget(device, Nz::Vector2ui(1920, 1080));
+
+	Nz::MeshParams meshParams;
+	meshParams.storage = Nz::DataStorage::Software;
+
+	// A few different meshes and materials so the pipeline has to sort and rebind state
+	constexpr std::size_t MeshCount = 4;
+	constexpr std::size_t MaterialCount = 8;
+
+	std::vector<std::shared_ptr<Nz::GraphicalMesh>> meshes;
+	for (std::size_t i = 0; i < MeshCount; ++i)
+	{
+		Nz::Mesh mesh;
+		mesh.CreateStatic();
+		mesh.BuildSubMesh(Nz::Primitive::Box(Nz::Vector3f::Unit(), Nz::Vector3ui(static_cast<unsigned int>(i))), meshParams);
+		mesh.SetMaterialCount(1);
+
+		meshes.push_back(std::make_shared<Nz::GraphicalMesh>(mesh));
+	}
+
+	std::vector<std::shared_ptr<Nz::Material>> materials;
+	for (std::size_t i = 0; i < MaterialCount; ++i)
+	{
+		std::shared_ptr<Nz::Material> material = std::make_shared<Nz::Material>(Nz::BasicMaterial::GetSettings());
+		material->EnableDepthBuffer(true);
+
+		Nz::BasicMaterial basicMat(*material);
+		basicMat.SetDiffuseColor(Nz::Color(static_cast<Nz::UInt8>(i * 32), 128, 255));
+
+		materials.push_back(std::move(material));
+	}
+
+	std::vector<std::unique_ptr<Nz::Model>> models;
+	std::vector<Nz::WorldInstance> worldInstances(modelCount);
+
+	Nz::ForwardFramePipeline framePipeline;
+
+	for (std::size_t i = 0; i < modelCount; ++i)
+	{
+		auto& model = models.emplace_back(std::make_unique<Nz::Model>(meshes[i % MeshCount]));
+		model->SetMaterial(0, materials[(i / MeshCount) % MaterialCount]);
+
+		float x = static_cast<float>(i % 100) - 50.f;
+		float z = static_cast<float>(i / 100) + 5.f;
+		worldInstances[i].UpdateWorldMatrix(Nz::Matrix4f::Translate(Nz::Vector3f(x, 0.f, -z)));
+
+		framePipeline.RegisterInstancedDrawable(&worldInstances[i], model.get());
+	}
+
+	Nz::CameraComponent camera(&renderTarget);
+	camera.UpdateZFar(10'000.f);
+	camera.GetViewerInstance().UpdateViewMatrix(Nz::Matrix4f::Translate(Nz::Vector3f(0.f, -5.f, 0.f)));
+
+	framePipeline.RegisterViewer(&camera);
+
+	auto RenderFrame = [&]
+	{
+		Nz::RenderFrame frame = renderTarget.Acquire();
+		framePipeline.Render(frame);
+		frame.Present();
+	};
+
+	// First frame bakes the frame graph and builds pipelines
+	auto start = std::chrono::steady_clock::now();
+	RenderFrame();
+	double firstFrameTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	device->ResetSubmittedStats();
+
+	double bestFrameTime = std::numeric_limits<double>::max();
+	double totalFrameTime = 0.0;
+	for (std::size_t i = 0; i < frameCount; ++i)
+	{
+		// Invalidate a part of the world instances each frame, like moving objects would
+		for (std::size_t j = i % 10; j < modelCount; j += 10)
+			framePipeline.InvalidateWorldInstance(&worldInstances[j]);
+
+		start = std::chrono::steady_clock::now();
+		RenderFrame();
+		double frameTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		bestFrameTime = std::min(bestFrameTime, frameTime);
+		totalFrameTime += frameTime;
+	}
+
+	const Nz::NullCommandBuffer::Stats& deviceStats = device->GetSubmittedStats();
+	const Nz::ForwardFramePipeline::RenderStats& pipelineStats = framePipeline.GetRenderStats();
+
+	std::cout << modelCount << " models, " << frameCount << " frames" << std::endl;
+	std::cout << " first frame: " << firstFrameTime << "ms" << std::endl;
+	std::cout << " frame time: " << totalFrameTime / frameCount << "ms average, " << bestFrameTime << "ms best" << std::endl;
+	std::cout << " per frame: " << deviceStats.drawCount / frameCount << " draws, "
+	          << deviceStats.pipelineBindCount / frameCount << " pipeline binds, "
+	          << deviceStats.shaderBindingBindCount / frameCount << " shader binding binds, "
+	          << deviceStats.vertexBufferBindCount / frameCount << " vertex buffer binds, "
+	          << deviceStats.bufferCopyCount / frameCount << " buffer copies, "
+	          << device->GetSubmittedCommandBufferCount() / frameCount << " command buffers" << std::endl;
+	std::cout << " last frame pipeline stats: " << pipelineStats.drawCount << " draws (" << pipelineStats.instancedDrawCount << " instanced), "
+	          << pipelineStats.materialBindCount << " material binds, " << pipelineStats.worldBindCount << " world binds" << std::endl;
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,5 @@
+target("ForwardFramePipelineBenchmark")
+	set_group("Benchmarks")
+	set_kind("binary")
+	add_deps("NazaraGraphics", "NazaraNullRenderer")
+	add_files("main.cpp")
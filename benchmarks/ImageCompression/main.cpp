@@ -0,0 +1,118 @@
+/*
+** ImageCompressionBenchmark - Measures block compression and decompression times of a 4K texture with its mipmaps, along with the compression error of each format
+*/
+
+#include <Nazara/Core/Modules.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Utility/Image.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <Nazara/Utility/Utility.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+
+namespace
+{
+	Nz::Image CreateNoisyGradient(unsigned int width, unsigned int height)
+	{
+		// Smooth content with some noise, closer to real textures than pure noise
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8, width, height);
+
+		std::mt19937 randomEngine(42);
+		std::uniform_int_distribution<int> noise(-8, 8);
+
+		Nz::UInt8* pixels = image.GetPixels();
+		for (unsigned int y = 0; y < height; ++y)
+		{
+			for (unsigned int x = 0; x < width; ++x)
+			{
+				int base[4] = {
+					int(127.f + 127.f * std::sin(x * 0.01f)),
+					int(127.f + 127.f * std::cos(y * 0.013f)),
+					int((x + y) * 255 / (width + height)),
+					int(127.f + 127.f * std::sin((x + y) * 0.005f))
+				};
+
+				for (unsigned int c = 0; c < 4; ++c)
+					*pixels++ = static_cast<Nz::UInt8>(std::clamp(base[c] + noise(randomEngine), 0, 255));
+			}
+		}
+
+		return image;
+	}
+
+	template<typename F>
+	double Measure(const Nz::Image& source, unsigned int repeatCount, F&& func)
+	{
+		double best = std::numeric_limits<double>::max();
+		for (unsigned int i = 0; i < repeatCount; ++i)
+		{
+			Nz::Image image(source);
+
+			auto start = std::chrono::steady_clock::now();
+			if (!func(image))
+			{
+				std::cerr << "conversion failed" << std::endl;
+				std::exit(EXIT_FAILURE);
+			}
+			auto end = std::chrono::steady_clock::now();
+
+			best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+		}
+
+		return best;
+	}
+
+	double ComputePSNR(const Nz::Image& reference, const Nz::Image& image)
+	{
+		const Nz::UInt8* referencePixels = reference.GetConstPixels();
+		const Nz::UInt8* pixels = image.GetConstPixels();
+		std::size_t size = reference.GetMemoryUsage(0);
+
+		double squaredError = 0.0;
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			double difference = double(referencePixels[i]) - double(pixels[i]);
+			squaredError += difference * difference;
+		}
+
+		double mse = squaredError / size;
+		return (mse > 0.0) ? 10.0 * std::log10(255.0 * 255.0 / mse) : std::numeric_limits<double>::infinity();
+	}
+}
+
+int main()
+{
+	constexpr unsigned int RepeatCount = 5;
+
+	Nz::Modules<Nz::Utility> nazara;
+
+	std::cout << Nz::TaskScheduler::GetWorkerCount() << " workers" << std::endl;
+
+	Nz::Image texture = CreateNoisyGradient(4096, 4096);
+	if (!texture.GenerateMipmaps())
+	{
+		std::cerr << "failed to generate mipmaps" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	for (Nz::PixelFormat format : { Nz::PixelFormat::DXT1, Nz::PixelFormat::DXT3, Nz::PixelFormat::DXT5, Nz::PixelFormat::BC4, Nz::PixelFormat::BC5 })
+	{
+		Nz::Image compressed(texture);
+		compressed.Convert(format);
+
+		Nz::Image decompressed(compressed);
+		decompressed.Convert(Nz::PixelFormat::RGBA8);
+
+		std::cout << Nz::PixelFormatInfo::GetName(format) << ":" << std::endl;
+		std::cout << " 4096x4096 texture compression: " << Measure(texture, RepeatCount, [&](Nz::Image& image) { return image.Convert(format); }) << "ms" << std::endl;
+		std::cout << " 4096x4096 texture decompression: " << Measure(compressed, RepeatCount, [](Nz::Image& image) { return image.Convert(Nz::PixelFormat::RGBA8); }) << "ms" << std::endl;
+		std::cout << " level 0 PSNR (every channel): " << ComputePSNR(texture, decompressed) << "dB" << std::endl;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,95 @@
+/*
+** ImageConversionBenchmark - Measures Image::Convert times between common pixel formats, on a 4K texture and on a cubemap with mipmaps
+*/
+
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <Nazara/Core/Modules.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Utility/Image.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <Nazara/Utility/Utility.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	Nz::Image CreateRandomImage(Nz::ImageType type, Nz::PixelFormat format, unsigned int width, unsigned int height, Nz::UInt8 levelCount)
+	{
+		Nz::Image image(type, format, width, height, 1, levelCount);
+
+		std::mt19937 randomEngine(42);
+		std::uniform_int_distribution<unsigned int> distribution(0, 255);
+		for (Nz::UInt8 level = 0; level < image.GetLevelCount(); ++level)
+		{
+			Nz::UInt8* pixels = image.GetPixels(0, 0, 0, level);
+			std::size_t size = image.GetMemoryUsage(level);
+			for (std::size_t i = 0; i < size; ++i)
+				pixels[i] = static_cast<Nz::UInt8>(distribution(randomEngine));
+		}
+
+		return image;
+	}
+
+	double MeasureConversion(const Nz::Image& source, Nz::PixelFormat format, unsigned int repeatCount)
+	{
+		double best = std::numeric_limits<double>::max();
+		for (unsigned int i = 0; i < repeatCount; ++i)
+		{
+			Nz::Image image(source);
+
+			auto start = std::chrono::steady_clock::now();
+			if (!image.Convert(format))
+			{
+				std::cerr << "conversion failed" << std::endl;
+				std::exit(EXIT_FAILURE);
+			}
+			auto end = std::chrono::steady_clock::now();
+
+			best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+		}
+
+		return best;
+	}
+}
+
+int main()
+{
+	constexpr unsigned int RepeatCount = 10;
+
+	Nz::Modules<Nz::Utility> nazara;
+
+	std::cout << Nz::TaskScheduler::GetWorkerCount() << " workers";
+	std::cout << ", SSE2: " << Nz::HardwareInfo::HasCapability(Nz::ProcessorCap::SSE2);
+	std::cout << ", SSSE3: " << Nz::HardwareInfo::HasCapability(Nz::ProcessorCap::SSSE3);
+	std::cout << ", AVX2: " << Nz::HardwareInfo::HasCapability(Nz::ProcessorCap::AVX2) << std::endl;
+
+	std::vector<std::pair<Nz::PixelFormat, Nz::PixelFormat>> conversions = {
+		{ Nz::PixelFormat::RGBA8,  Nz::PixelFormat::BGRA8  },
+		{ Nz::PixelFormat::RGB8,   Nz::PixelFormat::RGBA8  },
+		{ Nz::PixelFormat::RGBA8,  Nz::PixelFormat::RGB8   },
+		{ Nz::PixelFormat::L8,     Nz::PixelFormat::RGBA8  },
+		{ Nz::PixelFormat::LA8,    Nz::PixelFormat::RGBA8  },
+		{ Nz::PixelFormat::RGBA4,  Nz::PixelFormat::RGBA8  },
+		{ Nz::PixelFormat::RGB5A1, Nz::PixelFormat::RGBA8  },
+		{ Nz::PixelFormat::RGBA8,  Nz::PixelFormat::RGB5A1 },
+		{ Nz::PixelFormat::RGBA8,  Nz::PixelFormat::L8     }  //< scalar only
+	};
+
+	for (auto&& [srcFormat, dstFormat] : conversions)
+	{
+		Nz::Image texture = CreateRandomImage(Nz::ImageType::E2D, srcFormat, 4096, 4096, 1);
+		Nz::Image cubemap = CreateRandomImage(Nz::ImageType::Cubemap, srcFormat, 1024, 1024, 11);
+
+		std::cout << Nz::PixelFormatInfo::GetName(srcFormat) << " to " << Nz::PixelFormatInfo::GetName(dstFormat) << ":" << std::endl;
+		std::cout << " 4096x4096 texture: " << MeasureConversion(texture, dstFormat, RepeatCount) << "ms" << std::endl;
+		std::cout << " 1024x1024 cubemap with mipmaps: " << MeasureConversion(cubemap, dstFormat, RepeatCount) << "ms" << std::endl;
+	}
+
+	return EXIT_SUCCESS;
+}
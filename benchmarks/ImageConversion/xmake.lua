@@ -0,0 +1,5 @@
+target("ImageConversionBenchmark")
+	set_group("Benchmarks")
+	set_kind("binary")
+	add_deps("NazaraUtility")
+	add_files("main.cpp")
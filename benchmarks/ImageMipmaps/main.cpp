@@ -0,0 +1,100 @@
+/*
+** ImageMipmapsBenchmark - Measures Image::GenerateMipmaps and Image::Resize times per filter, on a 4K texture, a cubemap and a 3D texture
+*/
+
+#include <Nazara/Core/Modules.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Utility/Image.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <Nazara/Utility/Utility.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+	Nz::Image CreateRandomImage(Nz::ImageType type, Nz::PixelFormat format, unsigned int width, unsigned int height, unsigned int depth)
+	{
+		Nz::Image image(type, format, width, height, depth);
+
+		std::mt19937 randomEngine(42);
+		std::uniform_int_distribution<unsigned int> distribution(0, 255);
+
+		Nz::UInt8* pixels = image.GetPixels();
+		std::size_t size = image.GetMemoryUsage();
+		for (std::size_t i = 0; i < size; ++i)
+			pixels[i] = static_cast<Nz::UInt8>(distribution(randomEngine));
+
+		return image;
+	}
+
+	template<typename F>
+	double Measure(const Nz::Image& source, unsigned int repeatCount, F&& func)
+	{
+		double best = std::numeric_limits<double>::max();
+		for (unsigned int i = 0; i < repeatCount; ++i)
+		{
+			Nz::Image image(source);
+
+			auto start = std::chrono::steady_clock::now();
+			if (!func(image))
+			{
+				std::cerr << "resampling failed" << std::endl;
+				std::exit(EXIT_FAILURE);
+			}
+			auto end = std::chrono::steady_clock::now();
+
+			best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+		}
+
+		return best;
+	}
+
+	std::string GetFilterName(Nz::ImageFilter filter)
+	{
+		switch (filter)
+		{
+			case Nz::ImageFilter::Box:      return "box";
+			case Nz::ImageFilter::Kaiser:   return "kaiser";
+			case Nz::ImageFilter::Triangle: return "triangle";
+		}
+
+		return "unknown";
+	}
+}
+
+int main()
+{
+	constexpr unsigned int RepeatCount = 5;
+
+	Nz::Modules<Nz::Utility> nazara;
+
+	std::cout << Nz::TaskScheduler::GetWorkerCount() << " workers" << std::endl;
+
+	for (Nz::PixelFormat format : { Nz::PixelFormat::RGBA8, Nz::PixelFormat::RGBA8_SRGB, Nz::PixelFormat::RGBA32F })
+	{
+		Nz::Image texture = CreateRandomImage(Nz::ImageType::E2D, format, 4096, 4096, 1);
+		Nz::Image cubemap = CreateRandomImage(Nz::ImageType::Cubemap, format, 1024, 1024, 1);
+		Nz::Image volume = CreateRandomImage(Nz::ImageType::E3D, format, 128, 128, 128);
+
+		std::cout << Nz::PixelFormatInfo::GetName(format) << ":" << std::endl;
+
+		for (Nz::ImageFilter filter : { Nz::ImageFilter::Box, Nz::ImageFilter::Triangle, Nz::ImageFilter::Kaiser })
+		{
+			auto GenerateMipmaps = [&](Nz::Image& image) { return image.GenerateMipmaps(filter); };
+
+			std::cout << " " << GetFilterName(filter) << " filter:" << std::endl;
+			std::cout << "  4096x4096 texture mipmaps: " << Measure(texture, RepeatCount, GenerateMipmaps) << "ms" << std::endl;
+			std::cout << "  1024x1024 cubemap mipmaps: " << Measure(cubemap, RepeatCount, GenerateMipmaps) << "ms" << std::endl;
+			std::cout << "  128x128x128 texture mipmaps: " << Measure(volume, RepeatCount, GenerateMipmaps) << "ms" << std::endl;
+			std::cout << "  4096x4096 to 1920x1080 resize: " << Measure(texture, RepeatCount, [&](Nz::Image& image) { return image.Resize(Nz::Vector3ui(1920, 1080, 1), filter); }) << "ms" << std::endl;
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
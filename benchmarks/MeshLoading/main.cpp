@@ -0,0 +1,88 @@
+/*
+** MeshLoadingBenchmark - Compares loading times of a large mesh stored as OBJ and as NMF (raw and LZ4 compressed)
+*/
+
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/Modules.hpp>
+#include <Nazara/Core/Primitive.hpp>
+#include <Nazara/Utility/Mesh.hpp>
+#include <Nazara/Utility/Utility.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+
+namespace
+{
+	Nz::ByteArray Save(Nz::Mesh& mesh, const std::string& format, const Nz::MeshParams& params)
+	{
+		Nz::ByteArray data;
+		Nz::MemoryStream stream(&data);
+		if (!mesh.SaveToStream(stream, format, params))
+		{
+			std::cerr << "failed to save mesh as " << format << std::endl;
+			std::exit(EXIT_FAILURE);
+		}
+
+		return data;
+	}
+
+	double Measure(const Nz::ByteArray& data, const Nz::MeshParams& params, unsigned int repeatCount)
+	{
+		double best = std::numeric_limits<double>::max();
+		for (unsigned int i = 0; i < repeatCount; ++i)
+		{
+			auto start = std::chrono::steady_clock::now();
+			std::shared_ptr<Nz::Mesh> mesh = Nz::Mesh::LoadFromMemory(data.GetConstBuffer(), data.GetSize(), params);
+			auto end = std::chrono::steady_clock::now();
+
+			if (!mesh)
+			{
+				std::cerr << "failed to load mesh" << std::endl;
+				std::exit(EXIT_FAILURE);
+			}
+
+			best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+		}
+
+		return best;
+	}
+}
+
+int main()
+{
+	constexpr unsigned int RepeatCount = 5;
+
+	Nz::Modules<Nz::Utility> nazara;
+
+	Nz::MeshParams params;
+	params.optimizeIndexBuffers = false;
+	params.storage = Nz::DataStorage::Software;
+
+	Nz::Mesh mesh;
+	mesh.CreateStatic();
+	mesh.BuildSubMesh(Nz::Primitive::UVSphere(1.f, 512, 512), params);
+	mesh.BuildSubMesh(Nz::Primitive::Box(Nz::Vector3f(1.f), Nz::Vector3ui(256U)), params);
+	mesh.SetMaterialCount(1);
+
+	std::size_t vertexCount = 0;
+	for (std::size_t i = 0; i < mesh.GetSubMeshCount(); ++i)
+		vertexCount += mesh.GetSubMesh(i)->GetVertexCount();
+
+	Nz::MeshParams compressedParams = params;
+	compressedParams.custom.SetParameter("NativeNMFSaver_Compress", true);
+
+	Nz::ByteArray objData = Save(mesh, "obj", params);
+	Nz::ByteArray nmfData = Save(mesh, "nmf", params);
+	Nz::ByteArray compressedNmfData = Save(mesh, "nmf", compressedParams);
+
+	std::cout << vertexCount << " vertices" << std::endl;
+	std::cout << "OBJ (" << objData.GetSize() / 1024 << "KiB): " << Measure(objData, params, RepeatCount) << "ms" << std::endl;
+	std::cout << "NMF (" << nmfData.GetSize() / 1024 << "KiB): " << Measure(nmfData, params, RepeatCount) << "ms" << std::endl;
+	std::cout << "NMF LZ4 (" << compressedNmfData.GetSize() / 1024 << "KiB): " << Measure(compressedNmfData, params, RepeatCount) << "ms" << std::endl;
+
+	return EXIT_SUCCESS;
+}
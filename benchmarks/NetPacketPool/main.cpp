@@ -0,0 +1,217 @@
+/*
+** NetPacketPoolBenchmark - Compares Nz::NetPacket buffer pooling to a single mutex-guarded free list (the previous implementation design)
+*/
+
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <Nazara/Network/NetPacket.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	// One vector, one mutex, shared by every thread
+	class LockedBufferPool
+	{
+		public:
+			std::unique_ptr<Nz::ByteArray> Acquire(std::size_t minCapacity)
+			{
+				std::unique_ptr<Nz::ByteArray> buffer;
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					if (!m_buffers.empty())
+					{
+						buffer = std::move(m_buffers.back());
+						m_buffers.pop_back();
+					}
+				}
+
+				if (!buffer)
+					buffer = std::make_unique<Nz::ByteArray>();
+
+				buffer->Resize(minCapacity);
+				return buffer;
+			}
+
+			void Release(std::unique_ptr<Nz::ByteArray> buffer)
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_buffers.push_back(std::move(buffer));
+			}
+
+		private:
+			std::mutex m_mutex;
+			std::vector<std::unique_ptr<Nz::ByteArray>> m_buffers;
+	};
+
+	std::size_t PacketSize(std::size_t i)
+	{
+		// Mix of small and MTU-sized packets
+		return (i % 4 == 0) ? 1200 : 16 + (i * 37) % 200;
+	}
+
+	template<typename F>
+	double Measure(unsigned int repeatCount, F&& func)
+	{
+		double best = std::numeric_limits<double>::max();
+		for (unsigned int i = 0; i < repeatCount; ++i)
+		{
+			auto start = std::chrono::steady_clock::now();
+			func();
+			auto end = std::chrono::steady_clock::now();
+
+			best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+		}
+
+		return best;
+	}
+
+	template<typename F>
+	void RunOnThreads(unsigned int threadCount, F&& func)
+	{
+		std::vector<std::thread> threads;
+		for (unsigned int i = 0; i < threadCount; ++i)
+			threads.emplace_back([&func, i] { func(i); });
+
+		for (std::thread& thread : threads)
+			thread.join();
+	}
+
+	void Report(const char* name, std::size_t packetCount, double lockedTime, double pooledTime)
+	{
+		std::cout << name << " (" << packetCount << " packets)\n";
+		std::cout << "\tlocked free list: " << lockedTime << "ms (" << lockedTime * 1'000'000.0 / packetCount << "ns/packet)\n";
+		std::cout << "\tNetPacket pool:   " << pooledTime << "ms (" << pooledTime * 1'000'000.0 / packetCount << "ns/packet)\n";
+		std::cout << "\tspeedup:          x" << lockedTime / pooledTime << std::endl;
+	}
+}
+
+int main()
+{
+	constexpr unsigned int RepeatCount = 5;
+	constexpr std::size_t PacketPerThread = 500'000;
+
+	unsigned int maxThreadCount = Nz::HardwareInfo::GetProcessorCount();
+
+	LockedBufferPool lockedPool;
+	Nz::UInt8 payload[1200] = {};
+
+	for (unsigned int threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2)
+	{
+		// Each thread builds and destroys its own packets
+		double lockedTime = Measure(RepeatCount, [&]
+		{
+			RunOnThreads(threadCount, [&](unsigned int)
+			{
+				for (std::size_t i = 0; i < PacketPerThread; ++i)
+				{
+					std::size_t size = PacketSize(i);
+
+					auto buffer = lockedPool.Acquire(Nz::NetPacket::HeaderSize + size);
+					std::memcpy(buffer->GetBuffer() + Nz::NetPacket::HeaderSize, payload, size);
+					lockedPool.Release(std::move(buffer));
+				}
+			});
+		});
+
+		double pooledTime = Measure(RepeatCount, [&]
+		{
+			RunOnThreads(threadCount, [&](unsigned int)
+			{
+				for (std::size_t i = 0; i < PacketPerThread; ++i)
+				{
+					std::size_t size = PacketSize(i);
+
+					Nz::NetPacket packet(1, payload, size);
+				}
+			});
+		});
+
+		std::string name = "Build and destroy, " + std::to_string(threadCount) + " thread(s)";
+		Report(name.c_str(), threadCount * PacketPerThread, lockedTime, pooledTime);
+	}
+
+	// Packets built by half of the threads and released by the other half (like a network thread feeding game threads)
+	if (maxThreadCount >= 2)
+	{
+		constexpr std::size_t BatchCount = 1000;
+		constexpr std::size_t BatchSize = 500;
+
+		unsigned int pairCount = maxThreadCount / 2;
+
+		double lockedTime = Measure(RepeatCount, [&]
+		{
+			std::vector<std::vector<std::unique_ptr<Nz::ByteArray>>> batches(pairCount);
+			std::vector<std::mutex> mutexes(pairCount);
+
+			RunOnThreads(pairCount * 2, [&](unsigned int threadIndex)
+			{
+				unsigned int pairIndex = threadIndex / 2;
+				std::size_t processed = 0;
+				while (processed < BatchCount * BatchSize)
+				{
+					std::lock_guard<std::mutex> lock(mutexes[pairIndex]);
+					auto& batch = batches[pairIndex];
+					if (threadIndex % 2 == 0)
+					{
+						if (batch.size() < BatchSize)
+						{
+							batch.push_back(lockedPool.Acquire(Nz::NetPacket::HeaderSize + PacketSize(processed)));
+							processed++;
+						}
+					}
+					else if (!batch.empty())
+					{
+						lockedPool.Release(std::move(batch.back()));
+						batch.pop_back();
+						processed++;
+					}
+				}
+			});
+		});
+
+		double pooledTime = Measure(RepeatCount, [&]
+		{
+			std::vector<std::vector<Nz::NetPacket>> batches(pairCount);
+			std::vector<std::mutex> mutexes(pairCount);
+
+			RunOnThreads(pairCount * 2, [&](unsigned int threadIndex)
+			{
+				unsigned int pairIndex = threadIndex / 2;
+				std::size_t processed = 0;
+				while (processed < BatchCount * BatchSize)
+				{
+					std::lock_guard<std::mutex> lock(mutexes[pairIndex]);
+					auto& batch = batches[pairIndex];
+					if (threadIndex % 2 == 0)
+					{
+						if (batch.size() < BatchSize)
+						{
+							batch.emplace_back(Nz::UInt16(1), PacketSize(processed));
+							processed++;
+						}
+					}
+					else if (!batch.empty())
+					{
+						batch.pop_back();
+						processed++;
+					}
+				}
+			});
+		});
+
+		Report("Cross-thread release", pairCount * BatchCount * BatchSize, lockedTime, pooledTime);
+	}
+
+	Nz::NetPacket::PoolStats stats = Nz::NetPacket::GetPoolStats();
+	std::cout << "NetPacket pool: " << stats.hitCount << " hits, " << stats.missCount << " misses, " << stats.retainedBufferCount << " buffers (" << stats.retainedBytes << " bytes) retained" << std::endl;
+
+	return EXIT_SUCCESS;
+}
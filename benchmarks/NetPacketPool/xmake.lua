@@ -0,0 +1,5 @@
+target("NetPacketPoolBenchmark")
+	set_group("Benchmarks")
+	set_kind("binary")
+	add_deps("NazaraNetwork")
+	add_files("main.cpp")
@@ -0,0 +1,134 @@
+/*
+** OBJParsingBenchmark - Measures OBJParser throughput on synthetic multi-million faces files, from memory and from a file
+*/
+
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Core/Modules.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Utility/Utility.hpp>
+#include <Nazara/Utility/Formats/OBJParser.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+
+namespace
+{
+	// Generates a grid of vertices with normals and texture coordinates, and its triangles (two per grid cell)
+	Nz::ByteArray GenerateOBJ(unsigned int gridSize)
+	{
+		std::mt19937 randomEngine(42);
+		std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+		Nz::ByteArray content;
+		Nz::MemoryStream stream(&content);
+
+		std::string line;
+		for (unsigned int y = 0; y <= gridSize; ++y)
+		{
+			for (unsigned int x = 0; x <= gridSize; ++x)
+			{
+				line = "v " + std::to_string(float(x) / gridSize) + ' ' + std::to_string(distribution(randomEngine)) + ' ' + std::to_string(float(y) / gridSize) + '\n';
+				line += "vn " + std::to_string(distribution(randomEngine)) + ' ' + std::to_string(distribution(randomEngine)) + ' ' + std::to_string(distribution(randomEngine)) + '\n';
+				line += "vt " + std::to_string(float(x) / gridSize) + ' ' + std::to_string(float(y) / gridSize) + '\n';
+				stream.Write(line);
+			}
+		}
+
+		auto Vertex = [&](unsigned int x, unsigned int y)
+		{
+			std::string index = std::to_string(y * (gridSize + 1) + x + 1);
+			return index + '/' + index + '/' + index;
+		};
+
+		for (unsigned int y = 0; y < gridSize; ++y)
+		{
+			// Split the grid in a few groups/materials
+			if (y % (gridSize / 4) == 0)
+				stream.Write("g part" + std::to_string(y) + "\nusemtl material" + std::to_string(y % 2) + '\n');
+
+			for (unsigned int x = 0; x < gridSize; ++x)
+			{
+				line = "f " + Vertex(x, y) + ' ' + Vertex(x + 1, y) + ' ' + Vertex(x + 1, y + 1) + '\n';
+				line += "f " + Vertex(x, y) + ' ' + Vertex(x + 1, y + 1) + ' ' + Vertex(x, y + 1) + '\n';
+				stream.Write(line);
+			}
+		}
+
+		return content;
+	}
+
+	template<typename F>
+	double Measure(unsigned int repeatCount, F&& func)
+	{
+		double best = std::numeric_limits<double>::max();
+		for (unsigned int i = 0; i < repeatCount; ++i)
+		{
+			auto start = std::chrono::steady_clock::now();
+			if (!func())
+			{
+				std::cerr << "parsing failed" << std::endl;
+				std::exit(EXIT_FAILURE);
+			}
+			auto end = std::chrono::steady_clock::now();
+
+			best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+		}
+
+		return best;
+	}
+
+	void Report(const std::string& name, std::size_t size, double duration)
+	{
+		std::cout << "  " << name << ": " << duration << "ms (" << (size / (1024.0 * 1024.0)) / (duration / 1000.0) << "MiB/s)" << std::endl;
+	}
+}
+
+int main()
+{
+	constexpr unsigned int RepeatCount = 3;
+
+	Nz::Modules<Nz::Utility> nazara;
+
+	std::cout << Nz::TaskScheduler::GetWorkerCount() << " workers" << std::endl;
+
+	for (unsigned int gridSize : { 256, 1024, 2048 })
+	{
+		Nz::ByteArray content = GenerateOBJ(gridSize);
+
+		std::cout << 2 * gridSize * gridSize << " faces (" << content.GetSize() / (1024 * 1024) << "MiB):" << std::endl;
+
+		Report("memory", content.GetSize(), Measure(RepeatCount, [&]
+		{
+			Nz::MemoryView stream(content.GetConstBuffer(), content.GetSize());
+
+			Nz::OBJParser parser;
+			return parser.Parse(stream);
+		}));
+
+		std::filesystem::path filePath = std::filesystem::temp_directory_path() / "OBJParsingBenchmark.obj";
+		{
+			Nz::File file(filePath, Nz::OpenMode::WriteOnly | Nz::OpenMode::Truncate);
+			file.Write(content);
+		}
+
+		Report("file", content.GetSize(), Measure(RepeatCount, [&]
+		{
+			Nz::File file(filePath, Nz::OpenMode::ReadOnly);
+
+			Nz::OBJParser parser;
+			return parser.Parse(file);
+		}));
+
+		std::filesystem::remove(filePath);
+	}
+
+	return EXIT_SUCCESS;
+}
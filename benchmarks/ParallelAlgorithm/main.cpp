@@ -0,0 +1,105 @@
+/*
+** ParallelAlgorithmBenchmark - Measures how Nz::ParallelFor, Nz::ParallelReduce and Nz::ParallelSort scale with the worker count
+*/
+
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	template<typename F>
+	double Measure(unsigned int repeatCount, F&& func)
+	{
+		double best = std::numeric_limits<double>::max();
+		for (unsigned int i = 0; i < repeatCount; ++i)
+		{
+			auto start = std::chrono::steady_clock::now();
+			func();
+			auto end = std::chrono::steady_clock::now();
+
+			best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+		}
+
+		return best;
+	}
+}
+
+int main()
+{
+	constexpr unsigned int RepeatCount = 5;
+	constexpr std::size_t ElementCount = 8'000'000;
+
+	std::mt19937 randomGenerator(42);
+	std::uniform_real_distribution<float> distribution(0.f, 100.f);
+
+	std::vector<float> source(ElementCount);
+	for (float& value : source)
+		value = distribution(randomGenerator);
+
+	std::vector<float> destination(ElementCount);
+	std::vector<float> sortBuffer(ElementCount);
+
+	double forBaseline = 0.0;
+	double reduceBaseline = 0.0;
+	double sortBaseline = 0.0;
+
+	unsigned int processorCount = Nz::HardwareInfo::GetProcessorCount();
+	for (unsigned int workerCount = 1; ; workerCount = std::min(workerCount * 2, processorCount))
+	{
+		Nz::TaskScheduler::Uninitialize();
+		Nz::TaskScheduler::SetWorkerCount(workerCount);
+		Nz::TaskScheduler::Initialize();
+
+		double forTime = Measure(RepeatCount, [&]
+		{
+			Nz::ParallelFor(0, ElementCount, [&](std::size_t i)
+			{
+				destination[i] = std::sqrt(source[i]) * std::sin(source[i]);
+			});
+		});
+
+		float sum = 0.f;
+		double reduceTime = Measure(RepeatCount, [&]
+		{
+			sum = Nz::ParallelReduce(0, ElementCount, 0.f, [&](std::size_t begin, std::size_t end, float init)
+			{
+				for (std::size_t i = begin; i < end; ++i)
+					init += source[i];
+
+				return init;
+			}, [](float lhs, float rhs) { return lhs + rhs; });
+		});
+
+		double sortTime = Measure(RepeatCount, [&]
+		{
+			std::copy(source.begin(), source.end(), sortBuffer.begin());
+			Nz::ParallelSort(sortBuffer.begin(), sortBuffer.end());
+		});
+
+		if (workerCount == 1)
+		{
+			forBaseline = forTime;
+			reduceBaseline = reduceTime;
+			sortBaseline = sortTime;
+		}
+
+		std::cout << workerCount << " worker(s) (sum: " << sum << ")\n";
+		std::cout << "\tParallelFor:    " << forTime << "ms (x" << forBaseline / forTime << ")\n";
+		std::cout << "\tParallelReduce: " << reduceTime << "ms (x" << reduceBaseline / reduceTime << ")\n";
+		std::cout << "\tParallelSort:   " << sortTime << "ms (x" << sortBaseline / sortTime << ")" << std::endl;
+
+		if (workerCount >= processorCount)
+			break;
+	}
+
+	Nz::TaskScheduler::Uninitialize();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,195 @@
+/*
+** SkinningBenchmark - Compares the skinning kernels against the reference (per-weight Matrix4f) implementation and checks their results
+*/
+
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Math/EulerAngles.hpp>
+#include <Nazara/Utility/Algorithm.hpp>
+#include <Nazara/Utility/VertexStruct.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Former implementation, transforming each vertex by every weighted joint matrix
+	void ReferenceSkinPositionNormalTangent(const Nz::Matrix4f* matrices, const Nz::SkeletalMeshVertex* inputVertex, Nz::MeshVertex* outputVertex, unsigned int vertexCount)
+	{
+		for (unsigned int i = 0; i < vertexCount; ++i)
+		{
+			Nz::Vector3f finalPosition(Nz::Vector3f::Zero());
+			Nz::Vector3f finalNormal(Nz::Vector3f::Zero());
+			Nz::Vector3f finalTangent(Nz::Vector3f::Zero());
+
+			for (int j = 0; j < inputVertex->weightCount; ++j)
+			{
+				Nz::Matrix4f mat(matrices[inputVertex->jointIndexes[j]]);
+				mat *= inputVertex->weights[j];
+
+				finalPosition += mat.Transform(inputVertex->position);
+				finalNormal += mat.Transform(inputVertex->normal, 0.f);
+				finalTangent += mat.Transform(inputVertex->tangent, 0.f);
+			}
+
+			finalNormal.Normalize();
+			finalTangent.Normalize();
+
+			outputVertex->normal = finalNormal;
+			outputVertex->position = finalPosition;
+			outputVertex->tangent = finalTangent;
+			outputVertex->uv = inputVertex->uv;
+
+			inputVertex++;
+			outputVertex++;
+		}
+	}
+
+	float ComputeMaxError(const std::vector<Nz::MeshVertex>& reference, const std::vector<Nz::MeshVertex>& result)
+	{
+		float maxError = 0.f;
+		for (std::size_t i = 0; i < reference.size(); ++i)
+		{
+			// Relative to the position magnitude as the reference accumulates more rounding errors
+			float positionScale = std::max(reference[i].position.GetLength(), 1.f);
+
+			maxError = std::max(maxError, reference[i].position.Distance(result[i].position) / positionScale);
+			maxError = std::max(maxError, reference[i].normal.Distance(result[i].normal));
+			maxError = std::max(maxError, reference[i].tangent.Distance(result[i].tangent));
+			maxError = std::max(maxError, reference[i].uv.Distance(result[i].uv));
+		}
+
+		return maxError;
+	}
+
+	template<typename F>
+	double Measure(unsigned int repeatCount, F&& func)
+	{
+		double best = std::numeric_limits<double>::max();
+		for (unsigned int i = 0; i < repeatCount; ++i)
+		{
+			auto start = std::chrono::steady_clock::now();
+			func();
+			auto end = std::chrono::steady_clock::now();
+
+			best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+		}
+
+		return best;
+	}
+}
+
+int main()
+{
+	constexpr unsigned int RepeatCount = 10;
+	constexpr unsigned int CharacterCount = 200;
+	constexpr unsigned int JointCount = 64;
+	constexpr unsigned int VertexPerCharacter = 5'000;
+	constexpr unsigned int VertexCount = CharacterCount * VertexPerCharacter;
+	constexpr unsigned int WeightCountGroupSize = 32;
+	constexpr float MaxAllowedError = 1e-4f;
+
+	std::mt19937 randomGenerator(42);
+	std::uniform_real_distribution<float> angleDistribution(-180.f, 180.f);
+	std::uniform_real_distribution<float> coordDistribution(-50.f, 50.f);
+	std::uniform_real_distribution<float> weightDistribution(0.1f, 1.f);
+	std::uniform_int_distribution<int> jointDistribution(0, JointCount - 1);
+	std::uniform_int_distribution<int> weightCountDistribution(1, 4);
+	int weightCount = 0;
+
+	std::vector<Nz::Matrix4f> skinningMatrices(JointCount);
+	for (Nz::Matrix4f& matrix : skinningMatrices)
+	{
+		Nz::EulerAnglesf angles(angleDistribution(randomGenerator), angleDistribution(randomGenerator), angleDistribution(randomGenerator));
+		Nz::Vector3f translation(coordDistribution(randomGenerator), coordDistribution(randomGenerator), coordDistribution(randomGenerator));
+		matrix = Nz::Matrix4f::Transform(translation, angles.ToQuaternion());
+	}
+
+	std::vector<Nz::SkeletalMeshVertex> inputVertices(VertexCount);
+	for (std::size_t vertexIndex = 0; vertexIndex < VertexCount; ++vertexIndex)
+	{
+		Nz::SkeletalMeshVertex& vertex = inputVertices[vertexIndex];
+
+		// Neighbouring vertices usually are influenced by the same number of joints
+		if (vertexIndex % WeightCountGroupSize == 0)
+			weightCount = weightCountDistribution(randomGenerator);
+
+		vertex.position.Set(coordDistribution(randomGenerator), coordDistribution(randomGenerator), coordDistribution(randomGenerator));
+		vertex.normal = Nz::Vector3f::Normalize(Nz::Vector3f(coordDistribution(randomGenerator), coordDistribution(randomGenerator), coordDistribution(randomGenerator)));
+		vertex.tangent = Nz::Vector3f::Normalize(Nz::Vector3f(coordDistribution(randomGenerator), coordDistribution(randomGenerator), coordDistribution(randomGenerator)));
+		vertex.uv.Set(weightDistribution(randomGenerator), weightDistribution(randomGenerator));
+
+		vertex.weightCount = weightCount;
+		vertex.weights = Nz::Vector4f::Zero();
+		vertex.jointIndexes = Nz::Vector4i32::Zero();
+
+		float weightSum = 0.f;
+		for (int i = 0; i < vertex.weightCount; ++i)
+		{
+			vertex.weights[i] = weightDistribution(randomGenerator);
+			vertex.jointIndexes[i] = jointDistribution(randomGenerator);
+			weightSum += vertex.weights[i];
+		}
+
+		vertex.weights /= weightSum;
+	}
+
+	std::vector<Nz::MeshVertex> referenceVertices(VertexCount);
+	std::vector<Nz::MeshVertex> outputVertices(VertexCount);
+
+	Nz::SkinningData skinningData;
+	skinningData.joints = nullptr;
+	skinningData.inputVertex = inputVertices.data();
+	skinningData.outputVertex = outputVertices.data();
+	skinningData.skinningMatrices = skinningMatrices.data();
+
+	std::cout << CharacterCount << " characters of " << VertexPerCharacter << " vertices, " << JointCount << " joints" << std::endl;
+
+	double referenceTime = Measure(RepeatCount, [&]
+	{
+		ReferenceSkinPositionNormalTangent(skinningMatrices.data(), inputVertices.data(), referenceVertices.data(), VertexCount);
+	});
+	std::cout << "Reference:       " << referenceTime << "ms" << std::endl;
+
+	bool success = true;
+	auto Check = [&](const char* name, double time)
+	{
+		float error = ComputeMaxError(referenceVertices, outputVertices);
+		std::cout << name << time << "ms (x" << referenceTime / time << ", max error: " << error << ")" << std::endl;
+
+		if (error > MaxAllowedError)
+		{
+			std::cerr << "Results differ from the reference implementation" << std::endl;
+			success = false;
+		}
+
+		std::fill(outputVertices.begin(), outputVertices.end(), Nz::MeshVertex{});
+	};
+
+	Check("Single-threaded: ", Measure(RepeatCount, [&]
+	{
+		Nz::SkinPositionNormalTangent(skinningData, 0, VertexCount);
+	}));
+
+	Check("Per character:   ", Measure(RepeatCount, [&]
+	{
+		for (unsigned int i = 0; i < CharacterCount; ++i)
+			Nz::SkinPositionNormalTangent(skinningData, i * VertexPerCharacter, VertexPerCharacter);
+	}));
+
+	Nz::TaskScheduler::Initialize();
+
+	Check("Parallel:        ", Measure(RepeatCount, [&]
+	{
+		Nz::ParallelSkin(Nz::SkinPositionNormalTangent, skinningData, 0, VertexCount);
+	}));
+
+	std::cout << "(using " << Nz::TaskScheduler::GetWorkerCount() << " workers)" << std::endl;
+
+	Nz::TaskScheduler::Uninitialize();
+
+	return (success) ? 0 : 1;
+}
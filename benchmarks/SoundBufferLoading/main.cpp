@@ -0,0 +1,176 @@
+/*
+** SoundBufferLoadingBenchmark - Measures sound buffer load times per codec: plain decoding, decoded samples cache and asynchronous loading
+**
+** Usage: SoundBufferLoadingBenchmark [audio files...]
+** A generated WAV file and the FLAC/Vorbis/MP3 files from the resources directory are always measured, additional files can be passed
+*/
+
+#include <Nazara/Audio/Audio.hpp>
+#include <Nazara/Audio/SoundBuffer.hpp>
+#include <Nazara/Audio/SoundBufferCache.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/Modules.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+namespace
+{
+	template<typename F>
+	double Measure(unsigned int repeatCount, F&& func)
+	{
+		double best = std::numeric_limits<double>::max();
+		for (unsigned int i = 0; i < repeatCount; ++i)
+		{
+			auto start = std::chrono::steady_clock::now();
+			func();
+			auto end = std::chrono::steady_clock::now();
+
+			best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+		}
+
+		return best;
+	}
+
+	bool GenerateWav(const std::filesystem::path& filePath, Nz::UInt32 sampleRate, Nz::UInt16 channelCount, Nz::UInt32 frameCount)
+	{
+		Nz::File file(filePath, Nz::OpenMode::WriteOnly | Nz::OpenMode::Truncate);
+		if (!file.IsOpen())
+			return false;
+
+		Nz::UInt32 dataSize = frameCount * channelCount * sizeof(Nz::Int16);
+
+		auto WriteValue = [&](auto value)
+		{
+			file.Write(&value, sizeof(value));
+		};
+
+		file.Write("RIFF", 4);
+		WriteValue(Nz::UInt32(36 + dataSize));
+		file.Write("WAVEfmt ", 8);
+		WriteValue(Nz::UInt32(16));
+		WriteValue(Nz::UInt16(1)); //< PCM
+		WriteValue(channelCount);
+		WriteValue(sampleRate);
+		WriteValue(Nz::UInt32(sampleRate * channelCount * sizeof(Nz::Int16)));
+		WriteValue(Nz::UInt16(channelCount * sizeof(Nz::Int16)));
+		WriteValue(Nz::UInt16(16));
+		file.Write("data", 4);
+		WriteValue(dataSize);
+
+		std::vector<Nz::Int16> samples(std::size_t(frameCount) * channelCount);
+		for (Nz::UInt32 i = 0; i < frameCount; ++i)
+		{
+			for (Nz::UInt16 j = 0; j < channelCount; ++j)
+				samples[std::size_t(i) * channelCount + j] = static_cast<Nz::Int16>(16000.0 * std::sin(i * (440.0 + j * 110.0) * 6.283185307 / sampleRate));
+		}
+
+		return file.Write(samples.data(), dataSize) == dataSize;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	constexpr unsigned int RepeatCount = 5;
+	constexpr std::size_t AsyncLoadCount = 16;
+
+	Nz::Modules<Nz::Audio> nazara;
+
+	std::filesystem::path tempDirectory = std::filesystem::temp_directory_path() / "NazaraSoundBufferLoadingBenchmark";
+	std::filesystem::remove_all(tempDirectory);
+	std::filesystem::create_directories(tempDirectory);
+
+	std::vector<std::filesystem::path> filePaths;
+	filePaths.push_back(tempDirectory / "generated.wav");
+	if (!GenerateWav(filePaths.back(), 44100, 2, 44100 * 60))
+	{
+		std::cerr << "failed to generate " << filePaths.back() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::filesystem::path resourceDir = "resources";
+	if (!std::filesystem::is_directory(resourceDir) && std::filesystem::is_directory(".." / resourceDir))
+		resourceDir = ".." / resourceDir;
+
+	for (std::filesystem::path resourcePath : { resourceDir / "Engine/Audio/Cat.flac", resourceDir / "Engine/Audio/The_Brabanconne.ogg", resourceDir / "file_example_MP3_700KB.mp3" })
+	{
+		if (std::filesystem::is_regular_file(resourcePath))
+			filePaths.push_back(std::move(resourcePath));
+		else
+			std::cerr << resourcePath << " not found, skipping" << std::endl;
+	}
+
+	for (int i = 1; i < argc; ++i)
+		filePaths.emplace_back(argv[i]);
+
+	Nz::Audio* audio = Nz::Audio::Instance();
+	Nz::SoundBufferCache cache(tempDirectory / "cache");
+
+	std::cout << Nz::TaskScheduler::GetWorkerCount() << " workers" << std::endl;
+
+	for (const std::filesystem::path& filePath : filePaths)
+	{
+		std::shared_ptr<Nz::SoundBuffer> soundBuffer = audio->GetSoundBufferLoader().LoadFromFile(filePath, Nz::SoundBufferParams());
+		if (!soundBuffer)
+		{
+			std::cerr << "failed to load " << filePath << std::endl;
+			continue;
+		}
+
+		std::cout << filePath.filename() << ": " << soundBuffer->GetDuration() << "ms of audio, " << soundBuffer->GetSampleCount() << " samples" << std::endl;
+
+		double decodeTime = Measure(RepeatCount, [&]
+		{
+			audio->GetSoundBufferLoader().LoadFromFile(filePath, Nz::SoundBufferParams());
+		});
+
+		cache.LoadFromFile(filePath, Nz::SoundBufferParams()); //< fills the cache
+
+		double cacheTime = Measure(RepeatCount, [&]
+		{
+			cache.LoadFromFile(filePath, Nz::SoundBufferParams());
+		});
+
+		double sequentialTime = Measure(RepeatCount, [&]
+		{
+			for (std::size_t i = 0; i < AsyncLoadCount; ++i)
+				audio->GetSoundBufferLoader().LoadFromFile(filePath, Nz::SoundBufferParams());
+		});
+
+		double asyncTime = Measure(RepeatCount, [&]
+		{
+			std::atomic<std::size_t> loadedCount = 0;
+
+			Nz::TaskScheduler::Counter counter;
+			for (std::size_t i = 0; i < AsyncLoadCount; ++i)
+			{
+				Nz::SoundBuffer::LoadFromFileAsync(filePath, [&](std::shared_ptr<Nz::SoundBuffer> loadedBuffer)
+				{
+					if (loadedBuffer)
+						loadedCount++;
+				}, &counter);
+			}
+
+			Nz::TaskScheduler::WaitFor(counter);
+
+			if (loadedCount != AsyncLoadCount)
+				std::cerr << "async load failed" << std::endl;
+		});
+
+		std::cout << " decoding: " << decodeTime << "ms" << std::endl;
+		std::cout << " decoded samples cache: " << cacheTime << "ms (x" << decodeTime / cacheTime << ")" << std::endl;
+		std::cout << " " << AsyncLoadCount << " sequential loads: " << sequentialTime << "ms" << std::endl;
+		std::cout << " " << AsyncLoadCount << " asynchronous loads: " << asyncTime << "ms (x" << sequentialTime / asyncTime << ")" << std::endl;
+	}
+
+	std::filesystem::remove_all(tempDirectory);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,5 @@
+target("SoundBufferLoadingBenchmark")
+	set_group("Benchmarks")
+	set_kind("binary")
+	add_deps("NazaraAudio")
+	add_files("main.cpp")
@@ -0,0 +1,97 @@
+/*
+** StreamReadLineBenchmark - Compares line reading throughput of Nz::File with and without buffering
+*/
+
+#include <Nazara/Core/File.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <string>
+
+namespace
+{
+	template<typename F>
+	double Measure(unsigned int repeatCount, F&& func)
+	{
+		double best = std::numeric_limits<double>::max();
+		for (unsigned int i = 0; i < repeatCount; ++i)
+		{
+			auto start = std::chrono::steady_clock::now();
+			func();
+			auto end = std::chrono::steady_clock::now();
+
+			best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+		}
+
+		return best;
+	}
+
+	void Report(const char* name, Nz::UInt64 fileSize, std::size_t lineCount, double time)
+	{
+		std::cout << name << ": " << time << "ms (" << (fileSize / (1024.0 * 1024.0)) / (time / 1000.0) << "MiB/s, " << time * 1'000'000.0 / lineCount << "ns/line)" << std::endl;
+	}
+}
+
+int main()
+{
+	constexpr unsigned int RepeatCount = 3;
+	constexpr std::size_t LineCount = 1'000'000;
+
+	std::filesystem::path filePath = std::filesystem::temp_directory_path() / "NazaraStreamReadLineBenchmark.obj";
+
+	// OBJ-like content
+	{
+		Nz::File file(filePath, Nz::OpenMode::WriteOnly | Nz::OpenMode::Truncate);
+		if (!file.IsOpen())
+		{
+			std::cerr << "failed to create " << filePath << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		file.EnableBuffering(true);
+		for (std::size_t i = 0; i < LineCount; ++i)
+		{
+			switch (i % 3)
+			{
+				case 0: file.Write("v " + std::to_string(i * 0.25f) + " " + std::to_string(i * 0.5f) + " " + std::to_string(i * 0.75f) + "\n"); break;
+				case 1: file.Write("vt " + std::to_string(i * 0.01f) + " " + std::to_string(i * 0.02f) + "\n"); break;
+				case 2: file.Write("f " + std::to_string(i - 2) + "/" + std::to_string(i - 1) + " " + std::to_string(i - 1) + "/" + std::to_string(i) + " " + std::to_string(i) + "/" + std::to_string(i) + "\n"); break;
+			}
+		}
+	}
+
+	Nz::UInt64 fileSize = std::filesystem::file_size(filePath);
+	std::cout << LineCount << " lines, " << fileSize / (1024.0 * 1024.0) << "MiB" << std::endl;
+
+	auto ReadLines = [&](bool buffering, bool useView)
+	{
+		Nz::File file(filePath, Nz::OpenMode::ReadOnly | Nz::OpenMode::Text);
+		file.EnableBuffering(buffering);
+
+		std::size_t lineCount = 0;
+		std::size_t characterCount = 0;
+		while (!file.EndOfStream())
+		{
+			if (useView)
+				characterCount += file.ReadLineView().size();
+			else
+				characterCount += file.ReadLine().size();
+
+			lineCount++;
+		}
+
+		if (lineCount != LineCount || characterCount + lineCount != fileSize)
+			std::cerr << "unexpected content (" << lineCount << " lines, " << characterCount << " characters)" << std::endl;
+	};
+
+	Report("Unbuffered ReadLine", fileSize, LineCount, Measure(RepeatCount, [&] { ReadLines(false, false); }));
+	Report("Buffered ReadLine", fileSize, LineCount, Measure(RepeatCount, [&] { ReadLines(true, false); }));
+	Report("Buffered ReadLineView", fileSize, LineCount, Measure(RepeatCount, [&] { ReadLines(true, true); }));
+
+	std::filesystem::remove(filePath);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,215 @@
+/*
+** TaskSchedulerBenchmark - Compares the work-stealing Nz::TaskScheduler to a single locked queue thread pool (the previous implementation design)
+*/
+
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	// One queue, one mutex, one heap-allocated functor per task
+	class LockedQueuePool
+	{
+		public:
+			LockedQueuePool(unsigned int workerCount) :
+			m_pendingCount(0),
+			m_shouldFinish(false)
+			{
+				for (unsigned int i = 0; i < workerCount; ++i)
+					m_workers.emplace_back([this] { WorkerProc(); });
+			}
+
+			~LockedQueuePool()
+			{
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					m_shouldFinish = true;
+				}
+				m_notEmpty.notify_all();
+
+				for (std::thread& worker : m_workers)
+					worker.join();
+			}
+
+			void AddTask(std::function<void()> task)
+			{
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					m_tasks.push(new std::function<void()>(std::move(task)));
+					m_pendingCount++;
+				}
+				m_notEmpty.notify_one();
+			}
+
+			void WaitForTasks()
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_empty.wait(lock, [this] { return m_pendingCount == 0; });
+			}
+
+		private:
+			void WorkerProc()
+			{
+				for (;;)
+				{
+					std::function<void()>* task;
+					{
+						std::unique_lock<std::mutex> lock(m_mutex);
+						m_notEmpty.wait(lock, [this] { return !m_tasks.empty() || m_shouldFinish; });
+						if (m_shouldFinish)
+							return;
+
+						task = m_tasks.front();
+						m_tasks.pop();
+					}
+
+					(*task)();
+					delete task;
+
+					std::lock_guard<std::mutex> lock(m_mutex);
+					if (--m_pendingCount == 0)
+						m_empty.notify_all();
+				}
+			}
+
+			std::condition_variable m_empty;
+			std::condition_variable m_notEmpty;
+			std::mutex m_mutex;
+			std::queue<std::function<void()>*> m_tasks;
+			std::vector<std::thread> m_workers;
+			std::size_t m_pendingCount;
+			bool m_shouldFinish;
+	};
+
+	volatile unsigned int s_sink;
+
+	void Work(unsigned int iterations)
+	{
+		unsigned int value = iterations;
+		for (unsigned int i = 0; i < iterations; ++i)
+			value = value * 1664525u + 1013904223u;
+
+		s_sink = value;
+	}
+
+	template<typename F>
+	double Measure(unsigned int repeatCount, F&& func)
+	{
+		double best = std::numeric_limits<double>::max();
+		for (unsigned int i = 0; i < repeatCount; ++i)
+		{
+			auto start = std::chrono::steady_clock::now();
+			func();
+			auto end = std::chrono::steady_clock::now();
+
+			best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+		}
+
+		return best;
+	}
+
+	void Report(const char* name, std::size_t taskCount, double lockedTime, double stealingTime)
+	{
+		std::cout << name << " (" << taskCount << " tasks)\n";
+		std::cout << "\tlocked queue:   " << lockedTime << "ms (" << lockedTime * 1'000'000.0 / taskCount << "ns/task)\n";
+		std::cout << "\twork stealing:  " << stealingTime << "ms (" << stealingTime * 1'000'000.0 / taskCount << "ns/task)\n";
+		std::cout << "\tspeedup:        x" << lockedTime / stealingTime << std::endl;
+	}
+}
+
+int main()
+{
+	constexpr unsigned int RepeatCount = 5;
+
+	unsigned int workerCount = Nz::HardwareInfo::GetProcessorCount();
+	std::cout << "Worker count: " << workerCount << std::endl;
+
+	Nz::TaskScheduler::SetWorkerCount(workerCount);
+	Nz::TaskScheduler::Initialize();
+
+	LockedQueuePool lockedPool(workerCount);
+
+	for (unsigned int workSize : { 0u, 100u, 1000u })
+	{
+		constexpr std::size_t TaskCount = 200'000;
+
+		double lockedTime = Measure(RepeatCount, [&]
+		{
+			for (std::size_t i = 0; i < TaskCount; ++i)
+				lockedPool.AddTask([workSize] { Work(workSize); });
+
+			lockedPool.WaitForTasks();
+		});
+
+		double stealingTime = Measure(RepeatCount, [&]
+		{
+			Nz::TaskScheduler::Counter counter;
+			for (std::size_t i = 0; i < TaskCount; ++i)
+				Nz::TaskScheduler::Submit([workSize] { Work(workSize); }, &counter);
+
+			Nz::TaskScheduler::WaitFor(counter);
+		});
+
+		std::string name = "Flat submission, work size " + std::to_string(workSize);
+		Report(name.c_str(), TaskCount, lockedTime, stealingTime);
+	}
+
+	// Tasks spawning tasks: the locked pool can only receive them through its single queue, the work-stealing scheduler pushes them on the local deque
+	{
+		constexpr std::size_t ParentCount = 1'000;
+		constexpr std::size_t ChildCount = 200;
+
+		double lockedTime = Measure(RepeatCount, [&]
+		{
+			std::atomic<std::size_t> remaining(ParentCount);
+			for (std::size_t i = 0; i < ParentCount; ++i)
+			{
+				lockedPool.AddTask([&]
+				{
+					for (std::size_t j = 0; j < ChildCount; ++j)
+						lockedPool.AddTask([] { Work(100); });
+
+					remaining--;
+				});
+			}
+
+			while (remaining > 0)
+				std::this_thread::yield();
+
+			lockedPool.WaitForTasks();
+		});
+
+		double stealingTime = Measure(RepeatCount, [&]
+		{
+			Nz::TaskScheduler::Counter counter;
+			for (std::size_t i = 0; i < ParentCount; ++i)
+			{
+				Nz::TaskScheduler::Submit([&]
+				{
+					for (std::size_t j = 0; j < ChildCount; ++j)
+						Nz::TaskScheduler::Submit([] { Work(100); }, &counter);
+				}, &counter);
+			}
+
+			Nz::TaskScheduler::WaitFor(counter);
+		});
+
+		Report("Nested submission, work size 100", ParentCount * (ChildCount + 1), lockedTime, stealingTime);
+	}
+
+	Nz::TaskScheduler::Uninitialize();
+
+	return EXIT_SUCCESS;
+}
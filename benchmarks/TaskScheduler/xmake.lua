@@ -0,0 +1,5 @@
+target("TaskSchedulerBenchmark")
+	set_group("Benchmarks")
+	set_kind("binary")
+	add_deps("NazaraCore")
+	add_files("main.cpp")
@@ -0,0 +1,163 @@
+/*
+** TransformHierarchyBenchmark - Compares world matrix updates of a Node graph and of a TransformHierarchy and checks their results
+*/
+
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Math/EulerAngles.hpp>
+#include <Nazara/Utility/Node.hpp>
+#include <Nazara/Utility/TransformHierarchy.hpp>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+	float ComputeMaxError(const std::vector<std::unique_ptr<Nz::Node>>& nodes, const Nz::TransformHierarchy& hierarchy, const std::vector<std::size_t>& hierarchyNodes)
+	{
+		float maxError = 0.f;
+		for (std::size_t i = 0; i < nodes.size(); ++i)
+		{
+			const Nz::Matrix4f& reference = nodes[i]->GetTransformMatrix();
+			const Nz::Matrix4f& result = hierarchy.GetTransformMatrix(hierarchyNodes[i]);
+
+			for (unsigned int j = 0; j < 16; ++j)
+				maxError = std::max(maxError, std::abs(reference[j] - result[j]) / std::max(std::abs(reference[j]), 1.f));
+		}
+
+		return maxError;
+	}
+
+	template<typename F>
+	double Measure(unsigned int repeatCount, F&& func)
+	{
+		double best = std::numeric_limits<double>::max();
+		for (unsigned int i = 0; i < repeatCount; ++i)
+		{
+			auto start = std::chrono::steady_clock::now();
+			func();
+			auto end = std::chrono::steady_clock::now();
+
+			best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+		}
+
+		return best;
+	}
+}
+
+int main()
+{
+	constexpr unsigned int RepeatCount = 10;
+	constexpr unsigned int RootCount = 1'000;
+	constexpr unsigned int NodePerRoot = 100;
+	constexpr unsigned int NodeCount = RootCount * NodePerRoot;
+	constexpr float MaxAllowedError = 1e-4f;
+
+	std::mt19937 randomGenerator(42);
+	std::uniform_real_distribution<float> angleDistribution(-180.f, 180.f);
+	std::uniform_real_distribution<float> coordDistribution(-10.f, 10.f);
+	std::uniform_real_distribution<float> scaleDistribution(0.5f, 2.f);
+
+	// Every root has a few levels of children, as a character skeleton or a scene object would
+	std::vector<std::unique_ptr<Nz::Node>> nodes(NodeCount);
+	std::vector<std::size_t> hierarchyNodes(NodeCount);
+	std::vector<std::size_t> roots;
+
+	Nz::TransformHierarchy hierarchy;
+	for (std::size_t i = 0; i < NodeCount; ++i)
+	{
+		std::size_t parent = Nz::TransformHierarchy::InvalidNode;
+
+		nodes[i] = std::make_unique<Nz::Node>();
+		if (i % NodePerRoot == 0)
+			roots.push_back(i);
+		else
+		{
+			std::size_t rootIndex = i - i % NodePerRoot;
+			std::size_t parentIndex = rootIndex + (i % NodePerRoot - 1) / 3; //< Nodes have up to three children
+			nodes[i]->SetParent(*nodes[parentIndex]);
+
+			parent = hierarchyNodes[parentIndex];
+		}
+
+		hierarchyNodes[i] = hierarchy.CreateNode(parent);
+
+		Nz::Vector3f position(coordDistribution(randomGenerator), coordDistribution(randomGenerator), coordDistribution(randomGenerator));
+		Nz::Quaternionf rotation = Nz::EulerAnglesf(angleDistribution(randomGenerator), angleDistribution(randomGenerator), angleDistribution(randomGenerator)).ToQuaternion();
+		Nz::Vector3f scale(scaleDistribution(randomGenerator));
+
+		nodes[i]->SetPosition(position);
+		nodes[i]->SetRotation(rotation);
+		nodes[i]->SetScale(scale);
+
+		hierarchy.SetPosition(hierarchyNodes[i], position);
+		hierarchy.SetRotation(hierarchyNodes[i], rotation);
+		hierarchy.SetScale(hierarchyNodes[i], scale);
+	}
+
+	std::cout << NodeCount << " nodes (" << RootCount << " roots)" << std::endl;
+
+	// Each frame moves every root and reads back every world matrix
+	float offset = 0.f;
+	auto MoveNodeRoots = [&]
+	{
+		for (std::size_t rootIndex : roots)
+			nodes[rootIndex]->SetPosition(Nz::Vector3f(offset, 0.f, 0.f));
+	};
+
+	auto MoveHierarchyRoots = [&]
+	{
+		for (std::size_t rootIndex : roots)
+			hierarchy.SetPosition(hierarchyNodes[rootIndex], Nz::Vector3f(offset, 0.f, 0.f));
+	};
+
+	float checksum = 0.f;
+	double nodeTime = Measure(RepeatCount, [&]
+	{
+		offset += 1.f;
+		MoveNodeRoots();
+		for (const auto& node : nodes)
+			checksum += node->GetTransformMatrix()[12];
+	});
+	std::cout << "Node:                        " << nodeTime << "ms" << std::endl;
+
+	bool success = true;
+	auto Check = [&](const char* name, double time)
+	{
+		// Only the hierarchy roots were moved
+		MoveNodeRoots();
+
+		float error = ComputeMaxError(nodes, hierarchy, hierarchyNodes);
+		std::cout << name << time << "ms (x" << nodeTime / time << ", max error: " << error << ")" << std::endl;
+
+		if (error > MaxAllowedError)
+		{
+			std::cerr << "Results differ from the Node implementation" << std::endl;
+			success = false;
+		}
+	};
+
+	auto UpdateHierarchy = [&](bool useParallelism)
+	{
+		offset += 1.f;
+		MoveHierarchyRoots();
+		hierarchy.Update(useParallelism);
+		for (std::size_t node : hierarchyNodes)
+			checksum += hierarchy.GetTransformMatrix(node)[12];
+	};
+
+	Check("TransformHierarchy:          ", Measure(RepeatCount, [&] { UpdateHierarchy(false); }));
+
+	Nz::TaskScheduler::Initialize();
+
+	Check("TransformHierarchy parallel: ", Measure(RepeatCount, [&] { UpdateHierarchy(true); }));
+
+	std::cout << "(using " << Nz::TaskScheduler::GetWorkerCount() << " workers, checksum: " << checksum << ")" << std::endl;
+
+	Nz::TaskScheduler::Uninitialize();
+
+	return (success) ? 0 : 1;
+}
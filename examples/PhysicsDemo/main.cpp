@@ -102,6 +102,8 @@ int main()
 	entt::registry registry;
 
 	Nz::Physics3DSystem physSytem(registry);
+	physSytem.EnableParallelSync(); //< RenderSystem handles node invalidations from multiple threads
+
 	Nz::RenderSystem renderSystem(registry);
 
 
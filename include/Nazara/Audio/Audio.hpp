@@ -8,9 +8,11 @@
 #define NAZARA_AUDIO_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Audio/AudioStreamer.hpp>
 #include <Nazara/Audio/Config.hpp>
 #include <Nazara/Audio/Enums.hpp>
 #include <Nazara/Audio/SoundBuffer.hpp>
+#include <Nazara/Audio/SoundBufferCache.hpp>
 #include <Nazara/Audio/SoundStream.hpp>
 #include <Nazara/Core/Core.hpp>
 #include <Nazara/Math/Quaternion.hpp>
@@ -25,19 +27,21 @@ namespace Nz
 		public:
 			using Dependencies = TypeList<Core>;
 
-			struct Config {};
+			struct Config;
 
-			Audio(Config /*config*/);
+			Audio(Config config);
 			Audio(const Audio&) = delete;
 			Audio(Audio&&) = delete;
 			~Audio();
 
+			inline AudioStreamer& GetAudioStreamer();
 			float GetDopplerFactor() const;
 			float GetGlobalVolume() const;
 			Vector3f GetListenerDirection() const;
 			Vector3f GetListenerPosition() const;
 			Quaternionf GetListenerRotation() const;
 			Vector3f GetListenerVelocity() const;
+			inline SoundBufferCache& GetSoundBufferCache();
 			SoundBufferLoader& GetSoundBufferLoader();
 			const SoundBufferLoader& GetSoundBufferLoader() const;
 			SoundStreamLoader& GetSoundStreamLoader();
@@ -60,7 +64,14 @@ namespace Nz
 			Audio& operator=(const Audio&) = delete;
 			Audio& operator=(Audio&&) = delete;
 
+			struct Config
+			{
+				std::filesystem::path soundBufferCacheDirectory; //< Decoded samples of loaded sound buffers are stored in this directory, leave empty to disable
+			};
+
 		private:
+			std::unique_ptr<AudioStreamer> m_audioStreamer;
+			std::unique_ptr<SoundBufferCache> m_soundBufferCache;
 			SoundBufferLoader m_soundBufferLoader;
 			SoundStreamLoader m_soundStreamLoader;
 
@@ -68,4 +79,6 @@ namespace Nz
 	};
 }
 
+#include <Nazara/Audio/Audio.inl>
+
 #endif // NAZARA_AUDIO_HPP
@@ -0,0 +1,29 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Audio/Audio.hpp>
+#include <Nazara/Audio/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the audio streamer, which streams every music
+	* \return Reference to the audio streamer
+	*/
+	inline AudioStreamer& Audio::GetAudioStreamer()
+	{
+		return *m_audioStreamer;
+	}
+
+	/*!
+	* \brief Gets the cache storing decoded samples of loaded sound buffers
+	* \return Reference to the sound buffer cache
+	*/
+	inline SoundBufferCache& Audio::GetSoundBufferCache()
+	{
+		return *m_soundBufferCache;
+	}
+}
+
+#include <Nazara/Audio/DebugOff.hpp>
@@ -0,0 +1,69 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_AUDIOSTREAMER_HPP
+#define NAZARA_AUDIOSTREAMER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Audio/Config.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Nz
+{
+	class SoundStream;
+
+	class NAZARA_AUDIO_API AudioStreamer
+	{
+		public:
+			class StreamedSource;
+
+			AudioStreamer();
+			AudioStreamer(const AudioStreamer&) = delete;
+			AudioStreamer(AudioStreamer&&) = delete;
+			~AudioStreamer();
+
+			void EnableLooping(StreamedSource* streamedSource, bool loop);
+
+			UInt64 GetPlayedSampleCount(const StreamedSource* streamedSource) const;
+			std::size_t GetStreamedSourceCount() const;
+
+			bool IsFinished(const StreamedSource* streamedSource) const;
+
+			StreamedSource* Start(unsigned int source, std::shared_ptr<SoundStream> soundStream, UInt64 sampleOffset, bool loop);
+			void Stop(StreamedSource* streamedSource);
+
+			void Wake();
+
+			AudioStreamer& operator=(const AudioStreamer&) = delete;
+			AudioStreamer& operator=(AudioStreamer&&) = delete;
+
+			static constexpr std::chrono::milliseconds BufferDuration = std::chrono::milliseconds(250);
+			static constexpr std::chrono::milliseconds DecodeAheadDuration = std::chrono::milliseconds(1000);
+
+		private:
+			bool FillBuffer(StreamedSource& streamedSource, unsigned int buffer);
+			void ReleaseSource(StreamedSource& streamedSource);
+			void StreamerThread();
+			void SubmitDecode(StreamedSource& streamedSource);
+			std::chrono::microseconds UpdateSource(StreamedSource& streamedSource);
+
+			static void Decode(StreamedSource& streamedSource);
+
+			std::condition_variable m_wakeCondition;
+			mutable std::mutex m_mutex;
+			std::thread m_thread;
+			std::vector<std::unique_ptr<StreamedSource>> m_streamedSources;
+			bool m_running;
+			bool m_wakeRequested;
+	};
+}
+
+#endif // NAZARA_AUDIOSTREAMER_HPP
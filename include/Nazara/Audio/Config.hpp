@@ -40,8 +40,8 @@
 // Activate the security tests based on the code (Advised for development)
 #define NAZARA_AUDIO_SAFE 1
 
-// The number of buffers used for audio streaming (At least two)
-#define NAZARA_AUDIO_STREAMED_BUFFER_COUNT 2
+// The number of buffers used for audio streaming, each one holding a quarter second (At least two)
+#define NAZARA_AUDIO_STREAMED_BUFFER_COUNT 4
 
 /// Checking the values and types of certain constants
 #include <Nazara/Audio/ConfigCheck.hpp>
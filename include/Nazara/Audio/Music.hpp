@@ -11,9 +11,6 @@
 #include <Nazara/Audio/Enums.hpp>
 #include <Nazara/Audio/SoundEmitter.hpp>
 #include <Nazara/Audio/SoundStream.hpp>
-#include <condition_variable>
-#include <exception>
-#include <mutex>
 
 namespace Nz
 {
@@ -58,9 +55,7 @@ namespace Nz
 		private:
 			std::unique_ptr<MusicImpl> m_impl;
 
-			bool FillAndQueueBuffer(unsigned int buffer);
-			void MusicThread(std::condition_variable& cv, std::mutex& m, std::exception_ptr& err);
-			void StopThread();
+			void StopStreaming();
 	};
 }
 
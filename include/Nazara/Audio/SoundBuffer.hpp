@@ -16,6 +16,8 @@
 #include <Nazara/Core/ResourceManager.hpp>
 #include <Nazara/Core/ResourceParameters.hpp>
 #include <Nazara/Core/Signal.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <functional>
 
 namespace Nz
 {
@@ -40,13 +42,17 @@ namespace Nz
 		friend Sound;
 
 		public:
+			using LoadCallback = std::function<void(std::shared_ptr<SoundBuffer> soundBuffer)>;
+
 			SoundBuffer();
 			SoundBuffer(AudioFormat format, UInt64 sampleCount, UInt32 sampleRate, const Int16* samples);
+			SoundBuffer(AudioFormat format, UInt64 sampleCount, UInt32 sampleRate, std::unique_ptr<Int16[]> samples);
 			SoundBuffer(const SoundBuffer&) = delete;
 			SoundBuffer(SoundBuffer&&) = delete;
 			~SoundBuffer();
 
 			bool Create(AudioFormat format, UInt64 sampleCount, UInt32 sampleRate, const Int16* samples);
+			bool Create(AudioFormat format, UInt64 sampleCount, UInt32 sampleRate, std::unique_ptr<Int16[]> samples);
 			void Destroy();
 
 			UInt32 GetDuration() const;
@@ -63,6 +69,7 @@ namespace Nz
 			static bool IsFormatSupported(AudioFormat format);
 
 			static std::shared_ptr<SoundBuffer> LoadFromFile(const std::filesystem::path& filePath, const SoundBufferParams& params = SoundBufferParams());
+			static void LoadFromFileAsync(std::filesystem::path filePath, LoadCallback callback, TaskScheduler::Counter* counter = nullptr, const SoundBufferParams& params = SoundBufferParams());
 			static std::shared_ptr<SoundBuffer> LoadFromMemory(const void* data, std::size_t size, const SoundBufferParams& params = SoundBufferParams());
 			static std::shared_ptr<SoundBuffer> LoadFromStream(Stream& stream, const SoundBufferParams& params = SoundBufferParams());
 
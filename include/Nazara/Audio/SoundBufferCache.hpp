@@ -0,0 +1,63 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SOUNDBUFFERCACHE_HPP
+#define NAZARA_SOUNDBUFFERCACHE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Audio/Config.hpp>
+#include <atomic>
+#include <filesystem>
+#include <memory>
+
+namespace Nz
+{
+	class SoundBuffer;
+	struct SoundBufferParams;
+
+	class NAZARA_AUDIO_API SoundBufferCache
+	{
+		public:
+			struct Stats;
+
+			SoundBufferCache(std::filesystem::path cacheDirectory);
+			SoundBufferCache(const SoundBufferCache&) = delete;
+			SoundBufferCache(SoundBufferCache&&) = delete;
+			~SoundBufferCache() = default;
+
+			inline const std::filesystem::path& GetCacheDirectory() const;
+			inline Stats GetStats() const;
+
+			inline bool IsEnabled() const;
+
+			std::shared_ptr<SoundBuffer> LoadFromFile(const std::filesystem::path& filePath, const SoundBufferParams& params);
+
+			SoundBufferCache& operator=(const SoundBufferCache&) = delete;
+			SoundBufferCache& operator=(SoundBufferCache&&) = delete;
+
+			static constexpr UInt32 DecoderVersion = 1; //< Has to be increased when loaders output changes for the same file
+
+			struct Stats
+			{
+				UInt64 hitCount;
+				UInt64 missCount;
+			};
+
+		private:
+			std::filesystem::path ComputeCachePath(const UInt8* fileData, UInt64 fileSize, const SoundBufferParams& params) const;
+			std::shared_ptr<SoundBuffer> LoadSamples(const std::filesystem::path& cachePath) const;
+			void StoreSamples(const std::filesystem::path& cachePath, const SoundBuffer& soundBuffer) const;
+
+			std::atomic<UInt64> m_hitCount;
+			std::atomic<UInt64> m_missCount;
+			std::filesystem::path m_cacheDirectory;
+			bool m_isEnabled;
+	};
+}
+
+#include <Nazara/Audio/SoundBufferCache.inl>
+
+#endif // NAZARA_SOUNDBUFFERCACHE_HPP
@@ -0,0 +1,30 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Audio/SoundBufferCache.hpp>
+#include <Nazara/Audio/Debug.hpp>
+
+namespace Nz
+{
+	inline const std::filesystem::path& SoundBufferCache::GetCacheDirectory() const
+	{
+		return m_cacheDirectory;
+	}
+
+	inline auto SoundBufferCache::GetStats() const -> Stats
+	{
+		Stats stats;
+		stats.hitCount = m_hitCount.load(std::memory_order_relaxed);
+		stats.missCount = m_missCount.load(std::memory_order_relaxed);
+
+		return stats;
+	}
+
+	inline bool SoundBufferCache::IsEnabled() const
+	{
+		return m_isEnabled;
+	}
+}
+
+#include <Nazara/Audio/DebugOff.hpp>
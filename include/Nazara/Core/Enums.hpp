@@ -152,6 +152,7 @@ namespace Nz
 	{
 		x64,
 		AVX,
+		AVX2,
 		FMA3,
 		FMA4,
 		MMX,
@@ -210,8 +211,9 @@ namespace Nz
 
 		Sequential,
 		Text,
+		MemoryMapped,
 
-		Max = Text
+		Max = MemoryMapped
 	};
 
 	template<>
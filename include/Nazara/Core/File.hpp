@@ -36,11 +36,9 @@ namespace Nz
 			bool Delete();
 
 			bool EndOfFile() const;
-			bool EndOfStream() const override;
 
 			bool Exists() const;
 
-			UInt64 GetCursorPos() const override;
 			std::filesystem::path GetDirectory() const override;
 			std::filesystem::path GetFileName() const;
 			std::filesystem::path GetPath() const override;
@@ -51,8 +49,8 @@ namespace Nz
 			bool Open(OpenModeFlags openMode = OpenMode::NotOpen);
 			bool Open(const std::filesystem::path& filePath, OpenModeFlags openMode = OpenMode::NotOpen);
 
+			using Stream::SetCursorPos;
 			bool SetCursorPos(CursorPosition pos, Int64 offset = 0);
-			bool SetCursorPos(UInt64 offset) override;
 			bool SetFile(const std::filesystem::path& filePath);
 			bool SetSize(UInt64 size);
 
@@ -65,6 +63,9 @@ namespace Nz
 		private:
 			void FlushStream() override;
 			std::size_t ReadBlock(void* buffer, std::size_t size) override;
+			bool SeekStreamCursor(UInt64 offset) override;
+			UInt64 TellStreamCursor() const override;
+			bool TestStreamEnd() const override;
 			std::size_t WriteBlock(const void* buffer, std::size_t size) override;
 
 			std::filesystem::path m_filePath;
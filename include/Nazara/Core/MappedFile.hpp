@@ -0,0 +1,62 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_MAPPEDFILE_HPP
+#define NAZARA_MAPPEDFILE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Stream.hpp>
+#include <filesystem>
+#include <memory>
+
+namespace Nz
+{
+	class MappedFileImpl;
+
+	class NAZARA_CORE_API MappedFile : public Stream
+	{
+		public:
+			MappedFile();
+			MappedFile(const std::filesystem::path& filePath);
+			MappedFile(const MappedFile&) = delete;
+			MappedFile(MappedFile&& file) noexcept;
+			~MappedFile();
+
+			void Close();
+
+			inline const UInt8* GetData() const;
+			std::filesystem::path GetDirectory() const override;
+			std::filesystem::path GetFileName() const;
+			const void* GetMappedPointer() const override;
+			std::filesystem::path GetPath() const override;
+			UInt64 GetSize() const override;
+
+			inline bool IsOpen() const;
+
+			bool Open(const std::filesystem::path& filePath);
+
+			MappedFile& operator=(const MappedFile&) = delete;
+			MappedFile& operator=(MappedFile&& file) noexcept;
+
+		private:
+			void FlushStream() override;
+			std::size_t ReadBlock(void* buffer, std::size_t size) override;
+			bool SeekStreamCursor(UInt64 offset) override;
+			UInt64 TellStreamCursor() const override;
+			bool TestStreamEnd() const override;
+			std::size_t WriteBlock(const void* buffer, std::size_t size) override;
+
+			std::filesystem::path m_filePath;
+			std::unique_ptr<MappedFileImpl> m_impl;
+			const UInt8* m_data;
+			UInt64 m_pos;
+			UInt64 m_size;
+	};
+}
+
+#include <Nazara/Core/MappedFile.inl>
+
+#endif // NAZARA_MAPPEDFILE_HPP
@@ -0,0 +1,31 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/MappedFile.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the mapped file content
+	* \return Pointer to the first byte of the file, or nullptr if no file is mapped
+	*
+	* \remark The returned pointer is valid until the file gets closed
+	*/
+	inline const UInt8* MappedFile::GetData() const
+	{
+		return m_data;
+	}
+
+	/*!
+	* \brief Checks whether a file is mapped
+	* \return true if open
+	*/
+	inline bool MappedFile::IsOpen() const
+	{
+		return m_impl != nullptr;
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
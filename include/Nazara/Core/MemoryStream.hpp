@@ -26,15 +26,12 @@ namespace Nz
 
 			void Clear();
 
-			bool EndOfStream() const override;
-
 			inline ByteArray& GetBuffer();
 			inline const ByteArray& GetBuffer() const;
-			UInt64 GetCursorPos() const override;
+			const void* GetMappedPointer() const override;
 			UInt64 GetSize() const override;
 
 			void SetBuffer(ByteArray* byteArray, OpenModeFlags openMode = OpenMode_ReadWrite);
-			bool SetCursorPos(UInt64 offset) override;
 
 			MemoryStream& operator=(const MemoryStream&) = default;
 			MemoryStream& operator=(MemoryStream&&) noexcept = default;
@@ -42,6 +39,9 @@ namespace Nz
 		private:
 			void FlushStream() override;
 			std::size_t ReadBlock(void* buffer, std::size_t size) override;
+			bool SeekStreamCursor(UInt64 offset) override;
+			UInt64 TellStreamCursor() const override;
+			bool TestStreamEnd() const override;
 			std::size_t WriteBlock(const void* buffer, std::size_t size) override;
 
 			MovablePtr<ByteArray> m_buffer;
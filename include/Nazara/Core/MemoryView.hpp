@@ -21,19 +21,18 @@ namespace Nz
 			MemoryView(MemoryView&&) = delete; ///TODO
 			~MemoryView() = default;
 
-			bool EndOfStream() const override;
-
-			UInt64 GetCursorPos() const override;
+			const void* GetMappedPointer() const override;
 			UInt64 GetSize() const override;
 
-			bool SetCursorPos(UInt64 offset) override;
-
 			MemoryView& operator=(const MemoryView&) = delete;
 			MemoryView& operator=(MemoryView&&) = delete; ///TODO
 
 		private:
 			void FlushStream() override;
 			std::size_t ReadBlock(void* buffer, std::size_t size) override;
+			bool SeekStreamCursor(UInt64 offset) override;
+			UInt64 TellStreamCursor() const override;
+			bool TestStreamEnd() const override;
 			std::size_t WriteBlock(const void* buffer, std::size_t size) override;
 
 			UInt8* m_ptr;
@@ -7,6 +7,7 @@
 #ifndef NAZARA_MODULES_HPP
 #define NAZARA_MODULES_HPP
 
+#include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/TypeList.hpp>
 
 namespace Nz
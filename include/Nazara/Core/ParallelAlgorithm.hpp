@@ -0,0 +1,27 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_PARALLELALGORITHM_HPP
+#define NAZARA_PARALLELALGORITHM_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <cstddef>
+#include <functional>
+
+namespace Nz
+{
+	inline std::size_t ComputeGrainSize(std::size_t elementCount, std::size_t minGrainSize = 1);
+
+	template<typename F> void ParallelFor(std::size_t begin, std::size_t end, F&& func, std::size_t grainSize = 0);
+	template<typename F> void ParallelForRange(std::size_t begin, std::size_t end, F&& func, std::size_t grainSize = 0);
+	template<typename T, typename Reduce, typename Combine> T ParallelReduce(std::size_t begin, std::size_t end, T identity, Reduce&& reduce, Combine&& combine, std::size_t grainSize = 0);
+	template<typename It, typename Compare = std::less<>> void ParallelSort(It first, It last, Compare comp = Compare{}, std::size_t grainSize = 0);
+}
+
+#include <Nazara/Core/ParallelAlgorithm.inl>
+
+#endif // NAZARA_PARALLELALGORITHM_HPP
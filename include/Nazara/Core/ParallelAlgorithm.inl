@@ -0,0 +1,209 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/ParallelAlgorithm.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	namespace Detail
+	{
+		template<typename F>
+		void ParallelForSplit(std::size_t begin, std::size_t end, std::size_t grainSize, F& func, TaskScheduler::Counter& counter)
+		{
+			// Lazy binary splitting: give away the upper half to other workers (through stealing) until the range is small enough
+			while (end - begin > grainSize)
+			{
+				std::size_t middle = begin + (end - begin) / 2;
+				TaskScheduler::Submit([middle, end, grainSize, &func, &counter]
+				{
+					ParallelForSplit(middle, end, grainSize, func, counter);
+				}, &counter);
+
+				end = middle;
+			}
+
+			func(begin, end);
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Computes a grain size splitting a range in enough chunks to keep every worker of the TaskScheduler busy
+	* \return Grain size (number of elements per chunk)
+	*
+	* \param elementCount Number of elements to process
+	* \param minGrainSize Minimum number of elements per chunk, to keep the scheduling overhead low for small elements
+	*/
+	inline std::size_t ComputeGrainSize(std::size_t elementCount, std::size_t minGrainSize)
+	{
+		// A few chunks per worker allow for load balancing through work stealing
+		std::size_t chunkCount = std::size_t(TaskScheduler::GetWorkerCount()) * 4;
+		return std::max((elementCount + chunkCount - 1) / chunkCount, std::max<std::size_t>(minGrainSize, 1));
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Calls a function for every index of a range, using the TaskScheduler workers
+	*
+	* The calling thread takes part in the execution and this function returns once every index has been processed.
+	* It can be called from inside a task.
+	*
+	* \param begin First index of the range
+	* \param end Index past the last index of the range
+	* \param func Function called with each index, concurrently
+	* \param grainSize Maximum number of indices processed by a single task (0 to use ComputeGrainSize)
+	*
+	* \see ParallelForRange
+	*/
+	template<typename F>
+	void ParallelFor(std::size_t begin, std::size_t end, F&& func, std::size_t grainSize)
+	{
+		ParallelForRange(begin, end, [&func](std::size_t rangeBegin, std::size_t rangeEnd)
+		{
+			for (std::size_t i = rangeBegin; i < rangeEnd; ++i)
+				func(i);
+		}, grainSize);
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Splits a range into chunks and processes them using the TaskScheduler workers
+	*
+	* The range is recursively split in two until chunks are no larger than the grain size, idle workers steal the largest remaining halves.
+	* The calling thread takes part in the execution and this function returns once the whole range has been processed.
+	* It can be called from inside a task.
+	*
+	* \param begin First index of the range
+	* \param end Index past the last index of the range
+	* \param func Function called with the bounds (begin, end) of each chunk, concurrently
+	* \param grainSize Maximum number of indices per chunk (0 to use ComputeGrainSize)
+	*/
+	template<typename F>
+	void ParallelForRange(std::size_t begin, std::size_t end, F&& func, std::size_t grainSize)
+	{
+		if (begin >= end)
+			return;
+
+		std::size_t elementCount = end - begin;
+		if (grainSize == 0)
+			grainSize = ComputeGrainSize(elementCount);
+
+		if (elementCount <= grainSize)
+		{
+			func(begin, end);
+			return;
+		}
+
+		TaskScheduler::Counter counter;
+		Detail::ParallelForSplit(begin, end, grainSize, func, counter);
+		TaskScheduler::WaitFor(counter);
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Reduces a range to a single value using the TaskScheduler workers
+	* \return Combination of every chunk result
+	*
+	* The range is split into chunks of grainSize elements, each one being reduced independently, before chunk results are combined in order.
+	* As the partition only depends on the grain size, the result is deterministic even for non-associative operations (such as floating-point additions).
+	*
+	* \param begin First index of the range
+	* \param end Index past the last index of the range
+	* \param identity Identity value of the combine operation, also passed as the initial value of each chunk
+	* \param reduce Function called as reduce(chunkBegin, chunkEnd, identity) for each chunk, returning a T
+	* \param combine Function combining two T
+	* \param grainSize Number of indices per chunk (0 to use ComputeGrainSize)
+	*/
+	template<typename T, typename Reduce, typename Combine>
+	T ParallelReduce(std::size_t begin, std::size_t end, T identity, Reduce&& reduce, Combine&& combine, std::size_t grainSize)
+	{
+		if (begin >= end)
+			return identity;
+
+		std::size_t elementCount = end - begin;
+		if (grainSize == 0)
+			grainSize = ComputeGrainSize(elementCount);
+
+		if (elementCount <= grainSize)
+			return combine(identity, reduce(begin, end, identity));
+
+		std::size_t chunkCount = (elementCount + grainSize - 1) / grainSize;
+		std::vector<T> partialResults(chunkCount, identity);
+
+		ParallelFor(0, chunkCount, [&](std::size_t chunkIndex)
+		{
+			std::size_t chunkBegin = begin + chunkIndex * grainSize;
+			std::size_t chunkEnd = std::min(chunkBegin + grainSize, end);
+
+			partialResults[chunkIndex] = reduce(chunkBegin, chunkEnd, identity);
+		}, 1);
+
+		T result = std::move(identity);
+		for (T& partialResult : partialResults)
+			result = combine(std::move(result), std::move(partialResult));
+
+		return result;
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Sorts a range using the TaskScheduler workers
+	*
+	* Chunks of the range are sorted concurrently before being merged pairwise, every merge of a same pass running concurrently.
+	* Like std::sort, this sort is not stable.
+	*
+	* \param first Random access iterator to the first element
+	* \param last Random access iterator past the last element
+	* \param comp Comparison function object
+	* \param grainSize Minimum number of elements per initially sorted chunk (0 to compute one from the worker count)
+	*/
+	template<typename It, typename Compare>
+	void ParallelSort(It first, It last, Compare comp, std::size_t grainSize)
+	{
+		static_assert(std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<It>::iterator_category>, "ParallelSort requires random access iterators");
+
+		std::size_t elementCount = static_cast<std::size_t>(std::distance(first, last));
+		if (grainSize == 0)
+			grainSize = ComputeGrainSize(elementCount, 2048);
+
+		if (elementCount <= grainSize)
+		{
+			std::sort(first, last, comp);
+			return;
+		}
+
+		// Use a power of two chunk count to keep merges balanced
+		std::size_t chunkCount = 1;
+		while (chunkCount * grainSize < elementCount)
+			chunkCount *= 2;
+
+		auto ChunkBound = [&](std::size_t chunkIndex)
+		{
+			return first + static_cast<std::ptrdiff_t>(std::min(chunkIndex * elementCount / chunkCount, elementCount));
+		};
+
+		ParallelFor(0, chunkCount, [&](std::size_t chunkIndex)
+		{
+			std::sort(ChunkBound(chunkIndex), ChunkBound(chunkIndex + 1), comp);
+		}, 1);
+
+		for (std::size_t width = 1; width < chunkCount; width *= 2)
+		{
+			ParallelFor(0, chunkCount / (width * 2), [&](std::size_t pairIndex)
+			{
+				std::size_t chunkIndex = pairIndex * width * 2;
+				std::inplace_merge(ChunkBound(chunkIndex), ChunkBound(chunkIndex + width), ChunkBound(chunkIndex + width * 2), comp);
+			}, 1);
+		}
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
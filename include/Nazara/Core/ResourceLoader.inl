@@ -5,6 +5,7 @@
 #include <Nazara/Core/Config.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/File.hpp>
+#include <Nazara/Core/MappedFile.hpp>
 #include <Nazara/Core/MemoryView.hpp>
 #include <Nazara/Core/Stream.hpp>
 #include <Nazara/Core/StringExt.hpp>
@@ -77,7 +78,10 @@ namespace Nz
 		if (ext[0] == '.')
 			ext.erase(ext.begin());
 
-		File file(filePath.generic_u8string()); // Open only if needed
+		// Open only if needed, mapping the file in memory if possible so stream loaders can parse it without copies
+		MappedFile mappedFile;
+		File file;
+		Stream* stream = nullptr;
 
 		bool found = false;
 		for (auto& loaderPtr : m_loaders)
@@ -87,9 +91,13 @@ namespace Nz
 			if (loader.extensionSupport && !loader.extensionSupport(ext))
 				continue;
 
-			if (loader.streamChecker && !file.IsOpen())
+			if (loader.streamChecker && !stream)
 			{
-				if (!file.Open(OpenMode::ReadOnly))
+				if (mappedFile.Open(filePath))
+					stream = &mappedFile;
+				else if (file.Open(filePath, OpenMode::ReadOnly))
+					stream = &file;
+				else
 				{
 					NazaraError("Failed to load file: unable to open \"" + filePath.generic_u8string() + '"');
 					return nullptr;
@@ -101,9 +109,9 @@ namespace Nz
 			{
 				if (loader.streamChecker)
 				{
-					file.SetCursorPos(0);
+					stream->SetCursorPos(0);
 
-					recognized = loader.streamChecker(file, parameters);
+					recognized = loader.streamChecker(*stream, parameters);
 					if (recognized == Ternary::False)
 						continue;
 					else
@@ -126,17 +134,17 @@ namespace Nz
 			{
 				assert(loader.streamChecker);
 
-				file.SetCursorPos(0);
+				stream->SetCursorPos(0);
 
-				recognized = loader.streamChecker(file, parameters);
+				recognized = loader.streamChecker(*stream, parameters);
 				if (recognized == Ternary::False)
 					continue;
 				else if (recognized == Ternary::True)
 					found = true;
 
-				file.SetCursorPos(0);
+				stream->SetCursorPos(0);
 
-				std::shared_ptr<Type> resource = loader.streamLoader(file, parameters);
+				std::shared_ptr<Type> resource = loader.streamLoader(*stream, parameters);
 				if (resource)
 				{
 					resource->SetFilePath(filePath);
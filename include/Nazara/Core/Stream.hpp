@@ -12,6 +12,8 @@
 #include <Nazara/Core/Enums.hpp>
 #include <filesystem>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace Nz
 {
@@ -24,14 +26,17 @@ namespace Nz
 			Stream(Stream&&) noexcept = default;
 			virtual ~Stream();
 
-			virtual bool EndOfStream() const = 0;
-
+			void EnableBuffering(bool buffering, std::size_t bufferSize = DefaultBufferSize);
 			inline void EnableTextMode(bool textMode);
 
+			inline bool EndOfStream() const;
+
 			inline void Flush();
 
-			virtual UInt64 GetCursorPos() const = 0;
+			inline std::size_t GetBufferSize() const;
+			inline UInt64 GetCursorPos() const;
 			virtual std::filesystem::path GetDirectory() const;
+			virtual const void* GetMappedPointer() const;
 			virtual std::filesystem::path GetPath() const;
 			inline OpenModeFlags GetOpenMode() const;
 			inline StreamOptionFlags GetStreamOptions() const;
@@ -40,13 +45,16 @@ namespace Nz
 
 			inline std::size_t Read(void* buffer, std::size_t size);
 			virtual std::string ReadLine(unsigned int lineSize = 0);
+			std::string_view ReadLineView(unsigned int lineSize = 0);
 
+			inline bool IsBufferingEnabled() const;
+			inline bool IsMemoryMapped() const;
 			inline bool IsReadable() const;
 			inline bool IsSequential() const;
 			inline bool IsTextModeEnabled() const;
 			inline bool IsWritable() const;
 
-			virtual bool SetCursorPos(UInt64 offset) = 0;
+			bool SetCursorPos(UInt64 offset);
 
 			bool Write(const ByteArray& byteArray);
 			bool Write(const std::string_view& string);
@@ -55,15 +63,34 @@ namespace Nz
 			Stream& operator=(const Stream&) = default;
 			Stream& operator=(Stream&&) noexcept = default;
 
+			static constexpr std::size_t DefaultBufferSize = 64 * 1024;
+
 		protected:
 			inline Stream(StreamOptionFlags streamOptions = StreamOption::None, OpenModeFlags openMode = OpenMode::NotOpen);
 
+			bool FlushBuffer();
 			virtual void FlushStream() = 0;
 			virtual std::size_t ReadBlock(void* buffer, std::size_t size) = 0;
+			inline void ResetBuffer();
+			virtual bool SeekStreamCursor(UInt64 offset) = 0;
+			virtual UInt64 TellStreamCursor() const = 0;
+			virtual bool TestStreamEnd() const = 0;
 			virtual std::size_t WriteBlock(const void* buffer, std::size_t size) = 0;
 
 			OpenModeFlags m_openMode;
 			StreamOptionFlags m_streamOptions;
+
+		private:
+			bool FillBuffer();
+			std::size_t ReadBuffered(void* buffer, std::size_t size);
+			std::size_t WriteBuffered(const void* buffer, std::size_t size);
+
+			std::string m_lineBuffer;
+			std::vector<UInt8> m_buffer;
+			std::size_t m_bufferOffset; //< Logical cursor position, relative to m_bufferCursor
+			std::size_t m_bufferSize;   //< Read-ahead or pending bytes
+			UInt64 m_bufferCursor;      //< Position of the first buffered byte in the underlying stream
+			bool m_hasPendingWrites;
 	};
 }
 
@@ -16,7 +16,11 @@ namespace Nz
 
 	inline Stream::Stream(StreamOptionFlags streamOptions, OpenModeFlags openMode) :
 	m_openMode(openMode),
-	m_streamOptions(streamOptions)
+	m_streamOptions(streamOptions),
+	m_bufferOffset(0),
+	m_bufferSize(0),
+	m_bufferCursor(0),
+	m_hasPendingWrites(false)
 	{
 	}
 
@@ -34,9 +38,27 @@ namespace Nz
 			m_streamOptions &= ~StreamOption::Text;
 	}
 
+	/*!
+	* \brief Checks whether the stream reached its end
+	* \return true if there is nothing left to read
+	*/
+
+	inline bool Stream::EndOfStream() const
+	{
+		if (m_bufferOffset < m_bufferSize)
+			return false; //< Read-ahead data is available
+
+		if (m_hasPendingWrites)
+			return GetCursorPos() >= GetSize();
+
+		return TestStreamEnd();
+	}
+
 	/*!
 	* \brief Flushes the stream
 	*
+	* Data pending in the write buffer is written before flushing the stream itself
+	*
 	* \remark Produces a NazaraAssert if file is not writable
 	*/
 
@@ -44,9 +66,33 @@ namespace Nz
 	{
 		NazaraAssert(IsWritable(), "Stream is not writable");
 
+		FlushBuffer();
 		FlushStream();
 	}
 
+	/*!
+	* \brief Gets the size of the read-ahead/write-behind buffer
+	* \return Buffer size, zero if buffering is disabled
+	*/
+
+	inline std::size_t Stream::GetBufferSize() const
+	{
+		return m_buffer.size();
+	}
+
+	/*!
+	* \brief Gets the position of the cursor
+	* \return Position of the cursor, taking buffered data into account
+	*/
+
+	inline UInt64 Stream::GetCursorPos() const
+	{
+		if (m_bufferSize > 0)
+			return m_bufferCursor + m_bufferOffset;
+
+		return TellStreamCursor();
+	}
+
 	/*!
 	* \brief Gets the open mode of the stream
 	* \return Reading/writing mode for the stream
@@ -67,6 +113,30 @@ namespace Nz
 		return m_streamOptions;
 	}
 
+	/*!
+	* \brief Checks whether the stream buffers its reads and writes
+	* \return true if it is the case
+	*
+	* \see EnableBuffering
+	*/
+
+	inline bool Stream::IsBufferingEnabled() const
+	{
+		return !m_buffer.empty();
+	}
+
+	/*!
+	* \brief Checks whether the whole stream content is directly accessible in memory
+	* \return true if it is the case
+	*
+	* \see GetMappedPointer
+	*/
+
+	inline bool Stream::IsMemoryMapped() const
+	{
+		return (m_streamOptions & StreamOption::MemoryMapped) != 0;
+	}
+
 	/*!
 	* \brief Checks whether the stream is readable
 	* \return true if it is the case
@@ -122,6 +192,9 @@ namespace Nz
 	{
 		NazaraAssert(IsReadable(), "Stream is not readable");
 
+		if (IsBufferingEnabled())
+			return ReadBuffered(buffer, size);
+
 		return ReadBlock(buffer, size);
 	}
 
@@ -140,6 +213,24 @@ namespace Nz
 	{
 		NazaraAssert(IsWritable(), "Stream is not writable");
 
+		if (IsBufferingEnabled())
+			return WriteBuffered(buffer, size);
+
 		return WriteBlock(buffer, size);
 	}
+
+	/*!
+	* \brief Forgets buffered data without touching the underlying stream
+	*
+	* Must be called by derived classes when their underlying stream is replaced or reset
+	*
+	* \remark Pending writes are lost, use FlushBuffer to keep them
+	*/
+
+	inline void Stream::ResetBuffer()
+	{
+		m_bufferOffset = 0;
+		m_bufferSize = 0;
+		m_hasPendingWrites = false;
+	}
 }
@@ -0,0 +1,88 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SYSTEMSCHEDULER_HPP
+#define NAZARA_SYSTEMSCHEDULER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Bitset.hpp>
+#include <Nazara/Core/ECS.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <atomic>
+#include <functional>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API SystemScheduler
+	{
+		public:
+			class Access;
+			using UpdateFunc = std::function<void(float /*elapsedTime*/)>;
+
+			SystemScheduler() = default;
+			SystemScheduler(const SystemScheduler&) = delete;
+			SystemScheduler(SystemScheduler&&) noexcept = default;
+			~SystemScheduler() = default;
+
+			std::size_t AddSystem(Access access, UpdateFunc update);
+
+			inline std::size_t GetSystemCount() const;
+
+			void Update(float elapsedTime, bool useParallelism = true);
+
+			SystemScheduler& operator=(const SystemScheduler&) = delete;
+			SystemScheduler& operator=(SystemScheduler&&) noexcept = default;
+
+		private:
+			void RunSystem(std::size_t systemIndex, float elapsedTime, TaskScheduler::Counter& counter);
+
+			struct System;
+
+			std::vector<System> m_systems;
+			std::vector<std::atomic<std::size_t>> m_pendingDependencies;
+	};
+
+	class SystemScheduler::Access
+	{
+		public:
+			Access() = default;
+			Access(const Access&) = default;
+			Access(Access&&) noexcept = default;
+			~Access() = default;
+
+			inline bool Conflicts(const Access& access) const;
+
+			inline Access& Exclusive(bool exclusive = true);
+
+			inline bool IsExclusive() const;
+
+			template<typename... Components> Access& Read();
+			template<typename... Components> Access& Write();
+
+			Access& operator=(const Access&) = default;
+			Access& operator=(Access&&) noexcept = default;
+
+		private:
+			template<typename Component> static std::size_t GetComponentIndex();
+
+			Bitset<UInt64> m_readComponents;
+			Bitset<UInt64> m_writeComponents;
+			bool m_exclusive = false;
+	};
+
+	struct SystemScheduler::System
+	{
+		Access access;
+		UpdateFunc update;
+		std::size_t dependencyCount = 0;
+		std::vector<std::size_t> dependents;
+	};
+}
+
+#include <Nazara/Core/SystemScheduler.inl>
+
+#endif // NAZARA_SYSTEMSCHEDULER_HPP
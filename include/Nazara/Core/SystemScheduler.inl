@@ -0,0 +1,89 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/SystemScheduler.hpp>
+#include <type_traits>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the number of systems
+	* \return Number of systems added to the scheduler
+	*/
+	inline std::size_t SystemScheduler::GetSystemCount() const
+	{
+		return m_systems.size();
+	}
+
+	/*!
+	* \brief Checks if two systems cannot run at the same time
+	* \return true if one of them writes a component the other one reads or writes, or if one of them is exclusive
+	*
+	* \param access Component access of the other system
+	*/
+	inline bool SystemScheduler::Access::Conflicts(const Access& access) const
+	{
+		if (m_exclusive || access.m_exclusive)
+			return true;
+
+		return m_writeComponents.Intersects(access.m_readComponents) ||
+		       m_writeComponents.Intersects(access.m_writeComponents) ||
+		       m_readComponents.Intersects(access.m_writeComponents);
+	}
+
+	/*!
+	* \brief Makes the system run alone, on the thread calling SystemScheduler::Update
+	* \return A reference to this object
+	*
+	* This is meant for systems which aren't thread-safe at all or which have to run on the main thread (such as rendering).
+	*
+	* \param exclusive Should the system run alone
+	*/
+	inline auto SystemScheduler::Access::Exclusive(bool exclusive) -> Access&
+	{
+		m_exclusive = exclusive;
+		return *this;
+	}
+
+	/*!
+	* \brief Checks if the system has to run alone
+	* \return true if the system is exclusive
+	*/
+	inline bool SystemScheduler::Access::IsExclusive() const
+	{
+		return m_exclusive;
+	}
+
+	/*!
+	* \brief Declares components read by the system
+	* \return A reference to this object
+	*/
+	template<typename... Components>
+	auto SystemScheduler::Access::Read() -> Access&
+	{
+		(m_readComponents.UnboundedSet(GetComponentIndex<Components>()), ...);
+		return *this;
+	}
+
+	/*!
+	* \brief Declares components written by the system
+	* \return A reference to this object
+	*/
+	template<typename... Components>
+	auto SystemScheduler::Access::Write() -> Access&
+	{
+		(m_writeComponents.UnboundedSet(GetComponentIndex<Components>()), ...);
+		return *this;
+	}
+
+	template<typename Component>
+	std::size_t SystemScheduler::Access::GetComponentIndex()
+	{
+		entt::id_type componentId = entt::type_seq<std::remove_const_t<Component>>();
+		return static_cast<std::size_t>(componentId);
+	}
+}
+
+#include <Nazara/Core/DebugOff.hpp>
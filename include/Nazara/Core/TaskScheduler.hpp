@@ -8,28 +8,108 @@
 #define NAZARA_TASKSCHEDULER_HPP
 
 #include <Nazara/Prerequisites.hpp>
-#include <Nazara/Core/Functor.hpp>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <type_traits>
 
 namespace Nz
 {
+	struct TaskSchedulerNode;
+
 	class NAZARA_CORE_API TaskScheduler
 	{
 		public:
+			class Counter;
+			class Task;
+
 			TaskScheduler() = delete;
 			~TaskScheduler() = delete;
 
 			template<typename F> static void AddTask(F function);
 			template<typename F, typename... Args> static void AddTask(F function, Args&&... args);
 			template<typename C> static void AddTask(void (C::*function)(), C* object);
+
 			static unsigned int GetWorkerCount();
+
 			static bool Initialize();
+			static bool IsWorkerThread();
+
 			static void Run();
+
 			static void SetWorkerCount(unsigned int workerCount);
+			static void Submit(Task task, Counter* counter = nullptr, Counter* dependency = nullptr);
+
 			static void Uninitialize();
+
+			static void WaitFor(Counter& counter);
 			static void WaitForTasks();
 
 		private:
-			static void AddTaskFunctor(Functor* taskFunctor);
+			static void AddPendingTask(Task task);
+			static void ReleaseCounter(Counter& counter);
+	};
+
+	class TaskScheduler::Task
+	{
+		friend TaskScheduler;
+
+		public:
+			static constexpr std::size_t InlineStorageSize = 6 * sizeof(void*);
+
+			Task() = default;
+			template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Task>>> Task(F&& function);
+			Task(const Task&) = delete;
+			inline Task(Task&& task) noexcept;
+			inline ~Task();
+
+			inline bool IsValid() const;
+
+			inline void operator()();
+
+			Task& operator=(const Task&) = delete;
+			inline Task& operator=(Task&& task) noexcept;
+
+		private:
+			struct Operations
+			{
+				void (*destroy)(void* storage);
+				void (*invoke)(void* storage);
+				void (*move)(void* destination, void* source);
+			};
+
+			template<typename F> static constexpr bool FitsInline();
+
+			inline void Reset();
+
+			template<typename F> static const Operations s_heapOperations;
+			template<typename F> static const Operations s_inlineOperations;
+
+			alignas(std::max_align_t) unsigned char m_storage[InlineStorageSize];
+			const Operations* m_operations = nullptr;
+	};
+
+	class NAZARA_CORE_API TaskScheduler::Counter
+	{
+		friend TaskScheduler;
+
+		public:
+			inline Counter();
+			Counter(const Counter&) = delete;
+			Counter(Counter&&) = delete;
+			~Counter();
+
+			inline unsigned int GetValue() const;
+
+			inline bool IsDone() const;
+
+			Counter& operator=(const Counter&) = delete;
+			Counter& operator=(Counter&&) = delete;
+
+		private:
+			std::atomic<unsigned int> m_value;
+			std::mutex m_mutex;
+			TaskSchedulerNode* m_waitingTasks;
 	};
 }
 
@@ -2,6 +2,11 @@
 // This file is part of the "Nazara Engine - Core module"
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <new>
+#include <tuple>
+#include <utility>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -17,11 +22,10 @@ namespace Nz
 	*
 	* \param function Task that the pool will execute
 	*/
-
 	template<typename F>
 	void TaskScheduler::AddTask(F function)
 	{
-		AddTaskFunctor(new FunctorWithoutArgs<F>(function));
+		AddPendingTask(Task(std::move(function)));
 	}
 
 	/*!
@@ -30,11 +34,13 @@ namespace Nz
 	* \param function Task that the pool will execute
 	* \param args Arguments of the function
 	*/
-
 	template<typename F, typename... Args>
 	void TaskScheduler::AddTask(F function, Args&&... args)
 	{
-		AddTaskFunctor(new FunctorWithArgs<F, Args...>(function, std::forward<Args>(args)...));
+		AddPendingTask(Task([function = std::move(function), args = std::tuple<Args...>(std::forward<Args>(args)...)]() mutable
+		{
+			std::apply(function, args);
+		}));
 	}
 
 	/*!
@@ -43,11 +49,172 @@ namespace Nz
 	* \param function Task that the pool will execute
 	* \param object Object on which the method will be called
 	*/
-
 	template<typename C>
 	void TaskScheduler::AddTask(void (C::*function)(), C* object)
 	{
-		AddTaskFunctor(new MemberWithoutArgs<C>(function, object));
+		AddPendingTask(Task([function, object]()
+		{
+			(object->*function)();
+		}));
+	}
+
+
+	/*!
+	* \ingroup core
+	* \class Nz::TaskScheduler::Task
+	* \brief Core class that represents a type-erased callable executed by the TaskScheduler
+	*
+	* Callables fitting in InlineStorageSize bytes (and nothrow move constructible) are stored in place, larger ones are heap-allocated.
+	*/
+
+	/*!
+	* \brief Constructs a Task object from a callable
+	*
+	* \param function Callable object to execute
+	*/
+	template<typename F, typename>
+	TaskScheduler::Task::Task(F&& function)
+	{
+		using Func = std::decay_t<F>;
+
+		if constexpr (FitsInline<Func>())
+		{
+			new (m_storage) Func(std::forward<F>(function));
+			m_operations = &s_inlineOperations<Func>;
+		}
+		else
+		{
+			*reinterpret_cast<Func**>(m_storage) = new Func(std::forward<F>(function));
+			m_operations = &s_heapOperations<Func>;
+		}
+	}
+
+	/*!
+	* \brief Constructs a Task object by moving another one
+	*
+	* \param task Task to move into this
+	*/
+	inline TaskScheduler::Task::Task(Task&& task) noexcept :
+	m_operations(task.m_operations)
+	{
+		if (m_operations)
+		{
+			m_operations->move(m_storage, task.m_storage);
+			task.m_operations = nullptr;
+		}
+	}
+
+	inline TaskScheduler::Task::~Task()
+	{
+		Reset();
+	}
+
+	/*!
+	* \brief Checks whether the task holds a callable
+	* \return true If the task can be invoked
+	*/
+	inline bool TaskScheduler::Task::IsValid() const
+	{
+		return m_operations != nullptr;
+	}
+
+	/*!
+	* \brief Invokes the stored callable
+	*
+	* \remark The task must be valid
+	*/
+	inline void TaskScheduler::Task::operator()()
+	{
+		NazaraAssert(m_operations, "invalid task");
+
+		m_operations->invoke(m_storage);
+	}
+
+	inline auto TaskScheduler::Task::operator=(Task&& task) noexcept -> Task&
+	{
+		if (this != &task)
+		{
+			Reset();
+
+			m_operations = task.m_operations;
+			if (m_operations)
+			{
+				m_operations->move(m_storage, task.m_storage);
+				task.m_operations = nullptr;
+			}
+		}
+
+		return *this;
+	}
+
+	template<typename F>
+	constexpr bool TaskScheduler::Task::FitsInline()
+	{
+		return sizeof(F) <= InlineStorageSize && alignof(F) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<F>;
+	}
+
+	inline void TaskScheduler::Task::Reset()
+	{
+		if (m_operations)
+		{
+			m_operations->destroy(m_storage);
+			m_operations = nullptr;
+		}
+	}
+
+	template<typename F>
+	const TaskScheduler::Task::Operations TaskScheduler::Task::s_heapOperations = {
+		[](void* storage) { delete *static_cast<F**>(storage); },
+		[](void* storage) { (**static_cast<F**>(storage))(); },
+		[](void* destination, void* source) { *static_cast<F**>(destination) = *static_cast<F**>(source); }
+	};
+
+	template<typename F>
+	const TaskScheduler::Task::Operations TaskScheduler::Task::s_inlineOperations = {
+		[](void* storage) { std::launder(static_cast<F*>(storage))->~F(); },
+		[](void* storage) { (*std::launder(static_cast<F*>(storage)))(); },
+		[](void* destination, void* source)
+		{
+			F* sourceFunc = std::launder(static_cast<F*>(source));
+			new (destination) F(std::move(*sourceFunc));
+			sourceFunc->~F();
+		}
+	};
+
+
+	/*!
+	* \ingroup core
+	* \class Nz::TaskScheduler::Counter
+	* \brief Core class that tracks the completion of a group of tasks
+	*
+	* A counter is incremented when a task is submitted with it and decremented when that task has been executed,
+	* it can be waited on (see TaskScheduler::WaitFor) or used as a dependency by other tasks.
+	*
+	* \remark A counter must outlive the tasks referencing it, destroying it while tasks are still pending is undefined behavior
+	*/
+
+	inline TaskScheduler::Counter::Counter() :
+	m_value(0),
+	m_waitingTasks(nullptr)
+	{
+	}
+
+	/*!
+	* \brief Gets the number of tasks still pending on this counter
+	* \return Pending task count
+	*/
+	inline unsigned int TaskScheduler::Counter::GetValue() const
+	{
+		return m_value.load(std::memory_order_acquire);
+	}
+
+	/*!
+	* \brief Checks whether every task submitted with this counter has been executed
+	* \return true If the counter reached zero
+	*/
+	inline bool TaskScheduler::Counter::IsDone() const
+	{
+		return GetValue() == 0;
 	}
 }
 
@@ -59,6 +59,8 @@ namespace Nz
 			NazaraSignal(OnCullingListRelease, CullingList* /*cullingList*/);
 
 		private:
+			template<typename Bounds, typename VisibilityEntry> void CullEntries(const Frustumf& frustum, const std::vector<Bounds>& boundsList, std::vector<VisibilityEntry>& testList, std::size_t& fullyVisibleHash, std::size_t& partiallyVisibleHash, bool& forcedInvalidation);
+
 			inline void NotifyBoxUpdate(std::size_t index, const Boxf& boundingVolume);
 			inline void NotifyForceInvalidation(CullTest type, std::size_t index);
 			inline void NotifyMovement(CullTest type, std::size_t index, void* oldPtr, void* newPtr);
@@ -66,9 +68,9 @@ namespace Nz
 			inline void NotifySphereUpdate(std::size_t index, const Spheref& sphere);
 			inline void NotifyVolumeUpdate(std::size_t index, const BoundingVolumef& boundingVolume);
 
+			// Bounds are stored separately from entries (structure of arrays) to keep the culling loop cache-friendly
 			struct BoxVisibilityEntry
 			{
-				Boxf box;
 				BoxEntry* entry;
 				const T* renderable;
 				bool forceInvalidation;
@@ -83,7 +85,6 @@ namespace Nz
 
 			struct SphereVisibilityEntry
 			{
-				Spheref sphere;
 				SphereEntry* entry;
 				const T* renderable;
 				bool forceInvalidation;
@@ -91,15 +92,18 @@ namespace Nz
 
 			struct VolumeVisibilityEntry
 			{
-				BoundingVolumef volume;
 				VolumeEntry* entry;
 				const T* renderable;
 				bool forceInvalidation;
 			};
 
+			std::vector<BoundingVolumef> m_volumes;
+			std::vector<Boxf> m_boxes;
 			std::vector<BoxVisibilityEntry> m_boxTestList;
 			std::vector<NoTestVisibilityEntry> m_noTestList;
+			std::vector<Spheref> m_spheres;
 			std::vector<SphereVisibilityEntry> m_sphereTestList;
+			std::vector<UInt8> m_intersectionResults;
 			std::vector<VolumeVisibilityEntry> m_volumeTestList;
 			ResultContainer m_fullyVisibleResults;
 			ResultContainer m_partiallyVisibleResults;
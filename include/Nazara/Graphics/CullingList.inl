@@ -3,6 +3,9 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/CullingList.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
+#include <cassert>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
@@ -24,97 +27,19 @@ namespace Nz
 		std::size_t fullyVisibleHash = 5U;
 		std::size_t partiallyVisibleHash = 5U;
 
-		auto CombineHash = [](std::size_t currentHash, std::size_t newHash)
-		{
-			return currentHash * 23 + newHash;
-		};
-
-		for (BoxVisibilityEntry& entry : m_boxTestList)
-		{
-			switch (frustum.Intersect(entry.box))
-			{
-				case IntersectionSide_Inside:
-					m_fullyVisibleResults.push_back(entry.renderable);
-					fullyVisibleHash = CombineHash(fullyVisibleHash, std::hash<const T*>()(entry.renderable));
-
-					forcedInvalidation = forcedInvalidation | entry.forceInvalidation;
-					entry.forceInvalidation = false;
-					break;
-
-				case IntersectionSide_Intersecting:
-					m_partiallyVisibleResults.push_back(entry.renderable);
-					partiallyVisibleHash = CombineHash(partiallyVisibleHash, std::hash<const T*>()(entry.renderable));
-
-					forcedInvalidation = forcedInvalidation | entry.forceInvalidation;
-					entry.forceInvalidation = false;
-					break;
-
-				case IntersectionSide_Outside:
-					break;
-			}
-		}
+		CullEntries(frustum, m_boxes, m_boxTestList, fullyVisibleHash, partiallyVisibleHash, forcedInvalidation);
 
 		for (NoTestVisibilityEntry& entry : m_noTestList)
 		{
 			m_fullyVisibleResults.push_back(entry.renderable);
-			CombineHash(fullyVisibleHash, std::hash<const T*>()(entry.renderable));
+			fullyVisibleHash = fullyVisibleHash * 23 + std::hash<const T*>()(entry.renderable);
 
-			if (entry.forceInvalidation)
-			{
-				forcedInvalidation = true;
-				entry.forceInvalidation = false;
-			}
+			forcedInvalidation = forcedInvalidation | entry.forceInvalidation;
+			entry.forceInvalidation = false;
 		}
 
-		for (SphereVisibilityEntry& entry : m_sphereTestList)
-		{
-			switch (frustum.Intersect(entry.sphere))
-			{
-				case IntersectionSide_Inside:
-					m_fullyVisibleResults.push_back(entry.renderable);
-					fullyVisibleHash = CombineHash(fullyVisibleHash, std::hash<const T*>()(entry.renderable));
-
-					forcedInvalidation = forcedInvalidation | entry.forceInvalidation;
-					entry.forceInvalidation = false;
-					break;
-
-				case IntersectionSide_Intersecting:
-					m_partiallyVisibleResults.push_back(entry.renderable);
-					partiallyVisibleHash = CombineHash(partiallyVisibleHash, std::hash<const T*>()(entry.renderable));
-
-					forcedInvalidation = forcedInvalidation | entry.forceInvalidation;
-					entry.forceInvalidation = false;
-					break;
-
-				case IntersectionSide_Outside:
-					break;
-			}
-		}
-		
-		for (VolumeVisibilityEntry& entry : m_volumeTestList)
-		{
-			switch (frustum.Intersect(entry.volume))
-			{
-				case IntersectionSide_Inside:
-					m_fullyVisibleResults.push_back(entry.renderable);
-					fullyVisibleHash = CombineHash(fullyVisibleHash, std::hash<const T*>()(entry.renderable));
-
-					forcedInvalidation = forcedInvalidation | entry.forceInvalidation;
-					entry.forceInvalidation = false;
-					break;
-
-				case IntersectionSide_Intersecting:
-					m_partiallyVisibleResults.push_back(entry.renderable);
-					partiallyVisibleHash = CombineHash(partiallyVisibleHash, std::hash<const T*>()(entry.renderable));
-
-					forcedInvalidation = forcedInvalidation | entry.forceInvalidation;
-					entry.forceInvalidation = false;
-					break;
-
-				case IntersectionSide_Outside:
-					break;
-			}
-		}
+		CullEntries(frustum, m_spheres, m_sphereTestList, fullyVisibleHash, partiallyVisibleHash, forcedInvalidation);
+		CullEntries(frustum, m_volumes, m_volumeTestList, fullyVisibleHash, partiallyVisibleHash, forcedInvalidation);
 
 		if (forceInvalidation)
 			*forceInvalidation = forcedInvalidation;
@@ -171,7 +96,8 @@ namespace Nz
 	auto CullingList<T>::RegisterBoxTest(const T* renderable) -> BoxEntry
 	{
 		BoxEntry newEntry(this, m_boxTestList.size());
-		m_boxTestList.emplace_back(BoxVisibilityEntry{ Nz::Boxf(), &newEntry, renderable, false }); //< Address of entry will be updated when moving
+		m_boxes.push_back(Boxf::Zero());
+		m_boxTestList.emplace_back(BoxVisibilityEntry{ &newEntry, renderable, false }); //< Address of entry will be updated when moving
 
 		return newEntry;
 	}
@@ -179,7 +105,7 @@ namespace Nz
 	template<typename T>
 	auto CullingList<T>::RegisterNoTest(const T* renderable) -> NoTestEntry
 	{
-		NoTestEntry newEntry(this, m_volumeTestList.size());
+		NoTestEntry newEntry(this, m_noTestList.size());
 		m_noTestList.emplace_back(NoTestVisibilityEntry{&newEntry, renderable, false}); //< Address of entry will be updated when moving
 
 		return newEntry;
@@ -189,7 +115,8 @@ namespace Nz
 	auto CullingList<T>::RegisterSphereTest(const T* renderable) -> SphereEntry
 	{
 		SphereEntry newEntry(this, m_sphereTestList.size());
-		m_sphereTestList.emplace_back(SphereVisibilityEntry{Nz::Spheref(), &newEntry, renderable, false}); //< Address of entry will be updated when moving
+		m_spheres.push_back(Spheref::Zero());
+		m_sphereTestList.emplace_back(SphereVisibilityEntry{&newEntry, renderable, false}); //< Address of entry will be updated when moving
 
 		return newEntry;
 	}
@@ -198,15 +125,59 @@ namespace Nz
 	auto CullingList<T>::RegisterVolumeTest(const T* renderable) -> VolumeEntry
 	{
 		VolumeEntry newEntry(this, m_volumeTestList.size());
-		m_volumeTestList.emplace_back(VolumeVisibilityEntry{Nz::BoundingVolumef(), &newEntry, renderable, false}); //< Address of entry will be updated when moving
+		m_volumes.push_back(BoundingVolumef::Null());
+		m_volumeTestList.emplace_back(VolumeVisibilityEntry{&newEntry, renderable, false}); //< Address of entry will be updated when moving
 
 		return newEntry;
 	}
 
+	template<typename T>
+	template<typename Bounds, typename VisibilityEntry>
+	void CullingList<T>::CullEntries(const Frustumf& frustum, const std::vector<Bounds>& boundsList, std::vector<VisibilityEntry>& testList, std::size_t& fullyVisibleHash, std::size_t& partiallyVisibleHash, bool& forcedInvalidation)
+	{
+		assert(boundsList.size() == testList.size());
+
+		// Intersection tests only read the bounds array and can run concurrently, results are then gathered in order to keep them (and the hash) stable
+		std::size_t entryCount = boundsList.size();
+		m_intersectionResults.resize(entryCount);
+
+		ParallelForRange(0, entryCount, [&](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t i = begin; i < end; ++i)
+				m_intersectionResults[i] = static_cast<UInt8>(frustum.Intersect(boundsList[i]));
+		}, ComputeGrainSize(entryCount, 1024));
+
+		for (std::size_t i = 0; i < entryCount; ++i)
+		{
+			VisibilityEntry& entry = testList[i];
+			switch (static_cast<IntersectionSide>(m_intersectionResults[i]))
+			{
+				case IntersectionSide_Inside:
+					m_fullyVisibleResults.push_back(entry.renderable);
+					fullyVisibleHash = fullyVisibleHash * 23 + std::hash<const T*>()(entry.renderable);
+
+					forcedInvalidation = forcedInvalidation | entry.forceInvalidation;
+					entry.forceInvalidation = false;
+					break;
+
+				case IntersectionSide_Intersecting:
+					m_partiallyVisibleResults.push_back(entry.renderable);
+					partiallyVisibleHash = partiallyVisibleHash * 23 + std::hash<const T*>()(entry.renderable);
+
+					forcedInvalidation = forcedInvalidation | entry.forceInvalidation;
+					entry.forceInvalidation = false;
+					break;
+
+				case IntersectionSide_Outside:
+					break;
+			}
+		}
+	}
+
 	template<typename T>
 	inline void CullingList<T>::NotifyBoxUpdate(std::size_t index, const Boxf& box)
 	{
-		m_boxTestList[index].box = box;
+		m_boxes[index] = box;
 	}
 
 	template<typename T>
@@ -300,6 +271,9 @@ namespace Nz
 		{
 			case CullTest::Box:
 			{
+				m_boxes[index] = m_boxes.back();
+				m_boxes.pop_back();
+
 				m_boxTestList[index] = std::move(m_boxTestList.back());
 				m_boxTestList[index].entry->UpdateIndex(index);
 				m_boxTestList.pop_back();
@@ -316,6 +290,9 @@ namespace Nz
 
 			case CullTest::Sphere:
 			{
+				m_spheres[index] = m_spheres.back();
+				m_spheres.pop_back();
+
 				m_sphereTestList[index] = std::move(m_sphereTestList.back());
 				m_sphereTestList[index].entry->UpdateIndex(index);
 				m_sphereTestList.pop_back();
@@ -324,6 +301,9 @@ namespace Nz
 
 			case CullTest::Volume:
 			{
+				m_volumes[index] = m_volumes.back();
+				m_volumes.pop_back();
+
 				m_volumeTestList[index] = std::move(m_volumeTestList.back());
 				m_volumeTestList[index].entry->UpdateIndex(index);
 				m_volumeTestList.pop_back();
@@ -339,13 +319,13 @@ namespace Nz
 	template<typename T>
 	void CullingList<T>::NotifySphereUpdate(std::size_t index, const Spheref& sphere)
 	{
-		m_sphereTestList[index].sphere = sphere;
+		m_spheres[index] = sphere;
 	}
 
 	template<typename T>
 	void CullingList<T>::NotifyVolumeUpdate(std::size_t index, const BoundingVolumef& boundingVolume)
 	{
-		m_volumeTestList[index].volume = boundingVolume;
+		m_volumes[index] = boundingVolume;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -410,6 +390,13 @@ namespace Nz
 	template<CullTest Type>
 	typename CullingList<T>::template Entry<Type>& CullingList<T>::Entry<Type>::operator=(Entry&& entry)
 	{
+		if (this == &entry)
+			return *this;
+
+		// Release our current entry first, this may move the other entry (and update its index)
+		if (m_parent)
+			m_parent->NotifyRelease(Type, m_index);
+
 		m_index = entry.m_index;
 		m_parent = entry.m_parent;
 		if (m_parent)
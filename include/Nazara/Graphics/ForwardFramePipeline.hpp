@@ -10,24 +10,34 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Graphics/BakedFrameGraph.hpp>
 #include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Graphics/CullingList.hpp>
 #include <Nazara/Graphics/FramePipeline.hpp>
 #include <Nazara/Graphics/InstancedRenderable.hpp>
 #include <Nazara/Graphics/Material.hpp>
+#include <Nazara/Graphics/RenderElement.hpp>
+#include <Nazara/Graphics/RenderQueue.hpp>
 #include <Nazara/Renderer/ShaderBinding.hpp>
 #include <optional>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace Nz
 {
+	class ViewerInstance;
+
 	class NAZARA_GRAPHICS_API ForwardFramePipeline : public FramePipeline
 	{
 		public:
+			struct RenderStats;
+
 			ForwardFramePipeline();
 			ForwardFramePipeline(const ForwardFramePipeline&) = delete;
 			ForwardFramePipeline(ForwardFramePipeline&&) = delete;
 			~ForwardFramePipeline() = default;
 
+			inline const RenderStats& GetRenderStats() const;
+
 			void InvalidateViewer(AbstractViewer* viewerInstance) override;
 			void InvalidateWorldInstance(WorldInstance* worldInstance) override;
 
@@ -42,10 +52,35 @@ namespace Nz
 			ForwardFramePipeline& operator=(const ForwardFramePipeline&) = delete;
 			ForwardFramePipeline& operator=(ForwardFramePipeline&&) = delete;
 
+			static constexpr std::size_t MinInstanceCount = 2; //< Minimum number of identical draws merged in an instanced draw
+
+			struct RenderStats
+			{
+				std::size_t drawCount = 0;
+				std::size_t indexBufferBindCount = 0;
+				std::size_t instancedDrawCount = 0;
+				std::size_t materialBindCount = 0;
+				std::size_t pipelineBindCount = 0;
+				std::size_t vertexBufferBindCount = 0;
+				std::size_t worldBindCount = 0;
+			};
+
 		private:
+			struct RenderableData;
+			struct ViewerData;
+
 			BakedFrameGraph BuildFrameGraph();
+			void BuildRenderQueue(const ViewerInstance& viewerInstance, ViewerData& viewerData);
 			void RegisterMaterial(Material* material);
 			void UnregisterMaterial(Material* material);
+			static void UpdateRenderableBox(RenderableData& renderableData);
+
+			struct DrawCall
+			{
+				const RenderElement* element;
+				std::size_t firstInstance;
+				std::size_t instanceCount; //< 0 for non-instanced draws
+			};
 
 			struct MaterialData
 			{
@@ -56,6 +91,12 @@ namespace Nz
 
 			struct RenderableData
 			{
+				CullingList<RenderableData>::BoxEntry cullingEntry;
+				Boxf worldBox;
+				const InstancedRenderable* renderable;
+				WorldInstance* worldInstance;
+
+				NazaraSlot(InstancedRenderable, OnAABBUpdate, onAABBUpdate);
 				NazaraSlot(InstancedRenderable, OnMaterialInvalidated, onMaterialInvalidated);
 			};
 
@@ -63,17 +104,31 @@ namespace Nz
 			{
 				std::size_t colorAttachment;
 				std::size_t depthStencilAttachment;
+				std::size_t visibilityHash = 0;
+				std::shared_ptr<AbstractBuffer> instanceBuffer;
+				std::vector<const WorldInstance*> instancedWorldInstances;
+				std::vector<DrawCall> drawCalls;
+				RenderQueue<RenderElement> renderQueue;
+				RenderStats renderStats;
 				ShaderBindingPtr blitShaderBinding;
+				bool rebuildForwardPass = true;
+				bool updateInstanceBuffer = false;
 			};
 
 			std::size_t m_forwardPass;
+			std::unordered_map<const void*, UInt64> m_sortKeyIndices;
+			std::vector<const RenderElement*> m_sortedElements;
+			std::vector<RenderElement> m_renderElements;
 			std::unordered_map<AbstractViewer*, ViewerData> m_viewers;
 			std::unordered_map<Material*, MaterialData> m_materials;
+			CullingList<RenderableData> m_cullingList; //< must outlive renderables entries
 			std::unordered_map<WorldInstance*, std::unordered_map<const InstancedRenderable*, RenderableData>> m_renderables;
 			std::unordered_set<AbstractViewer*> m_invalidatedViewerInstances;
 			std::unordered_set<Material*> m_invalidatedMaterials;
 			std::unordered_set<WorldInstance*> m_invalidatedWorldInstances;
 			BakedFrameGraph m_bakedFrameGraph;
+			RenderStats m_renderStats;
+			UInt64 m_asyncShaderCompilationCount;
 			bool m_rebuildFrameGraph;
 			bool m_rebuildForwardPass;
 	};
@@ -7,6 +7,10 @@
 
 namespace Nz
 {
+	inline auto ForwardFramePipeline::GetRenderStats() const -> const RenderStats&
+	{
+		return m_renderStats;
+	}
 }
 
 #include <Nazara/Graphics/DebugOff.hpp>
@@ -23,6 +23,7 @@ namespace Nz
 			GraphicalMesh(GraphicalMesh&&) noexcept = default;
 			~GraphicalMesh() = default;
 
+			inline const Boxf& GetAABB() const;
 			inline const std::shared_ptr<AbstractBuffer>& GetIndexBuffer(std::size_t subMesh) const;
 			inline std::size_t GetIndexCount(std::size_t subMesh) const;
 			inline const std::shared_ptr<AbstractBuffer>& GetVertexBuffer(std::size_t subMesh) const;
@@ -42,6 +43,7 @@ namespace Nz
 			};
 
 			std::vector<GraphicalSubMesh> m_subMeshes;
+			Boxf m_aabb;
 	};
 }
 
@@ -8,6 +8,11 @@
 
 namespace Nz
 {
+	inline const Boxf& GraphicalMesh::GetAABB() const
+	{
+		return m_aabb;
+	}
+
 	inline const std::shared_ptr<AbstractBuffer>& GraphicalMesh::GetIndexBuffer(std::size_t subMesh) const
 	{
 		assert(subMesh < m_subMeshes.size());
@@ -9,10 +9,13 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Graphics/InstanceDataArena.hpp>
+#include <Nazara/Graphics/ShaderModuleCache.hpp>
 #include <Nazara/Graphics/TextureSamplerCache.hpp>
 #include <Nazara/Renderer/Renderer.hpp>
 #include <Nazara/Renderer/RenderDevice.hpp>
 #include <Nazara/Renderer/RenderPipelineLayout.hpp>
+#include <filesystem>
 #include <optional>
 
 namespace Nz
@@ -35,14 +38,17 @@ namespace Nz
 			inline const std::shared_ptr<RenderPipelineLayout>& GetBlitPipelineLayout() const;
 			inline const std::shared_ptr<AbstractBuffer>& GetFullscreenVertexBuffer() const;
 			inline const std::shared_ptr<VertexDeclaration>& GetFullscreenVertexDeclaration() const;
+			inline InstanceDataArena& GetInstanceDataArena();
 			inline PixelFormat GetPreferredDepthStencilFormat() const;
 			inline const std::shared_ptr<RenderPipelineLayout>& GetReferencePipelineLayout() const;
 			inline const std::shared_ptr<RenderDevice>& GetRenderDevice() const;
 			inline TextureSamplerCache& GetSamplerCache();
+			inline ShaderModuleCache& GetShaderModuleCache();
 
 			struct Config
 			{
 				RenderDeviceFeatures forceDisableFeatures;
+				std::filesystem::path shaderCacheDirectory; //< Generated shader code is stored in this directory, leave empty to disable
 				bool useDedicatedRenderDevice = true;
 			};
 
@@ -58,6 +64,8 @@ namespace Nz
 			void BuildFullscreenVertexBuffer();
 			void SelectDepthStencilFormats();
 
+			std::optional<InstanceDataArena> m_instanceDataArena;
+			std::optional<ShaderModuleCache> m_shaderModuleCache;
 			std::optional<TextureSamplerCache> m_samplerCache;
 			std::shared_ptr<AbstractBuffer> m_fullscreenVertexBuffer;
 			std::shared_ptr<RenderDevice> m_renderDevice;
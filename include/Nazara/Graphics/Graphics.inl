@@ -27,6 +27,11 @@ namespace Nz
 		return m_fullscreenVertexDeclaration;
 	}
 
+	inline InstanceDataArena& Graphics::GetInstanceDataArena()
+	{
+		return *m_instanceDataArena;
+	}
+
 	inline PixelFormat Graphics::GetPreferredDepthStencilFormat() const
 	{
 		return m_preferredDepthStencilFormat;
@@ -46,6 +51,11 @@ namespace Nz
 	{
 		return *m_samplerCache;
 	}
+
+	inline ShaderModuleCache& Graphics::GetShaderModuleCache()
+	{
+		return *m_shaderModuleCache;
+	}
 }
 
 #include <Nazara/Graphics/DebugOff.hpp>
@@ -0,0 +1,77 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_INSTANCEDATAARENA_HPP
+#define NAZARA_INSTANCEDATAARENA_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Bitset.hpp>
+#include <Nazara/Graphics/Config.hpp>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	class AbstractBuffer;
+	class CommandBufferBuilder;
+	class RenderDevice;
+	class UploadPool;
+
+	class NAZARA_GRAPHICS_API InstanceDataArena
+	{
+		public:
+			InstanceDataArena(std::shared_ptr<RenderDevice> device, UInt64 dataSize, std::size_t slotPerPage = DefaultSlotPerPage);
+			InstanceDataArena(const InstanceDataArena&) = delete;
+			InstanceDataArena(InstanceDataArena&&) = delete;
+			~InstanceDataArena() = default;
+
+			std::size_t Allocate();
+
+			void Free(std::size_t slotIndex);
+
+			inline const std::shared_ptr<AbstractBuffer>& GetBuffer(std::size_t slotIndex) const;
+			inline UInt64 GetDataSize() const;
+			inline UInt64 GetOffset(std::size_t slotIndex) const;
+
+			inline void* Update(std::size_t slotIndex);
+			void UpdateBuffers(UploadPool& uploadPool, CommandBufferBuilder& builder);
+
+			InstanceDataArena& operator=(const InstanceDataArena&) = delete;
+			InstanceDataArena& operator=(InstanceDataArena&&) = delete;
+
+			static constexpr std::size_t DefaultSlotPerPage = 256;
+			static constexpr std::size_t MaxCoalescedGap = 4; //< Clean slots copied along dirty ones to save a copy command
+
+		private:
+			void AllocatePage();
+
+			struct Page
+			{
+				std::shared_ptr<AbstractBuffer> buffer;
+				std::vector<UInt8> data;
+				Bitset<UInt64> dirtySlots;
+			};
+
+			struct SlotRange
+			{
+				std::size_t first;
+				std::size_t count;
+			};
+
+			std::shared_ptr<RenderDevice> m_device;
+			std::size_t m_slotPerPage;
+			std::vector<Page> m_pages;
+			std::vector<SlotRange> m_dirtyRanges;
+			std::vector<std::size_t> m_freeSlots;
+			Bitset<UInt64> m_dirtyPages;
+			UInt64 m_dataSize;
+			UInt64 m_slotStride;
+	};
+}
+
+#include <Nazara/Graphics/InstanceDataArena.inl>
+
+#endif // NAZARA_INSTANCEDATAARENA_HPP
@@ -0,0 +1,40 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/InstanceDataArena.hpp>
+#include <cassert>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	inline const std::shared_ptr<AbstractBuffer>& InstanceDataArena::GetBuffer(std::size_t slotIndex) const
+	{
+		assert(slotIndex / m_slotPerPage < m_pages.size());
+		return m_pages[slotIndex / m_slotPerPage].buffer;
+	}
+
+	inline UInt64 InstanceDataArena::GetDataSize() const
+	{
+		return m_dataSize;
+	}
+
+	inline UInt64 InstanceDataArena::GetOffset(std::size_t slotIndex) const
+	{
+		return (slotIndex % m_slotPerPage) * m_slotStride;
+	}
+
+	inline void* InstanceDataArena::Update(std::size_t slotIndex)
+	{
+		std::size_t pageIndex = slotIndex / m_slotPerPage;
+		assert(pageIndex < m_pages.size());
+
+		Page& page = m_pages[pageIndex];
+		page.dirtySlots.Set(slotIndex % m_slotPerPage, true);
+		m_dirtyPages.UnboundedSet(pageIndex, true);
+
+		return &page.data[GetOffset(slotIndex)];
+	}
+}
+
+#include <Nazara/Graphics/DebugOff.hpp>
@@ -10,31 +10,44 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Signal.hpp>
 #include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Math/Box.hpp>
 #include <memory>
+#include <vector>
 
 namespace Nz
 {
 	class CommandBufferBuilder;
 	class Material;
+	struct RenderElement;
 	class WorldInstance;
 
 	class NAZARA_GRAPHICS_API InstancedRenderable
 	{
 		public:
-			InstancedRenderable() = default;
+			inline InstancedRenderable();
 			InstancedRenderable(const InstancedRenderable&) = delete;
 			InstancedRenderable(InstancedRenderable&&) noexcept = default;
 			~InstancedRenderable();
 
+			virtual void BuildElements(std::vector<RenderElement>& elements) const = 0;
+
 			virtual void Draw(CommandBufferBuilder& commandBuffer) const = 0;
 
+			inline const Boxf& GetAABB() const;
 			virtual const std::shared_ptr<Material>& GetMaterial(std::size_t i) const = 0;
 			virtual std::size_t GetMaterialCount() const = 0;
 
 			InstancedRenderable& operator=(const InstancedRenderable&) = delete;
 			InstancedRenderable& operator=(InstancedRenderable&&) noexcept = default;
 
+			NazaraSignal(OnAABBUpdate, InstancedRenderable* /*instancedRenderable*/, const Boxf& /*aabb*/);
 			NazaraSignal(OnMaterialInvalidated, InstancedRenderable* /*instancedRenderable*/, std::size_t /*materialIndex*/, const std::shared_ptr<Material>& /*newMaterial*/);
+
+		protected:
+			inline void UpdateAABB(const Boxf& aabb);
+
+		private:
+			Boxf m_aabb;
 	};
 }
 
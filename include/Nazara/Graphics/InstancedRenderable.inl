@@ -7,6 +7,22 @@
 
 namespace Nz
 {
+	inline InstancedRenderable::InstancedRenderable() :
+	m_aabb(Boxf::Zero())
+	{
+	}
+
+	inline const Boxf& InstancedRenderable::GetAABB() const
+	{
+		return m_aabb;
+	}
+
+	inline void InstancedRenderable::UpdateAABB(const Boxf& aabb)
+	{
+		m_aabb = aabb;
+
+		OnAABBUpdate(this, m_aabb);
+	}
 }
 
 #include <Nazara/Graphics/DebugOff.hpp>
@@ -14,6 +14,7 @@
 #include <Nazara/Renderer/RenderPipeline.hpp>
 #include <array>
 #include <memory>
+#include <optional>
 
 namespace Nz
 {
@@ -51,15 +52,23 @@ namespace Nz
 			MaterialPipeline& operator=(MaterialPipeline&&) = delete;
 
 			inline const MaterialPipelineInfo& GetInfo() const;
+			MaterialPipeline* GetInstancedPipeline() const;
 			const std::shared_ptr<RenderPipeline>& GetRenderPipeline(const std::vector<RenderPipelineInfo::VertexBufferData>& vertexBuffers) const;
 
+			void Prewarm() const;
+
+			RenderPipeline* TryGetRenderPipeline(const std::vector<RenderPipelineInfo::VertexBufferData>& vertexBuffers) const;
+
 			static const std::shared_ptr<MaterialPipeline>& Get(const MaterialPipelineInfo& pipelineInfo);
 
 		private:
+			const std::shared_ptr<RenderPipeline>* FindRenderPipeline(const std::vector<RenderPipelineInfo::VertexBufferData>& vertexBuffers) const;
+
 			static bool Initialize();
 			static void Uninitialize();
 
 			mutable std::vector<std::shared_ptr<RenderPipeline>> m_renderPipelines;
+			mutable std::optional<MaterialPipeline*> m_instancedPipeline;
 			MaterialPipelineInfo m_pipelineInfo;
 
 			using PipelineCache = std::unordered_map<MaterialPipelineInfo, std::shared_ptr<MaterialPipeline>>;
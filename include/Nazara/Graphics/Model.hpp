@@ -28,6 +28,8 @@ namespace Nz
 			Model(Model&&) noexcept = default;
 			~Model() = default;
 
+			void BuildElements(std::vector<RenderElement>& elements) const override;
+
 			void Draw(CommandBufferBuilder& commandBuffer) const override;
 
 			const std::shared_ptr<AbstractBuffer>& GetIndexBuffer(std::size_t subMeshIndex) const;
@@ -47,6 +49,7 @@ namespace Nz
 			struct SubMeshData
 			{
 				std::shared_ptr<Material> material;
+				std::vector<RenderPipelineInfo::VertexBufferData> instancedVertexBufferData;
 				std::vector<RenderPipelineInfo::VertexBufferData> vertexBufferData;
 			};
 
@@ -9,6 +9,7 @@
 
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Graphics/MaterialSettings.hpp>
+#include <Nazara/Utility/VertexDeclaration.hpp>
 #include <array>
 
 namespace Nz
@@ -44,6 +45,16 @@ namespace Nz
 		static PredefinedInstanceData GetOffsets();
 	};
 
+	// Per-instance vertex attributes used by instanced rendering (the world matrix columns)
+	struct NAZARA_GRAPHICS_API PredefinedInstancingData
+	{
+		std::size_t totalSize;
+		std::size_t worldMatrixOffset;
+
+		static PredefinedInstancingData GetOffsets();
+		static const std::shared_ptr<VertexDeclaration>& GetVertexDeclaration();
+	};
+
 	struct NAZARA_GRAPHICS_API PredefinedViewerData
 	{
 		std::size_t eyePositionOffset;
@@ -0,0 +1,34 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_RENDERELEMENT_HPP
+#define NAZARA_RENDERELEMENT_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Graphics/Config.hpp>
+
+namespace Nz
+{
+	class AbstractBuffer;
+	class RenderPipeline;
+	class ShaderBinding;
+	class WorldInstance;
+
+	// Everything required to record a single indexed draw, without any ownership
+	struct RenderElement
+	{
+		AbstractBuffer* indexBuffer = nullptr;
+		AbstractBuffer* vertexBuffer = nullptr;
+		const RenderPipeline* instancedRenderPipeline = nullptr; //< Pipeline reading world matrices from a per-instance vertex buffer (if supported)
+		const RenderPipeline* renderPipeline = nullptr;
+		const ShaderBinding* materialBinding = nullptr;
+		const WorldInstance* worldInstance = nullptr;
+		float depth = 0.f;
+		UInt32 indexCount = 0;
+	};
+}
+
+#endif // NAZARA_RENDERELEMENT_HPP
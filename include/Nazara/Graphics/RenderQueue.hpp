@@ -8,12 +8,13 @@
 #define NAZARA_RENDERQUEUE_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Graphics/Config.hpp>
 #include <memory>
 #include <vector>
 
 namespace Nz
 {
-	class RenderQueueInternal
+	class NAZARA_GRAPHICS_API RenderQueueInternal
 	{
 		public:
 			using Index = Nz::UInt64;
@@ -32,6 +33,7 @@ namespace Nz
 			void Sort();
 
 			std::vector<RenderDataPair> m_orderedRenderQueue;
+			std::vector<RenderDataPair> m_sortBuffer;
 	};
 
 	template<typename RenderData>
@@ -107,7 +107,7 @@ namespace Nz
 	template<typename RenderData>
 	typename RenderQueue<RenderData>::const_iterator RenderQueue<RenderData>::const_iterator::operator++(int)
 	{
-		return iterator(m_queue, m_nextDataId++);
+		return const_iterator(m_queue, m_nextDataId++);
 	}
 
 	template<typename RenderData>
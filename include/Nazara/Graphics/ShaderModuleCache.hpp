@@ -0,0 +1,72 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_SHADERMODULECACHE_HPP
+#define NAZARA_SHADERMODULECACHE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Graphics/Config.hpp>
+#include <Nazara/Renderer/Enums.hpp>
+#include <Nazara/Shader/ShaderWriter.hpp>
+#include <Nazara/Shader/Ast/Nodes.hpp>
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	class RenderDevice;
+	class ShaderModule;
+
+	class NAZARA_GRAPHICS_API ShaderModuleCache
+	{
+		public:
+			struct Stats;
+
+			ShaderModuleCache(std::shared_ptr<RenderDevice> device, RenderAPI renderAPI, std::filesystem::path cacheDirectory);
+			ShaderModuleCache(const ShaderModuleCache&) = delete;
+			ShaderModuleCache(ShaderModuleCache&&) = delete;
+			~ShaderModuleCache() = default;
+
+			std::shared_ptr<ShaderModule> Get(ShaderStageTypeFlags shaderStages, ShaderAst::Statement& shaderAst, const ByteArray& astHash, const ShaderWriter::States& states);
+
+			inline const std::filesystem::path& GetCacheDirectory() const;
+			inline Stats GetStats() const;
+
+			inline bool IsEnabled() const;
+
+			ShaderModuleCache& operator=(const ShaderModuleCache&) = delete;
+			ShaderModuleCache& operator=(ShaderModuleCache&&) = delete;
+
+			static ByteArray ComputeAstHash(ShaderAst::StatementPtr& shaderAst);
+
+			static constexpr UInt32 WriterVersion = 1; //< Has to be increased when shader writers output changes for the same AST
+
+			struct Stats
+			{
+				UInt64 hitCount;
+				UInt64 missCount;
+			};
+
+		private:
+			std::filesystem::path ComputeCachePath(ShaderStageTypeFlags shaderStages, const ByteArray& astHash, const ShaderWriter::States& states) const;
+			bool LoadCode(const std::filesystem::path& cachePath, std::vector<UInt32>& code) const;
+			void StoreCode(const std::filesystem::path& cachePath, const std::vector<UInt32>& code) const;
+
+			std::atomic<UInt64> m_hitCount;
+			std::atomic<UInt64> m_missCount;
+			std::filesystem::path m_cacheDirectory;
+			std::shared_ptr<RenderDevice> m_device;
+			RenderAPI m_renderAPI;
+			bool m_isEnabled;
+	};
+}
+
+#include <Nazara/Graphics/ShaderModuleCache.inl>
+
+#endif // NAZARA_SHADERMODULECACHE_HPP
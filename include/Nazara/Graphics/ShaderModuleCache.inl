@@ -0,0 +1,30 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/ShaderModuleCache.hpp>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	inline const std::filesystem::path& ShaderModuleCache::GetCacheDirectory() const
+	{
+		return m_cacheDirectory;
+	}
+
+	inline auto ShaderModuleCache::GetStats() const -> Stats
+	{
+		Stats stats;
+		stats.hitCount = m_hitCount.load(std::memory_order_relaxed);
+		stats.missCount = m_missCount.load(std::memory_order_relaxed);
+
+		return stats;
+	}
+
+	inline bool ShaderModuleCache::IsEnabled() const
+	{
+		return m_isEnabled;
+	}
+}
+
+#include <Nazara/Graphics/DebugOff.hpp>
@@ -12,9 +12,11 @@
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Graphics/Components/GraphicsComponent.hpp>
 #include <Nazara/Utility/Node.hpp>
+#include <atomic>
 #include <memory>
-#include <set>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace Nz
 {
@@ -44,26 +46,38 @@ namespace Nz
 
 			struct CameraEntity
 			{
+				entt::entity entity;
+				std::atomic_bool invalidated = false;
+				std::size_t invalidationIndex;
+
 				NazaraSlot(Node, OnNodeInvalidation, onNodeInvalidation);
 			};
 
 			struct GraphicsEntity
 			{
+				entt::entity entity;
+				std::atomic_bool invalidated = false;
+				std::size_t invalidationIndex;
+
 				NazaraSlot(GraphicsComponent, OnRenderableAttached, onRenderableAttached);
 				NazaraSlot(GraphicsComponent, OnRenderableDetach, onRenderableDetach);
 				NazaraSlot(Node, OnNodeInvalidation, onNodeInvalidation);
 			};
 
+			template<typename T> static void Invalidate(T& entityData, std::vector<T*>& invalidatedEntities, std::mutex& mutex);
+			template<typename T> static void RemoveInvalidated(T& entityData, std::vector<T*>& invalidatedEntities);
+
 			entt::connection m_cameraDestroyConnection;
 			entt::connection m_graphicsDestroyConnection;
 			entt::connection m_nodeDestroyConnection;
 			entt::observer m_cameraConstructObserver;
 			entt::observer m_graphicsConstructObserver;
-			std::set<entt::entity> m_invalidatedCameraNode;
-			std::set<entt::entity> m_invalidatedWorldNode;
+			std::mutex m_invalidationMutex;
 			std::unique_ptr<FramePipeline> m_pipeline;
 			std::unordered_map<entt::entity, CameraEntity> m_cameraEntities;
 			std::unordered_map<entt::entity, GraphicsEntity> m_graphicsEntities;
+			std::vector<CameraEntity*> m_invalidatedCameraNode;
+			std::vector<GraphicsEntity*> m_invalidatedWorldNode;
 	};
 }
 
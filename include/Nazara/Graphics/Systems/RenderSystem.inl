@@ -3,10 +3,33 @@
 // For conditions of distribution and use, see copyright notice in Prerequisites.hpp
 
 #include <Nazara/Graphics/Systems/RenderSystem.hpp>
+#include <cassert>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
+	template<typename T>
+	void RenderSystem::Invalidate(T& entityData, std::vector<T*>& invalidatedEntities, std::mutex& mutex)
+	{
+		// Node invalidation may happen from multiple threads (see Physics3DSystem::EnableParallelSync), only lock the first time
+		if (entityData.invalidated.exchange(true, std::memory_order_relaxed))
+			return;
+
+		std::lock_guard<std::mutex> lock(mutex);
+		entityData.invalidationIndex = invalidatedEntities.size();
+		invalidatedEntities.push_back(&entityData);
+	}
+
+	template<typename T>
+	void RenderSystem::RemoveInvalidated(T& entityData, std::vector<T*>& invalidatedEntities)
+	{
+		if (!entityData.invalidated.load(std::memory_order_relaxed))
+			return;
+
+		// Keep indices valid, empty entries are skipped on update
+		assert(invalidatedEntities[entityData.invalidationIndex] == &entityData);
+		invalidatedEntities[entityData.invalidationIndex] = nullptr;
+	}
 }
 
 #include <Nazara/Graphics/DebugOff.hpp>
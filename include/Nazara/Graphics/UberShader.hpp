@@ -9,9 +9,16 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Bitset.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Shader/Ast/Nodes.hpp>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace Nz
 {
@@ -21,7 +28,9 @@ namespace Nz
 	{
 		public:
 			UberShader(ShaderStageTypeFlags shaderStages, const ShaderAst::StatementPtr& shaderAst);
-			~UberShader() = default;
+			UberShader(const UberShader&) = delete;
+			UberShader(UberShader&&) = delete;
+			~UberShader();
 
 			UInt64 GetOptionFlagByName(const std::string& optionName) const;
 
@@ -29,12 +38,37 @@ namespace Nz
 
 			const std::shared_ptr<ShaderModule>& Get(UInt64 combination);
 
+			bool IsReady(UInt64 combination);
+
+			void Prewarm(UInt64 combination);
+			void Prewarm(const std::vector<UInt64>& combinations);
+
+			UberShader& operator=(const UberShader&) = delete;
+			UberShader& operator=(UberShader&&) = delete;
+
+			static UInt64 GetAsyncCompilationCount();
+
 		private:
-			std::unordered_map<UInt64 /*combination*/, std::shared_ptr<ShaderModule>> m_combinations;
+			struct Combination
+			{
+				std::exception_ptr error;
+				std::shared_ptr<ShaderModule> shaderModule;
+				TaskScheduler::Counter compilationCounter;
+				bool isReady = false;
+			};
+
+			std::shared_ptr<ShaderModule> Compile(UInt64 combination);
+			Combination& StartCompilation(UInt64 combination);
+
+			std::mutex m_mutex;
+			std::unordered_map<UInt64 /*combination*/, std::unique_ptr<Combination>> m_combinations;
 			std::unordered_map<std::string, std::size_t> m_optionIndexByName;
+			ByteArray m_shaderAstHash;
 			ShaderAst::StatementPtr m_shaderAst;
 			ShaderStageTypeFlags m_shaderStages;
 			UInt64 m_combinationMask;
+
+			static std::atomic<UInt64> s_asyncCompilationCount;
 	};
 }
 
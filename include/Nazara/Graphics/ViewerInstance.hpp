@@ -30,7 +30,10 @@ namespace Nz
 
 			inline std::shared_ptr<AbstractBuffer>& GetInstanceBuffer();
 			inline const std::shared_ptr<AbstractBuffer>& GetInstanceBuffer() const;
+			inline const Matrix4f& GetInvViewMatrix() const;
+			inline const Matrix4f& GetProjectionMatrix() const;
 			inline ShaderBinding& GetShaderBinding();
+			inline const Matrix4f& GetViewMatrix() const;
 
 			void UpdateBuffers(UploadPool& uploadPool, CommandBufferBuilder& builder);
 			inline void UpdateProjectionMatrix(const Matrix4f& projectionMatrix);
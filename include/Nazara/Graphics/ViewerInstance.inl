@@ -18,11 +18,26 @@ namespace Nz
 		return m_viewerDataBuffer;
 	}
 
+	inline const Matrix4f& ViewerInstance::GetInvViewMatrix() const
+	{
+		return m_invViewMatrix;
+	}
+
+	inline const Matrix4f& ViewerInstance::GetProjectionMatrix() const
+	{
+		return m_projectionMatrix;
+	}
+
 	inline ShaderBinding& ViewerInstance::GetShaderBinding()
 	{
 		return *m_shaderBinding;
 	}
 
+	inline const Matrix4f& ViewerInstance::GetViewMatrix() const
+	{
+		return m_viewMatrix;
+	}
+
 	inline void ViewerInstance::UpdateProjectionMatrix(const Matrix4f& projectionMatrix)
 	{
 		m_projectionMatrix = projectionMatrix;
@@ -8,6 +8,7 @@
 #define NAZARA_MODELINSTANCE_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/MovablePtr.hpp>
 #include <Nazara/Math/Matrix4.hpp>
 #include <Nazara/Graphics/Config.hpp>
 #include <Nazara/Renderer/ShaderBinding.hpp>
@@ -17,6 +18,7 @@ namespace Nz
 {
 	class AbstractBuffer;
 	class CommandBufferBuilder;
+	class InstanceDataArena;
 	class MaterialSettings;
 	class UploadPool;
 
@@ -26,25 +28,29 @@ namespace Nz
 			WorldInstance();
 			WorldInstance(const WorldInstance&) = delete;
 			WorldInstance(WorldInstance&&) noexcept = default;
-			~WorldInstance() = default;
+			~WorldInstance();
 
-			inline std::shared_ptr<AbstractBuffer>& GetInstanceBuffer();
-			inline const std::shared_ptr<AbstractBuffer>& GetInstanceBuffer() const;
+			const std::shared_ptr<AbstractBuffer>& GetInstanceBuffer() const;
+			UInt64 GetInstanceBufferOffset() const;
+			inline const Matrix4f& GetInvWorldMatrix() const;
 			inline ShaderBinding& GetShaderBinding();
 			inline const ShaderBinding& GetShaderBinding() const;
+			inline const Matrix4f& GetWorldMatrix() const;
 
 			void UpdateBuffers(UploadPool& uploadPool, CommandBufferBuilder& builder);
+			void UpdateInstanceData();
 			inline void UpdateWorldMatrix(const Matrix4f& worldMatrix);
 			inline void UpdateWorldMatrix(const Matrix4f& worldMatrix, const Matrix4f& invWorldMatrix);
 
 			WorldInstance& operator=(const WorldInstance&) = delete;
-			WorldInstance& operator=(WorldInstance&&) noexcept = default;
+			WorldInstance& operator=(WorldInstance&&) noexcept;
 
 		private:
-			std::shared_ptr<AbstractBuffer> m_instanceDataBuffer;
+			MovablePtr<InstanceDataArena> m_instanceDataArena;
 			Matrix4f m_invWorldMatrix;
 			Matrix4f m_worldMatrix;
 			ShaderBindingPtr m_shaderBinding;
+			std::size_t m_instanceDataSlot;
 			bool m_dataInvalided;
 	};
 }
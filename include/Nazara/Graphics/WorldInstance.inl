@@ -8,14 +8,9 @@
 
 namespace Nz
 {
-	inline std::shared_ptr<AbstractBuffer>& WorldInstance::GetInstanceBuffer()
+	inline const Matrix4f& WorldInstance::GetInvWorldMatrix() const
 	{
-		return m_instanceDataBuffer;
-	}
-
-	inline const std::shared_ptr<AbstractBuffer>& WorldInstance::GetInstanceBuffer() const
-	{
-		return m_instanceDataBuffer;
+		return m_invWorldMatrix;
 	}
 
 	inline ShaderBinding& WorldInstance::GetShaderBinding()
@@ -28,6 +23,11 @@ namespace Nz
 		return *m_shaderBinding;
 	}
 
+	inline const Matrix4f& WorldInstance::GetWorldMatrix() const
+	{
+		return m_worldMatrix;
+	}
+
 	inline void WorldInstance::UpdateWorldMatrix(const Matrix4f& worldMatrix)
 	{
 		m_worldMatrix = worldMatrix;
@@ -0,0 +1,136 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_ENETCOMMANDPOOL_HPP
+#define NAZARA_ENETCOMMANDPOOL_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/MovablePtr.hpp>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Nz
+{
+	template<typename T> class ENetCommandList;
+
+	struct ENetCommandLink
+	{
+		ENetCommandLink* prev;
+		ENetCommandLink* next;
+	};
+
+	template<typename T>
+	struct ENetCommandNode : ENetCommandLink
+	{
+		inline T& GetValue();
+
+		std::aligned_storage_t<sizeof(T), alignof(T)> storage;
+	};
+
+	// Recycles command nodes of every peer of a host, so that queuing commands doesn't hit the heap in the steady state
+	template<typename T>
+	class ENetCommandPool
+	{
+		friend ENetCommandList<T>;
+
+		public:
+			ENetCommandPool() = default;
+			ENetCommandPool(const ENetCommandPool&) = delete;
+			ENetCommandPool(ENetCommandPool&&) noexcept = default;
+			~ENetCommandPool() = default;
+
+			inline std::size_t GetNodeCount() const;
+
+			ENetCommandPool& operator=(const ENetCommandPool&) = delete;
+			ENetCommandPool& operator=(ENetCommandPool&&) noexcept = default;
+
+			static constexpr std::size_t NodePerChunk = 64;
+
+		private:
+			template<typename... Args> ENetCommandNode<T>* Acquire(Args&&... args);
+			inline void Release(ENetCommandNode<T>* node);
+
+			std::vector<std::unique_ptr<ENetCommandNode<T>[]>> m_chunks;
+			MovablePtr<ENetCommandLink> m_freeNodes; //< singly linked through next
+	};
+
+	// Intrusive doubly linked list of commands, with a std::list-like interface for the parts of it ENet relies on
+	template<typename T>
+	class ENetCommandList
+	{
+		public:
+			class iterator;
+			using reverse_iterator = std::reverse_iterator<iterator>;
+
+			inline ENetCommandList(ENetCommandPool<T>* pool);
+			ENetCommandList(const ENetCommandList&) = delete;
+			inline ENetCommandList(ENetCommandList&& list) noexcept;
+			inline ~ENetCommandList();
+
+			inline iterator begin();
+			inline void clear();
+			template<typename... Args> T& emplace_back(Args&&... args);
+			inline bool empty() const;
+			inline iterator end();
+			inline iterator erase(iterator pos);
+			inline iterator erase(iterator first, iterator last);
+			inline T& front();
+			inline iterator insert(iterator pos, const T& value);
+			inline void pop_front();
+			inline reverse_iterator rbegin();
+			inline reverse_iterator rend();
+			inline void splice(iterator pos, ENetCommandList& other, iterator it);
+			inline void splice(iterator pos, ENetCommandList& other, iterator first, iterator last);
+
+			ENetCommandList& operator=(const ENetCommandList&) = delete;
+			inline ENetCommandList& operator=(ENetCommandList&& list) noexcept;
+
+			class iterator
+			{
+				friend ENetCommandList;
+
+				public:
+					using difference_type = std::ptrdiff_t;
+					using iterator_category = std::bidirectional_iterator_tag;
+					using pointer = T*;
+					using reference = T&;
+					using value_type = T;
+
+					iterator() = default;
+
+					inline T& operator*() const;
+					inline T* operator->() const;
+
+					inline iterator& operator++();
+					inline iterator operator++(int);
+					inline iterator& operator--();
+					inline iterator operator--(int);
+
+					inline bool operator==(const iterator& rhs) const;
+					inline bool operator!=(const iterator& rhs) const;
+
+				private:
+					inline explicit iterator(ENetCommandLink* link);
+
+					ENetCommandLink* m_link = nullptr;
+			};
+
+		private:
+			static inline void Link(ENetCommandLink* pos, ENetCommandLink* first, ENetCommandLink* last);
+			static inline void Unlink(ENetCommandLink* first, ENetCommandLink* last);
+
+			inline void TakeLinks(ENetCommandList& list);
+
+			ENetCommandLink m_head; //< sentinel, prev is the last node and next the first one
+			ENetCommandPool<T>* m_pool;
+	};
+}
+
+#include <Nazara/Network/ENetCommandPool.inl>
+
+#endif // NAZARA_ENETCOMMANDPOOL_HPP
@@ -0,0 +1,309 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Network/ENetCommandPool.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/MemoryHelper.hpp>
+#include <new>
+#include <utility>
+#include <Nazara/Network/Debug.hpp>
+
+namespace Nz
+{
+	template<typename T>
+	T& ENetCommandNode<T>::GetValue()
+	{
+		return *std::launder(reinterpret_cast<T*>(&storage));
+	}
+
+	template<typename T>
+	std::size_t ENetCommandPool<T>::GetNodeCount() const
+	{
+		return m_chunks.size() * NodePerChunk;
+	}
+
+	template<typename T>
+	template<typename... Args>
+	ENetCommandNode<T>* ENetCommandPool<T>::Acquire(Args&&... args)
+	{
+		if (!m_freeNodes)
+		{
+			auto& chunk = m_chunks.emplace_back(std::make_unique<ENetCommandNode<T>[]>(NodePerChunk));
+			for (std::size_t i = 0; i < NodePerChunk; ++i)
+				chunk[i].next = (i + 1 < NodePerChunk) ? &chunk[i + 1] : nullptr;
+
+			m_freeNodes = &chunk[0];
+		}
+
+		ENetCommandNode<T>* node = static_cast<ENetCommandNode<T>*>(m_freeNodes.Get());
+		PlacementNew(reinterpret_cast<T*>(&node->storage), std::forward<Args>(args)...);
+
+		m_freeNodes = node->next;
+
+		return node;
+	}
+
+	template<typename T>
+	void ENetCommandPool<T>::Release(ENetCommandNode<T>* node)
+	{
+		PlacementDestroy(&node->GetValue());
+
+		node->next = m_freeNodes;
+		m_freeNodes = node;
+	}
+
+
+	template<typename T>
+	ENetCommandList<T>::ENetCommandList(ENetCommandPool<T>* pool) :
+	m_pool(pool)
+	{
+		NazaraAssert(m_pool, "invalid command pool");
+
+		m_head.prev = &m_head;
+		m_head.next = &m_head;
+	}
+
+	template<typename T>
+	ENetCommandList<T>::ENetCommandList(ENetCommandList&& list) noexcept :
+	m_pool(list.m_pool)
+	{
+		m_head.prev = &m_head;
+		m_head.next = &m_head;
+
+		TakeLinks(list);
+	}
+
+	template<typename T>
+	ENetCommandList<T>::~ENetCommandList()
+	{
+		clear();
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::begin() -> iterator
+	{
+		return iterator(m_head.next);
+	}
+
+	template<typename T>
+	void ENetCommandList<T>::clear()
+	{
+		erase(begin(), end());
+	}
+
+	template<typename T>
+	template<typename... Args>
+	T& ENetCommandList<T>::emplace_back(Args&&... args)
+	{
+		ENetCommandNode<T>* node = m_pool->Acquire(std::forward<Args>(args)...);
+		Link(&m_head, node, node);
+
+		return node->GetValue();
+	}
+
+	template<typename T>
+	bool ENetCommandList<T>::empty() const
+	{
+		return m_head.next == &m_head;
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::end() -> iterator
+	{
+		return iterator(&m_head);
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::erase(iterator pos) -> iterator
+	{
+		NazaraAssert(pos != end(), "cannot erase end iterator");
+
+		ENetCommandLink* next = pos.m_link->next;
+		Unlink(pos.m_link, pos.m_link);
+		m_pool->Release(static_cast<ENetCommandNode<T>*>(pos.m_link));
+
+		return iterator(next);
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::erase(iterator first, iterator last) -> iterator
+	{
+		while (first != last)
+			first = erase(first);
+
+		return last;
+	}
+
+	template<typename T>
+	T& ENetCommandList<T>::front()
+	{
+		NazaraAssert(!empty(), "list is empty");
+
+		return *begin();
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::insert(iterator pos, const T& value) -> iterator
+	{
+		ENetCommandNode<T>* node = m_pool->Acquire(value);
+		Link(pos.m_link, node, node);
+
+		return iterator(node);
+	}
+
+	template<typename T>
+	void ENetCommandList<T>::pop_front()
+	{
+		erase(begin());
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::rbegin() -> reverse_iterator
+	{
+		return reverse_iterator(end());
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::rend() -> reverse_iterator
+	{
+		return reverse_iterator(begin());
+	}
+
+	template<typename T>
+	void ENetCommandList<T>::splice(iterator pos, ENetCommandList& other, iterator it)
+	{
+		NazaraUnused(other);
+		NazaraAssert(m_pool == other.m_pool, "lists must share the same pool");
+
+		if (pos == it)
+			return;
+
+		Unlink(it.m_link, it.m_link);
+		Link(pos.m_link, it.m_link, it.m_link);
+	}
+
+	template<typename T>
+	void ENetCommandList<T>::splice(iterator pos, ENetCommandList& other, iterator first, iterator last)
+	{
+		NazaraUnused(other);
+		NazaraAssert(m_pool == other.m_pool, "lists must share the same pool");
+
+		if (first == last)
+			return;
+
+		ENetCommandLink* lastLink = last.m_link->prev;
+		Unlink(first.m_link, lastLink);
+		Link(pos.m_link, first.m_link, lastLink);
+	}
+
+	template<typename T>
+	ENetCommandList<T>& ENetCommandList<T>::operator=(ENetCommandList&& list) noexcept
+	{
+		if (this == &list)
+			return *this;
+
+		clear();
+
+		m_pool = list.m_pool;
+		TakeLinks(list);
+
+		return *this;
+	}
+
+	template<typename T>
+	void ENetCommandList<T>::Link(ENetCommandLink* pos, ENetCommandLink* first, ENetCommandLink* last)
+	{
+		// Insert [first, last] before pos
+		first->prev = pos->prev;
+		last->next = pos;
+		pos->prev->next = first;
+		pos->prev = last;
+	}
+
+	template<typename T>
+	void ENetCommandList<T>::Unlink(ENetCommandLink* first, ENetCommandLink* last)
+	{
+		// Remove [first, last] from its list, the nodes keep their links to each other
+		first->prev->next = last->next;
+		last->next->prev = first->prev;
+	}
+
+	template<typename T>
+	void ENetCommandList<T>::TakeLinks(ENetCommandList& list)
+	{
+		if (list.empty())
+			return;
+
+		ENetCommandLink* first = list.m_head.next;
+		ENetCommandLink* last = list.m_head.prev;
+
+		list.m_head.prev = &list.m_head;
+		list.m_head.next = &list.m_head;
+
+		Link(&m_head, first, last);
+	}
+
+
+	template<typename T>
+	ENetCommandList<T>::iterator::iterator(ENetCommandLink* link) :
+	m_link(link)
+	{
+	}
+
+	template<typename T>
+	T& ENetCommandList<T>::iterator::operator*() const
+	{
+		return static_cast<ENetCommandNode<T>*>(m_link)->GetValue();
+	}
+
+	template<typename T>
+	T* ENetCommandList<T>::iterator::operator->() const
+	{
+		return &operator*();
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::iterator::operator++() -> iterator&
+	{
+		m_link = m_link->next;
+		return *this;
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::iterator::operator++(int) -> iterator
+	{
+		iterator it = *this;
+		m_link = m_link->next;
+		return it;
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::iterator::operator--() -> iterator&
+	{
+		m_link = m_link->prev;
+		return *this;
+	}
+
+	template<typename T>
+	auto ENetCommandList<T>::iterator::operator--(int) -> iterator
+	{
+		iterator it = *this;
+		m_link = m_link->prev;
+		return it;
+	}
+
+	template<typename T>
+	bool ENetCommandList<T>::iterator::operator==(const iterator& rhs) const
+	{
+		return m_link == rhs.m_link;
+	}
+
+	template<typename T>
+	bool ENetCommandList<T>::iterator::operator!=(const iterator& rhs) const
+	{
+		return m_link != rhs.m_link;
+	}
+}
+
+#include <Nazara/Network/DebugOff.hpp>
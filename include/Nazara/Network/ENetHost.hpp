@@ -21,6 +21,7 @@
 #include <Nazara/Core/Bitset.hpp>
 #include <Nazara/Core/Clock.hpp>
 #include <Nazara/Core/MemoryPool.hpp>
+#include <Nazara/Network/ENetCommandPool.hpp>
 #include <Nazara/Network/ENetCompressor.hpp>
 #include <Nazara/Network/ENetPeer.hpp>
 #include <Nazara/Network/ENetProtocol.hpp>
@@ -62,6 +63,7 @@ namespace Nz
 
 			void Flush();
 
+			inline std::size_t GetAllocatedCommandCount() const;
 			inline IpAddress GetBoundAddress() const;
 			inline UInt32 GetServiceTime() const;
 			inline UInt32 GetTotalReceivedPackets() const;
@@ -140,6 +142,8 @@ namespace Nz
 			std::size_t m_receivedDataLength;
 			std::uniform_int_distribution<UInt16> m_packetDelayDistribution;
 			std::unique_ptr<ENetCompressor> m_compressor;
+			ENetCommandPool<ENetPeer::IncomingCommmand> m_incomingCommandPool; //< must outlive peers
+			ENetCommandPool<ENetPeer::OutgoingCommand> m_outgoingCommandPool; //< must outlive peers
 			std::vector<ENetPeer> m_peers;
 			std::vector<PendingIncomingPacket> m_pendingIncomingPackets;
 			std::vector<PendingOutgoingPacket> m_pendingOutgoingPackets;
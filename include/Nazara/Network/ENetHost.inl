@@ -66,6 +66,12 @@ namespace Nz
 		return m_allowsIncomingConnections;
 	}
 
+	// Number of command nodes allocated for the peers of this host, used or waiting to be reused
+	inline std::size_t ENetHost::GetAllocatedCommandCount() const
+	{
+		return m_incomingCommandPool.GetNodeCount() + m_outgoingCommandPool.GetNodeCount();
+	}
+
 	inline IpAddress ENetHost::GetBoundAddress() const
 	{
 		return m_address;
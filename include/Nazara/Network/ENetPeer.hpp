@@ -20,11 +20,11 @@
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/Bitset.hpp>
 #include <Nazara/Core/MovablePtr.hpp>
+#include <Nazara/Network/ENetCommandPool.hpp>
 #include <Nazara/Network/ENetPacket.hpp>
 #include <Nazara/Network/ENetProtocol.hpp>
 #include <Nazara/Network/IpAddress.hpp>
 #include <array>
-#include <list>
 #include <random>
 #include <vector>
 
@@ -38,7 +38,7 @@ namespace Nz
 		friend struct PacketRef;
 
 		public:
-			inline ENetPeer(ENetHost* host, UInt16 peerId);
+			ENetPeer(ENetHost* host, UInt16 peerId);
 			ENetPeer(const ENetPeer&) = delete;
 			ENetPeer(ENetPeer&&) = default;
 			~ENetPeer() = default;
@@ -83,6 +83,7 @@ namespace Nz
 			ENetPeer& operator=(ENetPeer&&) = default;
 
 		private:
+			void InitChannels(std::size_t channelCount);
 			void InitIncoming(std::size_t channelCount, const IpAddress& address, ENetProtocolConnect& incomingCommand);
 			void InitOutgoing(std::size_t channelCount, const IpAddress& address, UInt32 connectId, UInt32 windowSize);
 
@@ -136,7 +137,9 @@ namespace Nz
 
 			struct Channel
 			{
-				Channel()
+				Channel(ENetCommandPool<IncomingCommmand>* commandPool) :
+				incomingReliableCommands(commandPool),
+				incomingUnreliableCommands(commandPool)
 				{
 					incomingReliableSequenceNumber = 0;
 					incomingUnreliableSequenceNumber = 0;
@@ -147,8 +150,8 @@ namespace Nz
 				}
 
 				std::array<UInt16, ENetPeer_ReliableWindows> reliableWindows;
-				std::list<IncomingCommmand>                  incomingReliableCommands;
-				std::list<IncomingCommmand>                  incomingUnreliableCommands;
+				ENetCommandList<IncomingCommmand>            incomingReliableCommands;
+				ENetCommandList<IncomingCommmand>            incomingUnreliableCommands;
 				UInt16                                       incomingReliableSequenceNumber;
 				UInt16                                       incomingUnreliableSequenceNumber;
 				UInt16                                       outgoingReliableSequenceNumber;
@@ -186,11 +189,11 @@ namespace Nz
 			IpAddress                             m_address; //< Internet address of the peer
 			std::array<UInt32, unsequencedWindow> m_unsequencedWindow;
 			std::bernoulli_distribution           m_packetLossProbability;
-			std::list<IncomingCommmand>           m_dispatchedCommands;
-			std::list<OutgoingCommand>            m_outgoingReliableCommands;
-			std::list<OutgoingCommand>            m_outgoingUnreliableCommands;
-			std::list<OutgoingCommand>            m_sentReliableCommands;
-			std::list<OutgoingCommand>            m_sentUnreliableCommands;
+			ENetCommandList<IncomingCommmand>     m_dispatchedCommands;
+			ENetCommandList<OutgoingCommand>      m_outgoingReliableCommands;
+			ENetCommandList<OutgoingCommand>      m_outgoingUnreliableCommands;
+			ENetCommandList<OutgoingCommand>      m_sentReliableCommands;
+			ENetCommandList<OutgoingCommand>      m_sentUnreliableCommands;
 			std::size_t                           m_totalWaitingData;
 			std::uniform_int_distribution<UInt16> m_packetDelayDistribution;
 			std::vector<Acknowledgement>          m_acknowledgements;
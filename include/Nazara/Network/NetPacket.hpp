@@ -11,7 +11,7 @@
 #include <Nazara/Core/ByteStream.hpp>
 #include <Nazara/Core/MemoryStream.hpp>
 #include <Nazara/Network/Config.hpp>
-#include <mutex>
+#include <memory>
 
 namespace Nz
 {
@@ -20,6 +20,8 @@ namespace Nz
 		friend class Network;
 
 		public:
+			struct PoolStats;
+
 			inline NetPacket();
 			inline NetPacket(UInt16 netCode, std::size_t minCapacity = 0);
 			inline NetPacket(UInt16 netCode, const void* ptr, std::size_t size);
@@ -49,8 +51,20 @@ namespace Nz
 			static bool DecodeHeader(const void* data, UInt32* packetSize, UInt16* netCode);
 			static bool EncodeHeader(void* data, UInt32 packetSize, UInt16 netCode);
 
+			static PoolStats GetPoolStats();
+
+			static void SetPoolLimits(std::size_t maxThreadCachedBuffers, UInt64 maxRetainedBytes);
+
 			static constexpr std::size_t HeaderSize = sizeof(UInt32) + sizeof(UInt16); //< PacketSize + NetCode
 
+			struct PoolStats
+			{
+				UInt64 hitCount;            //< Buffers reused from the pool
+				UInt64 missCount;           //< Buffers which had to be allocated
+				UInt64 retainedBufferCount; //< Buffers currently held by the pool
+				UInt64 retainedBytes;       //< Capacity of buffers currently held by the pool
+			};
+
 		private:
 			void OnEmptyStream() override;
 
@@ -63,9 +77,6 @@ namespace Nz
 			std::unique_ptr<ByteArray> m_buffer;
 			MemoryStream m_memoryStream;
 			UInt16 m_netCode;
-
-			static std::mutex s_availableBuffersMutex;
-			static std::vector<std::pair<std::size_t, std::unique_ptr<ByteArray>>> s_availableBuffers;
 	};
 }
 
@@ -0,0 +1,50 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NULLRENDERER_BUFFER_HPP
+#define NAZARA_NULLRENDERER_BUFFER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Utility/AbstractBuffer.hpp>
+#include <Nazara/NullRenderer/Config.hpp>
+#include <memory>
+
+namespace Nz
+{
+	class NAZARA_NULLRENDERER_API NullBuffer : public AbstractBuffer
+	{
+		public:
+			NullBuffer(BufferType type);
+			NullBuffer(const NullBuffer&) = delete;
+			NullBuffer(NullBuffer&&) = delete;
+			~NullBuffer() = default;
+
+			bool Fill(const void* data, UInt64 offset, UInt64 size) override;
+
+			bool Initialize(UInt64 size, BufferUsageFlags usage) override;
+
+			inline const UInt8* GetData() const;
+			UInt64 GetSize() const override;
+			DataStorage GetStorage() const override;
+			inline BufferType GetType() const;
+
+			void* Map(BufferAccess access, UInt64 offset, UInt64 size) override;
+			bool Unmap() override;
+
+			NullBuffer& operator=(const NullBuffer&) = delete;
+			NullBuffer& operator=(NullBuffer&&) = delete;
+
+		private:
+			std::unique_ptr<UInt8[]> m_data;
+			BufferType m_type;
+			BufferUsageFlags m_usage;
+			UInt64 m_size;
+	};
+}
+
+#include <Nazara/NullRenderer/NullBuffer.inl>
+
+#endif // NAZARA_NULLRENDERER_BUFFER_HPP
@@ -0,0 +1,21 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullBuffer.hpp>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	inline const UInt8* NullBuffer::GetData() const
+	{
+		return m_data.get();
+	}
+
+	inline BufferType NullBuffer::GetType() const
+	{
+		return m_type;
+	}
+}
+
+#include <Nazara/NullRenderer/DebugOff.hpp>
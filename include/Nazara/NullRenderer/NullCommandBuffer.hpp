@@ -0,0 +1,254 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NULLRENDERER_COMMANDBUFFER_HPP
+#define NAZARA_NULLRENDERER_COMMANDBUFFER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Math/Rect.hpp>
+#include <Nazara/Renderer/CommandBuffer.hpp>
+#include <Nazara/Renderer/CommandBufferBuilder.hpp>
+#include <Nazara/Utility/Enums.hpp>
+#include <Nazara/NullRenderer/Config.hpp>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace Nz
+{
+	class NullBuffer;
+	class NullCommandPool;
+	class NullFramebuffer;
+	class NullRenderPass;
+	class NullRenderPipeline;
+	class NullRenderPipelineLayout;
+	class NullShaderBinding;
+	class NullTexture;
+
+	class NAZARA_NULLRENDERER_API NullCommandBuffer final : public CommandBuffer
+	{
+		friend NullCommandPool;
+
+		public:
+			struct BeginDebugRegionData;
+			struct BeginRenderPassData;
+			struct BindIndexBufferData;
+			struct BindPipelineData;
+			struct BindShaderBindingData;
+			struct BindVertexBufferData;
+			struct CopyBufferData;
+			struct CopyBufferFromMemoryData;
+			struct DrawData;
+			struct DrawIndexedData;
+			struct EndDebugRegionData;
+			struct EndRenderPassData;
+			struct NextSubpassData;
+			struct PostTransferBarrierData;
+			struct PreTransferBarrierData;
+			struct SetScissorData;
+			struct SetViewportData;
+			struct Stats;
+			struct TextureBarrierData;
+
+			using CommandData = std::variant<
+				BeginDebugRegionData,
+				BeginRenderPassData,
+				BindIndexBufferData,
+				BindPipelineData,
+				BindShaderBindingData,
+				BindVertexBufferData,
+				CopyBufferData,
+				CopyBufferFromMemoryData,
+				DrawData,
+				DrawIndexedData,
+				EndDebugRegionData,
+				EndRenderPassData,
+				NextSubpassData,
+				PostTransferBarrierData,
+				PreTransferBarrierData,
+				SetScissorData,
+				SetViewportData,
+				TextureBarrierData
+			>;
+
+			inline NullCommandBuffer(NullCommandPool* owner = nullptr);
+			NullCommandBuffer(const NullCommandBuffer&) = delete;
+			NullCommandBuffer(NullCommandBuffer&&) = delete;
+			~NullCommandBuffer() = default;
+
+			inline void BeginDebugRegion(const std::string_view& regionName, const Color& color);
+			inline void BeginRenderPass(const NullFramebuffer& framebuffer, const NullRenderPass& renderPass, const Recti& renderRect, const CommandBufferBuilder::ClearValues* clearValues, std::size_t clearValueCount);
+
+			inline void BindIndexBuffer(const NullBuffer* indexBuffer, UInt64 offset = 0);
+			inline void BindPipeline(const NullRenderPipeline* pipeline);
+			inline void BindShaderBinding(const NullRenderPipelineLayout& pipelineLayout, UInt32 set, const NullShaderBinding* binding);
+			inline void BindVertexBuffer(UInt32 binding, const NullBuffer* vertexBuffer, UInt64 offset = 0);
+
+			inline void CopyBuffer(const NullBuffer* source, const NullBuffer* target, UInt64 size, UInt64 sourceOffset = 0, UInt64 targetOffset = 0);
+			inline void CopyBuffer(const UploadPool::Allocation& allocation, const NullBuffer* target, UInt64 size, UInt64 sourceOffset = 0, UInt64 targetOffset = 0);
+
+			inline void Draw(UInt32 vertexCount, UInt32 instanceCount = 1, UInt32 firstVertex = 0, UInt32 firstInstance = 0);
+			inline void DrawIndexed(UInt32 indexCount, UInt32 instanceCount = 1, UInt32 firstVertex = 0, UInt32 firstInstance = 0);
+
+			inline void EndDebugRegion();
+			inline void EndRenderPass();
+
+			inline const std::vector<CommandData>& GetCommands() const;
+			inline NullCommandPool* GetOwner() const;
+			inline const Stats& GetStats() const;
+
+			inline void NextSubpass();
+
+			inline void PostTransferBarrier();
+			inline void PreTransferBarrier();
+
+			inline void SetScissor(const Recti& scissorRegion);
+			inline void SetViewport(const Recti& viewportRegion);
+
+			inline void TextureBarrier(TextureLayout oldLayout, TextureLayout newLayout, const NullTexture& texture);
+
+			NullCommandBuffer& operator=(const NullCommandBuffer&) = delete;
+			NullCommandBuffer& operator=(NullCommandBuffer&&) = delete;
+
+			struct BeginDebugRegionData
+			{
+				std::string regionName;
+				Color color;
+			};
+
+			struct BeginRenderPassData
+			{
+				std::vector<CommandBufferBuilder::ClearValues> clearValues;
+				const NullFramebuffer* framebuffer;
+				const NullRenderPass* renderPass;
+				Recti renderRect;
+			};
+
+			struct BindIndexBufferData
+			{
+				const NullBuffer* indexBuffer;
+				UInt64 offset;
+			};
+
+			struct BindPipelineData
+			{
+				const NullRenderPipeline* pipeline;
+			};
+
+			struct BindShaderBindingData
+			{
+				const NullRenderPipelineLayout* pipelineLayout;
+				const NullShaderBinding* shaderBinding;
+				UInt32 set;
+			};
+
+			struct BindVertexBufferData
+			{
+				const NullBuffer* vertexBuffer;
+				UInt32 binding;
+				UInt64 offset;
+			};
+
+			struct CopyBufferData
+			{
+				const NullBuffer* source;
+				const NullBuffer* target;
+				UInt64 size;
+				UInt64 sourceOffset;
+				UInt64 targetOffset;
+			};
+
+			struct CopyBufferFromMemoryData
+			{
+				const void* memory; //< only valid until the upload pool it comes from is reset
+				const NullBuffer* target;
+				UInt64 size;
+				UInt64 targetOffset;
+			};
+
+			struct DrawData
+			{
+				UInt32 firstInstance;
+				UInt32 firstVertex;
+				UInt32 instanceCount;
+				UInt32 vertexCount;
+			};
+
+			struct DrawIndexedData
+			{
+				UInt32 firstInstance;
+				UInt32 firstVertex;
+				UInt32 indexCount;
+				UInt32 instanceCount;
+			};
+
+			struct EndDebugRegionData
+			{
+			};
+
+			struct EndRenderPassData
+			{
+			};
+
+			struct NextSubpassData
+			{
+			};
+
+			struct PostTransferBarrierData
+			{
+			};
+
+			struct PreTransferBarrierData
+			{
+			};
+
+			struct SetScissorData
+			{
+				Recti scissorRegion;
+			};
+
+			struct SetViewportData
+			{
+				Recti viewportRegion;
+			};
+
+			struct Stats
+			{
+				UInt64 bufferCopyCount = 0;
+				UInt64 drawCount = 0; //< Draw and DrawIndexed calls
+				UInt64 indexBufferBindCount = 0;
+				UInt64 instanceCount = 0;
+				UInt64 pipelineBindCount = 0;
+				UInt64 renderPassCount = 0;
+				UInt64 shaderBindingBindCount = 0;
+				UInt64 vertexBufferBindCount = 0;
+				UInt64 vertexCount = 0; //< vertices (or indices) processed, taking instancing into account
+
+				inline Stats& operator+=(const Stats& stats);
+			};
+
+			struct TextureBarrierData
+			{
+				const NullTexture* texture;
+				TextureLayout oldLayout;
+				TextureLayout newLayout;
+			};
+
+		private:
+			inline void Reset();
+			void Release() override;
+
+			std::vector<CommandData> m_commands;
+			const NullRenderPipeline* m_currentPipeline;
+			NullCommandPool* m_owner;
+			Stats m_stats;
+	};
+}
+
+#include <Nazara/NullRenderer/NullCommandBuffer.inl>
+
+#endif // NAZARA_NULLRENDERER_COMMANDBUFFER_HPP
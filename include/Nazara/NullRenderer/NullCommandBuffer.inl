@@ -0,0 +1,205 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullCommandBuffer.hpp>
+#include <stdexcept>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	inline NullCommandBuffer::NullCommandBuffer(NullCommandPool* owner) :
+	m_currentPipeline(nullptr),
+	m_owner(owner)
+	{
+	}
+
+	inline void NullCommandBuffer::BeginDebugRegion(const std::string_view& regionName, const Color& color)
+	{
+		BeginDebugRegionData beginDebugRegion;
+		beginDebugRegion.color = color;
+		beginDebugRegion.regionName = regionName;
+
+		m_commands.emplace_back(std::move(beginDebugRegion));
+	}
+
+	inline void NullCommandBuffer::BeginRenderPass(const NullFramebuffer& framebuffer, const NullRenderPass& renderPass, const Recti& renderRect, const CommandBufferBuilder::ClearValues* clearValues, std::size_t clearValueCount)
+	{
+		BeginRenderPassData beginRenderPass;
+		beginRenderPass.clearValues.assign(clearValues, clearValues + clearValueCount);
+		beginRenderPass.framebuffer = &framebuffer;
+		beginRenderPass.renderPass = &renderPass;
+		beginRenderPass.renderRect = renderRect;
+
+		m_commands.emplace_back(std::move(beginRenderPass));
+		m_stats.renderPassCount++;
+	}
+
+	inline void NullCommandBuffer::BindIndexBuffer(const NullBuffer* indexBuffer, UInt64 offset)
+	{
+		m_commands.emplace_back(BindIndexBufferData{ indexBuffer, offset });
+		m_stats.indexBufferBindCount++;
+	}
+
+	inline void NullCommandBuffer::BindPipeline(const NullRenderPipeline* pipeline)
+	{
+		m_currentPipeline = pipeline;
+
+		m_commands.emplace_back(BindPipelineData{ pipeline });
+		m_stats.pipelineBindCount++;
+	}
+
+	inline void NullCommandBuffer::BindShaderBinding(const NullRenderPipelineLayout& pipelineLayout, UInt32 set, const NullShaderBinding* binding)
+	{
+		m_commands.emplace_back(BindShaderBindingData{ &pipelineLayout, binding, set });
+		m_stats.shaderBindingBindCount++;
+	}
+
+	inline void NullCommandBuffer::BindVertexBuffer(UInt32 binding, const NullBuffer* vertexBuffer, UInt64 offset)
+	{
+		m_commands.emplace_back(BindVertexBufferData{ vertexBuffer, binding, offset });
+		m_stats.vertexBufferBindCount++;
+	}
+
+	inline void NullCommandBuffer::CopyBuffer(const NullBuffer* source, const NullBuffer* target, UInt64 size, UInt64 sourceOffset, UInt64 targetOffset)
+	{
+		CopyBufferData copyBuffer = {
+			source,
+			target,
+			size,
+			sourceOffset,
+			targetOffset
+		};
+
+		m_commands.emplace_back(std::move(copyBuffer));
+		m_stats.bufferCopyCount++;
+	}
+
+	inline void NullCommandBuffer::CopyBuffer(const UploadPool::Allocation& allocation, const NullBuffer* target, UInt64 size, UInt64 sourceOffset, UInt64 targetOffset)
+	{
+		CopyBufferFromMemoryData copyBuffer = {
+			static_cast<const UInt8*>(allocation.mappedPtr) + sourceOffset,
+			target,
+			size,
+			targetOffset
+		};
+
+		m_commands.emplace_back(std::move(copyBuffer));
+		m_stats.bufferCopyCount++;
+	}
+
+	inline void NullCommandBuffer::Draw(UInt32 vertexCount, UInt32 instanceCount, UInt32 firstVertex, UInt32 firstInstance)
+	{
+		if (!m_currentPipeline)
+			throw std::runtime_error("no pipeline bound");
+
+		DrawData draw;
+		draw.firstInstance = firstInstance;
+		draw.firstVertex = firstVertex;
+		draw.instanceCount = instanceCount;
+		draw.vertexCount = vertexCount;
+
+		m_commands.emplace_back(std::move(draw));
+
+		m_stats.drawCount++;
+		m_stats.instanceCount += instanceCount;
+		m_stats.vertexCount += UInt64(vertexCount) * instanceCount;
+	}
+
+	inline void NullCommandBuffer::DrawIndexed(UInt32 indexCount, UInt32 instanceCount, UInt32 firstVertex, UInt32 firstInstance)
+	{
+		if (!m_currentPipeline)
+			throw std::runtime_error("no pipeline bound");
+
+		DrawIndexedData draw;
+		draw.firstInstance = firstInstance;
+		draw.firstVertex = firstVertex;
+		draw.indexCount = indexCount;
+		draw.instanceCount = instanceCount;
+
+		m_commands.emplace_back(std::move(draw));
+
+		m_stats.drawCount++;
+		m_stats.instanceCount += instanceCount;
+		m_stats.vertexCount += UInt64(indexCount) * instanceCount;
+	}
+
+	inline void NullCommandBuffer::EndDebugRegion()
+	{
+		m_commands.emplace_back(EndDebugRegionData{});
+	}
+
+	inline void NullCommandBuffer::EndRenderPass()
+	{
+		m_commands.emplace_back(EndRenderPassData{});
+	}
+
+	inline auto NullCommandBuffer::GetCommands() const -> const std::vector<CommandData>&
+	{
+		return m_commands;
+	}
+
+	inline NullCommandPool* NullCommandBuffer::GetOwner() const
+	{
+		return m_owner;
+	}
+
+	inline auto NullCommandBuffer::GetStats() const -> const Stats&
+	{
+		return m_stats;
+	}
+
+	inline void NullCommandBuffer::NextSubpass()
+	{
+		m_commands.emplace_back(NextSubpassData{});
+	}
+
+	inline void NullCommandBuffer::PostTransferBarrier()
+	{
+		m_commands.emplace_back(PostTransferBarrierData{});
+	}
+
+	inline void NullCommandBuffer::PreTransferBarrier()
+	{
+		m_commands.emplace_back(PreTransferBarrierData{});
+	}
+
+	inline void NullCommandBuffer::SetScissor(const Recti& scissorRegion)
+	{
+		m_commands.emplace_back(SetScissorData{ scissorRegion });
+	}
+
+	inline void NullCommandBuffer::SetViewport(const Recti& viewportRegion)
+	{
+		m_commands.emplace_back(SetViewportData{ viewportRegion });
+	}
+
+	inline void NullCommandBuffer::TextureBarrier(TextureLayout oldLayout, TextureLayout newLayout, const NullTexture& texture)
+	{
+		m_commands.emplace_back(TextureBarrierData{ &texture, oldLayout, newLayout });
+	}
+
+	inline void NullCommandBuffer::Reset()
+	{
+		m_commands.clear(); //< keeps capacity, which is the point of reusing command buffers
+		m_currentPipeline = nullptr;
+		m_stats = Stats{};
+	}
+
+	inline auto NullCommandBuffer::Stats::operator+=(const Stats& stats) -> Stats&
+	{
+		bufferCopyCount += stats.bufferCopyCount;
+		drawCount += stats.drawCount;
+		indexBufferBindCount += stats.indexBufferBindCount;
+		instanceCount += stats.instanceCount;
+		pipelineBindCount += stats.pipelineBindCount;
+		renderPassCount += stats.renderPassCount;
+		shaderBindingBindCount += stats.shaderBindingBindCount;
+		vertexBufferBindCount += stats.vertexBufferBindCount;
+		vertexCount += stats.vertexCount;
+
+		return *this;
+	}
+}
+
+#include <Nazara/NullRenderer/DebugOff.hpp>
@@ -0,0 +1,16 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullCommandBufferBuilder.hpp>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	inline NullCommandBufferBuilder::NullCommandBufferBuilder(NullCommandBuffer& commandBuffer) :
+	m_commandBuffer(commandBuffer)
+	{
+	}
+}
+
+#include <Nazara/NullRenderer/DebugOff.hpp>
@@ -0,0 +1,43 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NULLRENDERER_COMMANDPOOL_HPP
+#define NAZARA_NULLRENDERER_COMMANDPOOL_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Renderer/CommandPool.hpp>
+#include <Nazara/NullRenderer/Config.hpp>
+#include <Nazara/NullRenderer/NullCommandBuffer.hpp>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_NULLRENDERER_API NullCommandPool final : public CommandPool
+	{
+		friend NullCommandBuffer;
+
+		public:
+			NullCommandPool() = default;
+			NullCommandPool(const NullCommandPool&) = delete;
+			NullCommandPool(NullCommandPool&&) noexcept = default;
+			~NullCommandPool() = default;
+
+			CommandBufferPtr BuildCommandBuffer(const std::function<void(CommandBufferBuilder& builder)>& callback) override;
+
+			NullCommandPool& operator=(const NullCommandPool&) = delete;
+			NullCommandPool& operator=(NullCommandPool&&) = delete;
+
+		private:
+			void Release(NullCommandBuffer& commandBuffer);
+
+			std::vector<std::unique_ptr<NullCommandBuffer>> m_freeCommandBuffers;
+	};
+}
+
+#include <Nazara/NullRenderer/NullCommandPool.inl>
+
+#endif // NAZARA_NULLRENDERER_COMMANDPOOL_HPP
@@ -0,0 +1,66 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NULLRENDERER_DEVICE_HPP
+#define NAZARA_NULLRENDERER_DEVICE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Signal.hpp>
+#include <Nazara/Renderer/RenderDevice.hpp>
+#include <Nazara/Renderer/RenderDeviceInfo.hpp>
+#include <Nazara/NullRenderer/Config.hpp>
+#include <Nazara/NullRenderer/NullCommandBuffer.hpp>
+
+namespace Nz
+{
+	class NAZARA_NULLRENDERER_API NullDevice : public RenderDevice
+	{
+		public:
+			NullDevice(const RenderDeviceFeatures& enabledFeatures = {});
+			NullDevice(const NullDevice&) = delete;
+			NullDevice(NullDevice&&) = delete;
+			~NullDevice() = default;
+
+			const RenderDeviceInfo& GetDeviceInfo() const override;
+			const RenderDeviceFeatures& GetEnabledFeatures() const override;
+			inline std::size_t GetSubmittedCommandBufferCount() const;
+			inline const NullCommandBuffer::Stats& GetSubmittedStats() const;
+
+			std::shared_ptr<AbstractBuffer> InstantiateBuffer(BufferType type) override;
+			std::shared_ptr<CommandPool> InstantiateCommandPool(QueueType queueType) override;
+			std::shared_ptr<Framebuffer> InstantiateFramebuffer(unsigned int width, unsigned int height, const std::shared_ptr<RenderPass>& renderPass, const std::vector<std::shared_ptr<Texture>>& attachments) override;
+			std::shared_ptr<RenderPass> InstantiateRenderPass(std::vector<RenderPass::Attachment> attachments, std::vector<RenderPass::SubpassDescription> subpassDescriptions, std::vector<RenderPass::SubpassDependency> subpassDependencies) override;
+			std::shared_ptr<RenderPipeline> InstantiateRenderPipeline(RenderPipelineInfo pipelineInfo) override;
+			std::shared_ptr<RenderPipelineLayout> InstantiateRenderPipelineLayout(RenderPipelineLayoutInfo pipelineLayoutInfo) override;
+			std::shared_ptr<ShaderModule> InstantiateShaderModule(ShaderStageTypeFlags shaderStages, ShaderAst::Statement& shaderAst, const ShaderWriter::States& states) override;
+			std::shared_ptr<ShaderModule> InstantiateShaderModule(ShaderStageTypeFlags shaderStages, ShaderLanguage lang, const void* source, std::size_t sourceSize, const ShaderWriter::States& states) override;
+			std::shared_ptr<Texture> InstantiateTexture(const TextureInfo& params) override;
+			std::shared_ptr<TextureSampler> InstantiateTextureSampler(const TextureSamplerInfo& params) override;
+
+			bool IsTextureFormatSupported(PixelFormat format, TextureUsage usage) const override;
+
+			inline void ResetSubmittedStats();
+
+			void Submit(const NullCommandBuffer& commandBuffer);
+
+			NullDevice& operator=(const NullDevice&) = delete;
+			NullDevice& operator=(NullDevice&&) = delete;
+
+			static RenderDeviceInfo BuildDeviceInfo();
+
+			NazaraSignal(OnCommandBufferSubmit, NullDevice* /*device*/, const NullCommandBuffer& /*commandBuffer*/);
+
+		private:
+			std::size_t m_submittedCommandBufferCount;
+			NullCommandBuffer::Stats m_submittedStats;
+			RenderDeviceFeatures m_enabledFeatures;
+			RenderDeviceInfo m_deviceInfo;
+	};
+}
+
+#include <Nazara/NullRenderer/NullDevice.inl>
+
+#endif // NAZARA_NULLRENDERER_DEVICE_HPP
@@ -0,0 +1,33 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullDevice.hpp>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Returns the number of command buffers submitted since the last call to ResetSubmittedStats
+	*/
+	inline std::size_t NullDevice::GetSubmittedCommandBufferCount() const
+	{
+		return m_submittedCommandBufferCount;
+	}
+
+	/*!
+	* \brief Returns the accumulated statistics of every command buffer submitted since the last call to ResetSubmittedStats
+	*/
+	inline const NullCommandBuffer::Stats& NullDevice::GetSubmittedStats() const
+	{
+		return m_submittedStats;
+	}
+
+	inline void NullDevice::ResetSubmittedStats()
+	{
+		m_submittedCommandBufferCount = 0;
+		m_submittedStats = NullCommandBuffer::Stats{};
+	}
+}
+
+#include <Nazara/NullRenderer/DebugOff.hpp>
@@ -0,0 +1,40 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NULLRENDERER_FRAMEBUFFER_HPP
+#define NAZARA_NULLRENDERER_FRAMEBUFFER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Renderer/Framebuffer.hpp>
+#include <Nazara/NullRenderer/Config.hpp>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	class Texture;
+
+	class NAZARA_NULLRENDERER_API NullFramebuffer : public Framebuffer
+	{
+		public:
+			inline NullFramebuffer(FramebufferType type, std::vector<std::shared_ptr<Texture>> attachments = {});
+			NullFramebuffer(const NullFramebuffer&) = delete;
+			NullFramebuffer(NullFramebuffer&&) noexcept = default;
+			~NullFramebuffer() = default;
+
+			inline const std::vector<std::shared_ptr<Texture>>& GetAttachments() const;
+
+			NullFramebuffer& operator=(const NullFramebuffer&) = delete;
+			NullFramebuffer& operator=(NullFramebuffer&&) noexcept = default;
+
+		private:
+			std::vector<std::shared_ptr<Texture>> m_attachments;
+	};
+}
+
+#include <Nazara/NullRenderer/NullFramebuffer.inl>
+
+#endif // NAZARA_NULLRENDERER_FRAMEBUFFER_HPP
@@ -0,0 +1,22 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullFramebuffer.hpp>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	inline NullFramebuffer::NullFramebuffer(FramebufferType type, std::vector<std::shared_ptr<Texture>> attachments) :
+	Framebuffer(type),
+	m_attachments(std::move(attachments))
+	{
+	}
+
+	inline const std::vector<std::shared_ptr<Texture>>& NullFramebuffer::GetAttachments() const
+	{
+		return m_attachments;
+	}
+}
+
+#include <Nazara/NullRenderer/DebugOff.hpp>
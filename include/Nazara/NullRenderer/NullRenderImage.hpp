@@ -0,0 +1,46 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NULLRENDERER_RENDERIMAGE_HPP
+#define NAZARA_NULLRENDERER_RENDERIMAGE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Renderer/RenderImage.hpp>
+#include <Nazara/NullRenderer/Config.hpp>
+#include <Nazara/NullRenderer/NullUploadPool.hpp>
+
+namespace Nz
+{
+	class NullRenderWindow;
+
+	class NAZARA_NULLRENDERER_API NullRenderImage : public RenderImage
+	{
+		public:
+			NullRenderImage(NullRenderWindow& owner);
+			NullRenderImage(const NullRenderImage&) = delete;
+			NullRenderImage(NullRenderImage&&) = delete;
+			~NullRenderImage() = default;
+
+			void Execute(const std::function<void(CommandBufferBuilder& builder)>& callback, QueueTypeFlags queueTypeFlags) override;
+
+			NullUploadPool& GetUploadPool() override;
+
+			void Present() override;
+
+			void SubmitCommandBuffer(CommandBuffer* commandBuffer, QueueTypeFlags queueTypeFlags) override;
+
+			NullRenderImage& operator=(const NullRenderImage&) = delete;
+			NullRenderImage& operator=(NullRenderImage&&) = delete;
+
+		private:
+			NullRenderWindow& m_owner;
+			NullUploadPool m_uploadPool;
+	};
+}
+
+#include <Nazara/NullRenderer/NullRenderImage.inl>
+
+#endif // NAZARA_NULLRENDERER_RENDERIMAGE_HPP
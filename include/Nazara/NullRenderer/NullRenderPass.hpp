@@ -0,0 +1,31 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NULLRENDERER_RENDERPASS_HPP
+#define NAZARA_NULLRENDERER_RENDERPASS_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Renderer/RenderPass.hpp>
+#include <Nazara/NullRenderer/Config.hpp>
+
+namespace Nz
+{
+	class NAZARA_NULLRENDERER_API NullRenderPass final : public RenderPass
+	{
+		public:
+			using RenderPass::RenderPass;
+			NullRenderPass(const NullRenderPass&) = delete;
+			NullRenderPass(NullRenderPass&&) noexcept = default;
+			~NullRenderPass() = default;
+
+			NullRenderPass& operator=(const NullRenderPass&) = delete;
+			NullRenderPass& operator=(NullRenderPass&&) noexcept = default;
+	};
+}
+
+#include <Nazara/NullRenderer/NullRenderPass.inl>
+
+#endif // NAZARA_NULLRENDERER_RENDERPASS_HPP
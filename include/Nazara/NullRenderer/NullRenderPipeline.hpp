@@ -0,0 +1,38 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NULLRENDERER_RENDERPIPELINE_HPP
+#define NAZARA_NULLRENDERER_RENDERPIPELINE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Renderer/RenderPipeline.hpp>
+#include <Nazara/NullRenderer/Config.hpp>
+
+namespace Nz
+{
+	class NullDevice;
+
+	class NAZARA_NULLRENDERER_API NullRenderPipeline : public RenderPipeline
+	{
+		public:
+			NullRenderPipeline(NullDevice& device, RenderPipelineInfo pipelineInfo);
+			NullRenderPipeline(const NullRenderPipeline&) = delete;
+			NullRenderPipeline(NullRenderPipeline&&) = delete;
+			~NullRenderPipeline() = default;
+
+			const RenderPipelineInfo& GetPipelineInfo() const override;
+
+			NullRenderPipeline& operator=(const NullRenderPipeline&) = delete;
+			NullRenderPipeline& operator=(NullRenderPipeline&&) = delete;
+
+		private:
+			RenderPipelineInfo m_pipelineInfo;
+	};
+}
+
+#include <Nazara/NullRenderer/NullRenderPipeline.inl>
+
+#endif // NAZARA_NULLRENDERER_RENDERPIPELINE_HPP
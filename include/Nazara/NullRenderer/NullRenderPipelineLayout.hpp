@@ -0,0 +1,43 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NULLRENDERER_RENDERPIPELINELAYOUT_HPP
+#define NAZARA_NULLRENDERER_RENDERPIPELINELAYOUT_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Renderer/RenderPipelineLayout.hpp>
+#include <Nazara/NullRenderer/Config.hpp>
+#include <Nazara/NullRenderer/NullShaderBinding.hpp>
+
+namespace Nz
+{
+	class NAZARA_NULLRENDERER_API NullRenderPipelineLayout : public RenderPipelineLayout
+	{
+		friend NullShaderBinding;
+
+		public:
+			NullRenderPipelineLayout(RenderPipelineLayoutInfo layoutInfo);
+			NullRenderPipelineLayout(const NullRenderPipelineLayout&) = delete;
+			NullRenderPipelineLayout(NullRenderPipelineLayout&&) = delete;
+			~NullRenderPipelineLayout() = default;
+
+			ShaderBindingPtr AllocateShaderBinding(UInt32 setIndex) override;
+
+			inline const RenderPipelineLayoutInfo& GetLayoutInfo() const;
+
+			NullRenderPipelineLayout& operator=(const NullRenderPipelineLayout&) = delete;
+			NullRenderPipelineLayout& operator=(NullRenderPipelineLayout&&) = delete;
+
+		private:
+			void Release(NullShaderBinding& binding);
+
+			RenderPipelineLayoutInfo m_layoutInfo;
+	};
+}
+
+#include <Nazara/NullRenderer/NullRenderPipelineLayout.inl>
+
+#endif // NAZARA_NULLRENDERER_RENDERPIPELINELAYOUT_HPP
@@ -0,0 +1,16 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullRenderPipelineLayout.hpp>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	inline const RenderPipelineLayoutInfo& NullRenderPipelineLayout::GetLayoutInfo() const
+	{
+		return m_layoutInfo;
+	}
+}
+
+#include <Nazara/NullRenderer/DebugOff.hpp>
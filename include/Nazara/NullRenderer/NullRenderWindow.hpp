@@ -0,0 +1,64 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NULLRENDERER_RENDERWINDOW_HPP
+#define NAZARA_NULLRENDERER_RENDERWINDOW_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Math/Vector2.hpp>
+#include <Nazara/Renderer/RenderWindowImpl.hpp>
+#include <Nazara/NullRenderer/Config.hpp>
+#include <Nazara/NullRenderer/NullFramebuffer.hpp>
+#include <Nazara/NullRenderer/NullRenderImage.hpp>
+#include <Nazara/NullRenderer/NullRenderPass.hpp>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace Nz
+{
+	class NullDevice;
+	class RenderWindow;
+
+	class NAZARA_NULLRENDERER_API NullRenderWindow : public RenderWindowImpl
+	{
+		public:
+			NullRenderWindow(RenderWindow& owner);
+			NullRenderWindow(std::shared_ptr<NullDevice> device, const Vector2ui& size);
+			~NullRenderWindow() = default;
+
+			RenderFrame Acquire() override;
+
+			bool Create(RendererImpl* renderer, RenderSurface* surface, const RenderWindowParameters& parameters) override;
+			std::shared_ptr<CommandPool> CreateCommandPool(QueueType queueType) override;
+
+			inline NullDevice& GetDevice();
+			const NullFramebuffer& GetFramebuffer(std::size_t i) const override;
+			std::size_t GetFramebufferCount() const override;
+			const NullRenderPass& GetRenderPass() const override;
+			const Vector2ui& GetSize() const override;
+
+			void Present();
+
+			void Resize(const Vector2ui& size);
+
+		private:
+			void CreateRenderImages();
+
+			std::optional<NullRenderPass> m_renderPass;
+			std::shared_ptr<NullDevice> m_device;
+			std::size_t m_currentFrame;
+			std::vector<std::unique_ptr<NullRenderImage>> m_renderImages;
+			NullFramebuffer m_framebuffer;
+			RenderWindow* m_owner;
+			Vector2ui m_size;
+			bool m_sizeChanged;
+	};
+}
+
+#include <Nazara/NullRenderer/NullRenderWindow.inl>
+
+#endif // NAZARA_NULLRENDERER_RENDERWINDOW_HPP
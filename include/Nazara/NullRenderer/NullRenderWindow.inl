@@ -0,0 +1,18 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullRenderWindow.hpp>
+#include <cassert>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	inline NullDevice& NullRenderWindow::GetDevice()
+	{
+		assert(m_device);
+		return *m_device;
+	}
+}
+
+#include <Nazara/NullRenderer/DebugOff.hpp>
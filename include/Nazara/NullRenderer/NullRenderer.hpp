@@ -0,0 +1,45 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NULLRENDERER_RENDERER_HPP
+#define NAZARA_NULLRENDERER_RENDERER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Renderer/RendererImpl.hpp>
+#include <Nazara/NullRenderer/Config.hpp>
+#include <Nazara/NullRenderer/NullDevice.hpp>
+#include <memory>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_NULLRENDERER_API NullRenderer : public RendererImpl
+	{
+		public:
+			NullRenderer() = default;
+			~NullRenderer() = default;
+
+			std::unique_ptr<RenderSurface> CreateRenderSurfaceImpl() override;
+			std::unique_ptr<RenderWindowImpl> CreateRenderWindowImpl(RenderWindow& owner) override;
+
+			std::shared_ptr<RenderDevice> InstanciateRenderDevice(std::size_t deviceIndex, const RenderDeviceFeatures& enabledFeatures) override;
+
+			bool Prepare(const ParameterList& parameters) override;
+
+			RenderAPI QueryAPI() const override;
+			std::string QueryAPIString() const override;
+			UInt32 QueryAPIVersion() const override;
+
+			const std::vector<RenderDeviceInfo>& QueryRenderDevices() const override;
+
+		private:
+			std::vector<RenderDeviceInfo> m_deviceInfos;
+	};
+}
+
+#include <Nazara/NullRenderer/NullRenderer.inl>
+
+#endif // NAZARA_NULLRENDERER_RENDERER_HPP
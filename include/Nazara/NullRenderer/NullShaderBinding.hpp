@@ -0,0 +1,48 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NULLRENDERER_SHADERBINDING_HPP
+#define NAZARA_NULLRENDERER_SHADERBINDING_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Renderer/ShaderBinding.hpp>
+#include <Nazara/NullRenderer/Config.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class NullRenderPipelineLayout;
+
+	class NAZARA_NULLRENDERER_API NullShaderBinding : public ShaderBinding
+	{
+		public:
+			inline NullShaderBinding(NullRenderPipelineLayout& owner, UInt32 setIndex);
+			NullShaderBinding(const NullShaderBinding&) = delete;
+			NullShaderBinding(NullShaderBinding&&) = delete;
+			~NullShaderBinding() = default;
+
+			inline const std::vector<Binding>& GetBindings() const;
+			inline NullRenderPipelineLayout& GetOwner();
+			inline const NullRenderPipelineLayout& GetOwner() const;
+			inline UInt32 GetSetIndex() const;
+
+			void Update(const Binding* bindings, std::size_t bindingCount) override;
+
+			NullShaderBinding& operator=(const NullShaderBinding&) = delete;
+			NullShaderBinding& operator=(NullShaderBinding&&) = delete;
+
+		private:
+			void Release() override;
+
+			std::vector<Binding> m_bindings;
+			NullRenderPipelineLayout& m_owner;
+			UInt32 m_setIndex;
+	};
+}
+
+#include <Nazara/NullRenderer/NullShaderBinding.inl>
+
+#endif // NAZARA_NULLRENDERER_SHADERBINDING_HPP
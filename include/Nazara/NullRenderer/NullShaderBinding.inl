@@ -0,0 +1,40 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullShaderBinding.hpp>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	inline NullShaderBinding::NullShaderBinding(NullRenderPipelineLayout& owner, UInt32 setIndex) :
+	m_owner(owner),
+	m_setIndex(setIndex)
+	{
+	}
+
+	/*!
+	* \brief Returns the current bindings, sorted by binding index
+	*/
+	inline auto NullShaderBinding::GetBindings() const -> const std::vector<Binding>&
+	{
+		return m_bindings;
+	}
+
+	inline NullRenderPipelineLayout& NullShaderBinding::GetOwner()
+	{
+		return m_owner;
+	}
+
+	inline const NullRenderPipelineLayout& NullShaderBinding::GetOwner() const
+	{
+		return m_owner;
+	}
+
+	inline UInt32 NullShaderBinding::GetSetIndex() const
+	{
+		return m_setIndex;
+	}
+}
+
+#include <Nazara/NullRenderer/DebugOff.hpp>
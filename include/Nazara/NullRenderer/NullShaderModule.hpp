@@ -0,0 +1,37 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NULLRENDERER_SHADERMODULE_HPP
+#define NAZARA_NULLRENDERER_SHADERMODULE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Renderer/Enums.hpp>
+#include <Nazara/Renderer/ShaderModule.hpp>
+#include <Nazara/NullRenderer/Config.hpp>
+
+namespace Nz
+{
+	class NAZARA_NULLRENDERER_API NullShaderModule : public ShaderModule
+	{
+		public:
+			inline NullShaderModule(ShaderStageTypeFlags shaderStages);
+			NullShaderModule(const NullShaderModule&) = delete;
+			NullShaderModule(NullShaderModule&&) = delete;
+			~NullShaderModule() = default;
+
+			inline ShaderStageTypeFlags GetStages() const;
+
+			NullShaderModule& operator=(const NullShaderModule&) = delete;
+			NullShaderModule& operator=(NullShaderModule&&) = delete;
+
+		private:
+			ShaderStageTypeFlags m_shaderStages;
+	};
+}
+
+#include <Nazara/NullRenderer/NullShaderModule.inl>
+
+#endif // NAZARA_NULLRENDERER_SHADERMODULE_HPP
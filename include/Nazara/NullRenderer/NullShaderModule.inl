@@ -0,0 +1,21 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullShaderModule.hpp>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	inline NullShaderModule::NullShaderModule(ShaderStageTypeFlags shaderStages) :
+	m_shaderStages(shaderStages)
+	{
+	}
+
+	inline ShaderStageTypeFlags NullShaderModule::GetStages() const
+	{
+		return m_shaderStages;
+	}
+}
+
+#include <Nazara/NullRenderer/DebugOff.hpp>
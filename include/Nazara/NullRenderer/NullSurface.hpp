@@ -0,0 +1,29 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NULLRENDERER_SURFACE_HPP
+#define NAZARA_NULLRENDERER_SURFACE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Renderer/RenderSurface.hpp>
+#include <Nazara/NullRenderer/Config.hpp>
+
+namespace Nz
+{
+	class NAZARA_NULLRENDERER_API NullSurface : public RenderSurface
+	{
+		public:
+			NullSurface() = default;
+			~NullSurface() = default;
+
+			bool Create(WindowHandle handle) override;
+			void Destroy() override;
+	};
+}
+
+#include <Nazara/NullRenderer/NullSurface.inl>
+
+#endif // NAZARA_NULLRENDERER_SURFACE_HPP
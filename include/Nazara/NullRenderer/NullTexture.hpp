@@ -0,0 +1,42 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NULLRENDERER_TEXTURE_HPP
+#define NAZARA_NULLRENDERER_TEXTURE_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Renderer/Texture.hpp>
+#include <Nazara/NullRenderer/Config.hpp>
+
+namespace Nz
+{
+	class NAZARA_NULLRENDERER_API NullTexture : public Texture
+	{
+		public:
+			inline NullTexture(const TextureInfo& params);
+			NullTexture(const NullTexture&) = delete;
+			NullTexture(NullTexture&&) = delete;
+			~NullTexture() = default;
+
+			PixelFormat GetFormat() const override;
+			inline const TextureInfo& GetInfo() const;
+			UInt8 GetLevelCount() const override;
+			Vector3ui GetSize(UInt8 level = 0) const override;
+			ImageType GetType() const override;
+
+			bool Update(const void* ptr) override;
+
+			NullTexture& operator=(const NullTexture&) = delete;
+			NullTexture& operator=(NullTexture&&) = delete;
+
+		private:
+			TextureInfo m_params;
+	};
+}
+
+#include <Nazara/NullRenderer/NullTexture.inl>
+
+#endif // NAZARA_NULLRENDERER_TEXTURE_HPP
@@ -0,0 +1,21 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullTexture.hpp>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	inline NullTexture::NullTexture(const TextureInfo& params) :
+	m_params(params)
+	{
+	}
+
+	inline const TextureInfo& NullTexture::GetInfo() const
+	{
+		return m_params;
+	}
+}
+
+#include <Nazara/NullRenderer/DebugOff.hpp>
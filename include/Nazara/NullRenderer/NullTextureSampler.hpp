@@ -0,0 +1,38 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_NULLRENDERER_TEXTURESAMPLER_HPP
+#define NAZARA_NULLRENDERER_TEXTURESAMPLER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Renderer/TextureSampler.hpp>
+#include <Nazara/NullRenderer/Config.hpp>
+
+namespace Nz
+{
+	class NullDevice;
+
+	class NAZARA_NULLRENDERER_API NullTextureSampler : public TextureSampler
+	{
+		public:
+			NullTextureSampler(NullDevice& device, TextureSamplerInfo samplerInfo);
+			NullTextureSampler(const NullTextureSampler&) = delete;
+			NullTextureSampler(NullTextureSampler&&) = delete;
+			~NullTextureSampler() = default;
+
+			inline const TextureSamplerInfo& GetSamplerInfo() const;
+
+			NullTextureSampler& operator=(const NullTextureSampler&) = delete;
+			NullTextureSampler& operator=(NullTextureSampler&&) = delete;
+
+		private:
+			TextureSamplerInfo m_samplerInfo;
+	};
+}
+
+#include <Nazara/NullRenderer/NullTextureSampler.inl>
+
+#endif // NAZARA_NULLRENDERER_TEXTURESAMPLER_HPP
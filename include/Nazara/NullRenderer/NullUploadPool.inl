@@ -0,0 +1,17 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullUploadPool.hpp>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	inline NullUploadPool::NullUploadPool(UInt64 blockSize) :
+	m_nextAllocationIndex(0),
+	m_blockSize(blockSize)
+	{
+	}
+}
+
+#include <Nazara/NullRenderer/DebugOff.hpp>
@@ -26,6 +26,7 @@ namespace Nz::GL
 			GLenum type;
 			GLboolean normalized;
 			GLsizei stride;
+			GLuint divisor;
 			const void* pointer;
 		};
 
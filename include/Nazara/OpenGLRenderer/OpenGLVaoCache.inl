@@ -38,6 +38,9 @@ namespace Nz::GL
 				if (lAttrib.stride != rAttrib.stride)
 					return false;
 
+				if (lAttrib.divisor != rAttrib.divisor)
+					return false;
+
 				if (lAttrib.pointer != rAttrib.pointer)
 					return false;
 			}
@@ -68,6 +71,7 @@ namespace Nz::GL
 				HashCombine(seed, attrib.type);
 				HashCombine(seed, attrib.normalized);
 				HashCombine(seed, attrib.stride);
+				HashCombine(seed, attrib.divisor);
 				HashCombine(seed, attrib.pointer);
 			}
 
@@ -50,6 +50,7 @@ namespace Nz::GL
 	{
 		DepthClamp,
 		SpirV,
+		TextureCompressionRgtc,
 		TextureCompressionS3tc,
 		TextureFilterAnisotropic,
 
@@ -11,10 +11,12 @@
 #include <Nazara/Core/Color.hpp>
 #include <Nazara/Core/Signal.hpp>
 #include <Nazara/Math/Angle.hpp>
+#include <Nazara/Math/Rect.hpp>
 #include <Nazara/Math/Vector2.hpp>
 #include <Nazara/Physics2D/Config.hpp>
 #include <Nazara/Physics2D/RigidBody2D.hpp>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <unordered_map>
 
@@ -44,10 +46,14 @@ namespace Nz
 		public:
 			struct Callback;
 			struct DebugDrawOptions;
+			struct NearestQuery;
 			struct NearestQueryResult;
 			struct RaycastHit;
+			struct RaycastQueryInfo;
+			struct RegionQueryInfo;
 
 			PhysWorld2D();
+			explicit PhysWorld2D(unsigned int solverThreadCount);
 			PhysWorld2D(const PhysWorld2D&) = delete;
 			PhysWorld2D(PhysWorld2D&&) = delete; ///TODO
 			~PhysWorld2D();
@@ -59,17 +65,24 @@ namespace Nz
 			cpSpace* GetHandle() const;
 			std::size_t GetIterationCount() const;
 			std::size_t GetMaxStepCount() const;
+			unsigned int GetSolverThreadCount() const;
 			float GetStepSize() const;
 
+			bool IsSolverThreaded() const;
+
 			bool NearestBodyQuery(const Vector2f& from, float maxDistance, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, RigidBody2D** nearestBody = nullptr);
 			bool NearestBodyQuery(const Vector2f& from, float maxDistance, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, NearestQueryResult* result);
+			std::size_t NearestBodyQuery(const NearestQuery* queries, std::size_t queryCount, NearestQueryResult* results);
 
 			void RaycastQuery(const Nz::Vector2f& from, const Nz::Vector2f& to, float radius, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, const std::function<void(const RaycastHit&)>& callback);
 			bool RaycastQuery(const Nz::Vector2f& from, const Nz::Vector2f& to, float radius, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, std::vector<RaycastHit>* hitInfos);
+			std::size_t RaycastQuery(const RaycastQueryInfo* queries, std::size_t queryCount, RaycastHit* hitInfos, std::size_t maxHitPerQuery, std::size_t* hitCounts);
 			bool RaycastQueryFirst(const Nz::Vector2f& from, const Nz::Vector2f& to, float radius, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, RaycastHit* hitInfo = nullptr);
+			std::size_t RaycastQueryFirst(const RaycastQueryInfo* queries, std::size_t queryCount, RaycastHit* hitInfos);
 
 			void RegionQuery(const Nz::Rectf& boundingBox, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, const std::function<void(Nz::RigidBody2D*)>& callback);
 			void RegionQuery(const Nz::Rectf& boundingBox, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, std::vector<Nz::RigidBody2D*>* bodies);
+			std::size_t RegionQuery(const RegionQueryInfo* queries, std::size_t queryCount, Nz::RigidBody2D** bodies, std::size_t maxBodyPerQuery, std::size_t* bodyCounts);
 
 			void RegisterCallbacks(unsigned int collisionId, Callback callbacks);
 			void RegisterCallbacks(unsigned int collisionIdA, unsigned int collisionIdB, Callback callbacks);
@@ -79,6 +92,7 @@ namespace Nz
 			void SetIterationCount(std::size_t iterationCount);
 			void SetMaxStepCount(std::size_t maxStepCount);
 			void SetSleepTime(float sleepTime);
+			void SetSolverThreadCount(unsigned int solverThreadCount);
 			void SetStepSize(float stepSize);
 
 			void Step(float timestep);
@@ -113,6 +127,15 @@ namespace Nz
 				void* userdata;
 			};
 
+			struct NearestQuery
+			{
+				Nz::Vector2f from;
+				float maxDistance;
+				Nz::UInt32 collisionGroup = 0;
+				Nz::UInt32 categoryMask = std::numeric_limits<Nz::UInt32>::max();
+				Nz::UInt32 collisionMask = std::numeric_limits<Nz::UInt32>::max();
+			};
+
 			struct NearestQueryResult
 			{
 				Nz::RigidBody2D* nearestBody;
@@ -129,11 +152,30 @@ namespace Nz
 				float fraction;
 			};
 
+			struct RaycastQueryInfo
+			{
+				Nz::Vector2f from;
+				Nz::Vector2f to;
+				float radius = 0.f;
+				Nz::UInt32 collisionGroup = 0;
+				Nz::UInt32 categoryMask = std::numeric_limits<Nz::UInt32>::max();
+				Nz::UInt32 collisionMask = std::numeric_limits<Nz::UInt32>::max();
+			};
+
+			struct RegionQueryInfo
+			{
+				Nz::Rectf boundingBox;
+				Nz::UInt32 collisionGroup = 0;
+				Nz::UInt32 categoryMask = std::numeric_limits<Nz::UInt32>::max();
+				Nz::UInt32 collisionMask = std::numeric_limits<Nz::UInt32>::max();
+			};
+
 			NazaraSignal(OnPhysWorld2DPreStep, const PhysWorld2D* /*physWorld*/, float /*invStepCount*/);
 			NazaraSignal(OnPhysWorld2DPostStep, const PhysWorld2D* /*physWorld*/, float /*invStepCount*/);
 
 		private:
 			void InitCallbacks(cpCollisionHandler* handler, Callback callbacks);
+			template<typename F> void ProcessQueries(std::size_t queryCount, F&& func);
 
 			using PostStep = std::function<void(Nz::RigidBody2D* body)>;
 
@@ -156,6 +198,8 @@ namespace Nz
 			std::unordered_map<cpCollisionHandler*, std::unique_ptr<Callback>> m_callbacks;
 			std::unordered_map<RigidBody2D*, PostStepContainer> m_rigidPostSteps;
 			cpSpace* m_handle;
+			bool m_isSolverThreaded;
+			bool m_usesSpatialHash;
 			float m_stepSize;
 			float m_timestepAccumulator;
 	};
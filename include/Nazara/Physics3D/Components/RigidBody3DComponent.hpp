@@ -8,6 +8,7 @@
 #define NAZARA_RIGIDBODYCOMPONENT_HPP
 
 #include <Nazara/Prerequisites.hpp>
+#include <Nazara/Physics3D/PhysWorld3D.hpp>
 #include <Nazara/Physics3D/RigidBody3D.hpp>
 
 namespace Nz
@@ -20,6 +21,11 @@ namespace Nz
 			RigidBody3DComponent(RigidBody3DComponent&&) noexcept = default;
 			~RigidBody3DComponent() = default;
 
+			using RigidBody3D::GetInterpolatedPosition;
+			using RigidBody3D::GetInterpolatedRotation;
+			inline Vector3f GetInterpolatedPosition() const;
+			inline Quaternionf GetInterpolatedRotation() const;
+
 			RigidBody3DComponent& operator=(const RigidBody3DComponent&) = default;
 			RigidBody3DComponent& operator=(RigidBody3DComponent&&) noexcept = default;
 	};
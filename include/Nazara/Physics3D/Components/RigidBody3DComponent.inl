@@ -7,6 +7,23 @@
 
 namespace Nz
 {
+	/*!
+	* \brief Interpolates the position of the body using the current interpolation factor of its world
+	* \return Position of the body between the last two steps of the world
+	*/
+	inline Vector3f RigidBody3DComponent::GetInterpolatedPosition() const
+	{
+		return GetInterpolatedPosition(GetWorld()->GetInterpolationFactor());
+	}
+
+	/*!
+	* \brief Interpolates the rotation of the body using the current interpolation factor of its world
+	* \return Rotation of the body between the last two steps of the world
+	*/
+	inline Quaternionf RigidBody3DComponent::GetInterpolatedRotation() const
+	{
+		return GetInterpolatedRotation(GetWorld()->GetInterpolationFactor());
+	}
 }
 
 #include <Nazara/Physics3D/DebugOff.hpp>
@@ -9,9 +9,11 @@
 
 #include <Nazara/Prerequisites.hpp>
 #include <Nazara/Core/MovablePtr.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Math/Box.hpp>
 #include <Nazara/Math/Vector3.hpp>
 #include <Nazara/Physics3D/Config.hpp>
+#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -42,11 +44,14 @@ namespace Nz
 
 			Vector3f GetGravity() const;
 			NewtonWorld* GetHandle() const;
+			float GetInterpolationFactor() const;
 			int GetMaterial(const std::string& name);
 			std::size_t GetMaxStepCount() const;
 			float GetStepSize() const;
 			unsigned int GetThreadCount() const;
 
+			bool IsStepping() const;
+
 			void SetGravity(const Vector3f& gravity);
 			void SetMaxStepCount(std::size_t maxStepCount);
 			void SetStepSize(float stepSize);
@@ -60,6 +65,9 @@ namespace Nz
 			void SetMaterialSurfaceThickness(int firstMaterial, int secondMaterial, float thickness);
 
 			void Step(float timestep);
+			void StepAsync(float timestep);
+
+			void WaitForStep();
 
 			PhysWorld3D& operator=(const PhysWorld3D&) = delete;
 			PhysWorld3D& operator=(PhysWorld3D&&) noexcept;
@@ -71,12 +79,15 @@ namespace Nz
 				CollisionCallback collisionCallback;
 			};
 
+			void SaveBodyPoses(bool previousPoses);
+
 			static int OnAABBOverlap(const NewtonJoint* const contact, float timestep, int threadIndex);
 			static void ProcessContact(const NewtonJoint* const contact, float timestep, int threadIndex);
 
 			std::unordered_map<Nz::UInt64, std::unique_ptr<Callback>> m_callbacks;
 			std::unordered_map<std::string, int> m_materialIds;
 			std::size_t m_maxStepCount;
+			std::unique_ptr<TaskScheduler::Counter> m_stepCounter;
 			MovablePtr<NewtonWorld> m_world;
 			Vector3f m_gravity;
 			float m_stepSize;
@@ -24,6 +24,8 @@ namespace Nz
 
 	class NAZARA_PHYSICS3D_API RigidBody3D
 	{
+		friend PhysWorld3D;
+
 		public:
 			RigidBody3D(PhysWorld3D* world, const Matrix4f& mat = Matrix4f::Identity());
 			RigidBody3D(PhysWorld3D* world, std::shared_ptr<Collider3D> geom, const Matrix4f& mat = Matrix4f::Identity());
@@ -44,6 +46,8 @@ namespace Nz
 			const std::shared_ptr<Collider3D>& GetGeom() const;
 			float GetGravityFactor() const;
 			NewtonBody* GetHandle() const;
+			Vector3f GetInterpolatedPosition(float interpolationFactor) const;
+			Quaternionf GetInterpolatedRotation(float interpolationFactor) const;
 			float GetLinearDamping() const;
 			Vector3f GetLinearVelocity() const;
 			float GetMass() const;
@@ -78,12 +82,18 @@ namespace Nz
 			RigidBody3D& operator=(RigidBody3D&& object) noexcept;
 
 		private:
+			void ResetStepPoses();
+			void SaveStepPose(bool previousPose);
 			void UpdateBody(const Matrix4f& transformMatrix);
 			static void ForceAndTorqueCallback(const NewtonBody* body, float timeStep, int threadIndex);
 
 			std::shared_ptr<Collider3D> m_geom;
 			MovablePtr<NewtonBody> m_body;
+			Quaternionf m_previousStepRotation;
+			Quaternionf m_stepRotation;
 			Vector3f m_forceAccumulator;
+			Vector3f m_previousStepPosition;
+			Vector3f m_stepPosition;
 			Vector3f m_torqueAccumulator;
 			PhysWorld3D* m_world;
 			void* m_userdata;
@@ -11,6 +11,7 @@
 #include <Nazara/Core/ECS.hpp>
 #include <Nazara/Physics3D/PhysWorld3D.hpp>
 #include <Nazara/Physics3D/Components/RigidBody3DComponent.hpp>
+#include <vector>
 
 namespace Nz
 {
@@ -24,19 +25,34 @@ namespace Nz
 
 			template<typename... Args> RigidBody3DComponent CreateRigidBody(Args&&... args);
 
+			inline void EnableAsyncStepping(bool enable = true);
+			inline void EnableInterpolation(bool enable = true);
+			inline void EnableParallelSync(bool enable = true);
+
 			inline PhysWorld3D& GetPhysWorld();
 			inline const PhysWorld3D& GetPhysWorld() const;
 
+			inline bool IsAsyncSteppingEnabled() const;
+			inline bool IsInterpolationEnabled() const;
+			inline bool IsParallelSyncEnabled() const;
+
 			void Update(entt::registry& registry, float elapsedTime);
 
 			Physics3DSystem& operator=(const Physics3DSystem&) = delete;
 			Physics3DSystem& operator=(Physics3DSystem&&) = delete;
 
 		private:
+			void SyncNodes(entt::registry& registry);
+
 			static void OnConstruct(entt::registry& registry, entt::entity entity);
 
 			entt::connection m_constructConnection;
+			std::vector<entt::entity> m_childEntities;
+			std::vector<entt::entity> m_rootEntities;
 			PhysWorld3D m_physWorld;
+			bool m_asyncStepping;
+			bool m_interpolation;
+			bool m_parallelSync;
 	};
 }
 
@@ -13,6 +13,49 @@ namespace Nz
 		return RigidBody3DComponent(&m_physWorld, std::forward<Args>(args)...);
 	}
 
+	/*!
+	* \brief Enables stepping the physics world on a TaskScheduler worker
+	*
+	* Update then replicates the result of the step started by the previous Update and starts a new one, which runs while the frame is rendered.
+	* This adds a frame of latency and, between Update calls, rigid bodies (including their creation) must not be accessed without calling PhysWorld3D::WaitForStep first.
+	*
+	* \param enable Should the world be stepped asynchronously
+	*
+	* \see EnableInterpolation
+	*/
+	inline void Physics3DSystem::EnableAsyncStepping(bool enable)
+	{
+		if (!enable)
+			m_physWorld.WaitForStep();
+
+		m_asyncStepping = enable;
+	}
+
+	/*!
+	* \brief Enables replication of interpolated rigid bodies transforms to nodes
+	*
+	* Nodes are then placed between the last two physics steps instead of the last one, which smoothes motion when the frame rate doesn't match the step size.
+	*
+	* \param enable Should transforms be interpolated
+	*/
+	inline void Physics3DSystem::EnableInterpolation(bool enable)
+	{
+		m_interpolation = enable;
+	}
+
+	/*!
+	* \brief Enables replication of rigid bodies transforms to nodes from multiple threads
+	*
+	* Nodes without parent are then updated concurrently by the TaskScheduler workers, which means their OnNodeInvalidation signal
+	* (and the one of their children) may be triggered from any thread. Only enable this if every slot connected to them is thread-safe.
+	*
+	* \param enable Should nodes be updated concurrently
+	*/
+	inline void Physics3DSystem::EnableParallelSync(bool enable)
+	{
+		m_parallelSync = enable;
+	}
+
 	inline PhysWorld3D& Physics3DSystem::GetPhysWorld()
 	{
 		return m_physWorld;
@@ -22,6 +65,21 @@ namespace Nz
 	{
 		return m_physWorld;
 	}
+
+	inline bool Physics3DSystem::IsAsyncSteppingEnabled() const
+	{
+		return m_asyncStepping;
+	}
+
+	inline bool Physics3DSystem::IsInterpolationEnabled() const
+	{
+		return m_interpolation;
+	}
+
+	inline bool Physics3DSystem::IsParallelSyncEnabled() const
+	{
+		return m_parallelSync;
+	}
 }
 
 #include <Nazara/Physics3D/DebugOff.hpp>
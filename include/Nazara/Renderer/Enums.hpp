@@ -112,6 +112,7 @@ namespace Nz
 		Direct3D, ///< Microsoft Render API, only works on MS platforms
 		Mantle,   ///< AMD Render API, Vulkan predecessor, only works on AMD GPUs
 		Metal,    ///< Apple Render API, only works on OS X platforms
+		Null,     ///< Headless renderer performing no GPU work, used for testing and CPU-side benchmarking
 		OpenGL,   ///< Khronos Render API, works on Web/Desktop/Mobile and some consoles
 		Vulkan,   ///< New Khronos Render API, made to replace OpenGL, works on desktop (Windows/Linux) and mobile (Android), and Apple platform using MoltenVK
 
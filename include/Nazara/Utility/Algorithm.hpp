@@ -32,8 +32,11 @@ namespace Nz
 		const Joint* joints;
 		const SkeletalMeshVertex* inputVertex;
 		MeshVertex* outputVertex;
+		const Matrix4f* skinningMatrices = nullptr; //< Skinning matrices of the joints (see ComputeSkinningMatrices), used instead of joints if set
 	};
 
+	using SkinFunction = void(*)(const SkinningData& data, unsigned int startVertex, unsigned int vertexCount);
+
 	struct VertexPointers
 	{
 		SparsePtr<Vector3f> normalPtr;
@@ -49,6 +52,7 @@ namespace Nz
 	NAZARA_UTILITY_API void ComputeCubicSphereIndexVertexCount(unsigned int subdivision, unsigned int* indexCount, unsigned int* vertexCount);
 	NAZARA_UTILITY_API void ComputeIcoSphereIndexVertexCount(unsigned int recursionLevel, unsigned int* indexCount, unsigned int* vertexCount);
 	NAZARA_UTILITY_API void ComputePlaneIndexVertexCount(const Vector2ui& subdivision, unsigned int* indexCount, unsigned int* vertexCount);
+	NAZARA_UTILITY_API void ComputeSkinningMatrices(const Joint* joints, std::size_t jointCount, Matrix4f* matrices);
 	NAZARA_UTILITY_API void ComputeUvSphereIndexVertexCount(unsigned int sliceCount, unsigned int stackCount, unsigned int* indexCount, unsigned int* vertexCount);
 
 	NAZARA_UTILITY_API void GenerateBox(const Vector3f& lengths, const Vector3ui& subdivision, const Matrix4f& matrix, const Rectf& textureCoords, VertexPointers vertexPointers, IndexIterator indices, Boxf* aabb = nullptr, unsigned int indexOffset = 0);
@@ -60,6 +64,8 @@ namespace Nz
 
 	NAZARA_UTILITY_API void OptimizeIndices(IndexIterator indices, unsigned int indexCount);
 
+	NAZARA_UTILITY_API void ParallelSkin(SkinFunction skinFunc, const SkinningData& data, unsigned int startVertex, unsigned int vertexCount, unsigned int grainSize = 0);
+
 	NAZARA_UTILITY_API void SkinPosition(const SkinningData& data, unsigned int startVertex, unsigned int vertexCount);
 	NAZARA_UTILITY_API void SkinPositionNormal(const SkinningData& data, unsigned int startVertex, unsigned int vertexCount);
 	NAZARA_UTILITY_API void SkinPositionNormalTangent(const SkinningData& data, unsigned int startVertex, unsigned int vertexCount);
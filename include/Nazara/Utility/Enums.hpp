@@ -157,6 +157,17 @@ namespace Nz
 		Max = CounterClockwise
 	};
 
+	enum class ImageFilter
+	{
+		Box,
+		Kaiser,
+		Triangle,
+
+		Max = Triangle
+	};
+
+	constexpr std::size_t ImageFilterCount = static_cast<std::size_t>(ImageFilter::Max) + 1;
+
 	enum class ImageType
 	{
 		E1D,
@@ -197,6 +208,8 @@ namespace Nz
 		Undefined = -1,
 
 		A8,              // 1*uint8
+		BC4,
+		BC5,
 		BGR8,            // 3*uint8
 		BGR8_SRGB,       // 3*uint8
 		BGRA8,           // 4*uint8
@@ -467,8 +480,9 @@ namespace Nz
 
 		// Predefined declarations for instancing
 		Matrix4,
+		Matrix4_Instance,
 
-		Max = Matrix4
+		Max = Matrix4_Instance
 	};
 
 	constexpr std::size_t VertexLayoutCount = static_cast<std::size_t>(VertexLayout::Max) + 1;
@@ -21,8 +21,6 @@
 #include <Nazara/Utility/CubemapParams.hpp>
 #include <atomic>
 
-///TODO: Filtres
-
 namespace Nz
 {
 	struct NAZARA_UTILITY_API ImageParams : ResourceParameters
@@ -69,6 +67,8 @@ namespace Nz
 			bool FlipHorizontally();
 			bool FlipVertically();
 
+			bool GenerateMipmaps(ImageFilter filter = ImageFilter::Box);
+
 			const UInt8* GetConstPixels(unsigned int x = 0, unsigned int y = 0, unsigned int z = 0, UInt8 level = 0) const;
 			unsigned int GetDepth(UInt8 level = 0) const override;
 			PixelFormat GetFormat() const override;
@@ -92,6 +92,8 @@ namespace Nz
 			bool LoadFaceFromMemory(CubemapFace face, const void* data, std::size_t size, const ImageParams& params = ImageParams());
 			bool LoadFaceFromStream(CubemapFace face, Stream& stream, const ImageParams& params = ImageParams());
 
+			bool Resize(const Vector3ui& size, ImageFilter filter = ImageFilter::Kaiser);
+
 			// Save
 			bool SaveToFile(const std::filesystem::path& filePath, const ImageParams& params = ImageParams());
 			bool SaveToStream(Stream& stream, const std::string& format, const ImageParams& params = ImageParams());
@@ -158,6 +160,7 @@ namespace Nz
 
 		private:
 			void EnsureOwnership();
+			Vector3ui GetResampledSize(UInt8 level) const;
 			void ReleaseImage();
 
 			SharedImage* m_sharedImage;
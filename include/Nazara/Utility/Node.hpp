@@ -95,6 +95,8 @@ namespace Nz
 			Node& operator=(const Node& node);
 			Node& operator=(Node&& node) noexcept;
 
+			static Quaternionf ScaleQuaternion(const Vector3f& scale, Quaternionf quaternion);
+
 			// Signals:
 			NazaraSignal(OnNodeInvalidation, const Node* /*node*/);
 			NazaraSignal(OnNodeNewParent, const Node* /*node*/, const Node* /*parent*/);
@@ -108,8 +110,6 @@ namespace Nz
 			virtual void UpdateDerived() const;
 			virtual void UpdateTransformMatrix() const;
 
-			static Quaternionf ScaleQuaternion(const Vector3f& scale, Quaternionf quaternion);
-
 			mutable std::vector<Node*> m_childs;
 			mutable Matrix4f m_transformMatrix;
 			mutable Quaternionf m_derivedRotation;
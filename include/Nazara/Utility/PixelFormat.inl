@@ -151,10 +151,12 @@ namespace Nz
 		{
 			switch (format)
 			{
+				case PixelFormat::BC4:
+				case PixelFormat::BC5:
 				case PixelFormat::DXT1:
 				case PixelFormat::DXT3:
 				case PixelFormat::DXT5:
-					return (((width + 3) / 4) * ((height + 3) / 4) * ((format == PixelFormat::DXT1) ? 8 : 16)) * depth;
+					return (((width + 3) / 4) * ((height + 3) / 4) * ((format == PixelFormat::BC4 || format == PixelFormat::DXT1) ? 8 : 16)) * depth;
 
 				default:
 					NazaraError("Unsupported format");
@@ -198,7 +200,7 @@ namespace Nz
 			return true;
 		}
 
-		ConvertFunction func = s_convertFunctions[UnderlyingCast(srcFormat)][UnderlyingCast(dstFormat)];
+		const ConvertFunction& func = s_convertFunctions[UnderlyingCast(srcFormat)][UnderlyingCast(dstFormat)];
 		if (!func)
 		{
 			NazaraError("Pixel format conversion from " + GetName(srcFormat) + " to " + GetName(dstFormat) + " is not supported");
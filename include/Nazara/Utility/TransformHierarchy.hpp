@@ -0,0 +1,94 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_TRANSFORMHIERARCHY_HPP
+#define NAZARA_TRANSFORMHIERARCHY_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/Signal.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Utility/Config.hpp>
+#include <Nazara/Utility/Enums.hpp>
+#include <limits>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_UTILITY_API TransformHierarchy
+	{
+		public:
+			TransformHierarchy();
+			TransformHierarchy(const TransformHierarchy&) = delete;
+			TransformHierarchy(TransformHierarchy&&) noexcept = default;
+			~TransformHierarchy() = default;
+
+			std::size_t CreateNode(std::size_t parent = InvalidNode);
+			void DestroyNode(std::size_t node);
+
+			inline std::size_t GetNodeCount() const;
+			std::size_t GetParent(std::size_t node) const;
+			inline const Vector3f& GetPosition(std::size_t node, CoordSys coordSys = CoordSys::Local) const;
+			inline const Quaternionf& GetRotation(std::size_t node, CoordSys coordSys = CoordSys::Local) const;
+			inline const Vector3f& GetScale(std::size_t node, CoordSys coordSys = CoordSys::Local) const;
+			inline const Matrix4f& GetTransformMatrix(std::size_t node) const;
+
+			inline bool IsValid(std::size_t node) const;
+
+			void SetParent(std::size_t node, std::size_t parent = InvalidNode);
+			inline void SetPosition(std::size_t node, const Vector3f& position);
+			inline void SetRotation(std::size_t node, const Quaternionf& rotation);
+			inline void SetScale(std::size_t node, const Vector3f& scale);
+
+			void Update(bool useParallelism = false);
+
+			TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+			TransformHierarchy& operator=(TransformHierarchy&&) noexcept = default;
+
+			static constexpr std::size_t InvalidNode = std::numeric_limits<std::size_t>::max();
+
+			// Signals:
+			NazaraSignal(OnTransformsUpdated, TransformHierarchy* /*hierarchy*/, const std::vector<std::size_t>& /*updatedNodes*/);
+
+		private:
+			inline std::size_t GetIndex(std::size_t node) const;
+			inline void Invalidate(std::size_t index);
+			void Reorder();
+			void UpdateRange(std::size_t begin, std::size_t end);
+
+			struct Transform
+			{
+				Quaternionf rotation;
+				Vector3f position;
+				Vector3f scale;
+			};
+
+			static constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
+
+			// Indexed by node
+			std::vector<std::size_t> m_freeNodes;
+			std::vector<std::size_t> m_nodeIndices;
+
+			// Indexed by position in the hierarchy (sorted by depth, parents come before their children)
+			std::vector<Matrix4f> m_transformMatrices;
+			std::vector<Transform> m_globalTransforms;
+			std::vector<Transform> m_localTransforms;
+			std::vector<std::size_t> m_depths;
+			std::vector<std::size_t> m_indexNodes;
+			std::vector<std::size_t> m_parentIndices;
+			std::vector<UInt8> m_dirtyFlags; //< Not a Bitset as nodes of a same depth are updated concurrently
+
+			std::vector<std::size_t> m_levelOffsets;
+			std::vector<std::size_t> m_updatedNodes;
+			std::size_t m_firstDirtyIndex;
+			bool m_orderInvalidated;
+	};
+}
+
+#include <Nazara/Utility/TransformHierarchy.inl>
+
+#endif // NAZARA_TRANSFORMHIERARCHY_HPP
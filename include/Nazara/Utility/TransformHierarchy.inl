@@ -0,0 +1,138 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/TransformHierarchy.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <cassert>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Gets the number of nodes of the hierarchy
+	* \return Number of valid nodes
+	*/
+	inline std::size_t TransformHierarchy::GetNodeCount() const
+	{
+		return m_nodeIndices.size() - m_freeNodes.size();
+	}
+
+	/*!
+	* \brief Gets the position of a node
+	* \return Position of the node, global positions are the ones computed by the last Update
+	*
+	* \param node Node identifier
+	* \param coordSys Coordinate system of the position
+	*/
+	inline const Vector3f& TransformHierarchy::GetPosition(std::size_t node, CoordSys coordSys) const
+	{
+		std::size_t index = GetIndex(node);
+		return (coordSys == CoordSys::Global) ? m_globalTransforms[index].position : m_localTransforms[index].position;
+	}
+
+	/*!
+	* \brief Gets the rotation of a node
+	* \return Rotation of the node, global rotations are the ones computed by the last Update
+	*
+	* \param node Node identifier
+	* \param coordSys Coordinate system of the rotation
+	*/
+	inline const Quaternionf& TransformHierarchy::GetRotation(std::size_t node, CoordSys coordSys) const
+	{
+		std::size_t index = GetIndex(node);
+		return (coordSys == CoordSys::Global) ? m_globalTransforms[index].rotation : m_localTransforms[index].rotation;
+	}
+
+	/*!
+	* \brief Gets the scale of a node
+	* \return Scale of the node, global scales are the ones computed by the last Update
+	*
+	* \param node Node identifier
+	* \param coordSys Coordinate system of the scale
+	*/
+	inline const Vector3f& TransformHierarchy::GetScale(std::size_t node, CoordSys coordSys) const
+	{
+		std::size_t index = GetIndex(node);
+		return (coordSys == CoordSys::Global) ? m_globalTransforms[index].scale : m_localTransforms[index].scale;
+	}
+
+	/*!
+	* \brief Gets the global transform matrix of a node
+	* \return Transform matrix computed by the last Update
+	*
+	* \param node Node identifier
+	*/
+	inline const Matrix4f& TransformHierarchy::GetTransformMatrix(std::size_t node) const
+	{
+		return m_transformMatrices[GetIndex(node)];
+	}
+
+	/*!
+	* \brief Checks whether a node identifier refers to a node of this hierarchy
+	* \return true if the node exists
+	*
+	* \param node Node identifier
+	*/
+	inline bool TransformHierarchy::IsValid(std::size_t node) const
+	{
+		return node < m_nodeIndices.size() && m_nodeIndices[node] != InvalidIndex;
+	}
+
+	/*!
+	* \brief Sets the local position of a node
+	*
+	* \param node Node identifier
+	* \param position New position relative to the parent
+	*/
+	inline void TransformHierarchy::SetPosition(std::size_t node, const Vector3f& position)
+	{
+		std::size_t index = GetIndex(node);
+		m_localTransforms[index].position = position;
+
+		Invalidate(index);
+	}
+
+	/*!
+	* \brief Sets the local rotation of a node
+	*
+	* \param node Node identifier
+	* \param rotation New rotation relative to the parent
+	*/
+	inline void TransformHierarchy::SetRotation(std::size_t node, const Quaternionf& rotation)
+	{
+		std::size_t index = GetIndex(node);
+		m_localTransforms[index].rotation = rotation;
+
+		Invalidate(index);
+	}
+
+	/*!
+	* \brief Sets the local scale of a node
+	*
+	* \param node Node identifier
+	* \param scale New scale relative to the parent
+	*/
+	inline void TransformHierarchy::SetScale(std::size_t node, const Vector3f& scale)
+	{
+		std::size_t index = GetIndex(node);
+		m_localTransforms[index].scale = scale;
+
+		Invalidate(index);
+	}
+
+	inline std::size_t TransformHierarchy::GetIndex(std::size_t node) const
+	{
+		NazaraAssert(IsValid(node), "Invalid node");
+		return m_nodeIndices[node];
+	}
+
+	inline void TransformHierarchy::Invalidate(std::size_t index)
+	{
+		m_dirtyFlags[index] = 1;
+		m_firstDirtyIndex = std::min(m_firstDirtyIndex, index);
+	}
+}
+
+#include <Nazara/Utility/DebugOff.hpp>
@@ -31,6 +31,7 @@ namespace Nz
 			struct ComponentEntry;
 
 			VertexDeclaration(VertexInputRate inputRate, std::initializer_list<ComponentEntry> components);
+			VertexDeclaration(VertexInputRate inputRate, const std::vector<ComponentEntry>& components);
 			VertexDeclaration(const VertexDeclaration&) = delete;
 			VertexDeclaration(VertexDeclaration&&) = delete;
 			~VertexDeclaration() = default;
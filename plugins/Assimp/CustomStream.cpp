@@ -6,6 +6,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
 #include <Nazara/Core/File.hpp>
+#include <Nazara/Core/MappedFile.hpp>
 #include <Nazara/Utility/Mesh.hpp>
 #include <assimp/cfileio.h>
 #include <assimp/cimport.h>
@@ -111,9 +112,24 @@ aiFile* StreamOpener(aiFileIO* fileIO, const char* filePath, const char* openMod
 		if (!std::strchr(openMode, 'b'))
 			openModeEnum |= OpenMode::Text;
 
-		std::unique_ptr<File> file = std::make_unique<File>();
-		if (!file->Open(filePath, openModeEnum))
-			return nullptr;
+		std::unique_ptr<Stream> file;
+
+		// Map read-only files in memory, falling back to regular files if that's not possible
+		if (openModeEnum == OpenMode::ReadOnly || openModeEnum == (OpenMode::ReadOnly | OpenMode::Text))
+		{
+			std::unique_ptr<MappedFile> mappedFile = std::make_unique<MappedFile>();
+			if (mappedFile->Open(filePath))
+				file = std::move(mappedFile);
+		}
+
+		if (!file)
+		{
+			std::unique_ptr<File> regularFile = std::make_unique<File>();
+			if (!regularFile->Open(filePath, openModeEnum))
+				return nullptr;
+
+			file = std::move(regularFile);
+		}
 
 		stream = reinterpret_cast<char*>(file.release());
 	}
@@ -136,7 +152,7 @@ void StreamCloser(aiFileIO* fileIO, aiFile* file)
 	Stream* fileUserdata = reinterpret_cast<Stream*>(file->UserData);
 
 	if (fileUserdata != fileIOUserdata->originalStream)
-		delete reinterpret_cast<File*>(file->UserData);
+		delete fileUserdata;
 
 	delete file;
 }
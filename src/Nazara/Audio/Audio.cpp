@@ -26,7 +26,7 @@ namespace Nz
 	* \brief Audio class that represents the module initializer of Audio
 	*/
 
-	Audio::Audio(Config /*config*/) :
+	Audio::Audio(Config config) :
 	ModuleBase("Audio", this)
 	{
 		// Initialisation of OpenAL
@@ -36,6 +36,9 @@ namespace Nz
 		// Definition of the orientation by default
 		SetListenerDirection(Vector3f::Forward());
 
+		m_audioStreamer = std::make_unique<AudioStreamer>();
+		m_soundBufferCache = std::make_unique<SoundBufferCache>(std::move(config.soundBufferCacheDirectory));
+
 		// Loaders
 		m_soundBufferLoader.RegisterLoader(Loaders::GetSoundBufferLoader_drwav());
 		m_soundStreamLoader.RegisterLoader(Loaders::GetSoundStreamLoader_drwav());
@@ -49,6 +52,9 @@ namespace Nz
 
 	Audio::~Audio()
 	{
+		// Streamed sources must be released before OpenAL
+		m_audioStreamer.reset();
+
 		OpenAL::Uninitialize();
 	}
 
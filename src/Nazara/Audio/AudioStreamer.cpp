@@ -0,0 +1,506 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Audio/AudioStreamer.hpp>
+#include <Nazara/Audio/Algorithm.hpp>
+#include <Nazara/Audio/OpenAL.hpp>
+#include <Nazara/Audio/SoundStream.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <Nazara/Audio/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		constexpr std::size_t CacheLineSize = 64;
+
+		constexpr std::chrono::microseconds MinWaitDuration = std::chrono::milliseconds(2);
+		constexpr std::chrono::microseconds MaxWaitDuration = std::chrono::milliseconds(100);
+
+		// Single producer (decoder) single consumer (streamer thread) ring buffer
+		// Its capacity is kept as-is (and not rounded to a power of two) so that contiguous spans of a buffer sized in frames are made of whole frames
+		template<typename T>
+		class SpscRingBuffer
+		{
+			public:
+				SpscRingBuffer(std::size_t capacity) :
+				m_data(capacity),
+				m_readIndex(0),
+				m_writeIndex(0)
+				{
+				}
+
+				std::size_t GetCapacity() const
+				{
+					return m_data.size();
+				}
+
+				std::size_t GetReadableCount() const
+				{
+					return m_writeIndex.load(std::memory_order_acquire) - m_readIndex.load(std::memory_order_relaxed);
+				}
+
+				// Contiguous readable part, data before the end of the storage
+				std::pair<const T*, std::size_t> GetReadSpan() const
+				{
+					std::size_t readIndex = m_readIndex.load(std::memory_order_relaxed);
+					std::size_t readableCount = m_writeIndex.load(std::memory_order_acquire) - readIndex;
+
+					std::size_t offset = readIndex % m_data.size();
+					return { &m_data[offset], std::min(readableCount, m_data.size() - offset) };
+				}
+
+				// Contiguous writable part, space before the end of the storage
+				std::pair<T*, std::size_t> GetWriteSpan()
+				{
+					std::size_t writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+					std::size_t writableCount = m_data.size() - (writeIndex - m_readIndex.load(std::memory_order_acquire));
+
+					std::size_t offset = writeIndex % m_data.size();
+					return { &m_data[offset], std::min(writableCount, m_data.size() - offset) };
+				}
+
+				void CommitRead(std::size_t count)
+				{
+					m_readIndex.store(m_readIndex.load(std::memory_order_relaxed) + count, std::memory_order_release);
+				}
+
+				void CommitWrite(std::size_t count)
+				{
+					m_writeIndex.store(m_writeIndex.load(std::memory_order_relaxed) + count, std::memory_order_release);
+				}
+
+			private:
+				std::vector<T> m_data;
+				alignas(CacheLineSize) std::atomic<std::size_t> m_readIndex;
+				alignas(CacheLineSize) std::atomic<std::size_t> m_writeIndex;
+		};
+	}
+
+	class AudioStreamer::StreamedSource
+	{
+		public:
+			StreamedSource(std::size_t decodedSampleCount) :
+			decodedSamples(decodedSampleCount)
+			{
+			}
+
+			struct QueuedBuffer
+			{
+				ALuint buffer;
+				std::size_t sampleCount;
+			};
+
+			std::array<ALuint, NAZARA_AUDIO_STREAMED_BUFFER_COUNT> buffers;
+			std::atomic_bool endOfStream = false;
+			std::atomic_bool loop = false;
+			std::deque<QueuedBuffer> queuedBuffers;
+			std::shared_ptr<SoundStream> stream;
+			std::size_t bufferSampleCount;
+			std::vector<ALuint> freeBuffers;
+			std::vector<Int16> uploadBuffer;
+			SpscRingBuffer<Int16> decodedSamples;
+			TaskScheduler::Counter decodeCounter;
+			ALenum audioFormat;
+			ALuint source;
+			UInt64 decodeOffset;
+			UInt64 playedSamples;
+			bool finished = false;
+			unsigned int channelCount;
+			unsigned int sampleRate;
+	};
+
+	/*!
+	* \ingroup audio
+	* \class Nz::AudioStreamer
+	* \brief Audio class streaming every music from a single thread
+	*
+	* The streamer thread only refills OpenAL buffer queues, and sleeps until the buffer being played is about to be consumed (or until it's woken up).
+	* Sound streams are decoded ahead into a ring buffer per source by the TaskScheduler workers.
+	*
+	* \remark The streamer is owned by the Audio module, see Audio::GetAudioStreamer
+	*/
+	AudioStreamer::AudioStreamer() :
+	m_running(false),
+	m_wakeRequested(false)
+	{
+	}
+
+	AudioStreamer::~AudioStreamer()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_running = false;
+		}
+
+		m_wakeCondition.notify_one();
+
+		if (m_thread.joinable())
+			m_thread.join();
+
+		for (auto& streamedSourcePtr : m_streamedSources)
+			ReleaseSource(*streamedSourcePtr);
+	}
+
+	/*!
+	* \brief Enables or disables the looping of a streamed source
+	*
+	* \param streamedSource Source returned by Start
+	* \param loop Should the sound stream loop
+	*/
+	void AudioStreamer::EnableLooping(StreamedSource* streamedSource, bool loop)
+	{
+		NazaraAssert(streamedSource, "invalid streamed source");
+
+		streamedSource->loop = loop;
+		Wake();
+	}
+
+	/*!
+	* \brief Gets the number of samples played by a streamed source
+	* \return Sample count (including the sample offset given to Start and every channel)
+	*
+	* \param streamedSource Source returned by Start
+	*/
+	UInt64 AudioStreamer::GetPlayedSampleCount(const StreamedSource* streamedSource) const
+	{
+		NazaraAssert(streamedSource, "invalid streamed source");
+
+		// Prevent the streamer thread from unqueuing buffers while we're getting the count
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		ALint sampleOffset = 0;
+		alGetSourcei(streamedSource->source, AL_SAMPLE_OFFSET, &sampleOffset);
+
+		return streamedSource->playedSamples + UInt64(sampleOffset) * streamedSource->channelCount;
+	}
+
+	/*!
+	* \brief Gets the number of sources being streamed (including finished ones which weren't stopped yet)
+	* \return Streamed source count
+	*/
+	std::size_t AudioStreamer::GetStreamedSourceCount() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_streamedSources.size();
+	}
+
+	/*!
+	* \brief Checks whether a streamed source has played its whole sound stream
+	* \return true if the end of the stream was reached and played (never happens when looping)
+	*
+	* \param streamedSource Source returned by Start
+	*/
+	bool AudioStreamer::IsFinished(const StreamedSource* streamedSource) const
+	{
+		NazaraAssert(streamedSource, "invalid streamed source");
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return streamedSource->finished;
+	}
+
+	/*!
+	* \brief Starts streaming a sound stream to an OpenAL source
+	* \return Streamed source which must be passed to Stop
+	*
+	* The first second of the stream is decoded on the calling thread and the source starts playing before this returns.
+	*
+	* \param source OpenAL source, it must not be used by anything else until Stop is called
+	* \param soundStream Sound stream to read samples from
+	* \param sampleOffset Offset (in samples, counting every channel) to start reading from
+	* \param loop Should the sound stream loop
+	*/
+	auto AudioStreamer::Start(unsigned int source, std::shared_ptr<SoundStream> soundStream, UInt64 sampleOffset, bool loop) -> StreamedSource*
+	{
+		NazaraAssert(soundStream, "invalid sound stream");
+
+		AudioFormat format = soundStream->GetFormat();
+		unsigned int channelCount = GetChannelCount(format);
+		unsigned int sampleRate = soundStream->GetSampleRate();
+
+		// Decoders read whole frames, keep the decoded samples buffer sized in frames
+		std::size_t decodedSampleCount = channelCount * std::size_t(sampleRate * DecodeAheadDuration.count() / 1000);
+
+		auto streamedSourcePtr = std::make_unique<StreamedSource>(decodedSampleCount);
+		StreamedSource& streamedSource = *streamedSourcePtr;
+		streamedSource.audioFormat = OpenAL::AudioFormat[UnderlyingCast(format)];
+		streamedSource.bufferSampleCount = std::size_t(channelCount * sampleRate * BufferDuration.count() / 1000);
+		streamedSource.channelCount = channelCount;
+		streamedSource.decodeOffset = sampleOffset;
+		streamedSource.loop = loop;
+		streamedSource.playedSamples = sampleOffset;
+		streamedSource.sampleRate = sampleRate;
+		streamedSource.source = source;
+		streamedSource.stream = std::move(soundStream);
+
+		// Decode on the calling thread to start playing right away (and report decoding errors)
+		Decode(streamedSource);
+
+		alGenBuffers(NAZARA_AUDIO_STREAMED_BUFFER_COUNT, streamedSource.buffers.data());
+		streamedSource.freeBuffers.assign(streamedSource.buffers.rbegin(), streamedSource.buffers.rend());
+
+		while (!streamedSource.freeBuffers.empty() && FillBuffer(streamedSource, streamedSource.freeBuffers.back()))
+			streamedSource.freeBuffers.pop_back();
+
+		alSourcePlay(source);
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_streamedSources.push_back(std::move(streamedSourcePtr));
+			m_wakeRequested = true;
+
+			if (!m_running)
+			{
+				m_running = true;
+				m_thread = std::thread(&AudioStreamer::StreamerThread, this);
+			}
+		}
+
+		m_wakeCondition.notify_one();
+
+		return &streamedSource;
+	}
+
+	/*!
+	* \brief Stops streaming a source
+	*
+	* The OpenAL source is stopped and its buffer queue is cleared, the streamed source is then destroyed.
+	*
+	* \param streamedSource Source returned by Start
+	*/
+	void AudioStreamer::Stop(StreamedSource* streamedSource)
+	{
+		NazaraAssert(streamedSource, "invalid streamed source");
+
+		std::unique_ptr<StreamedSource> streamedSourcePtr;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			auto it = std::find_if(m_streamedSources.begin(), m_streamedSources.end(), [&](const std::unique_ptr<StreamedSource>& ptr) { return ptr.get() == streamedSource; });
+			NazaraAssert(it != m_streamedSources.end(), "streamed source is not registered");
+
+			streamedSourcePtr = std::move(*it);
+			*it = std::move(m_streamedSources.back());
+			m_streamedSources.pop_back();
+		}
+
+		ReleaseSource(*streamedSourcePtr);
+	}
+
+	/*!
+	* \brief Wakes the streamer thread up, to refill buffer queues as soon as possible
+	*/
+	void AudioStreamer::Wake()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_wakeRequested = true;
+		}
+
+		m_wakeCondition.notify_one();
+	}
+
+	bool AudioStreamer::FillBuffer(StreamedSource& streamedSource, unsigned int buffer)
+	{
+		auto& decodedSamples = streamedSource.decodedSamples;
+
+		std::size_t sampleCount = std::min(decodedSamples.GetReadableCount(), streamedSource.bufferSampleCount);
+		sampleCount -= sampleCount % streamedSource.channelCount;
+		if (sampleCount == 0)
+			return false;
+
+		auto [samples, contiguousCount] = decodedSamples.GetReadSpan();
+		if (contiguousCount >= sampleCount)
+		{
+			alBufferData(buffer, streamedSource.audioFormat, samples, static_cast<ALsizei>(sampleCount * sizeof(Int16)), static_cast<ALsizei>(streamedSource.sampleRate));
+			decodedSamples.CommitRead(sampleCount);
+		}
+		else
+		{
+			// Samples wrap around the end of the ring buffer
+			streamedSource.uploadBuffer.resize(sampleCount);
+			std::memcpy(&streamedSource.uploadBuffer[0], samples, contiguousCount * sizeof(Int16));
+			decodedSamples.CommitRead(contiguousCount);
+
+			std::tie(samples, std::ignore) = decodedSamples.GetReadSpan();
+			std::memcpy(&streamedSource.uploadBuffer[contiguousCount], samples, (sampleCount - contiguousCount) * sizeof(Int16));
+			decodedSamples.CommitRead(sampleCount - contiguousCount);
+
+			alBufferData(buffer, streamedSource.audioFormat, &streamedSource.uploadBuffer[0], static_cast<ALsizei>(sampleCount * sizeof(Int16)), static_cast<ALsizei>(streamedSource.sampleRate));
+		}
+
+		ALuint alBuffer = buffer;
+		alSourceQueueBuffers(streamedSource.source, 1, &alBuffer);
+		streamedSource.queuedBuffers.push_back({ alBuffer, sampleCount });
+
+		return true;
+	}
+
+	void AudioStreamer::ReleaseSource(StreamedSource& streamedSource)
+	{
+		// A decoding task may still be writing into the ring buffer
+		TaskScheduler::WaitFor(streamedSource.decodeCounter);
+
+		alSourceStop(streamedSource.source);
+
+		// Every buffer is processed once the source is stopped
+		for (const auto& queuedBuffer : streamedSource.queuedBuffers)
+		{
+			ALuint buffer = queuedBuffer.buffer;
+			alSourceUnqueueBuffers(streamedSource.source, 1, &buffer);
+		}
+
+		alDeleteBuffers(NAZARA_AUDIO_STREAMED_BUFFER_COUNT, streamedSource.buffers.data());
+	}
+
+	void AudioStreamer::StreamerThread()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		while (m_running)
+		{
+			std::chrono::microseconds waitDuration = MaxWaitDuration;
+			for (auto& streamedSourcePtr : m_streamedSources)
+				waitDuration = std::min(waitDuration, UpdateSource(*streamedSourcePtr));
+
+			waitDuration = std::max(waitDuration, MinWaitDuration);
+
+			m_wakeCondition.wait_for(lock, waitDuration, [&] { return m_wakeRequested || !m_running; });
+			m_wakeRequested = false;
+		}
+	}
+
+	void AudioStreamer::SubmitDecode(StreamedSource& streamedSource)
+	{
+		TaskScheduler::Submit([this, &streamedSource]
+		{
+			try
+			{
+				Decode(streamedSource);
+			}
+			catch (const std::exception& e)
+			{
+				NazaraError("failed to decode sound stream: " + std::string(e.what()));
+				streamedSource.endOfStream = true;
+				streamedSource.loop = false;
+			}
+
+			// Sources may be starving
+			Wake();
+		}, &streamedSource.decodeCounter);
+	}
+
+	std::chrono::microseconds AudioStreamer::UpdateSource(StreamedSource& streamedSource)
+	{
+		if (streamedSource.finished)
+			return MaxWaitDuration;
+
+		ALint state;
+		alGetSourcei(streamedSource.source, AL_SOURCE_STATE, &state);
+
+		ALint processedCount = 0;
+		alGetSourcei(streamedSource.source, AL_BUFFERS_PROCESSED, &processedCount);
+		for (ALint i = 0; i < processedCount; ++i)
+		{
+			ALuint buffer;
+			alSourceUnqueueBuffers(streamedSource.source, 1, &buffer);
+
+			assert(!streamedSource.queuedBuffers.empty() && streamedSource.queuedBuffers.front().buffer == buffer);
+			streamedSource.playedSamples += streamedSource.queuedBuffers.front().sampleCount;
+			streamedSource.queuedBuffers.pop_front();
+			streamedSource.freeBuffers.push_back(buffer);
+		}
+
+		while (!streamedSource.freeBuffers.empty() && FillBuffer(streamedSource, streamedSource.freeBuffers.back()))
+			streamedSource.freeBuffers.pop_back();
+
+		bool isDecoding = !streamedSource.decodeCounter.IsDone();
+		bool hasMoreSamples = !streamedSource.endOfStream || streamedSource.loop;
+
+		// Decode ahead once half of the decoded samples were consumed
+		if (!isDecoding && hasMoreSamples && streamedSource.decodedSamples.GetReadableCount() <= streamedSource.decodedSamples.GetCapacity() / 2)
+		{
+			SubmitDecode(streamedSource);
+			isDecoding = true;
+		}
+
+		if (state == AL_STOPPED)
+		{
+			if (!streamedSource.queuedBuffers.empty())
+			{
+				// The source ran out of buffers before we refilled it, resume playing
+				alSourcePlay(streamedSource.source);
+			}
+			else if (!isDecoding && !hasMoreSamples && streamedSource.decodedSamples.GetReadableCount() == 0)
+			{
+				streamedSource.finished = true;
+				return MaxWaitDuration;
+			}
+		}
+		else if (state != AL_PLAYING)
+			return MaxWaitDuration; //< paused sources don't consume their buffers
+
+		if (streamedSource.queuedBuffers.empty())
+			return MaxWaitDuration; //< the decoding task will wake us up
+
+		// Sleep until the buffer being played is consumed
+		ALint sampleOffset = 0;
+		alGetSourcei(streamedSource.source, AL_SAMPLE_OFFSET, &sampleOffset);
+
+		UInt64 frameCount = streamedSource.queuedBuffers.front().sampleCount / streamedSource.channelCount;
+		UInt64 remainingFrames = (frameCount > UInt64(sampleOffset)) ? frameCount - sampleOffset : 0;
+
+		return std::chrono::microseconds(remainingFrames * 1'000'000 / streamedSource.sampleRate);
+	}
+
+	void AudioStreamer::Decode(StreamedSource& streamedSource)
+	{
+		SoundStream& stream = *streamedSource.stream;
+
+		std::lock_guard<std::mutex> lock(stream.GetMutex());
+
+		// Sound streams may be shared between musics
+		stream.Seek(streamedSource.decodeOffset);
+		streamedSource.endOfStream = false;
+
+		bool rewound = false;
+		for (;;)
+		{
+			auto [samples, writableCount] = streamedSource.decodedSamples.GetWriteSpan();
+			writableCount -= writableCount % streamedSource.channelCount;
+			if (writableCount == 0)
+				break;
+
+			UInt64 sampleRead = stream.Read(samples, writableCount);
+			streamedSource.decodedSamples.CommitWrite(sampleRead);
+
+			// Decoders may read less than asked for, only an empty read means we reached the end of the stream
+			if (sampleRead == 0)
+			{
+				// Seek back to the beginning, unless we just did (empty stream)
+				if (streamedSource.loop && !rewound)
+				{
+					stream.Seek(0);
+					rewound = true;
+					continue;
+				}
+
+				streamedSource.endOfStream = true;
+				break;
+			}
+
+			rewound = false;
+		}
+
+		streamedSource.decodeOffset = stream.Tell();
+	}
+}
@@ -132,7 +132,7 @@ namespace Nz
 				sampleCount = wav.totalPCMFrameCount;
 			}
 			
-			return std::make_shared<SoundBuffer>(format, sampleCount, wav.sampleRate, samples.get());
+			return std::make_shared<SoundBuffer>(format, sampleCount, wav.sampleRate, std::move(samples));
 		}
 
 		class drwavStream : public SoundStream
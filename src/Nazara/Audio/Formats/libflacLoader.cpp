@@ -304,7 +304,7 @@ namespace Nz
 				sampleCount = frameCount;
 			}
 			
-			return std::make_shared<SoundBuffer>(format, sampleCount, sampleRate, samples.get());
+			return std::make_shared<SoundBuffer>(format, sampleCount, sampleRate, std::move(samples));
 		}
 
 		class libflacStream : public SoundStream
@@ -212,7 +212,7 @@ namespace Nz
 				sampleCount = frameCount;
 			}
 			
-			return std::make_shared<SoundBuffer>(format, sampleCount, info->rate, samples.get());
+			return std::make_shared<SoundBuffer>(format, sampleCount, info->rate, std::move(samples));
 		}
 
 		class libvorbisStream : public SoundStream
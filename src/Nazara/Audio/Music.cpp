@@ -4,15 +4,11 @@
 
 #include <Nazara/Audio/Music.hpp>
 #include <Nazara/Audio/Algorithm.hpp>
+#include <Nazara/Audio/Audio.hpp>
+#include <Nazara/Audio/AudioStreamer.hpp>
 #include <Nazara/Audio/OpenAL.hpp>
 #include <Nazara/Audio/SoundStream.hpp>
-#include <Nazara/Core/CallOnExit.hpp>
-#include <array>
-#include <atomic>
-#include <chrono>
 #include <memory>
-#include <thread>
-#include <vector>
 #include <Nazara/Audio/Debug.hpp>
 
 namespace Nz
@@ -22,18 +18,15 @@ namespace Nz
 	* \class Nz::Music
 	* \brief Audio class that represents a music
 	*
+	* Musics are streamed by the AudioStreamer of the Audio module, which doesn't spawn a thread per music.
+	*
 	* \remark Module Audio needs to be initialized to use this class
 	*/
 
 	struct MusicImpl
 	{
-		ALenum audioFormat;
-		std::atomic_bool streaming = false;
-		std::atomic<UInt64> processedSamples;
-		std::vector<Int16> chunkSamples;
-		std::mutex bufferLock;
+		AudioStreamer::StreamedSource* streamedSource = nullptr;
 		std::shared_ptr<SoundStream> stream;
-		std::thread thread;
 		UInt64 streamOffset;
 		bool loop = false;
 		unsigned int sampleRate;
@@ -65,12 +58,8 @@ namespace Nz
 
 		Destroy();
 
-		AudioFormat format = soundStream->GetFormat();
-
 		m_impl = std::make_unique<MusicImpl>();
 		m_impl->sampleRate = soundStream->GetSampleRate();
-		m_impl->audioFormat = OpenAL::AudioFormat[UnderlyingCast(format)];
-		m_impl->chunkSamples.resize(GetChannelCount(format) * m_impl->sampleRate); // One second of samples
 		m_impl->stream = std::move(soundStream);
 
 		SetPlayingOffset(0);
@@ -87,7 +76,7 @@ namespace Nz
 	{
 		if (m_impl)
 		{
-			StopThread();
+			StopStreaming();
 
 			m_impl.reset();
 		}
@@ -105,6 +94,9 @@ namespace Nz
 		NazaraAssert(m_impl, "Music not created");
 
 		m_impl->loop = loop;
+
+		if (m_impl->streamedSource)
+			Audio::Instance()->GetAudioStreamer().EnableLooping(m_impl->streamedSource, loop);
 	}
 
 	/*!
@@ -143,13 +135,13 @@ namespace Nz
 	{
 		NazaraAssert(m_impl, "Music not created");
 
-		// Prevent music thread from enqueing new buffers while we're getting the count
-		std::lock_guard<std::mutex> lock(m_impl->bufferLock);
-
-		ALint samples = 0;
-		alGetSourcei(m_source, AL_SAMPLE_OFFSET, &samples);
+		UInt64 playedSamples;
+		if (m_impl->streamedSource)
+			playedSamples = Audio::Instance()->GetAudioStreamer().GetPlayedSampleCount(m_impl->streamedSource);
+		else
+			playedSamples = m_impl->streamOffset;
 
-		return static_cast<UInt32>((1000ULL * (samples + (m_impl->processedSamples / GetChannelCount(m_impl->stream->GetFormat())))) / m_impl->sampleRate);
+		return static_cast<UInt32>((1000ULL * (playedSamples / GetChannelCount(m_impl->stream->GetFormat()))) / m_impl->sampleRate);
 	}
 
 	/*!
@@ -190,8 +182,8 @@ namespace Nz
 
 		SoundStatus status = GetInternalStatus();
 
-		// To compensate any delays (or the timelaps between Play() and the thread startup)
-		if (m_impl->streaming && status == SoundStatus::Stopped)
+		// The source may have run out of buffers until the streamer refills it
+		if (m_impl->streamedSource && status == SoundStatus::Stopped && !Audio::Instance()->GetAudioStreamer().IsFinished(m_impl->streamedSource))
 			status = SoundStatus::Playing;
 
 		return status;
@@ -286,42 +278,36 @@ namespace Nz
 	{
 		NazaraAssert(m_impl, "Music not created");
 
+		AudioStreamer& audioStreamer = Audio::Instance()->GetAudioStreamer();
+
 		// Maybe we are already playing
-		if (m_impl->streaming)
+		if (m_impl->streamedSource)
 		{
-			switch (GetStatus())
+			if (!audioStreamer.IsFinished(m_impl->streamedSource))
 			{
-				case SoundStatus::Playing:
-					SetPlayingOffset(0);
-					break;
-
-				case SoundStatus::Paused:
-					alSourcePlay(m_source);
-					break;
-
-				default:
-					break; // We shouldn't be stopped
-			}
-		}
-		else
-		{
-			std::mutex mutex;
-			std::condition_variable cv;
-
-			// Starting streaming thread
-			m_impl->streaming = true;
+				switch (GetStatus())
+				{
+					case SoundStatus::Playing:
+						SetPlayingOffset(0);
+						break;
 
-			std::exception_ptr exceptionPtr;
+					case SoundStatus::Paused:
+						alSourcePlay(m_source);
+						break;
 
-			std::unique_lock<std::mutex> lock(mutex);
-			m_impl->thread = std::thread(&Music::MusicThread, this, std::ref(cv), std::ref(mutex), std::ref(exceptionPtr));
+					default:
+						break; // We shouldn't be stopped
+				}
 
-			// Wait until thread signal it has properly started (or an error occurred)
-			cv.wait(lock);
+				return;
+			}
 
-			if (exceptionPtr)
-				std::rethrow_exception(exceptionPtr);
+			// We reached the end of the music, play it again
+			StopStreaming();
+			m_impl->streamOffset = 0;
 		}
+
+		m_impl->streamedSource = audioStreamer.Start(m_source, m_impl->stream, m_impl->streamOffset, m_impl->loop);
 	}
 
 	/*!
@@ -337,15 +323,12 @@ namespace Nz
 	{
 		NazaraAssert(m_impl, "Music not created");
 
-		bool isPlaying = m_impl->streaming;
+		bool isPlaying = (m_impl->streamedSource != nullptr);
 
 		if (isPlaying)
-			Stop();
-
-		UInt64 sampleOffset = UInt64(offset) * m_impl->sampleRate * GetChannelCount(m_impl->stream->GetFormat()) / 1000ULL;
+			StopStreaming();
 
-		m_impl->processedSamples = sampleOffset;
-		m_impl->streamOffset = sampleOffset;
+		m_impl->streamOffset = UInt64(offset) * m_impl->sampleRate * GetChannelCount(m_impl->stream->GetFormat()) / 1000ULL;
 
 		if (isPlaying)
 			Play();
@@ -360,148 +343,18 @@ namespace Nz
 	{
 		NazaraAssert(m_impl, "Music not created");
 
-		StopThread();
+		StopStreaming();
 		SetPlayingOffset(0);
 	}
 
 	Music& Music::operator=(Music&&) noexcept = default;
 
-	bool Music::FillAndQueueBuffer(unsigned int buffer)
-	{
-		std::size_t sampleCount = m_impl->chunkSamples.size();
-		std::size_t sampleRead = 0;
-		{
-			std::lock_guard<std::mutex> lock(m_impl->stream->GetMutex());
-
-			m_impl->stream->Seek(m_impl->streamOffset);
-
-			// Fill the buffer by reading from the stream
-			for (;;)
-			{
-				sampleRead += m_impl->stream->Read(&m_impl->chunkSamples[sampleRead], sampleCount - sampleRead);
-				if (sampleRead < sampleCount && m_impl->loop)
-				{
-					// In case we read less than expected, assume we reached the end of the stream and seek back to the beginning
-					m_impl->stream->Seek(0);
-					continue;
-				}
-
-				// Either we read the size we wanted, either we're not looping
-				break;
-			}
-
-			m_impl->streamOffset = m_impl->stream->Tell();
-		}
-
-		// Update the buffer (send it to OpenAL) and queue it if we got any data
-		if (sampleRead > 0)
-		{
-			alBufferData(buffer, m_impl->audioFormat, &m_impl->chunkSamples[0], static_cast<ALsizei>(sampleRead*sizeof(Int16)), static_cast<ALsizei>(m_impl->sampleRate));
-			alSourceQueueBuffers(m_source, 1, &buffer);
-		}
-
-		return sampleRead != sampleCount; // End of stream (Does not happen when looping)
-	}
-
-	void Music::MusicThread(std::condition_variable& cv, std::mutex& m, std::exception_ptr& err)
+	void Music::StopStreaming()
 	{
-		// Allocation of streaming buffers
-		std::array<ALuint, NAZARA_AUDIO_STREAMED_BUFFER_COUNT> buffers;
-		alGenBuffers(NAZARA_AUDIO_STREAMED_BUFFER_COUNT, buffers.data());
-
-		CallOnExit freebuffers([&]
-		{
-			alDeleteBuffers(NAZARA_AUDIO_STREAMED_BUFFER_COUNT, buffers.data());
-		});
-
-
-		try
-		{
-			for (ALuint buffer : buffers)
-			{
-				if (FillAndQueueBuffer(buffer))
-					break; // We have reached the end of the stream, there is no use to add new buffers
-			}
-		}
-		catch (const std::exception&)
+		if (m_impl->streamedSource)
 		{
-			err = std::current_exception();
-
-			std::unique_lock<std::mutex> lock(m);
-			cv.notify_all();
-			return;
+			Audio::Instance()->GetAudioStreamer().Stop(m_impl->streamedSource);
+			m_impl->streamedSource = nullptr;
 		}
-		
-		CallOnExit unqueueBuffers([&]
-		{
-			// We delete buffers from the stream
-			ALint queuedBufferCount;
-			alGetSourcei(m_source, AL_BUFFERS_QUEUED, &queuedBufferCount);
-
-			ALuint buffer;
-			for (ALint i = 0; i < queuedBufferCount; ++i)
-				alSourceUnqueueBuffers(m_source, 1, &buffer);
-		});
-
-		alSourcePlay(m_source);
-		
-		CallOnExit stopSource([&]
-		{
-			// Stop playing of the sound (in the case where it has not been already done)
-			alSourceStop(m_source);
-		});
-
-		// Signal we're good
-		{
-			std::unique_lock<std::mutex> lock(m);
-			cv.notify_all();
-		} // m & cv no longer exists from here
-
-		// Reading loop (Filling new buffers as playing)
-		while (m_impl->streaming)
-		{
-			// The reading has stopped, we have reached the end of the stream
-			SoundStatus status = GetInternalStatus();
-			if (status == SoundStatus::Stopped)
-			{
-				m_impl->streaming = false;
-				break;
-			}
-
-			{
-				std::lock_guard<std::mutex> lock(m_impl->bufferLock);
-
-				// We treat read buffers
-				ALint processedCount = 0;
-				alGetSourcei(m_source, AL_BUFFERS_PROCESSED, &processedCount);
-				while (processedCount--)
-				{
-					ALuint buffer;
-					alSourceUnqueueBuffers(m_source, 1, &buffer);
-
-					ALint bits, size;
-					alGetBufferi(buffer, AL_BITS, &bits);
-					alGetBufferi(buffer, AL_SIZE, &size);
-
-					if (bits != 0)
-						m_impl->processedSamples += (8 * size) / bits;
-
-					if (FillAndQueueBuffer(buffer))
-						break;
-				}
-			}
-
-			// We go back to sleep
-			std::this_thread::sleep_for(std::chrono::milliseconds(50));
-		}
-	}
-
-	void Music::StopThread()
-	{
-		if (m_impl->streaming)
-			m_impl->streaming = false;
-
-		if (m_impl->thread.joinable())
-			m_impl->thread.join();
 	}
 }
@@ -11,6 +11,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <Nazara/Audio/Debug.hpp>
 
@@ -36,6 +37,12 @@ namespace Nz
 		return true;
 	}
 
+	namespace
+	{
+		// Sound buffers may be created from multiple threads (see LoadFromFileAsync), this prevents them from consuming each other OpenAL errors
+		std::mutex s_bufferCreationMutex;
+	}
+
 	struct SoundBufferImpl
 	{
 		ALuint buffer;
@@ -74,6 +81,32 @@ namespace Nz
 		#endif
 	}
 
+	/*!
+	* \brief Constructs a SoundBuffer object, taking ownership of the samples
+	*
+	* \param format Format for the audio
+	* \param sampleCount Number of samples
+	* \param sampleRate Rate of samples
+	* \param samples Samples raw data, which will be kept by the sound buffer without being copied
+	*
+	* \remark Produces a NazaraError if creation went wrong with NAZARA_AUDIO_SAFE defined
+	* \remark Produces a std::runtime_error if creation went wrong with NAZARA_AUDIO_SAFE defined
+	*
+	* \see Create
+	*/
+	SoundBuffer::SoundBuffer(AudioFormat format, UInt64 sampleCount, UInt32 sampleRate, std::unique_ptr<Int16[]> samples)
+	{
+		Create(format, sampleCount, sampleRate, std::move(samples));
+
+		#ifdef NAZARA_DEBUG
+		if (!m_impl)
+		{
+			NazaraError("Failed to create sound buffer");
+			throw std::runtime_error("Constructor failed");
+		}
+		#endif
+	}
+
 	SoundBuffer::~SoundBuffer() = default;
 
 	/*!
@@ -89,6 +122,35 @@ namespace Nz
 	* this could happen if parameters are invalid or creation of OpenAL buffers failed
 	*/
 	bool SoundBuffer::Create(AudioFormat format, UInt64 sampleCount, UInt32 sampleRate, const Int16* samples)
+	{
+		#if NAZARA_AUDIO_SAFE
+		if (!samples)
+		{
+			NazaraError("Invalid sample source");
+			return false;
+		}
+		#endif
+
+		std::unique_ptr<Int16[]> sampleCopy = std::make_unique<Int16[]>(sampleCount);
+		std::memcpy(&sampleCopy[0], samples, sampleCount*sizeof(Int16));
+
+		return Create(format, sampleCount, sampleRate, std::move(sampleCopy));
+	}
+
+	/*!
+	* \brief Creates the SoundBuffer object, taking ownership of the samples
+	* \return true if creation is successful
+	*
+	* \param format Format for the audio
+	* \param sampleCount Number of samples
+	* \param sampleRate Rate of samples
+	* \param samples Samples raw data, which will be kept by the sound buffer without being copied
+	*
+	* \remark Produces a NazaraError if creation went wrong with NAZARA_AUDIO_SAFE defined,
+	* this could happen if parameters are invalid or creation of OpenAL buffers failed
+	* \remark This can be called from any thread
+	*/
+	bool SoundBuffer::Create(AudioFormat format, UInt64 sampleCount, UInt32 sampleRate, std::unique_ptr<Int16[]> samples)
 	{
 		Destroy();
 
@@ -118,6 +180,8 @@ namespace Nz
 		}
 		#endif
 
+		std::unique_lock<std::mutex> lock(s_bufferCreationMutex);
+
 		// We empty the error stack
 		while (alGetError() != AL_NO_ERROR);
 
@@ -131,7 +195,7 @@ namespace Nz
 
 		CallOnExit clearBufferOnExit([buffer] () { alDeleteBuffers(1, &buffer); });
 
-		alBufferData(buffer, OpenAL::AudioFormat[UnderlyingCast(format)], samples, static_cast<ALsizei>(sampleCount*sizeof(Int16)), static_cast<ALsizei>(sampleRate));
+		alBufferData(buffer, OpenAL::AudioFormat[UnderlyingCast(format)], samples.get(), static_cast<ALsizei>(sampleCount*sizeof(Int16)), static_cast<ALsizei>(sampleRate));
 
 		if (alGetError() != AL_NO_ERROR)
 		{
@@ -139,14 +203,15 @@ namespace Nz
 			return false;
 		}
 
+		lock.unlock();
+
 		m_impl = std::make_unique<SoundBufferImpl>();
 		m_impl->buffer = buffer;
 		m_impl->duration = static_cast<UInt32>((1000ULL*sampleCount / (GetChannelCount(format) * sampleRate)));
 		m_impl->format = format;
 		m_impl->sampleCount = sampleCount;
 		m_impl->sampleRate = sampleRate;
-		m_impl->samples = std::make_unique<Int16[]>(sampleCount);
-		std::memcpy(&m_impl->samples[0], samples, sampleCount*sizeof(Int16));
+		m_impl->samples = std::move(samples);
 
 		clearBufferOnExit.Reset();
 
@@ -263,7 +328,30 @@ namespace Nz
 		Audio* audio = Audio::Instance();
 		NazaraAssert(audio, "Audio module has not been initialized");
 
-		return audio->GetSoundBufferLoader().LoadFromFile(filePath, params);
+		// The cache forwards to the loaders on its own when it is disabled
+		return audio->GetSoundBufferCache().LoadFromFile(filePath, params);
+	}
+
+	/*!
+	* \brief Loads the sound buffer from file on a task scheduler worker
+	*
+	* Decoding and buffer creation both happen on the worker, allowing multiple files to be decoded in parallel.
+	*
+	* \param filePath Path to the file
+	* \param callback Function called from the worker with the loaded sound buffer (or nullptr on failure)
+	* \param counter Optional counter to wait on for the load (and callback) completion
+	* \param params Parameters for the sound buffer
+	*
+	* \see LoadFromFile
+	*/
+	void SoundBuffer::LoadFromFileAsync(std::filesystem::path filePath, LoadCallback callback, TaskScheduler::Counter* counter, const SoundBufferParams& params)
+	{
+		NazaraAssert(callback, "Invalid callback");
+
+		TaskScheduler::Submit([filePath = std::move(filePath), callback = std::move(callback), params]
+		{
+			callback(LoadFromFile(filePath, params));
+		}, counter);
 	}
 
 	/*!
@@ -0,0 +1,195 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Audio module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Audio/SoundBufferCache.hpp>
+#include <Nazara/Audio/Audio.hpp>
+#include <Nazara/Audio/SoundBuffer.hpp>
+#include <Nazara/Core/AbstractHash.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/MappedFile.hpp>
+#include <functional>
+#include <thread>
+#include <Nazara/Audio/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		constexpr UInt32 CacheMagicNumber = 0x4D43504E; //< "NPCM"
+
+		struct CacheHeader
+		{
+			UInt32 magic;
+			UInt32 format;
+			UInt32 sampleRate;
+			UInt32 padding;
+			UInt64 sampleCount;
+		};
+	}
+
+	/*!
+	* \ingroup audio
+	* \class Nz::SoundBufferCache
+	* \brief Audio class storing decoded samples on disk, addressed by the hash of the encoded file content
+	*
+	* Loading a file already present in the cache only reads back its samples, skipping the decoder (which is especially costly for Vorbis and FLAC).
+	*/
+	SoundBufferCache::SoundBufferCache(std::filesystem::path cacheDirectory) :
+	m_hitCount(0),
+	m_missCount(0),
+	m_cacheDirectory(std::move(cacheDirectory))
+	{
+		m_isEnabled = !m_cacheDirectory.empty();
+		if (m_isEnabled)
+		{
+			std::error_code ec;
+			std::filesystem::create_directories(m_cacheDirectory, ec);
+			if (ec)
+			{
+				NazaraWarning("failed to create sound buffer cache directory " + m_cacheDirectory.generic_u8string() + ": " + ec.message() + ", sound buffer cache is disabled");
+				m_isEnabled = false;
+			}
+		}
+	}
+
+	/*!
+	* \brief Loads a sound buffer from a file, using the cached samples if this file content was already decoded
+	* \return The loaded sound buffer or nullptr on failure
+	*
+	* \param filePath Path to the file
+	* \param params Parameters for the sound buffer
+	*
+	* \remark This function can be called from multiple threads at once
+	*/
+	std::shared_ptr<SoundBuffer> SoundBufferCache::LoadFromFile(const std::filesystem::path& filePath, const SoundBufferParams& params)
+	{
+		Audio* audio = Audio::Instance();
+		NazaraAssert(audio, "Audio module has not been initialized");
+
+		MappedFile mappedFile;
+		if (!m_isEnabled || !mappedFile.Open(filePath) || mappedFile.GetSize() == 0)
+			return audio->GetSoundBufferLoader().LoadFromFile(filePath, params);
+
+		std::filesystem::path cachePath = ComputeCachePath(mappedFile.GetData(), mappedFile.GetSize(), params);
+
+		std::shared_ptr<SoundBuffer> soundBuffer = LoadSamples(cachePath);
+		if (soundBuffer)
+		{
+			m_hitCount.fetch_add(1, std::memory_order_relaxed);
+
+			soundBuffer->SetFilePath(filePath);
+			return soundBuffer;
+		}
+
+		m_missCount.fetch_add(1, std::memory_order_relaxed);
+
+		soundBuffer = audio->GetSoundBufferLoader().LoadFromStream(mappedFile, params);
+		if (!soundBuffer)
+			return nullptr;
+
+		soundBuffer->SetFilePath(filePath);
+
+		StoreSamples(cachePath, *soundBuffer);
+
+		return soundBuffer;
+	}
+
+	std::filesystem::path SoundBufferCache::ComputeCachePath(const UInt8* fileData, UInt64 fileSize, const SoundBufferParams& params) const
+	{
+		std::unique_ptr<AbstractHash> hash = AbstractHash::Get(HashType::SHA256);
+		hash->Begin();
+
+		auto AppendValue = [&](auto value)
+		{
+			hash->Append(reinterpret_cast<const UInt8*>(&value), sizeof(value));
+		};
+
+		hash->Append(fileData, static_cast<std::size_t>(fileSize));
+		AppendValue(UInt8(params.forceMono));
+		AppendValue(DecoderVersion);
+
+		std::filesystem::path cachePath = m_cacheDirectory / hash->End().ToHex();
+		cachePath += ".pcm";
+
+		return cachePath;
+	}
+
+	std::shared_ptr<SoundBuffer> SoundBufferCache::LoadSamples(const std::filesystem::path& cachePath) const
+	{
+		std::error_code ec;
+		if (!std::filesystem::is_regular_file(cachePath, ec))
+			return nullptr;
+
+		File file(cachePath, OpenMode::ReadOnly);
+		if (!file.IsOpen())
+			return nullptr;
+
+		CacheHeader header;
+		if (file.Read(&header, sizeof(header)) != sizeof(header) || header.magic != CacheMagicNumber ||
+		    header.format >= AudioFormatCount || header.sampleRate == 0 || header.sampleCount == 0 ||
+		    file.GetSize() != sizeof(header) + header.sampleCount * sizeof(Int16))
+		{
+			NazaraWarning("ignoring corrupted sound buffer cache entry " + cachePath.generic_u8string());
+			return nullptr;
+		}
+
+		// Samples are read straight into the buffer storage, which the sound buffer takes ownership of
+		std::unique_ptr<Int16[]> samples(new Int16[header.sampleCount]); //< every sample is overwritten by the read, skip make_unique zero-initialization
+
+		std::size_t sampleSize = static_cast<std::size_t>(header.sampleCount * sizeof(Int16));
+		if (file.Read(samples.get(), sampleSize) != sampleSize)
+		{
+			NazaraWarning("ignoring corrupted sound buffer cache entry " + cachePath.generic_u8string());
+			return nullptr;
+		}
+
+		std::shared_ptr<SoundBuffer> soundBuffer = std::make_shared<SoundBuffer>();
+		if (!soundBuffer->Create(static_cast<AudioFormat>(header.format), header.sampleCount, header.sampleRate, std::move(samples)))
+			return nullptr;
+
+		return soundBuffer;
+	}
+
+	void SoundBufferCache::StoreSamples(const std::filesystem::path& cachePath, const SoundBuffer& soundBuffer) const
+	{
+		CacheHeader header;
+		header.magic = CacheMagicNumber;
+		header.format = static_cast<UInt32>(soundBuffer.GetFormat());
+		header.sampleRate = soundBuffer.GetSampleRate();
+		header.padding = 0;
+		header.sampleCount = soundBuffer.GetSampleCount();
+
+		// Write to a temporary file and rename it so other threads and processes never read a partial entry
+		std::filesystem::path tempPath = cachePath;
+		tempPath += "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+
+		{
+			File file(tempPath, OpenMode::WriteOnly | OpenMode::Truncate);
+			if (!file.IsOpen())
+			{
+				NazaraWarning("failed to open " + tempPath.generic_u8string() + " for writing");
+				return;
+			}
+
+			std::size_t sampleSize = static_cast<std::size_t>(header.sampleCount * sizeof(Int16));
+			if (file.Write(&header, sizeof(header)) != sizeof(header) || file.Write(soundBuffer.GetSamples(), sampleSize) != sampleSize)
+			{
+				NazaraWarning("failed to write sound buffer cache entry " + tempPath.generic_u8string());
+				file.Close();
+				file.Delete();
+				return;
+			}
+		}
+
+		std::error_code ec;
+		std::filesystem::rename(tempPath, cachePath, ec);
+		if (ec)
+		{
+			NazaraWarning("failed to store sound buffer cache entry " + cachePath.generic_u8string() + ": " + ec.message());
+			std::filesystem::remove(tempPath, ec);
+		}
+	}
+}
@@ -21,33 +21,39 @@ namespace Nz
 	void EmptyStream::Clear()
 	{
 		m_size = 0;
+
+		ResetBuffer();
 	}
 
 	/*!
-	* \brief Checks whether the stream reached the end of the stream
-	* \return Always false
+	* \brief Gets the size of the raw memory (how many bytes would have been written on a regular stream)
+	* \return Size occupied until now
 	*/
-	bool EmptyStream::EndOfStream() const
+	UInt64 EmptyStream::GetSize() const
 	{
-		return false;
+		return m_size;
 	}
 
 	/*!
-	* \brief Gets the position of the cursor (which is always zero)
-	* \return Always zero
+	* \brief Flushes the stream (does nothing)
 	*/
-	UInt64 EmptyStream::GetCursorPos() const
+	void EmptyStream::FlushStream()
 	{
-		return 0;
+		// Nothing to flush
 	}
 
 	/*!
-	* \brief Gets the size of the raw memory (how many bytes would have been written on a regular stream)
-	* \return Size occupied until now
+	* \brief Reads data
+	* \return Number of byte read (always zero)
+	*
+	* Reading from an empty stream does nothing and will always returns zero
+	*
+	* \param buffer Preallocated buffer to contain information read
+	* \param size Size of the read and thus of the buffer
 	*/
-	UInt64 EmptyStream::GetSize() const
+	std::size_t EmptyStream::ReadBlock(void* /*buffer*/, std::size_t /*size*/)
 	{
-		return m_size;
+		return 0;
 	}
 
 	/*!
@@ -56,31 +62,27 @@ namespace Nz
 	*
 	* \param offset Offset according to the beginning of the stream
 	*/
-	bool EmptyStream::SetCursorPos(UInt64 /*offset*/)
+	bool EmptyStream::SeekStreamCursor(UInt64 /*offset*/)
 	{
 		return true;
 	}
 
 	/*!
-	* \brief Flushes the stream (does nothing)
+	* \brief Gets the position of the cursor (which is always zero)
+	* \return Always zero
 	*/
-	void EmptyStream::FlushStream()
+	UInt64 EmptyStream::TellStreamCursor() const
 	{
-		// Nothing to flush
+		return 0;
 	}
 
 	/*!
-	* \brief Reads data
-	* \return Number of byte read (always zero)
-	*
-	* Reading from an empty stream does nothing and will always returns zero
-	*
-	* \param buffer Preallocated buffer to contain information read
-	* \param size Size of the read and thus of the buffer
+	* \brief Checks whether the stream reached the end of the stream
+	* \return Always false
 	*/
-	std::size_t EmptyStream::ReadBlock(void* /*buffer*/, std::size_t /*size*/)
+	bool EmptyStream::TestStreamEnd() const
 	{
-		return 0;
+		return false;
 	}
 
 	/*!
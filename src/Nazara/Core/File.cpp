@@ -83,12 +83,15 @@ namespace Nz
 
 	/*!
 	* \brief Closes the file
+	*
+	* Data pending in the write buffer is written before closing the file
 	*/
 
 	void File::Close()
 	{
 		if (m_impl)
 		{
+			FlushBuffer();
 			m_impl.reset();
 
 			m_openMode = OpenMode::NotOpen;
@@ -111,34 +114,12 @@ namespace Nz
 	* \brief Checks whether the file has reached the end
 	* \return true if cursor is at the end of the file
 	*
-	* \remark Produces a NazaraError if file is not open with NAZARA_CORE_SAFE defined
+	* \see EndOfStream
 	*/
 
 	bool File::EndOfFile() const
 	{
-		#if NAZARA_CORE_SAFE
-		if (!IsOpen())
-		{
-			NazaraError("File not open");
-			return false;
-		}
-		#endif
-
-		return m_impl->EndOfFile();
-	}
-
-	/*!
-	* \brief Checks whether the file has reached the end of the stream
-	* \return true if cursor is at the end of the file
-	*
-	* \remark Produces a NazaraError if file is not open with NAZARA_CORE_SAFE defined
-	*
-	* \see EndOfFile
-	*/
-
-	bool File::EndOfStream() const
-	{
-		return EndOfFile();
+		return EndOfStream();
 	}
 
 	/*!
@@ -154,20 +135,6 @@ namespace Nz
 			return std::filesystem::exists(m_filePath);
 	}
 
-	/*!
-	* \brief Gets the position of the cursor in the file
-	* \return Position of the cursor
-	*
-	* \remark Produces a NazaraAssert if file is not open
-	*/
-
-	UInt64 File::GetCursorPos() const
-	{
-		NazaraAssert(IsOpen(), "File is not open");
-
-		return m_impl->GetCursorPos();
-	}
-
 	/*!
 	* \brief Gets the directory of the file
 	* \return Directory of the file
@@ -195,6 +162,12 @@ namespace Nz
 		return m_filePath;
 	}
 
+	/*!
+	* \brief Gets the size of the file
+	* \return Size of the file
+	*
+	* \remark Data pending in the write buffer is not taken into account until flushed
+	*/
 	UInt64 File::GetSize() const
 	{
 		return std::filesystem::file_size(m_filePath);
@@ -280,23 +253,21 @@ namespace Nz
 	{
 		NazaraAssert(IsOpen(), "File is not open");
 
-		return m_impl->SetCursorPos(pos, offset);
-	}
+		switch (pos)
+		{
+			case CursorPosition::AtBegin:
+				return SetCursorPos(static_cast<UInt64>(offset));
 
-	/*!
-	* \brief Sets the position of the cursor
-	* \return true if cursor is successfully positioned
-	*
-	* \param offset Offset according to the cursor begin position
-	*
-	* \remark Produces a NazaraAssert if file is not open
-	*/
+			case CursorPosition::AtCurrent:
+				return SetCursorPos(static_cast<UInt64>(static_cast<Int64>(GetCursorPos()) + offset));
 
-	bool File::SetCursorPos(UInt64 offset)
-	{
-		NazaraAssert(IsOpen(), "File is not open");
+			case CursorPosition::AtEnd:
+				break;
+		}
 
-		return m_impl->SetCursorPos(CursorPosition::AtBegin, offset);
+		FlushBuffer();
+
+		return m_impl->SetCursorPos(pos, offset);
 	}
 
 	/*!
@@ -320,6 +291,7 @@ namespace Nz
 				return false;
 			}
 
+			FlushBuffer();
 			m_impl = std::move(impl);
 		}
 
@@ -341,6 +313,8 @@ namespace Nz
 		NazaraAssert(IsOpen(), "File is not open");
 		NazaraAssert(IsWritable(), "File is not writable");
 
+		FlushBuffer();
+
 		return m_impl->SetSize(size);
 	}
 
@@ -389,6 +363,56 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Moves the file cursor
+	* \return true if cursor is successfully positioned
+	*
+	* \param offset Offset according to the beginning of the file
+	*
+	* \remark Produces a NazaraAssert if file is not open
+	*/
+
+	bool File::SeekStreamCursor(UInt64 offset)
+	{
+		NazaraAssert(IsOpen(), "File is not open");
+
+		return m_impl->SetCursorPos(CursorPosition::AtBegin, offset);
+	}
+
+	/*!
+	* \brief Gets the position of the file cursor
+	* \return Position of the cursor
+	*
+	* \remark Produces a NazaraAssert if file is not open
+	*/
+
+	UInt64 File::TellStreamCursor() const
+	{
+		NazaraAssert(IsOpen(), "File is not open");
+
+		return m_impl->GetCursorPos();
+	}
+
+	/*!
+	* \brief Checks whether the file cursor has reached the end of the file
+	* \return true if cursor is at the end of the file
+	*
+	* \remark Produces a NazaraError if file is not open with NAZARA_CORE_SAFE defined
+	*/
+
+	bool File::TestStreamEnd() const
+	{
+		#if NAZARA_CORE_SAFE
+		if (!IsOpen())
+		{
+			NazaraError("File not open");
+			return false;
+		}
+		#endif
+
+		return m_impl->EndOfFile();
+	}
+
 	/*!
 	* \brief Writes blocks
 	* \return Number of blocks written
@@ -227,13 +227,20 @@ namespace Nz
 			}
 		}
 
-		if (eax >= 1)
+		UInt32 maxSupportedFunction = eax;
+		if (maxSupportedFunction >= 1)
 		{
 			// Retrieval of certain capacities of the processor (ECX and EDX, function 1)
 			HardwareInfoImpl::Cpuid(1, 0, registers);
 
-			s_capabilities[UnderlyingCast(ProcessorCap::AVX)]   = (ecx & (1U << 28)) != 0;
-			s_capabilities[UnderlyingCast(ProcessorCap::FMA3)]  = (ecx & (1U << 12)) != 0;
+			// VEX encoded instructions (AVX, AVX2 and FMA3) also require the OS to save YMM registers on context switches:
+			// OSXSAVE must be set, and XCR0 must enable both SSE (bit 1) and AVX (bit 2) states
+			bool avxStateEnabled = false;
+			if ((ecx & (1U << 27)) != 0)
+				avxStateEnabled = (HardwareInfoImpl::Xgetbv(0) & 0x6) == 0x6;
+
+			s_capabilities[UnderlyingCast(ProcessorCap::AVX)]   = avxStateEnabled && (ecx & (1U << 28)) != 0;
+			s_capabilities[UnderlyingCast(ProcessorCap::FMA3)]  = avxStateEnabled && (ecx & (1U << 12)) != 0;
 			s_capabilities[UnderlyingCast(ProcessorCap::MMX)]   = (edx & (1U << 23)) != 0;
 			s_capabilities[UnderlyingCast(ProcessorCap::SSE)]   = (edx & (1U << 25)) != 0;
 			s_capabilities[UnderlyingCast(ProcessorCap::SSE2)]  = (edx & (1U << 26)) != 0;
@@ -243,6 +250,14 @@ namespace Nz
 			s_capabilities[UnderlyingCast(ProcessorCap::SSE42)] = (ecx & (1U << 20)) != 0;
 		}
 
+		if (maxSupportedFunction >= 7)
+		{
+			// Retrieval of structured extended capabilities of the processor (EBX, function 7 subfunction 0)
+			HardwareInfoImpl::Cpuid(7, 0, registers);
+
+			s_capabilities[UnderlyingCast(ProcessorCap::AVX2)]  = s_capabilities[UnderlyingCast(ProcessorCap::AVX)] && (ebx & (1U << 5)) != 0;
+		}
+
 		// Retrieval of biggest extended function handled (EAX, function 0x80000000)
 		HardwareInfoImpl::Cpuid(0x80000000, 0, registers);
 
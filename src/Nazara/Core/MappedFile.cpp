@@ -0,0 +1,234 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/MappedFile.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ErrorFlags.hpp>
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#if defined(NAZARA_PLATFORM_WINDOWS)
+	#include <Nazara/Core/Win32/MappedFileImpl.hpp>
+#elif defined(NAZARA_PLATFORM_POSIX)
+	#include <Nazara/Core/Posix/MappedFileImpl.hpp>
+#else
+	#error OS not handled
+#endif
+
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::MappedFile
+	* \brief Core class that maps a file in memory as a read-only stream
+	*
+	* The file content is directly accessible through GetData (or GetMappedPointer), allowing loaders to parse it without copying it.
+	* The mapping is released when the file gets closed.
+	*/
+
+	/*!
+	* \brief Constructs a MappedFile object by default
+	*/
+	MappedFile::MappedFile() :
+	Stream(StreamOption::MemoryMapped),
+	m_data(nullptr),
+	m_pos(0),
+	m_size(0)
+	{
+	}
+
+	/*!
+	* \brief Constructs a MappedFile object and maps a file
+	*
+	* \param filePath Path to the file
+	*
+	* \see Open
+	*/
+	MappedFile::MappedFile(const std::filesystem::path& filePath) :
+	MappedFile()
+	{
+		Open(filePath);
+	}
+
+	MappedFile::MappedFile(MappedFile&& file) noexcept :
+	Stream(std::move(file)),
+	m_filePath(std::move(file.m_filePath)),
+	m_impl(std::move(file.m_impl)),
+	m_data(std::exchange(file.m_data, nullptr)),
+	m_pos(std::exchange(file.m_pos, 0)),
+	m_size(std::exchange(file.m_size, 0))
+	{
+	}
+
+	/*!
+	* \brief Destructs the object and calls Close
+	*
+	* \see Close
+	*/
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+	/*!
+	* \brief Unmaps the file
+	*
+	* \remark Every pointer returned by GetData is invalidated
+	*/
+	void MappedFile::Close()
+	{
+		if (m_impl)
+		{
+			m_impl.reset();
+
+			m_data = nullptr;
+			m_openMode = OpenMode::NotOpen;
+			m_pos = 0;
+			m_size = 0;
+		}
+	}
+
+	/*!
+	* \brief Gets the directory of the file
+	* \return Directory of the file
+	*/
+	std::filesystem::path MappedFile::GetDirectory() const
+	{
+		return m_filePath.parent_path();
+	}
+
+	/*!
+	* \brief Gets the name of the file
+	* \return Name of the file
+	*/
+	std::filesystem::path MappedFile::GetFileName() const
+	{
+		return m_filePath.filename();
+	}
+
+	/*!
+	* \brief Gets the mapped file content
+	* \return Pointer to the first byte of the file
+	*
+	* \see GetData
+	*/
+	const void* MappedFile::GetMappedPointer() const
+	{
+		return m_data;
+	}
+
+	/*!
+	* \brief Gets the path of the file
+	* \return Path of the file
+	*/
+	std::filesystem::path MappedFile::GetPath() const
+	{
+		return m_filePath;
+	}
+
+	/*!
+	* \brief Gets the size of the mapped file
+	* \return Size of the file
+	*/
+	UInt64 MappedFile::GetSize() const
+	{
+		return m_size;
+	}
+
+	/*!
+	* \brief Maps a file in memory
+	* \return true if mapping is successful
+	*
+	* \param filePath Path to the file
+	*
+	* \remark Produces a silent NazaraError if the file cannot be mapped (missing, empty or not a regular file)
+	*/
+	bool MappedFile::Open(const std::filesystem::path& filePath)
+	{
+		Close();
+
+		m_filePath = filePath;
+		if (m_filePath.empty())
+			return false;
+
+		std::unique_ptr<MappedFileImpl> impl = std::make_unique<MappedFileImpl>();
+		{
+			ErrorFlags flags(ErrorMode::Silent); // Silent by default, callers usually fall back to File
+			if (!impl->Open(m_filePath))
+			{
+				NazaraError("Failed to map \"" + m_filePath.generic_u8string() + '"');
+				return false;
+			}
+		}
+
+		m_data = impl->GetData();
+		m_impl = std::move(impl);
+		m_openMode = OpenMode::ReadOnly;
+		m_pos = 0;
+		m_size = m_impl->GetSize();
+
+		ResetBuffer();
+
+		return true;
+	}
+
+	MappedFile& MappedFile::operator=(MappedFile&& file) noexcept
+	{
+		Close();
+
+		Stream::operator=(std::move(file));
+
+		m_filePath = std::move(file.m_filePath);
+		m_impl = std::move(file.m_impl);
+		m_data = std::exchange(file.m_data, nullptr);
+		m_pos = std::exchange(file.m_pos, 0);
+		m_size = std::exchange(file.m_size, 0);
+
+		return *this;
+	}
+
+	void MappedFile::FlushStream()
+	{
+		// Nothing to flush, the mapping is read-only
+	}
+
+	std::size_t MappedFile::ReadBlock(void* buffer, std::size_t size)
+	{
+		NazaraAssert(IsOpen(), "File is not open");
+
+		std::size_t readSize = static_cast<std::size_t>(std::min<UInt64>(size, m_size - m_pos));
+		if (buffer)
+			std::memcpy(buffer, &m_data[m_pos], readSize);
+
+		m_pos += readSize;
+		return readSize;
+	}
+
+	bool MappedFile::SeekStreamCursor(UInt64 offset)
+	{
+		NazaraAssert(IsOpen(), "File is not open");
+
+		m_pos = std::min(offset, m_size);
+		return true;
+	}
+
+	UInt64 MappedFile::TellStreamCursor() const
+	{
+		return m_pos;
+	}
+
+	bool MappedFile::TestStreamEnd() const
+	{
+		return m_pos >= m_size;
+	}
+
+	std::size_t MappedFile::WriteBlock(const void* /*buffer*/, std::size_t /*size*/)
+	{
+		NazaraError("MappedFile is read-only");
+		return 0;
+	}
+}
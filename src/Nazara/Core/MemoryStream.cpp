@@ -24,26 +24,18 @@ namespace Nz
 	{
 		m_buffer->Clear();
 		m_pos = 0;
-	}
 
-	/*!
-	* \brief Checks whether the stream reached the end of the stream
-	* \return true if cursor is at the end of the stream
-	*/
-
-	bool MemoryStream::EndOfStream() const
-	{
-		return m_pos >= m_buffer->size();
+		ResetBuffer();
 	}
 
 	/*!
-	* \brief Gets the position of the cursor
-	* \return Position of the cursor
+	* \brief Gets the internal buffer content
+	* \return Pointer to the first byte of the buffer, valid until the next write
 	*/
 
-	UInt64 MemoryStream::GetCursorPos() const
+	const void* MemoryStream::GetMappedPointer() const
 	{
-		return m_pos;
+		return m_buffer->GetConstBuffer();
 	}
 
 	/*!
@@ -71,20 +63,8 @@ namespace Nz
 
 		m_buffer = byteArray;
 		m_openMode = openMode;
-	}
 
-	/*!
-	* \brief Sets the position of the cursor
-	* \return true
-	*
-	* \param offset Offset according to the beginning of the stream
-	*/
-
-	bool MemoryStream::SetCursorPos(UInt64 offset)
-	{
-		m_pos = offset;
-
-		return true;
+		ResetBuffer();
 	}
 
 	/*!
@@ -106,7 +86,7 @@ namespace Nz
 
 	std::size_t MemoryStream::ReadBlock(void* buffer, std::size_t size)
 	{
-		if (EndOfStream())
+		if (TestStreamEnd())
 			return 0;
 
 		std::size_t readSize = std::min<std::size_t>(size, static_cast<std::size_t>(m_buffer->GetSize() - m_pos));
@@ -118,6 +98,40 @@ namespace Nz
 		return readSize;
 	}
 
+	/*!
+	* \brief Sets the position of the cursor
+	* \return true
+	*
+	* \param offset Offset according to the beginning of the stream
+	*/
+
+	bool MemoryStream::SeekStreamCursor(UInt64 offset)
+	{
+		m_pos = offset;
+
+		return true;
+	}
+
+	/*!
+	* \brief Gets the position of the cursor
+	* \return Position of the cursor
+	*/
+
+	UInt64 MemoryStream::TellStreamCursor() const
+	{
+		return m_pos;
+	}
+
+	/*!
+	* \brief Checks whether the stream reached the end of the stream
+	* \return true if cursor is at the end of the stream
+	*/
+
+	bool MemoryStream::TestStreamEnd() const
+	{
+		return m_pos >= m_buffer->size();
+	}
+
 	/*!
 	* \brief Writes blocks
 	* \return Number of blocks written
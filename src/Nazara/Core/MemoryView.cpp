@@ -25,7 +25,7 @@ namespace Nz
 	*/
 
 	MemoryView::MemoryView(void* ptr, UInt64 size) :
-	Stream(StreamOption::None, OpenMode_ReadWrite),
+	Stream(StreamOption::MemoryMapped, OpenMode_ReadWrite),
 	m_ptr(static_cast<UInt8*>(ptr)), 
 	m_pos(0),
 	m_size(size)
@@ -42,7 +42,7 @@ namespace Nz
 	*/
 
 	MemoryView::MemoryView(const void* ptr, UInt64 size) :
-	Stream(StreamOption::None, OpenMode::ReadOnly),
+	Stream(StreamOption::MemoryMapped, OpenMode::ReadOnly),
 	m_ptr(static_cast<UInt8*>(const_cast<void*>(ptr))), //< Okay, right, const_cast is bad, but this pointer is still read-only
 	m_pos(0),
 	m_size(size)
@@ -50,23 +50,13 @@ namespace Nz
 	}
 
 	/*!
-	* \brief Checks whether the stream reached the end of the stream
-	* \return true if cursor is at the end of the stream
-	*/
-
-	bool MemoryView::EndOfStream() const
-	{
-		return m_pos >= m_size;
-	}
-
-	/*!
-	* \brief Gets the position of the cursor
-	* \return Position of the cursor
+	* \brief Gets the viewed memory
+	* \return Pointer to the raw memory
 	*/
 
-	UInt64 MemoryView::GetCursorPos() const
+	const void* MemoryView::GetMappedPointer() const
 	{
-		return m_pos;
+		return m_ptr;
 	}
 
 	/*!
@@ -79,20 +69,6 @@ namespace Nz
 		return m_size;
 	}
 
-	/*!
-	* \brief Sets the position of the cursor
-	* \return true
-	*
-	* \param offset Offset according to the beginning of the stream
-	*/
-
-	bool MemoryView::SetCursorPos(UInt64 offset)
-	{
-		m_pos = std::min(offset, m_size);
-
-		return true;
-	}
-
 	/*!
 	* \brief Flushes the stream
 	*/
@@ -121,6 +97,40 @@ namespace Nz
 		return readSize;
 	}
 
+	/*!
+	* \brief Sets the position of the cursor
+	* \return true
+	*
+	* \param offset Offset according to the beginning of the stream
+	*/
+
+	bool MemoryView::SeekStreamCursor(UInt64 offset)
+	{
+		m_pos = std::min(offset, m_size);
+
+		return true;
+	}
+
+	/*!
+	* \brief Gets the position of the cursor
+	* \return Position of the cursor
+	*/
+
+	UInt64 MemoryView::TellStreamCursor() const
+	{
+		return m_pos;
+	}
+
+	/*!
+	* \brief Checks whether the stream reached the end of the stream
+	* \return true if cursor is at the end of the stream
+	*/
+
+	bool MemoryView::TestStreamEnd() const
+	{
+		return m_pos >= m_size;
+	}
+
 	/*!
 	* \brief Writes blocks
 	* \return Number of blocks written
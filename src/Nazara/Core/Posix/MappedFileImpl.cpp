@@ -0,0 +1,89 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Posix/MappedFileImpl.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <limits>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	MappedFileImpl::MappedFileImpl() :
+	m_mapping(MAP_FAILED),
+	m_size(0)
+	{
+	}
+
+	MappedFileImpl::~MappedFileImpl()
+	{
+		if (m_mapping != MAP_FAILED)
+			munmap(m_mapping, static_cast<std::size_t>(m_size));
+	}
+
+	const UInt8* MappedFileImpl::GetData() const
+	{
+		return static_cast<const UInt8*>(m_mapping);
+	}
+
+	UInt64 MappedFileImpl::GetSize() const
+	{
+		return m_size;
+	}
+
+	bool MappedFileImpl::Open(const std::filesystem::path& filePath)
+	{
+		int fileDescriptor = open(filePath.generic_u8string().data(), O_RDONLY);
+		if (fileDescriptor == -1)
+		{
+			NazaraError("Failed to open \"" + filePath.generic_u8string() + "\" : " + Error::GetLastSystemError());
+			return false;
+		}
+
+		struct stat fileInfo;
+		if (fstat(fileDescriptor, &fileInfo) == -1)
+		{
+			close(fileDescriptor);
+			NazaraError("Failed to get file size: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		if (!S_ISREG(fileInfo.st_mode) || fileInfo.st_size <= 0)
+		{
+			close(fileDescriptor);
+			NazaraError("Only non-empty regular files can be mapped");
+			return false;
+		}
+
+		UInt64 size = static_cast<UInt64>(fileInfo.st_size);
+		if (size > std::numeric_limits<std::size_t>::max())
+		{
+			close(fileDescriptor);
+			NazaraError("File is too big to be mapped");
+			return false;
+		}
+
+		void* mapping = mmap(nullptr, static_cast<std::size_t>(size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+		// The mapping keeps a reference to the file
+		close(fileDescriptor);
+
+		if (mapping == MAP_FAILED)
+		{
+			NazaraError("Failed to map file: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		// Loaders mostly read from the beginning to the end, let the kernel read ahead and drop pages behind
+		madvise(mapping, static_cast<std::size_t>(size), MADV_SEQUENTIAL);
+
+		m_mapping = mapping;
+		m_size = size;
+
+		return true;
+	}
+}
@@ -6,7 +6,10 @@
 #include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/StringExt.hpp>
+#include <algorithm>
+#include <cassert>
 #include <cstring>
+#include <limits>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
@@ -33,6 +36,23 @@ namespace Nz
 		return std::filesystem::path();
 	}
 
+	/*!
+	* \brief Gets a pointer to the stream content
+	* \return Pointer to the first byte of the stream (not the current cursor position), or nullptr if the stream is not memory-mapped
+	*
+	* The pointer is valid until the stream is closed or written to.
+	*
+	* \remark Produces a NazaraAssert if the stream is not memory-mapped
+	*
+	* \see IsMemoryMapped
+	*/
+
+	const void* Stream::GetMappedPointer() const
+	{
+		NazaraAssert(IsMemoryMapped(), "Stream is not memory-mapped");
+		return nullptr;
+	}
+
 	/*!
 	* \brief Gets the path of the stream
 	* \return Empty string (meant to be virtual)
@@ -43,90 +63,221 @@ namespace Nz
 		return std::filesystem::path();
 	}
 
+	/*!
+	* \brief Enables read-ahead and write-behind buffering
+	*
+	* When buffering is enabled, small reads are served from a buffer filled with a single large read, and small writes are accumulated before being written at once.
+	* This greatly reduces the number of calls (and possibly system calls) made to the underlying stream, and allows ReadLine to work without seeking back.
+	*
+	* Pending writes are written by Flush, when moving the cursor, when reading and when buffering gets disabled (a File also writes them when being closed).
+	*
+	* \param buffering Should buffering be enabled
+	* \param bufferSize Size of the buffer, used for both reading and writing
+	*
+	* \remark Produces a NazaraAssert if buffering is enabled on a sequential stream
+	*/
+	void Stream::EnableBuffering(bool buffering, std::size_t bufferSize)
+	{
+		NazaraAssert(!buffering || !IsSequential(), "Sequential streams cannot be buffered");
+		NazaraAssert(!buffering || bufferSize > 0, "Invalid buffer size");
+
+		FlushBuffer();
+
+		if (buffering)
+			m_buffer.resize(bufferSize);
+		else
+		{
+			m_buffer.clear();
+			m_buffer.shrink_to_fit();
+		}
+	}
+
 	/*!
 	* \brief Reads a line from the stream
 	*
 	* Reads the stream until a line separator or the end of the stream is found.
 	*
 	* If lineSize does not equal zero, it represents the maximum character count to be read from the stream.
-	* 
+	*
 	* \param lineSize Maximum number of characters to read, or zero for no limit
 	*
 	* \return Line read from file
 	*
 	* \remark With the text stream option, "\r\n" is treated as "\n"
 	* \remark The line separator character is not returned as part of the string
+	*
+	* \see ReadLineView
 	*/
 	std::string Stream::ReadLine(unsigned int lineSize)
 	{
-		std::string line;
-		if (lineSize == 0) // Maximal size undefined
+		return std::string(ReadLineView(lineSize));
+	}
+
+	/*!
+	* \brief Reads a line from the stream without copying it
+	*
+	* Works like ReadLine, but returns a view which is only valid until the next operation on the stream.
+	* Memory-mapped streams return a view of their content, otherwise when buffering is enabled the view points directly into the read buffer when possible and the stream cursor is never moved back.
+	*
+	* \param lineSize Maximum number of characters to read, or zero for no limit
+	*
+	* \return View of the line read from the stream
+	*
+	* \see EnableBuffering
+	* \see ReadLine
+	*/
+	std::string_view Stream::ReadLineView(unsigned int lineSize)
+	{
+		NazaraAssert(IsReadable(), "Stream is not readable");
+
+		std::size_t maxLength = (lineSize != 0) ? lineSize : std::numeric_limits<std::size_t>::max();
+		bool textMode = IsTextModeEnabled();
+
+		m_lineBuffer.clear();
+
+		if (IsMemoryMapped() && !IsBufferingEnabled())
+		{
+			// Whole content is already in memory, return a view of it
+			UInt64 cursorPos = TellStreamCursor();
+			UInt64 size = GetSize();
+			if (cursorPos >= size)
+				return {};
+
+			const char* begin = static_cast<const char*>(GetMappedPointer()) + cursorPos;
+			std::size_t available = static_cast<std::size_t>(std::min<UInt64>(size - cursorPos, maxLength));
+
+			const char* ptr = static_cast<const char*>(std::memchr(begin, '\n', available));
+			std::size_t length = (ptr) ? ptr - begin : available;
+
+			if (!SeekStreamCursor(cursorPos + length + ((ptr) ? 1 : 0)))
+				NazaraWarning("Failed to move cursor pos");
+
+			std::string_view line(begin, length);
+			if (textMode && !line.empty() && line.back() == '\r')
+				line.remove_suffix(1);
+
+			return line;
+		}
+
+		if (!IsBufferingEnabled())
 		{
 			const unsigned int bufferSize = 64;
 
-			char buffer[bufferSize + 1];
-			buffer[bufferSize] = '\0';
+			char buffer[bufferSize];
 
 			std::size_t readSize;
 			do
 			{
-				readSize = Read(buffer, bufferSize);
+				std::size_t maxReadSize = std::min<std::size_t>(bufferSize, maxLength - m_lineBuffer.size());
+				readSize = ReadBlock(buffer, maxReadSize);
 
-				const char* ptr = std::strchr(buffer, '\n');
-				if (ptr)
+				if (const char* ptr = static_cast<const char*>(std::memchr(buffer, '\n', readSize)))
 				{
-					std::ptrdiff_t pos = ptr - buffer;
-					if (ptr != buffer)
-					{
-						if (m_streamOptions & StreamOption::Text && buffer[pos - 1] == '\r')
-							line.append(buffer, pos - 1);
-						else
-							line.append(buffer, pos);
-					}
-
-					if (!SetCursorPos(GetCursorPos() - readSize + pos + 1))
+					std::size_t pos = ptr - buffer;
+					m_lineBuffer.append(buffer, pos);
+
+					if (!SeekStreamCursor(TellStreamCursor() - readSize + pos + 1))
 						NazaraWarning("Failed to reset cursor pos");
 
 					break;
 				}
-				else
-				{
-					std::size_t length = readSize;
-					if (m_streamOptions & StreamOption::Text && buffer[length - 1] == '\r')
-					{
-						if (!SetCursorPos(GetCursorPos() - 1))
-							NazaraWarning("Failed to reset cursor pos");
 
-						length--;
-					}
+				m_lineBuffer.append(buffer, readSize);
 
-					line.append(buffer, length);
+				// Don't split a "\r\n" sequence between two reads
+				if (textMode && readSize > 0 && buffer[readSize - 1] == '\r' && readSize == maxReadSize && m_lineBuffer.size() < maxLength)
+				{
+					m_lineBuffer.pop_back();
+					if (!SeekStreamCursor(TellStreamCursor() - 1))
+						NazaraWarning("Failed to reset cursor pos");
 				}
+
+				if (readSize != maxReadSize || m_lineBuffer.size() >= maxLength)
+					break;
 			}
-			while (readSize == bufferSize);
+			while (readSize > 0);
+
+			std::string_view line = m_lineBuffer;
+			if (textMode && !line.empty() && line.back() == '\r')
+				line.remove_suffix(1);
+
+			return line;
 		}
-		else
+
+		if (m_hasPendingWrites)
+			FlushBuffer();
+
+		std::string_view line;
+		bool useLineBuffer = false;
+		for (;;)
 		{
-			line.resize(lineSize, '\0');
-			std::size_t readSize = Read(&line[0], lineSize);
-			std::size_t pos = line.find('\n');
-			if (pos <= readSize) // False only if the character is not available (npos being the biggest integer)
+			if (m_bufferOffset == m_bufferSize && !FillBuffer())
+			{
+				line = m_lineBuffer; //< End of stream
+				break;
+			}
+
+			const char* begin = reinterpret_cast<const char*>(&m_buffer[m_bufferOffset]);
+			std::size_t available = std::min(m_bufferSize - m_bufferOffset, maxLength - m_lineBuffer.size());
+
+			if (const char* ptr = static_cast<const char*>(std::memchr(begin, '\n', available)))
 			{
-				if (m_streamOptions & StreamOption::Text && pos > 0 && line[pos - 1] == '\r')
-					line.resize(pos);
+				std::size_t length = ptr - begin;
+				m_bufferOffset += length + 1;
+
+				if (useLineBuffer)
+				{
+					m_lineBuffer.append(begin, length);
+					line = m_lineBuffer;
+				}
 				else
-					line.resize(pos + 1);
+					line = std::string_view(begin, length); //< Line is entirely in the buffer, no copy required
 
-				if (!SetCursorPos(GetCursorPos() - readSize + pos + 1))
-					NazaraWarning("Failed to reset cursos pos");
+				break;
+			}
+
+			// Line continues past the buffer end, keep what we have before refilling it
+			m_lineBuffer.append(begin, available);
+			m_bufferOffset += available;
+			useLineBuffer = true;
+
+			if (m_lineBuffer.size() >= maxLength)
+			{
+				line = m_lineBuffer;
+				break;
 			}
-			else
-				line.resize(readSize);
 		}
 
+		if (textMode && !line.empty() && line.back() == '\r')
+			line.remove_suffix(1);
+
 		return line;
 	}
 
+	/*!
+	* \brief Sets the position of the cursor
+	* \return true if cursor is successfully positioned
+	*
+	* If the new position is inside the read-ahead buffer, the underlying stream is not touched
+	*
+	* \param offset Offset according to the cursor begin position
+	*/
+	bool Stream::SetCursorPos(UInt64 offset)
+	{
+		if (!m_hasPendingWrites && m_bufferSize > 0 && offset >= m_bufferCursor && offset <= m_bufferCursor + m_bufferSize)
+		{
+			m_bufferOffset = static_cast<std::size_t>(offset - m_bufferCursor);
+			return true;
+		}
+
+		if (m_hasPendingWrites)
+			FlushBuffer();
+		else
+			ResetBuffer(); //< No need to move the underlying cursor back since we're seeking anyway
+
+		return SeekStreamCursor(offset);
+	}
+
 	/*!
 	* \brief Writes a ByteArray into the stream
 	* \return true if successful
@@ -167,4 +318,112 @@ namespace Nz
 		else
 			return Write(string.data(), string.size()) == string.size();
 	}
+
+	/*!
+	* \brief Empties the buffer
+	* \return true if successful
+	*
+	* Pending writes are written to the underlying stream, and the underlying cursor is moved back to the logical cursor position if data was read ahead.
+	*/
+	bool Stream::FlushBuffer()
+	{
+		bool success = true;
+		if (m_hasPendingWrites)
+		{
+			std::size_t writtenSize = WriteBlock(m_buffer.data(), m_bufferSize);
+			if (writtenSize != m_bufferSize)
+			{
+				NazaraError("Failed to write buffered data (" + NumberToString(writtenSize) + " out of " + NumberToString(m_bufferSize) + " bytes written)");
+				success = false;
+			}
+		}
+		else if (m_bufferOffset != m_bufferSize)
+		{
+			if (!SeekStreamCursor(m_bufferCursor + m_bufferOffset))
+			{
+				NazaraError("Failed to reset cursor pos");
+				success = false;
+			}
+		}
+
+		ResetBuffer();
+
+		return success;
+	}
+
+	bool Stream::FillBuffer()
+	{
+		assert(!m_hasPendingWrites && m_bufferOffset == m_bufferSize);
+
+		m_bufferCursor = (m_bufferSize > 0) ? m_bufferCursor + m_bufferSize : TellStreamCursor();
+		m_bufferOffset = 0;
+		m_bufferSize = ReadBlock(m_buffer.data(), m_buffer.size());
+
+		return m_bufferSize > 0;
+	}
+
+	std::size_t Stream::ReadBuffered(void* buffer, std::size_t size)
+	{
+		if (m_hasPendingWrites)
+			FlushBuffer();
+
+		UInt8* ptr = static_cast<UInt8*>(buffer);
+
+		std::size_t readSize = 0;
+		while (size > 0)
+		{
+			if (m_bufferOffset == m_bufferSize)
+			{
+				// Large reads are not worth going through the buffer
+				if (size >= m_buffer.size())
+				{
+					ResetBuffer(); //< Underlying cursor already matches the logical one
+					readSize += ReadBlock(ptr, size);
+					break;
+				}
+
+				if (!FillBuffer())
+					break;
+			}
+
+			std::size_t copySize = std::min(size, m_bufferSize - m_bufferOffset);
+			if (ptr)
+			{
+				std::memcpy(ptr, &m_buffer[m_bufferOffset], copySize);
+				ptr += copySize;
+			}
+
+			m_bufferOffset += copySize;
+			readSize += copySize;
+			size -= copySize;
+		}
+
+		return readSize;
+	}
+
+	std::size_t Stream::WriteBuffered(const void* buffer, std::size_t size)
+	{
+		// Drop read-ahead data, moving the underlying cursor back to where we are writing
+		if (!m_hasPendingWrites && m_bufferSize > 0)
+			FlushBuffer();
+
+		if (m_bufferSize + size > m_buffer.size())
+		{
+			if (!FlushBuffer())
+				return 0;
+
+			if (size >= m_buffer.size())
+				return WriteBlock(buffer, size);
+		}
+
+		if (m_bufferSize == 0)
+			m_bufferCursor = TellStreamCursor();
+
+		std::memcpy(&m_buffer[m_bufferSize], buffer, size);
+		m_bufferSize += size;
+		m_bufferOffset = m_bufferSize;
+		m_hasPendingWrites = true;
+
+		return size;
+	}
 }
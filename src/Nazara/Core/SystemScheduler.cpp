@@ -0,0 +1,133 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/SystemScheduler.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup core
+	* \class Nz::SystemScheduler
+	* \brief Core class running ECS systems concurrently, based on the components they access
+	*
+	* Each system declares which components it reads and writes. Systems are run in the order they were added,
+	* except that a system may run at the same time as previous ones as long as none of them writes a component it accesses (and vice versa).
+	* Systems declared exclusive run alone on the calling thread and act as barriers.
+	*
+	* Concurrent systems are run by the TaskScheduler workers, and may use parallel algorithms themselves.
+	*/
+
+	/*!
+	* \brief Adds a system to the scheduler
+	* \return Index of the system
+	*
+	* \param access Components accessed by the system
+	* \param update Function called with the elapsed time on every update
+	*/
+	std::size_t SystemScheduler::AddSystem(Access access, UpdateFunc update)
+	{
+		NazaraAssert(update, "invalid update function");
+
+		std::size_t systemIndex = m_systems.size();
+
+		System& system = m_systems.emplace_back();
+		system.access = std::move(access);
+		system.update = std::move(update);
+
+		// Systems are only scheduled concurrently between exclusive ones, which don't need dependencies
+		if (!system.access.IsExclusive())
+		{
+			for (std::size_t i = systemIndex; i > 0; --i)
+			{
+				System& previousSystem = m_systems[i - 1];
+				if (previousSystem.access.IsExclusive())
+					break;
+
+				if (previousSystem.access.Conflicts(system.access))
+				{
+					previousSystem.dependents.push_back(systemIndex);
+					system.dependencyCount++;
+				}
+			}
+		}
+
+		return systemIndex;
+	}
+
+	/*!
+	* \brief Runs every system once
+	*
+	* \param elapsedTime Time passed to the systems
+	* \param useParallelism Run independent systems concurrently, using the TaskScheduler workers (if false, systems are run in order on the calling thread)
+	*/
+	void SystemScheduler::Update(float elapsedTime, bool useParallelism)
+	{
+		if (!useParallelism)
+		{
+			for (System& system : m_systems)
+				system.update(elapsedTime);
+
+			return;
+		}
+
+		if (m_pendingDependencies.size() != m_systems.size())
+			m_pendingDependencies = std::vector<std::atomic<std::size_t>>(m_systems.size());
+
+		std::size_t groupStart = 0;
+		for (std::size_t i = 0; i <= m_systems.size(); ++i)
+		{
+			bool isExclusive = (i < m_systems.size() && m_systems[i].access.IsExclusive());
+			if (i < m_systems.size() && !isExclusive)
+				continue;
+
+			// Run non-exclusive systems since the last barrier as a dependency graph
+			if (i - groupStart == 1)
+				m_systems[groupStart].update(elapsedTime);
+			else if (i > groupStart)
+			{
+				for (std::size_t j = groupStart; j < i; ++j)
+					m_pendingDependencies[j].store(m_systems[j].dependencyCount, std::memory_order_relaxed);
+
+				TaskScheduler::Counter counter;
+				for (std::size_t j = groupStart; j < i; ++j)
+				{
+					if (m_systems[j].dependencyCount == 0)
+					{
+						TaskScheduler::Submit([this, j, elapsedTime, &counter]
+						{
+							RunSystem(j, elapsedTime, counter);
+						}, &counter);
+					}
+				}
+
+				TaskScheduler::WaitFor(counter);
+			}
+
+			if (isExclusive)
+				m_systems[i].update(elapsedTime);
+
+			groupStart = i + 1;
+		}
+	}
+
+	void SystemScheduler::RunSystem(std::size_t systemIndex, float elapsedTime, TaskScheduler::Counter& counter)
+	{
+		System& system = m_systems[systemIndex];
+		system.update(elapsedTime);
+
+		// The counter can't reach zero before this task is over, so dependents submitted from here are waited for as well
+		for (std::size_t dependentIndex : system.dependents)
+		{
+			if (m_pendingDependencies[dependentIndex].fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				TaskScheduler::Submit([this, dependentIndex, elapsedTime, &counter]
+				{
+					RunSystem(dependentIndex, elapsedTime, counter);
+				}, &counter);
+			}
+		}
+	}
+}
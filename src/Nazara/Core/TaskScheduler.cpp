@@ -5,23 +5,419 @@
 #include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/HardwareInfo.hpp>
-
-#if defined(NAZARA_PLATFORM_WINDOWS)
-	#include <Nazara/Core/Win32/TaskSchedulerImpl.hpp>
-#elif defined(NAZARA_PLATFORM_POSIX)
-	#include <Nazara/Core/Posix/TaskSchedulerImpl.hpp>
-#else
-	#error Lack of implementation: Task Scheduler
-#endif
-
+#include <condition_variable>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
 #include <Nazara/Core/Debug.hpp>
 
 namespace Nz
 {
 	namespace
 	{
-		std::vector<Functor*> s_pendingWorks;
+		struct ThreadContext;
+	}
+
+	struct TaskSchedulerNode
+	{
+		ThreadContext* owner;
+		TaskScheduler::Counter* counter;
+		TaskScheduler::Task task;
+		TaskSchedulerNode* next;
+	};
+
+	namespace
+	{
+		using TaskNode = TaskSchedulerNode;
+
+		constexpr std::size_t CacheLineSize = 64;
+		constexpr std::size_t TaskNodeChunkSize = 256;
+		constexpr unsigned int IdleSpinCount = 64;
+
+		// Chase-Lev work-stealing deque, as described by "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê et al.)
+		// Only the owning worker can push and pop (at the bottom), any thread can steal (at the top)
+		class WorkStealingQueue
+		{
+			public:
+				WorkStealingQueue(std::size_t capacity = 1024) :
+				m_top(0),
+				m_bottom(0)
+				{
+					m_buffers.push_back(std::make_unique<Buffer>(capacity));
+					m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+				}
+
+				bool IsEmpty() const
+				{
+					Int64 bottom = m_bottom.load(std::memory_order_relaxed);
+					Int64 top = m_top.load(std::memory_order_relaxed);
+					return bottom <= top;
+				}
+
+				TaskNode* Pop()
+				{
+					Int64 bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+					Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+					m_bottom.store(bottom, std::memory_order_relaxed);
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+					Int64 top = m_top.load(std::memory_order_relaxed);
+
+					TaskNode* node = nullptr;
+					if (top <= bottom)
+					{
+						node = buffer->Get(bottom);
+						if (top == bottom)
+						{
+							// Last element, race against thieves
+							if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+								node = nullptr;
+
+							m_bottom.store(bottom + 1, std::memory_order_relaxed);
+						}
+					}
+					else
+						m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+					return node;
+				}
+
+				void Push(TaskNode* node)
+				{
+					Int64 bottom = m_bottom.load(std::memory_order_relaxed);
+					Int64 top = m_top.load(std::memory_order_acquire);
+					Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+					if (bottom - top > static_cast<Int64>(buffer->mask))
+						buffer = Grow(buffer, top, bottom);
+
+					buffer->Put(bottom, node);
+					std::atomic_thread_fence(std::memory_order_release);
+					m_bottom.store(bottom + 1, std::memory_order_relaxed);
+				}
+
+				TaskNode* Steal()
+				{
+					Int64 top = m_top.load(std::memory_order_acquire);
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+					Int64 bottom = m_bottom.load(std::memory_order_acquire);
+
+					if (top >= bottom)
+						return nullptr;
+
+					Buffer* buffer = m_buffer.load(std::memory_order_acquire);
+					TaskNode* node = buffer->Get(top);
+					if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+						return nullptr;
+
+					return node;
+				}
+
+			private:
+				struct Buffer
+				{
+					Buffer(std::size_t capacity) :
+					mask(capacity - 1),
+					nodes(std::make_unique<std::atomic<TaskNode*>[]>(capacity))
+					{
+						NazaraAssert((capacity & mask) == 0, "capacity must be a power of two");
+					}
+
+					TaskNode* Get(Int64 index) const
+					{
+						return nodes[index & mask].load(std::memory_order_relaxed);
+					}
+
+					void Put(Int64 index, TaskNode* node)
+					{
+						nodes[index & mask].store(node, std::memory_order_relaxed);
+					}
+
+					std::size_t mask;
+					std::unique_ptr<std::atomic<TaskNode*>[]> nodes;
+				};
+
+				Buffer* Grow(Buffer* buffer, Int64 top, Int64 bottom)
+				{
+					// Thieves may still be reading from the previous buffer, keep it alive until the queue is destroyed
+					auto newBuffer = std::make_unique<Buffer>((buffer->mask + 1) * 2);
+					for (Int64 i = top; i < bottom; ++i)
+						newBuffer->Put(i, buffer->Get(i));
+
+					Buffer* newBufferPtr = newBuffer.get();
+					m_buffers.push_back(std::move(newBuffer));
+					m_buffer.store(newBufferPtr, std::memory_order_release);
+
+					return newBufferPtr;
+				}
+
+				alignas(CacheLineSize) std::atomic<Int64> m_top;
+				alignas(CacheLineSize) std::atomic<Int64> m_bottom;
+				std::atomic<Buffer*> m_buffer;
+				std::vector<std::unique_ptr<Buffer>> m_buffers;
+		};
+
+		// Per-thread data, owns the memory of the task nodes allocated by this thread
+		struct ThreadContext
+		{
+			ThreadContext(unsigned int index, bool worker) :
+			remoteFreeList(nullptr),
+			freeList(nullptr),
+			randomGenerator(index + 1),
+			workerIndex(index),
+			isWorker(worker)
+			{
+			}
+
+			TaskNode* AllocateNode()
+			{
+				if (!freeList)
+				{
+					// Reclaim every node released by other threads in one go
+					freeList = remoteFreeList.exchange(nullptr, std::memory_order_acquire);
+					if (!freeList)
+					{
+						auto& chunk = nodeChunks.emplace_back(std::make_unique<TaskNode[]>(TaskNodeChunkSize));
+						TaskNode* nodes = chunk.get();
+						for (std::size_t i = 0; i < TaskNodeChunkSize; ++i)
+							nodes[i].next = (i + 1 < TaskNodeChunkSize) ? &nodes[i + 1] : nullptr;
+
+						freeList = nodes;
+					}
+				}
+
+				TaskNode* node = freeList;
+				freeList = node->next;
+
+				return node;
+			}
+
+			WorkStealingQueue queue;
+			alignas(CacheLineSize) std::atomic<TaskNode*> remoteFreeList;
+			alignas(CacheLineSize) TaskNode* freeList;
+			std::minstd_rand randomGenerator;
+			std::thread thread;
+			std::vector<std::unique_ptr<TaskNode[]>> nodeChunks;
+			unsigned int workerIndex;
+			bool isWorker;
+		};
+
+		struct SchedulerData
+		{
+			std::condition_variable wakeCondition;
+			std::mutex contextMutex;
+			std::mutex injectionMutex;
+			std::mutex pendingMutex;
+			std::mutex wakeMutex;
+			std::vector<std::unique_ptr<ThreadContext>> externalContexts;
+			std::vector<ThreadContext*> releasedExternalContexts;
+			std::vector<std::unique_ptr<ThreadContext>> workers;
+			std::vector<TaskScheduler::Task> pendingTasks;
+			alignas(CacheLineSize) std::atomic<UInt64> wakeEpoch = 0;
+			alignas(CacheLineSize) std::atomic<unsigned int> sleepingWorkers = 0;
+			alignas(CacheLineSize) std::atomic<std::size_t> injectedCount = 0;
+			TaskNode* injectedHead = nullptr;
+			TaskNode* injectedTail = nullptr;
+			TaskScheduler::Counter runCounter;
+			std::atomic<bool> shouldFinish = false;
+		};
+
+		std::mutex s_initializationMutex;
+		std::unique_ptr<SchedulerData> s_data;
+		std::atomic<bool> s_isInitialized = false;
+		std::atomic<UInt64> s_generation = 0;
 		unsigned int s_workerCount = 0;
+
+		// Workers must be joined before static destruction if Uninitialize wasn't called
+		struct SchedulerCleaner
+		{
+			~SchedulerCleaner()
+			{
+				TaskScheduler::Uninitialize();
+			}
+		};
+
+		SchedulerCleaner s_cleaner;
+
+		thread_local ThreadContext* t_context = nullptr;
+		thread_local UInt64 t_contextGeneration = 0;
+
+		// Gives the context of an external thread back to the scheduler when the thread exits
+		// Nodes allocated from it may still be queued or in flight, so it is kept alive and reused by the next external thread
+		struct ExternalContextReleaser
+		{
+			~ExternalContextReleaser()
+			{
+				if (!isRegistered)
+					return;
+
+				std::lock_guard<std::mutex> lock(s_initializationMutex);
+				if (s_data && t_context && t_contextGeneration == s_generation.load(std::memory_order_relaxed))
+				{
+					std::lock_guard<std::mutex> contextLock(s_data->contextMutex);
+					s_data->releasedExternalContexts.push_back(t_context);
+				}
+
+				t_context = nullptr;
+			}
+
+			bool isRegistered = false;
+		};
+
+		thread_local ExternalContextReleaser t_contextReleaser;
+
+		ThreadContext& GetThreadContext()
+		{
+			UInt64 generation = s_generation.load(std::memory_order_relaxed);
+			if (!t_context || t_contextGeneration != generation)
+			{
+				// First submission from a thread which is not a worker (contexts from a previous generation were destroyed with the scheduler data)
+				std::lock_guard<std::mutex> lock(s_data->contextMutex);
+
+				if (!s_data->releasedExternalContexts.empty())
+				{
+					t_context = s_data->releasedExternalContexts.back();
+					s_data->releasedExternalContexts.pop_back();
+				}
+				else
+				{
+					auto& context = s_data->externalContexts.emplace_back(std::make_unique<ThreadContext>(static_cast<unsigned int>(s_data->externalContexts.size()), false));
+					t_context = context.get();
+				}
+
+				t_contextGeneration = generation;
+				t_contextReleaser.isRegistered = true;
+			}
+
+			return *t_context;
+		}
+
+		void FreeNode(TaskNode* node)
+		{
+			ThreadContext* owner = node->owner;
+			if (owner == t_context)
+			{
+				node->next = owner->freeList;
+				owner->freeList = node;
+			}
+			else
+			{
+				TaskNode* head = owner->remoteFreeList.load(std::memory_order_relaxed);
+				do
+				{
+					node->next = head;
+				}
+				while (!owner->remoteFreeList.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+			}
+		}
+
+		void WakeWorkers(bool all)
+		{
+			s_data->wakeEpoch.fetch_add(1, std::memory_order_seq_cst);
+			if (s_data->sleepingWorkers.load(std::memory_order_seq_cst) == 0)
+				return;
+
+			{
+				// Ensure a worker cannot miss the notification between its last check and its wait
+				std::lock_guard<std::mutex> lock(s_data->wakeMutex);
+			}
+
+			if (all)
+				s_data->wakeCondition.notify_all();
+			else
+				s_data->wakeCondition.notify_one();
+		}
+
+		void PushNodes(TaskNode* first, TaskNode* last, std::size_t count)
+		{
+			ThreadContext* context = t_context;
+			if (context && context->isWorker && t_contextGeneration == s_generation.load(std::memory_order_relaxed))
+			{
+				for (TaskNode* node = first; node; )
+				{
+					TaskNode* next = (node != last) ? node->next : nullptr;
+					context->queue.Push(node);
+					node = next;
+				}
+			}
+			else
+			{
+				std::lock_guard<std::mutex> lock(s_data->injectionMutex);
+				last->next = nullptr;
+				if (s_data->injectedTail)
+					s_data->injectedTail->next = first;
+				else
+					s_data->injectedHead = first;
+
+				s_data->injectedTail = last;
+				s_data->injectedCount.fetch_add(count, std::memory_order_release);
+			}
+
+			WakeWorkers(count > 1);
+		}
+
+		TaskNode* PopInjectedNode()
+		{
+			if (s_data->injectedCount.load(std::memory_order_acquire) == 0)
+				return nullptr;
+
+			std::lock_guard<std::mutex> lock(s_data->injectionMutex);
+			TaskNode* node = s_data->injectedHead;
+			if (node)
+			{
+				s_data->injectedHead = node->next;
+				if (!s_data->injectedHead)
+					s_data->injectedTail = nullptr;
+
+				s_data->injectedCount.fetch_sub(1, std::memory_order_relaxed);
+			}
+
+			return node;
+		}
+
+		TaskNode* StealNode(ThreadContext& context)
+		{
+			std::size_t workerCount = s_data->workers.size();
+			std::size_t offset = context.randomGenerator() % workerCount;
+			for (std::size_t i = 0; i < workerCount; ++i)
+			{
+				ThreadContext& victim = *s_data->workers[(offset + i) % workerCount];
+				if (&victim == &context)
+					continue;
+
+				if (TaskNode* node = victim.queue.Steal())
+					return node;
+			}
+
+			return nullptr;
+		}
+
+		TaskNode* FindNode(ThreadContext& context)
+		{
+			if (context.isWorker)
+			{
+				if (TaskNode* node = context.queue.Pop())
+					return node;
+			}
+
+			if (TaskNode* node = PopInjectedNode())
+				return node;
+
+			return StealNode(context);
+		}
+
+		bool HasWork()
+		{
+			if (s_data->injectedCount.load(std::memory_order_acquire) > 0)
+				return true;
+
+			for (const auto& worker : s_data->workers)
+			{
+				if (!worker->queue.IsEmpty())
+					return true;
+			}
+
+			return false;
+		}
 	}
 
 	/*!
@@ -29,6 +425,11 @@ namespace Nz
 	* \class Nz::TaskScheduler
 	* \brief Core class that represents a pool of threads
 	*
+	* Each worker owns a lock-free work-stealing deque, tasks submitted from a worker (including from inside a task) are pushed on its own deque
+	* while tasks submitted from other threads go through a shared injection queue. Idle workers steal from each other.
+	*
+	* Tasks are stored in pooled nodes with an inline storage for the callable, meaning scheduling a task doesn't allocate in the steady state.
+	*
 	* \remark Initialized should be called first
 	*/
 
@@ -36,7 +437,6 @@ namespace Nz
 	* \brief Gets the number of threads
 	* \return Number of threads, if none, the number of simulatenous threads on the processor is returned
 	*/
-
 	unsigned int TaskScheduler::GetWorkerCount()
 	{
 		return (s_workerCount > 0) ? s_workerCount : HardwareInfo::GetProcessorCount();
@@ -46,10 +446,93 @@ namespace Nz
 	* \brief Initializes the TaskScheduler class
 	* \return true if everything is ok
 	*/
-
 	bool TaskScheduler::Initialize()
 	{
-		return TaskSchedulerImpl::Initialize(GetWorkerCount());
+		if (s_isInitialized.load(std::memory_order_acquire))
+			return true; // Already initialized
+
+		std::lock_guard<std::mutex> lock(s_initializationMutex);
+		if (s_isInitialized.load(std::memory_order_relaxed))
+			return true;
+
+		unsigned int workerCount = GetWorkerCount();
+
+		#if NAZARA_CORE_SAFE
+		if (workerCount == 0)
+		{
+			NazaraError("Invalid worker count ! (0)");
+			return false;
+		}
+		#endif
+
+		s_generation.fetch_add(1, std::memory_order_relaxed);
+		s_data = std::make_unique<SchedulerData>();
+
+		s_data->workers.reserve(workerCount);
+		for (unsigned int i = 0; i < workerCount; ++i)
+			s_data->workers.emplace_back(std::make_unique<ThreadContext>(i, true));
+
+		UInt64 generation = s_generation.load(std::memory_order_relaxed);
+		for (auto& workerPtr : s_data->workers)
+		{
+			ThreadContext* worker = workerPtr.get();
+			worker->thread = std::thread([worker, generation]
+			{
+				t_context = worker;
+				t_contextGeneration = generation;
+
+				unsigned int idleCount = 0;
+				while (!s_data->shouldFinish.load(std::memory_order_relaxed))
+				{
+					if (TaskNode* node = FindNode(*worker))
+					{
+						idleCount = 0;
+
+						node->task();
+						node->task.Reset();
+
+						Counter* counter = node->counter;
+						FreeNode(node);
+
+						if (counter)
+							ReleaseCounter(*counter);
+
+						continue;
+					}
+
+					if (++idleCount < IdleSpinCount)
+					{
+						std::this_thread::yield();
+						continue;
+					}
+
+					// Nothing to do for a while, sleep until some task is pushed
+					s_data->sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+					UInt64 epoch = s_data->wakeEpoch.load(std::memory_order_seq_cst);
+					if (!HasWork())
+					{
+						std::unique_lock<std::mutex> wakeLock(s_data->wakeMutex);
+						s_data->wakeCondition.wait(wakeLock, [&] { return s_data->wakeEpoch.load(std::memory_order_relaxed) != epoch || s_data->shouldFinish.load(std::memory_order_relaxed); });
+					}
+					s_data->sleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+
+					idleCount = 0;
+				}
+			});
+		}
+
+		s_isInitialized.store(true, std::memory_order_release);
+
+		return true;
+	}
+
+	/*!
+	* \brief Checks whether the calling thread is one of the scheduler workers
+	* \return true If called from a worker thread (for example from inside a task)
+	*/
+	bool TaskScheduler::IsWorkerThread()
+	{
+		return t_context && t_context->isWorker && t_contextGeneration == s_generation.load(std::memory_order_relaxed);
 	}
 
 	/*!
@@ -57,7 +540,6 @@ namespace Nz
 	*
 	* \remark Produce a NazaraError if the class is not initialized
 	*/
-
 	void TaskScheduler::Run()
 	{
 		if (!Initialize())
@@ -66,11 +548,14 @@ namespace Nz
 			return;
 		}
 
-		if (!s_pendingWorks.empty())
+		std::vector<Task> pendingTasks;
 		{
-			TaskSchedulerImpl::Run(&s_pendingWorks[0], s_pendingWorks.size());
-			s_pendingWorks.clear();
+			std::lock_guard<std::mutex> lock(s_data->pendingMutex);
+			pendingTasks.swap(s_data->pendingTasks);
 		}
+
+		for (Task& task : pendingTasks)
+			Submit(std::move(task), &s_data->runCounter);
 	}
 
 	/*!
@@ -80,11 +565,10 @@ namespace Nz
 	*
 	* \remark Produce a NazaraError if the class is not initialized and NAZARA_CORE_SAFE is defined
 	*/
-
 	void TaskScheduler::SetWorkerCount(unsigned int workerCount)
 	{
 		#ifdef NAZARA_CORE_SAFE
-		if (TaskSchedulerImpl::IsInitialized())
+		if (s_isInitialized)
 		{
 			NazaraError("Worker count cannot be set while initialized");
 			return;
@@ -95,21 +579,140 @@ namespace Nz
 	}
 
 	/*!
-	* \brief Uninitializes the TaskScheduler class
+	* \brief Schedules a task for execution
+	*
+	* The task is immediately available to the workers, unless a dependency is specified in which case it will only be scheduled once the dependency counter reaches zero.
+	* This can be called from any thread, including from inside a task.
+	*
+	* \param task Task to execute
+	* \param counter Optional counter incremented now and decremented once the task has been executed
+	* \param dependency Optional counter which has to reach zero before the task can run
+	*
+	* \remark Produce a NazaraError if the class is not initialized
 	*/
+	void TaskScheduler::Submit(Task task, Counter* counter, Counter* dependency)
+	{
+		NazaraAssert(task.IsValid(), "invalid task");
+
+		if (!Initialize())
+		{
+			NazaraError("Failed to initialize Task Scheduler");
+			return;
+		}
+
+		ThreadContext& context = GetThreadContext();
+
+		TaskNode* node = context.AllocateNode();
+		node->owner = &context;
+		node->counter = counter;
+		node->next = nullptr;
+		node->task = std::move(task);
+
+		if (counter)
+			counter->m_value.fetch_add(1, std::memory_order_relaxed);
+
+		if (dependency)
+		{
+			std::lock_guard<std::mutex> lock(dependency->m_mutex);
+			if (dependency->m_value.load(std::memory_order_acquire) != 0)
+			{
+				// Will be scheduled by the last task of the dependency
+				node->next = dependency->m_waitingTasks;
+				dependency->m_waitingTasks = node;
+				return;
+			}
+		}
+
+		PushNodes(node, node, 1);
+	}
 
+	/*!
+	* \brief Uninitializes the TaskScheduler class
+	*
+	* \remark Tasks which weren't executed yet are discarded, their counters are still decremented
+	*/
 	void TaskScheduler::Uninitialize()
 	{
-		if (TaskSchedulerImpl::IsInitialized())
-			TaskSchedulerImpl::Uninitialize();
+		std::lock_guard<std::mutex> lock(s_initializationMutex);
+		if (!s_isInitialized.load(std::memory_order_relaxed))
+			return;
+
+		s_data->shouldFinish.store(true, std::memory_order_relaxed);
+		WakeWorkers(true);
+
+		for (auto& worker : s_data->workers)
+			worker->thread.join();
+
+		// Destroy tasks which weren't executed (their memory is owned by the thread contexts) and release their counters so nobody waits on them forever
+		// Releasing a counter may schedule the tasks depending on it through the injection queue, which are discarded as well
+		auto DiscardNode = [](TaskNode* node)
+		{
+			node->task.Reset();
+
+			if (Counter* counter = node->counter)
+				ReleaseCounter(*counter);
+		};
+
+		for (auto& worker : s_data->workers)
+		{
+			while (TaskNode* node = worker->queue.Pop())
+				DiscardNode(node);
+		}
+
+		while (TaskNode* node = PopInjectedNode())
+			DiscardNode(node);
+
+		s_data.reset();
+		s_isInitialized.store(false, std::memory_order_release);
 	}
 
 	/*!
-	* \brief Waits for tasks to be done
+	* \brief Waits until a counter reaches zero
+	*
+	* The calling thread executes pending tasks while waiting, it is therefore safe to wait from inside a task.
+	*
+	* \param counter Counter to wait on
 	*
 	* \remark Produce a NazaraError if the class is not initialized
 	*/
+	void TaskScheduler::WaitFor(Counter& counter)
+	{
+		if (!counter.IsDone())
+		{
+			if (!Initialize())
+			{
+				NazaraError("Failed to initialize Task Scheduler");
+				return;
+			}
+
+			ThreadContext& context = GetThreadContext();
+			while (!counter.IsDone())
+			{
+				if (TaskNode* node = FindNode(context))
+				{
+					node->task();
+					node->task.Reset();
+
+					Counter* taskCounter = node->counter;
+					FreeNode(node);
+
+					if (taskCounter)
+						ReleaseCounter(*taskCounter);
+				}
+				else
+					std::this_thread::yield();
+			}
+		}
 
+		// The last decrement happens under the counter lock, make sure it's over before giving control back (the counter may be destroyed right after)
+		std::lock_guard<std::mutex> lock(counter.m_mutex);
+	}
+
+	/*!
+	* \brief Waits for tasks started by Run to be done
+	*
+	* \remark Produce a NazaraError if the class is not initialized
+	*/
 	void TaskScheduler::WaitForTasks()
 	{
 		if (!Initialize())
@@ -118,19 +721,17 @@ namespace Nz
 			return;
 		}
 
-		TaskSchedulerImpl::WaitForTasks();
+		WaitFor(s_data->runCounter);
 	}
 
 	/*!
 	* \brief Adds a task on the pending list
 	*
-	* \param taskFunctor Functor represeting a task to be done
+	* \param task Task to be done on next Run call
 	*
 	* \remark Produce a NazaraError if the class is not initialized
-	* \remark A task containing a call on this class is undefined behaviour
 	*/
-
-	void TaskScheduler::AddTaskFunctor(Functor* taskFunctor)
+	void TaskScheduler::AddPendingTask(Task task)
 	{
 		if (!Initialize())
 		{
@@ -138,6 +739,51 @@ namespace Nz
 			return;
 		}
 
-		s_pendingWorks.push_back(taskFunctor);
+		std::lock_guard<std::mutex> lock(s_data->pendingMutex);
+		s_data->pendingTasks.push_back(std::move(task));
+	}
+
+	void TaskScheduler::ReleaseCounter(Counter& counter)
+	{
+		// Fast path: this is not the last task
+		unsigned int value = counter.m_value.load(std::memory_order_relaxed);
+		while (value > 1)
+		{
+			if (counter.m_value.compare_exchange_weak(value, value - 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+				return;
+		}
+
+		// Reaching zero must be done under the lock to synchronize with dependency registration
+		TaskNode* waitingTasks;
+		{
+			std::lock_guard<std::mutex> lock(counter.m_mutex);
+			if (counter.m_value.fetch_sub(1, std::memory_order_acq_rel) != 1)
+				return;
+
+			waitingTasks = counter.m_waitingTasks;
+			counter.m_waitingTasks = nullptr;
+		}
+
+		// Counter must not be accessed from here as it may have been destroyed
+		if (waitingTasks)
+		{
+			TaskNode* last = waitingTasks;
+			std::size_t count = 1;
+			while (last->next)
+			{
+				last = last->next;
+				count++;
+			}
+
+			PushNodes(waitingTasks, last, count);
+		}
+	}
+
+	TaskScheduler::Counter::~Counter()
+	{
+		// Wait for the last decrement to release the lock
+		std::lock_guard<std::mutex> lock(m_mutex);
+		NazaraAssert(m_value.load(std::memory_order_relaxed) == 0, "counter destroyed while tasks are pending");
+		NazaraAssert(!m_waitingTasks, "counter destroyed while tasks depend on it");
 	}
 }
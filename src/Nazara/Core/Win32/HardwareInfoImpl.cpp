@@ -109,4 +109,21 @@ namespace Nz
 		#endif
 	#endif
 	}
+	UInt64 HardwareInfoImpl::Xgetbv(UInt32 registerId)
+	{
+	#if defined(NAZARA_COMPILER_MSVC)
+		// Only valid if CPUID reports OSXSAVE support
+		return _xgetbv(registerId);
+	#elif defined(NAZARA_COMPILER_CLANG) || defined(NAZARA_COMPILER_GCC) || defined(NAZARA_COMPILER_INTEL)
+		UInt32 eax, edx;
+		asm volatile(".byte 0x0f, 0x01, 0xd0" // xgetbv, encoded for assemblers not knowing it
+			: "=a"(eax), "=d"(edx)
+			: "c"(registerId));
+
+		return (UInt64(edx) << 32) | eax;
+	#else
+		NazaraInternalError("Xgetbv has been called although it is not supported");
+		return 0;
+	#endif
+	}
 }
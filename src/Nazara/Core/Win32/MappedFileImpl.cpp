@@ -0,0 +1,90 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Core/Win32/MappedFileImpl.hpp>
+#include <Nazara/Core/CallOnExit.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/StringExt.hpp>
+#include <windows.h>
+#include <limits>
+#include <Nazara/Core/Debug.hpp>
+
+namespace Nz
+{
+	MappedFileImpl::MappedFileImpl() :
+	m_view(nullptr),
+	m_size(0)
+	{
+	}
+
+	MappedFileImpl::~MappedFileImpl()
+	{
+		if (m_view)
+			UnmapViewOfFile(m_view);
+	}
+
+	const UInt8* MappedFileImpl::GetData() const
+	{
+		return static_cast<const UInt8*>(m_view);
+	}
+
+	UInt64 MappedFileImpl::GetSize() const
+	{
+		return m_size;
+	}
+
+	bool MappedFileImpl::Open(const std::filesystem::path& filePath)
+	{
+		HANDLE fileHandle = CreateFileW(ToWideString(filePath.generic_u8string()).data(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			NazaraError("Failed to open \"" + filePath.generic_u8string() + "\" : " + Error::GetLastSystemError());
+			return false;
+		}
+
+		CallOnExit closeFile([&] { CloseHandle(fileHandle); });
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(fileHandle, &fileSize))
+		{
+			NazaraError("Failed to get file size: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		if (fileSize.QuadPart <= 0)
+		{
+			NazaraError("Only non-empty files can be mapped");
+			return false;
+		}
+
+		UInt64 size = static_cast<UInt64>(fileSize.QuadPart);
+		if (size > std::numeric_limits<std::size_t>::max())
+		{
+			NazaraError("File is too big to be mapped");
+			return false;
+		}
+
+		HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mappingHandle)
+		{
+			NazaraError("Failed to create file mapping: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		// The view keeps a reference to the mapping object
+		void* view = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(mappingHandle);
+
+		if (!view)
+		{
+			NazaraError("Failed to map file: " + Error::GetLastSystemError());
+			return false;
+		}
+
+		m_view = view;
+		m_size = size;
+
+		return true;
+	}
+}
@@ -3,23 +3,32 @@
 // For conditions of distribution and use, see copyright notice in Config.hpp
 
 #include <Nazara/Graphics/ForwardFramePipeline.hpp>
+#include <Nazara/Core/Algorithm.hpp>
 #include <Nazara/Graphics/AbstractViewer.hpp>
 #include <Nazara/Graphics/FrameGraph.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Graphics/InstancedRenderable.hpp>
+#include <Nazara/Graphics/PredefinedShaderStructs.hpp>
+#include <Nazara/Graphics/UberShader.hpp>
 #include <Nazara/Graphics/ViewerInstance.hpp>
 #include <Nazara/Graphics/WorldInstance.hpp>
+#include <Nazara/Math/Frustum.hpp>
 #include <Nazara/Renderer/CommandBufferBuilder.hpp>
 #include <Nazara/Renderer/Framebuffer.hpp>
+#include <Nazara/Renderer/RenderDevice.hpp>
 #include <Nazara/Renderer/RenderFrame.hpp>
 #include <Nazara/Renderer/RenderTarget.hpp>
 #include <Nazara/Renderer/UploadPool.hpp>
+#include <algorithm>
 #include <array>
+#include <cstring>
+#include <stdexcept>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
 {
 	ForwardFramePipeline::ForwardFramePipeline() :
+	m_asyncShaderCompilationCount(0),
 	m_rebuildFrameGraph(true),
 	m_rebuildForwardPass(false)
 	{
@@ -41,6 +50,16 @@ namespace Nz
 		if (auto it = renderableMap.find(instancedRenderable); it == renderableMap.end())
 		{
 			auto& renderableData = renderableMap.emplace(instancedRenderable, RenderableData{}).first->second;
+			renderableData.renderable = instancedRenderable;
+			renderableData.worldInstance = worldInstance;
+			renderableData.cullingEntry = m_cullingList.RegisterBoxTest(&renderableData);
+			UpdateRenderableBox(renderableData);
+
+			renderableData.onAABBUpdate.Connect(instancedRenderable->OnAABBUpdate, [&renderableData](InstancedRenderable* /*instancedRenderable*/, const Boxf& /*aabb*/)
+			{
+				UpdateRenderableBox(renderableData);
+			});
+
 			renderableData.onMaterialInvalidated.Connect(instancedRenderable->OnMaterialInvalidated, [this](InstancedRenderable* instancedRenderable, std::size_t materialIndex, const std::shared_ptr<Material>& newMaterial)
 			{
 				if (newMaterial)
@@ -77,9 +96,20 @@ namespace Nz
 		{
 			renderFrame.PushForRelease(std::move(m_bakedFrameGraph));
 			m_bakedFrameGraph = BuildFrameGraph();
-			m_rebuildForwardPass = false; //< No need to rebuild forward pass twice
+			m_rebuildForwardPass = true; //< New frame graph, every forward pass has to be recorded
+		}
+
+		// Renderables skip their elements until their shaders are compiled, rebuild render queues when some shaders got ready
+		UInt64 asyncShaderCompilationCount = UberShader::GetAsyncCompilationCount();
+		if (asyncShaderCompilationCount != m_asyncShaderCompilationCount)
+		{
+			m_asyncShaderCompilationCount = asyncShaderCompilationCount;
+			m_rebuildForwardPass = true;
 		}
 
+		// Instanced draws read world matrices from the viewers instance buffers, which have to be updated as well
+		bool worldInstancesInvalidated = !m_invalidatedWorldInstances.empty();
+
 		// Update UBOs and materials
 		UploadPool& uploadPool = renderFrame.GetUploadPool();
 
@@ -95,10 +125,22 @@ namespace Nz
 				m_invalidatedViewerInstances.clear();
 
 				for (WorldInstance* worldInstance : m_invalidatedWorldInstances)
-					worldInstance->UpdateBuffers(uploadPool, builder);
+				{
+					worldInstance->UpdateInstanceData();
+
+					// World matrix changed, update bounding boxes used for culling
+					if (auto it = m_renderables.find(worldInstance); it != m_renderables.end())
+					{
+						for (auto&& [_, renderableData] : it->second)
+							UpdateRenderableBox(renderableData);
+					}
+				}
 
 				m_invalidatedWorldInstances.clear();
 
+				// Transfer every instance data at once
+				graphics->GetInstanceDataArena().UpdateBuffers(uploadPool, builder);
+
 				for (Material* material : m_invalidatedMaterials)
 				{
 					if (material->Update(renderFrame, builder))
@@ -111,6 +153,75 @@ namespace Nz
 			builder.EndDebugRegion();
 		}, QueueType::Transfer);
 
+		// Frustum culling: each viewer only records visible renderables, commands are recorded again only if the visible set changed
+		for (auto&& [viewer, viewerData] : m_viewers)
+		{
+			const ViewerInstance& viewerInstance = viewer->GetViewerInstance();
+
+			Frustumf frustum;
+			frustum.Extract(viewerInstance.GetViewMatrix(), viewerInstance.GetProjectionMatrix());
+
+			bool forceInvalidation = false;
+			std::size_t visibilityHash = m_cullingList.Cull(frustum, &forceInvalidation);
+
+			if (m_rebuildForwardPass || forceInvalidation || visibilityHash != viewerData.visibilityHash)
+			{
+				BuildRenderQueue(viewerInstance, viewerData);
+				viewerData.rebuildForwardPass = true;
+
+				UInt64 instanceBufferSize = viewerData.instancedWorldInstances.size() * PredefinedInstancingData::GetOffsets().totalSize;
+				if (instanceBufferSize > 0 && (!viewerData.instanceBuffer || viewerData.instanceBuffer->GetSize() < instanceBufferSize))
+				{
+					if (viewerData.instanceBuffer)
+						renderFrame.PushForRelease(std::move(viewerData.instanceBuffer));
+
+					// Leave some room to avoid reallocating the buffer every time an instance appears
+					instanceBufferSize += instanceBufferSize / 2;
+
+					viewerData.instanceBuffer = graphics->GetRenderDevice()->InstantiateBuffer(BufferType::Vertex);
+					if (!viewerData.instanceBuffer->Initialize(instanceBufferSize, BufferUsage::DeviceLocal | BufferUsage::Dynamic))
+						throw std::runtime_error("failed to initialize instance buffer");
+				}
+			}
+			else if (worldInstancesInvalidated && !viewerData.instancedWorldInstances.empty())
+				viewerData.updateInstanceBuffer = true;
+
+			viewerData.visibilityHash = visibilityHash;
+		}
+		m_rebuildForwardPass = false;
+
+		if (std::any_of(m_viewers.begin(), m_viewers.end(), [](const auto& viewerPair) { return viewerPair.second.updateInstanceBuffer; }))
+		{
+			renderFrame.Execute([&](CommandBufferBuilder& builder)
+			{
+				builder.BeginDebugRegion("Instance buffers update", Color::Yellow);
+				{
+					builder.PreTransferBarrier();
+
+					PredefinedInstancingData instancingOffsets = PredefinedInstancingData::GetOffsets();
+					for (auto&& [_, viewerData] : m_viewers)
+					{
+						if (!viewerData.updateInstanceBuffer)
+							continue;
+
+						const auto& worldInstances = viewerData.instancedWorldInstances;
+						UInt64 instanceDataSize = worldInstances.size() * instancingOffsets.totalSize;
+
+						auto& allocation = uploadPool.Allocate(instanceDataSize);
+						for (std::size_t i = 0; i < worldInstances.size(); ++i)
+							AccessByOffset<Matrix4f&>(allocation.mappedPtr, i * instancingOffsets.totalSize + instancingOffsets.worldMatrixOffset) = worldInstances[i]->GetWorldMatrix();
+
+						builder.CopyBuffer(allocation, viewerData.instanceBuffer.get(), instanceDataSize);
+
+						viewerData.updateInstanceBuffer = false;
+					}
+
+					builder.PostTransferBarrier();
+				}
+				builder.EndDebugRegion();
+			}, QueueType::Transfer);
+		}
+
 		const Vector2ui& frameSize = renderFrame.GetSize();
 		if (m_bakedFrameGraph.Resize(frameSize.x, frameSize.y))
 		{
@@ -135,6 +246,20 @@ namespace Nz
 
 		m_bakedFrameGraph.Execute(renderFrame);
 
+		// Recorded commands are reused until the next rebuild, so are their stats
+		m_renderStats = RenderStats{};
+		for (auto&& [_, viewerData] : m_viewers)
+		{
+			const RenderStats& viewerStats = viewerData.renderStats;
+			m_renderStats.drawCount += viewerStats.drawCount;
+			m_renderStats.indexBufferBindCount += viewerStats.indexBufferBindCount;
+			m_renderStats.instancedDrawCount += viewerStats.instancedDrawCount;
+			m_renderStats.materialBindCount += viewerStats.materialBindCount;
+			m_renderStats.pipelineBindCount += viewerStats.pipelineBindCount;
+			m_renderStats.vertexBufferBindCount += viewerStats.vertexBufferBindCount;
+			m_renderStats.worldBindCount += viewerStats.worldBindCount;
+		}
+
 		for (auto&& [viewer, viewerData] : m_viewers)
 		{
 			const RenderTarget& renderTarget = viewer->GetRenderTarget();
@@ -232,18 +357,18 @@ namespace Nz
 			framePass.SetClearColor(0, Color::Black);
 			framePass.SetDepthStencilClear(1.f, 0);
 
-			framePass.SetExecutionCallback([this]()
+			framePass.SetExecutionCallback([viewerData = &viewerData]()
 			{
-				if (m_rebuildForwardPass)
+				if (viewerData->rebuildForwardPass)
 				{
-					m_rebuildForwardPass = false;
+					viewerData->rebuildForwardPass = false;
 					return FramePassExecution::UpdateAndExecute;
 				}
 				else
 					return FramePassExecution::Execute;
 			});
 
-			framePass.SetCommandCallback([this, viewer = viewer](CommandBufferBuilder& builder, const Recti& /*renderRect*/)
+			framePass.SetCommandCallback([viewer = viewer, viewerData = &viewerData](CommandBufferBuilder& builder, const Recti& /*renderRect*/)
 			{
 				Recti viewport = viewer->GetViewport();
 
@@ -251,12 +376,73 @@ namespace Nz
 				builder.SetViewport(viewport);
 				builder.BindShaderBinding(Graphics::ViewerBindingSet, viewer->GetViewerInstance().GetShaderBinding());
 
-				for (const auto& [worldInstance, renderables] : m_renderables)
+				RenderStats& renderStats = viewerData->renderStats;
+				renderStats = RenderStats{};
+
+				// Elements are sorted by state, only bind what changed since the previous draw
+				AbstractBuffer* currentIndexBuffer = nullptr;
+				AbstractBuffer* currentVertexBuffer = nullptr;
+				const RenderPipeline* currentPipeline = nullptr;
+				const ShaderBinding* currentMaterialBinding = nullptr;
+				const WorldInstance* currentWorldInstance = nullptr;
+
+				for (const DrawCall& drawCall : viewerData->drawCalls)
 				{
-					builder.BindShaderBinding(Graphics::WorldBindingSet, worldInstance->GetShaderBinding());
+					const RenderElement& element = *drawCall.element;
+
+					const RenderPipeline* renderPipeline = (drawCall.instanceCount > 0) ? element.instancedRenderPipeline : element.renderPipeline;
+					if (renderPipeline != currentPipeline)
+					{
+						builder.BindPipeline(*renderPipeline);
+						currentPipeline = renderPipeline;
+						renderStats.pipelineBindCount++;
+					}
 
-					for (const auto& [renderable, renderableData] : renderables)
-						renderable->Draw(builder);
+					if (element.materialBinding != currentMaterialBinding)
+					{
+						builder.BindShaderBinding(Graphics::MaterialBindingSet, *element.materialBinding);
+						currentMaterialBinding = element.materialBinding;
+						renderStats.materialBindCount++;
+					}
+
+					if (element.indexBuffer != currentIndexBuffer)
+					{
+						builder.BindIndexBuffer(element.indexBuffer);
+						currentIndexBuffer = element.indexBuffer;
+						renderStats.indexBufferBindCount++;
+					}
+
+					if (drawCall.instanceCount > 0)
+					{
+						// Instance data comes first (binding 0), mesh vertices second (binding 1)
+						UInt64 instanceOffset = drawCall.firstInstance * PredefinedInstancingData::GetOffsets().totalSize;
+						builder.BindVertexBuffer(0, viewerData->instanceBuffer.get(), instanceOffset);
+						builder.BindVertexBuffer(1, element.vertexBuffer);
+						currentVertexBuffer = nullptr;
+						renderStats.vertexBufferBindCount += 2;
+
+						builder.DrawIndexed(element.indexCount, static_cast<UInt32>(drawCall.instanceCount));
+						renderStats.drawCount++;
+						renderStats.instancedDrawCount++;
+						continue;
+					}
+
+					if (element.vertexBuffer != currentVertexBuffer)
+					{
+						builder.BindVertexBuffer(0, element.vertexBuffer);
+						currentVertexBuffer = element.vertexBuffer;
+						renderStats.vertexBufferBindCount++;
+					}
+
+					if (element.worldInstance != currentWorldInstance)
+					{
+						builder.BindShaderBinding(Graphics::WorldBindingSet, element.worldInstance->GetShaderBinding());
+						currentWorldInstance = element.worldInstance;
+						renderStats.worldBindCount++;
+					}
+
+					builder.DrawIndexed(element.indexCount);
+					renderStats.drawCount++;
 				}
 			});
 		}
@@ -268,6 +454,116 @@ namespace Nz
 		return frameGraph.Bake();
 	}
 
+	void ForwardFramePipeline::BuildRenderQueue(const ViewerInstance& viewerInstance, ViewerData& viewerData)
+	{
+		RenderQueue<RenderElement>& renderQueue = viewerData.renderQueue;
+
+		Vector3f eyePosition = viewerInstance.GetInvViewMatrix().GetTranslation();
+
+		auto FillElements = [&](const std::vector<const RenderableData*>& visibleRenderables)
+		{
+			for (const RenderableData* renderableData : visibleRenderables)
+			{
+				std::size_t firstElement = m_renderElements.size();
+				renderableData->renderable->BuildElements(m_renderElements);
+
+				float depth = eyePosition.SquaredDistance(renderableData->worldBox.GetCenter());
+				for (std::size_t i = firstElement; i < m_renderElements.size(); ++i)
+				{
+					RenderElement& element = m_renderElements[i];
+					element.depth = depth;
+					element.worldInstance = renderableData->worldInstance;
+				}
+			}
+		};
+
+		m_renderElements.clear();
+		FillElements(m_cullingList.GetFullyVisibleResults());
+		FillElements(m_cullingList.GetPartiallyVisibleResults());
+
+		renderQueue.Clear();
+		for (RenderElement& element : m_renderElements)
+			renderQueue.Insert(std::move(element));
+
+		// State indices are attributed by order of appearance, they only need to be unique for the current queue
+		m_sortKeyIndices.clear();
+		auto GetStateIndex = [&](const void* state) -> UInt64
+		{
+			constexpr UInt64 MaxIndex = (1 << 12) - 1;
+
+			auto it = m_sortKeyIndices.find(state);
+			if (it == m_sortKeyIndices.end())
+				it = m_sortKeyIndices.emplace(state, std::min<UInt64>(m_sortKeyIndices.size(), MaxIndex)).first;
+
+			return it->second;
+		};
+
+		renderQueue.Sort([&](const RenderElement& element)
+		{
+			// Sort key layout (most significant bits first):
+			// - Pipeline index (12 bits)
+			// - Material index (12 bits)
+			// - Vertex buffer index (12 bits)
+			// - Index buffer index (12 bits)
+			// - Depth (16 bits), front to back
+
+			// Positive floats keep their order when compared as integers, keep the 16 most significant bits
+			UInt32 depthBits;
+			std::memcpy(&depthBits, &element.depth, sizeof(float));
+
+			return GetStateIndex(element.renderPipeline) << 52 |
+			       GetStateIndex(element.materialBinding) << 40 |
+			       GetStateIndex(element.vertexBuffer) << 28 |
+			       GetStateIndex(element.indexBuffer) << 16 |
+			       UInt64(depthBits >> 16);
+		});
+
+		// Identical consecutive draws (same states and mesh) are merged into instanced draws
+		m_sortedElements.clear();
+		for (const RenderElement& element : renderQueue)
+			m_sortedElements.push_back(&element);
+
+		auto IsInstanceOf = [](const RenderElement& element, const RenderElement& firstElement)
+		{
+			return element.instancedRenderPipeline == firstElement.instancedRenderPipeline &&
+			       element.materialBinding == firstElement.materialBinding &&
+			       element.indexBuffer == firstElement.indexBuffer &&
+			       element.vertexBuffer == firstElement.vertexBuffer &&
+			       element.indexCount == firstElement.indexCount;
+		};
+
+		viewerData.drawCalls.clear();
+		viewerData.instancedWorldInstances.clear();
+
+		for (std::size_t i = 0; i < m_sortedElements.size();)
+		{
+			const RenderElement& firstElement = *m_sortedElements[i];
+
+			std::size_t batchEnd = i + 1;
+			if (firstElement.instancedRenderPipeline)
+			{
+				while (batchEnd < m_sortedElements.size() && IsInstanceOf(*m_sortedElements[batchEnd], firstElement))
+					batchEnd++;
+			}
+
+			if (batchEnd - i >= MinInstanceCount)
+			{
+				viewerData.drawCalls.push_back({ &firstElement, viewerData.instancedWorldInstances.size(), batchEnd - i });
+				for (std::size_t j = i; j < batchEnd; ++j)
+					viewerData.instancedWorldInstances.push_back(m_sortedElements[j]->worldInstance);
+			}
+			else
+			{
+				for (std::size_t j = i; j < batchEnd; ++j)
+					viewerData.drawCalls.push_back({ m_sortedElements[j], 0, 0 });
+			}
+
+			i = batchEnd;
+		}
+
+		viewerData.updateInstanceBuffer = !viewerData.instancedWorldInstances.empty();
+	}
+
 	void ForwardFramePipeline::RegisterMaterial(Material* material)
 	{
 		auto it = m_materials.find(material);
@@ -285,6 +581,14 @@ namespace Nz
 		it->second.usedCount++;
 	}
 
+	void ForwardFramePipeline::UpdateRenderableBox(RenderableData& renderableData)
+	{
+		renderableData.worldBox = renderableData.renderable->GetAABB();
+		renderableData.worldBox.Transform(renderableData.worldInstance->GetWorldMatrix());
+
+		renderableData.cullingEntry.UpdateBox(renderableData.worldBox);
+	}
+
 	void ForwardFramePipeline::UnregisterMaterial(Material* material)
 	{
 		auto it = m_materials.find(material);
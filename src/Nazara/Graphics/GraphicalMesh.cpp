@@ -11,7 +11,8 @@
 
 namespace Nz
 {
-	GraphicalMesh::GraphicalMesh(const Mesh& mesh)
+	GraphicalMesh::GraphicalMesh(const Mesh& mesh) :
+	m_aabb(mesh.GetAABB())
 	{
 		assert(mesh.GetAnimationType() == AnimationType::Static);
 
@@ -60,7 +60,9 @@ namespace Nz
 		if (!m_renderDevice)
 			throw std::runtime_error("failed to instantiate render device");
 
+		m_instanceDataArena.emplace(m_renderDevice, PredefinedInstanceData::GetOffsets().totalSize);
 		m_samplerCache.emplace(m_renderDevice);
+		m_shaderModuleCache.emplace(m_renderDevice, renderer->QueryAPI(), std::move(config.shaderCacheDirectory));
 
 		MaterialPipeline::Initialize();
 
@@ -78,7 +80,9 @@ namespace Nz
 	Graphics::~Graphics()
 	{
 		MaterialPipeline::Uninitialize();
+		m_instanceDataArena.reset();
 		m_samplerCache.reset();
+		m_shaderModuleCache.reset();
 		m_fullscreenVertexBuffer.reset();
 		m_fullscreenVertexDeclaration.reset();
 		m_blitPipeline.reset();
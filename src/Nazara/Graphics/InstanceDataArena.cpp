@@ -0,0 +1,126 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/InstanceDataArena.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Renderer/CommandBufferBuilder.hpp>
+#include <Nazara/Renderer/RenderDevice.hpp>
+#include <Nazara/Renderer/UploadPool.hpp>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup graphics
+	* \class Nz::InstanceDataArena
+	* \brief Graphics class sub-allocating per-instance uniform data from a few large buffers
+	*
+	* Every slot has a CPU copy, dirty slots are transferred by UpdateBuffers using as few copies as possible.
+	*/
+	InstanceDataArena::InstanceDataArena(std::shared_ptr<RenderDevice> device, UInt64 dataSize, std::size_t slotPerPage) :
+	m_device(std::move(device)),
+	m_slotPerPage(slotPerPage),
+	m_dataSize(dataSize)
+	{
+		UInt64 alignment = std::max<UInt64>(m_device->GetDeviceInfo().limits.minUniformBufferOffsetAlignment, 1);
+		m_slotStride = Align(m_dataSize, alignment);
+	}
+
+	std::size_t InstanceDataArena::Allocate()
+	{
+		if (m_freeSlots.empty())
+			AllocatePage();
+
+		std::size_t slotIndex = m_freeSlots.back();
+		m_freeSlots.pop_back();
+
+		return slotIndex;
+	}
+
+	void InstanceDataArena::Free(std::size_t slotIndex)
+	{
+		std::size_t pageIndex = slotIndex / m_slotPerPage;
+		assert(pageIndex < m_pages.size());
+
+		// Don't bother transferring data of a freed slot
+		m_pages[pageIndex].dirtySlots.Reset(slotIndex % m_slotPerPage);
+
+		m_freeSlots.push_back(slotIndex);
+	}
+
+	void InstanceDataArena::UpdateBuffers(UploadPool& uploadPool, CommandBufferBuilder& builder)
+	{
+		for (std::size_t pageIndex = m_dirtyPages.FindFirst(); pageIndex != m_dirtyPages.npos; pageIndex = m_dirtyPages.FindNext(pageIndex))
+		{
+			Page& page = m_pages[pageIndex];
+
+			// Merge dirty slots in ranges, a few clean slots in between are copied as well
+			m_dirtyRanges.clear();
+			for (std::size_t slot = page.dirtySlots.FindFirst(); slot != page.dirtySlots.npos; slot = page.dirtySlots.FindNext(slot))
+			{
+				if (!m_dirtyRanges.empty())
+				{
+					SlotRange& lastRange = m_dirtyRanges.back();
+					if (slot - (lastRange.first + lastRange.count) <= MaxCoalescedGap)
+					{
+						lastRange.count = slot - lastRange.first + 1;
+						continue;
+					}
+				}
+
+				m_dirtyRanges.push_back({ slot, 1 });
+			}
+
+			if (m_dirtyRanges.empty())
+				continue; //< Every dirty slot was freed
+
+			std::size_t slotCount = 0;
+			for (const SlotRange& range : m_dirtyRanges)
+				slotCount += range.count;
+
+			// One upload allocation per page, one copy per range
+			auto& allocation = uploadPool.Allocate(slotCount * m_slotStride);
+
+			UInt64 allocationOffset = 0;
+			for (const SlotRange& range : m_dirtyRanges)
+			{
+				UInt64 bufferOffset = range.first * m_slotStride;
+				UInt64 rangeSize = range.count * m_slotStride;
+
+				std::memcpy(static_cast<UInt8*>(allocation.mappedPtr) + allocationOffset, &page.data[bufferOffset], rangeSize);
+				builder.CopyBuffer(allocation, page.buffer.get(), rangeSize, allocationOffset, bufferOffset);
+
+				allocationOffset += rangeSize;
+			}
+
+			page.dirtySlots.Reset();
+		}
+
+		m_dirtyPages.Reset();
+	}
+
+	void InstanceDataArena::AllocatePage()
+	{
+		std::size_t pageIndex = m_pages.size();
+
+		Page& page = m_pages.emplace_back();
+		page.buffer = m_device->InstantiateBuffer(BufferType::Uniform);
+		if (!page.buffer->Initialize(m_slotStride * m_slotPerPage, BufferUsage::DeviceLocal | BufferUsage::Dynamic))
+		{
+			m_pages.pop_back();
+			throw std::runtime_error("failed to initialize instance data buffer");
+		}
+
+		page.data.resize(m_slotStride * m_slotPerPage);
+		page.dirtySlots.Resize(m_slotPerPage, false);
+
+		// Reverse order so that slots are handed out in increasing order, keeping active slots close to each other
+		m_freeSlots.reserve(m_freeSlots.size() + m_slotPerPage);
+		for (std::size_t i = m_slotPerPage; i > 0; --i)
+			m_freeSlots.push_back(pageIndex * m_slotPerPage + i - 1);
+	}
+}
@@ -22,27 +22,50 @@ namespace Nz
 	*/
 
 	/*!
-	* \brief Retrieve (and generate if required) a pipeline instance using shader flags without applying it
+	* \brief Retrieve the variant of this pipeline rendering multiple instances per draw
 	*
-	* \param flags Shader flags
+	* The instanced variant enables the INSTANCED option of the shaders, which then read the world matrix from a per-instance vertex buffer
+	* (see PredefinedInstancingData) bound before the mesh vertex buffer.
 	*
-	* \return Pipeline instance
+	* \return Instanced pipeline (which is owned by the pipeline cache) or nullptr if no shader of this pipeline supports instancing
 	*/
-	const std::shared_ptr<RenderPipeline>& MaterialPipeline::GetRenderPipeline(const std::vector<RenderPipelineInfo::VertexBufferData>& vertexBuffers) const
+	MaterialPipeline* MaterialPipeline::GetInstancedPipeline() const
 	{
-		for (const auto& pipeline : m_renderPipelines)
+		if (!m_instancedPipeline)
 		{
-			const auto& pipelineInfo = pipeline->GetPipelineInfo();
+			MaterialPipelineInfo instancedPipelineInfo = m_pipelineInfo;
 
-			bool isEqual = std::equal(pipelineInfo.vertexBuffers.begin(), pipelineInfo.vertexBuffers.end(), vertexBuffers.begin(), [](const auto& v1, const auto& v2)
+			bool supportsInstancing = false;
+			for (auto& shader : instancedPipelineInfo.shaders)
 			{
-				return v1.binding == v2.binding && v1.declaration == v2.declaration;
-			});
+				if (!shader.uberShader)
+					continue;
 
-			if (isEqual)
-				return pipeline;
+				if (UInt64 instancedFlag = shader.uberShader->GetOptionFlagByName("INSTANCED"))
+				{
+					shader.enabledOptions |= instancedFlag;
+					supportsInstancing = true;
+				}
+			}
+
+			m_instancedPipeline = (supportsInstancing) ? Get(instancedPipelineInfo).get() : nullptr;
 		}
 
+		return *m_instancedPipeline;
+	}
+
+	/*!
+	* \brief Retrieve (and generate if required) a pipeline instance using shader flags without applying it
+	*
+	* \param flags Shader flags
+	*
+	* \return Pipeline instance
+	*/
+	const std::shared_ptr<RenderPipeline>& MaterialPipeline::GetRenderPipeline(const std::vector<RenderPipelineInfo::VertexBufferData>& vertexBuffers) const
+	{
+		if (const std::shared_ptr<RenderPipeline>* pipeline = FindRenderPipeline(vertexBuffers))
+			return *pipeline;
+
 		RenderPipelineInfo renderPipelineInfo;
 		static_cast<RenderStates&>(renderPipelineInfo).operator=(m_pipelineInfo); // Not my proudest line
 
@@ -58,6 +81,70 @@ namespace Nz
 
 		return m_renderPipelines.emplace_back(Graphics::Instance()->GetRenderDevice()->InstantiateRenderPipeline(std::move(renderPipelineInfo)));
 	}
+
+	/*!
+	* \brief Starts compiling the shaders of this pipeline (and of its instanced variant) in background
+	*
+	* This is meant to be called while loading, so that the first frames using this pipeline don't have to wait for shaders.
+	*/
+	void MaterialPipeline::Prewarm() const
+	{
+		for (const auto& shader : m_pipelineInfo.shaders)
+		{
+			if (shader.uberShader)
+				shader.uberShader->Prewarm(shader.enabledOptions);
+		}
+
+		if (MaterialPipeline* instancedPipeline = GetInstancedPipeline(); instancedPipeline && instancedPipeline != this)
+			instancedPipeline->Prewarm();
+	}
+
+	/*!
+	* \brief Retrieve a pipeline instance without waiting for shader compilation
+	*
+	* If some shaders of this pipeline are not compiled yet, their compilation is started in background.
+	*
+	* \param vertexBuffers Vertex buffers layout
+	*
+	* \return Pipeline instance or nullptr if its shaders are still compiling
+	*
+	* \see GetRenderPipeline
+	*/
+	RenderPipeline* MaterialPipeline::TryGetRenderPipeline(const std::vector<RenderPipelineInfo::VertexBufferData>& vertexBuffers) const
+	{
+		if (const std::shared_ptr<RenderPipeline>* pipeline = FindRenderPipeline(vertexBuffers))
+			return pipeline->get();
+
+		bool isReady = true;
+		for (const auto& shader : m_pipelineInfo.shaders)
+		{
+			if (shader.uberShader && !shader.uberShader->IsReady(shader.enabledOptions))
+				isReady = false; //< Keep going to start compilation of every shader
+		}
+
+		if (!isReady)
+			return nullptr;
+
+		return GetRenderPipeline(vertexBuffers).get();
+	}
+
+	const std::shared_ptr<RenderPipeline>* MaterialPipeline::FindRenderPipeline(const std::vector<RenderPipelineInfo::VertexBufferData>& vertexBuffers) const
+	{
+		for (const auto& pipeline : m_renderPipelines)
+		{
+			const auto& pipelineInfo = pipeline->GetPipelineInfo();
+
+			bool isEqual = std::equal(pipelineInfo.vertexBuffers.begin(), pipelineInfo.vertexBuffers.end(), vertexBuffers.begin(), vertexBuffers.end(), [](const auto& v1, const auto& v2)
+			{
+				return v1.binding == v2.binding && v1.declaration == v2.declaration;
+			});
+
+			if (isEqual)
+				return &pipeline;
+		}
+
+		return nullptr;
+	}
 	/*!
 	* \brief Returns a reference to a MaterialPipeline built with MaterialPipelineInfo
 	*
@@ -6,6 +6,8 @@
 #include <Nazara/Graphics/GraphicalMesh.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Graphics/Material.hpp>
+#include <Nazara/Graphics/PredefinedShaderStructs.hpp>
+#include <Nazara/Graphics/RenderElement.hpp>
 #include <Nazara/Graphics/WorldInstance.hpp>
 #include <Nazara/Renderer/CommandBufferBuilder.hpp>
 #include <Nazara/Graphics/Debug.hpp>
@@ -26,6 +28,42 @@ namespace Nz
 					m_graphicalMesh->GetVertexDeclaration(i)
 				}
 			};
+
+			subMeshData.instancedVertexBufferData = {
+				{
+					0,
+					PredefinedInstancingData::GetVertexDeclaration()
+				},
+				{
+					1,
+					m_graphicalMesh->GetVertexDeclaration(i)
+				}
+			};
+		}
+
+		UpdateAABB(m_graphicalMesh->GetAABB());
+	}
+
+	void Model::BuildElements(std::vector<RenderElement>& elements) const
+	{
+		for (std::size_t i = 0; i < m_subMeshes.size(); ++i)
+		{
+			const auto& submeshData = m_subMeshes[i];
+
+			// Don't wait for shaders to compile, the submesh will appear once they're ready
+			const RenderPipeline* renderPipeline = submeshData.material->GetPipeline()->TryGetRenderPipeline(submeshData.vertexBufferData);
+			if (!renderPipeline)
+				continue;
+
+			auto& element = elements.emplace_back();
+			element.indexBuffer = m_graphicalMesh->GetIndexBuffer(i).get();
+			element.indexCount = static_cast<UInt32>(m_graphicalMesh->GetIndexCount(i));
+			element.materialBinding = &submeshData.material->GetShaderBinding();
+			element.renderPipeline = renderPipeline;
+			element.vertexBuffer = m_graphicalMesh->GetVertexBuffer(i).get();
+
+			if (MaterialPipeline* instancedPipeline = submeshData.material->GetPipeline()->GetInstancedPipeline())
+				element.instancedRenderPipeline = instancedPipeline->TryGetRenderPipeline(submeshData.instancedVertexBufferData);
 		}
 	}
 
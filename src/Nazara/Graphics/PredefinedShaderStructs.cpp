@@ -67,6 +67,20 @@ namespace Nz
 		return instanceData;
 	}
 
+	PredefinedInstancingData PredefinedInstancingData::GetOffsets()
+	{
+		PredefinedInstancingData instancingData;
+		instancingData.worldMatrixOffset = 0;
+		instancingData.totalSize = GetVertexDeclaration()->GetStride();
+
+		return instancingData;
+	}
+
+	const std::shared_ptr<VertexDeclaration>& PredefinedInstancingData::GetVertexDeclaration()
+	{
+		return VertexDeclaration::Get(VertexLayout::Matrix4_Instance);
+	}
+
 	PredefinedViewerData PredefinedViewerData::GetOffsets()
 	{
 		FieldOffsets viewerStruct(StructLayout::Std140);
@@ -0,0 +1,70 @@
+// Copyright (C) 2017 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/RenderQueue.hpp>
+#include <algorithm>
+#include <array>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	void RenderQueueInternal::Sort()
+	{
+		constexpr std::size_t RadixBits = 8;
+		constexpr std::size_t BucketCount = 1 << RadixBits;
+		constexpr std::size_t PassCount = sizeof(Index) * 8 / RadixBits;
+		constexpr std::size_t RadixThreshold = 64;
+
+		std::size_t elementCount = m_orderedRenderQueue.size();
+
+		// Comparison sort is faster for small queues
+		if (elementCount < RadixThreshold)
+		{
+			std::stable_sort(m_orderedRenderQueue.begin(), m_orderedRenderQueue.end(), [](const RenderDataPair& lhs, const RenderDataPair& rhs)
+			{
+				return lhs.first < rhs.first;
+			});
+
+			return;
+		}
+
+		// LSD radix sort, every histogram is computed in a single pass over the keys
+		std::array<std::array<std::size_t, BucketCount>, PassCount> histograms = {};
+		for (const RenderDataPair& pair : m_orderedRenderQueue)
+		{
+			for (std::size_t pass = 0; pass < PassCount; ++pass)
+				histograms[pass][(pair.first >> (pass * RadixBits)) & (BucketCount - 1)]++;
+		}
+
+		m_sortBuffer.resize(elementCount);
+
+		RenderDataPair* source = m_orderedRenderQueue.data();
+		RenderDataPair* destination = m_sortBuffer.data();
+		for (std::size_t pass = 0; pass < PassCount; ++pass)
+		{
+			std::size_t shift = pass * RadixBits;
+			auto& histogram = histograms[pass];
+
+			// Skip digits shared by every key (unused key bits for example)
+			if (histogram[(source[0].first >> shift) & (BucketCount - 1)] == elementCount)
+				continue;
+
+			std::size_t offset = 0;
+			for (std::size_t& bucket : histogram)
+			{
+				std::size_t count = bucket;
+				bucket = offset;
+				offset += count;
+			}
+
+			for (std::size_t i = 0; i < elementCount; ++i)
+				destination[histogram[(source[i].first >> shift) & (BucketCount - 1)]++] = source[i];
+
+			std::swap(source, destination);
+		}
+
+		if (source != m_orderedRenderQueue.data())
+			m_orderedRenderQueue.swap(m_sortBuffer);
+	}
+}
@@ -0,0 +1,158 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Graphics/ShaderModuleCache.hpp>
+#include <Nazara/Core/AbstractHash.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Renderer/RenderDevice.hpp>
+#include <Nazara/Shader/SpirvData.hpp>
+#include <Nazara/Shader/SpirvWriter.hpp>
+#include <Nazara/Shader/Ast/AstSerializer.hpp>
+#include <functional>
+#include <thread>
+#include <Nazara/Graphics/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup graphics
+	* \class Nz::ShaderModuleCache
+	* \brief Graphics class storing generated shader code on disk, addressed by the hash of everything it depends on
+	*
+	* Only backends consuming SPIR-V are cached, as OpenGL generates its GLSL at pipeline link time (depending on the context and bindings).
+	*/
+	ShaderModuleCache::ShaderModuleCache(std::shared_ptr<RenderDevice> device, RenderAPI renderAPI, std::filesystem::path cacheDirectory) :
+	m_hitCount(0),
+	m_missCount(0),
+	m_cacheDirectory(std::move(cacheDirectory)),
+	m_device(std::move(device)),
+	m_renderAPI(renderAPI)
+	{
+		m_isEnabled = !m_cacheDirectory.empty() && m_renderAPI == RenderAPI::Vulkan;
+		if (m_isEnabled)
+		{
+			std::error_code ec;
+			std::filesystem::create_directories(m_cacheDirectory, ec);
+			if (ec)
+			{
+				NazaraWarning("failed to create shader cache directory " + m_cacheDirectory.generic_u8string() + ": " + ec.message() + ", shader cache is disabled");
+				m_isEnabled = false;
+			}
+		}
+	}
+
+	std::shared_ptr<ShaderModule> ShaderModuleCache::Get(ShaderStageTypeFlags shaderStages, ShaderAst::Statement& shaderAst, const ByteArray& astHash, const ShaderWriter::States& states)
+	{
+		if (!m_isEnabled)
+			return m_device->InstantiateShaderModule(shaderStages, shaderAst, states);
+
+		std::filesystem::path cachePath = ComputeCachePath(shaderStages, astHash, states);
+
+		std::vector<UInt32> code;
+		if (LoadCode(cachePath, code))
+		{
+			m_hitCount.fetch_add(1, std::memory_order_relaxed);
+			return m_device->InstantiateShaderModule(shaderStages, ShaderLanguage::SpirV, code.data(), code.size() * sizeof(UInt32), {});
+		}
+
+		m_missCount.fetch_add(1, std::memory_order_relaxed);
+
+		SpirvWriter writer;
+		code = writer.Generate(shaderAst, states);
+
+		StoreCode(cachePath, code);
+
+		return m_device->InstantiateShaderModule(shaderStages, ShaderLanguage::SpirV, code.data(), code.size() * sizeof(UInt32), {});
+	}
+
+	ByteArray ShaderModuleCache::ComputeAstHash(ShaderAst::StatementPtr& shaderAst)
+	{
+		return ComputeHash(HashType::SHA256, ShaderAst::SerializeShader(shaderAst));
+	}
+
+	std::filesystem::path ShaderModuleCache::ComputeCachePath(ShaderStageTypeFlags shaderStages, const ByteArray& astHash, const ShaderWriter::States& states) const
+	{
+		std::unique_ptr<AbstractHash> hash = AbstractHash::Get(HashType::SHA256);
+		hash->Begin();
+
+		auto AppendValue = [&](auto value)
+		{
+			hash->Append(reinterpret_cast<const UInt8*>(&value), sizeof(value));
+		};
+
+		hash->Append(astHash.GetConstBuffer(), astHash.GetSize());
+		AppendValue(UInt64(states.enabledOptions));
+		AppendValue(UInt8(states.optimize));
+		AppendValue(UInt8(states.sanitized));
+		AppendValue(UInt32(shaderStages));
+		AppendValue(UInt32(m_renderAPI));
+		AppendValue(WriterVersion);
+
+		std::filesystem::path cachePath = m_cacheDirectory / hash->End().ToHex();
+		cachePath += ".spv";
+
+		return cachePath;
+	}
+
+	bool ShaderModuleCache::LoadCode(const std::filesystem::path& cachePath, std::vector<UInt32>& code) const
+	{
+		std::error_code ec;
+		if (!std::filesystem::is_regular_file(cachePath, ec))
+			return false;
+
+		File file(cachePath, OpenMode::ReadOnly);
+		if (!file.IsOpen())
+			return false;
+
+		UInt64 fileSize = file.GetSize();
+		if (fileSize == 0 || fileSize % sizeof(UInt32) != 0)
+		{
+			NazaraWarning("ignoring corrupted shader cache entry " + cachePath.generic_u8string());
+			return false;
+		}
+
+		code.resize(fileSize / sizeof(UInt32));
+		if (file.Read(code.data(), fileSize) != fileSize || code.front() != SpirvMagicNumber)
+		{
+			NazaraWarning("ignoring corrupted shader cache entry " + cachePath.generic_u8string());
+			return false;
+		}
+
+		return true;
+	}
+
+	void ShaderModuleCache::StoreCode(const std::filesystem::path& cachePath, const std::vector<UInt32>& code) const
+	{
+		// Write to a temporary file and rename it so other processes never read a partial entry
+		std::filesystem::path tempPath = cachePath;
+		tempPath += "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+
+		{
+			File file(tempPath, OpenMode::WriteOnly | OpenMode::Truncate);
+			if (!file.IsOpen())
+			{
+				NazaraWarning("failed to open " + tempPath.generic_u8string() + " for writing");
+				return;
+			}
+
+			std::size_t codeSize = code.size() * sizeof(UInt32);
+			if (file.Write(code.data(), codeSize) != codeSize)
+			{
+				NazaraWarning("failed to write shader cache entry " + tempPath.generic_u8string());
+				file.Close();
+				file.Delete();
+				return;
+			}
+		}
+
+		std::error_code ec;
+		std::filesystem::rename(tempPath, cachePath, ec);
+		if (ec)
+		{
+			NazaraWarning("failed to store shader cache entry " + cachePath.generic_u8string() + ": " + ec.message());
+			std::filesystem::remove(tempPath, ec);
+		}
+	}
+}
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Prerequisites.hpp
 
 #include <Nazara/Graphics/Systems/RenderSystem.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
 #include <Nazara/Graphics/ForwardFramePipeline.hpp>
 #include <Nazara/Graphics/ViewerInstance.hpp>
 #include <Nazara/Graphics/WorldInstance.hpp>
@@ -12,6 +13,7 @@
 #include <Nazara/Renderer/RenderFrame.hpp>
 #include <Nazara/Renderer/UploadPool.hpp>
 #include <Nazara/Utility/Components/NodeComponent.hpp>
+#include <algorithm>
 #include <Nazara/Graphics/Debug.hpp>
 
 namespace Nz
@@ -45,14 +47,15 @@ namespace Nz
 
 			m_pipeline->RegisterViewer(&entityCamera);
 
-			m_invalidatedCameraNode.insert(entity);
-
 			assert(m_cameraEntities.find(entity) == m_cameraEntities.end());
 			auto& cameraEntity = m_cameraEntities[entity];
-			cameraEntity.onNodeInvalidation.Connect(entityNode.OnNodeInvalidation, [this, entity](const Node* node)
+			cameraEntity.entity = entity;
+			cameraEntity.onNodeInvalidation.Connect(entityNode.OnNodeInvalidation, [this, cameraEntity = &cameraEntity](const Node* /*node*/)
 			{
-				m_invalidatedCameraNode.insert(entity);
+				Invalidate(*cameraEntity, m_invalidatedCameraNode, m_invalidationMutex);
 			});
+
+			Invalidate(cameraEntity, m_invalidatedCameraNode, m_invalidationMutex);
 		});
 		
 		m_graphicsConstructObserver.each([&](entt::entity entity)
@@ -64,15 +67,16 @@ namespace Nz
 			for (const auto& renderable : entityGfx.GetRenderables())
 				m_pipeline->RegisterInstancedDrawable(&worldInstance, renderable.get());
 
-			m_invalidatedWorldNode.insert(entity);
-
 			assert(m_graphicsEntities.find(entity) == m_graphicsEntities.end());
 			auto& graphicsEntity = m_graphicsEntities[entity];
-			graphicsEntity.onNodeInvalidation.Connect(entityNode.OnNodeInvalidation, [this, entity](const Node* node)
+			graphicsEntity.entity = entity;
+			graphicsEntity.onNodeInvalidation.Connect(entityNode.OnNodeInvalidation, [this, graphicsEntity = &graphicsEntity](const Node* /*node*/)
 			{
-				m_invalidatedWorldNode.insert(entity);
+				Invalidate(*graphicsEntity, m_invalidatedWorldNode, m_invalidationMutex);
 			});
 
+			Invalidate(graphicsEntity, m_invalidatedWorldNode, m_invalidationMutex);
+
 			graphicsEntity.onRenderableAttached.Connect(entityGfx.OnRenderableAttached, [this](GraphicsComponent* gfx, const std::shared_ptr<InstancedRenderable>& renderable)
 			{
 				WorldInstance& worldInstance = gfx->GetWorldInstance();
@@ -93,8 +97,11 @@ namespace Nz
 
 	void RenderSystem::OnCameraDestroy(entt::registry& registry, entt::entity entity)
 	{
-		m_cameraEntities.erase(entity);
-		m_invalidatedCameraNode.erase(entity);
+		if (auto it = m_cameraEntities.find(entity); it != m_cameraEntities.end())
+		{
+			RemoveInvalidated(it->second, m_invalidatedCameraNode);
+			m_cameraEntities.erase(it);
+		}
 
 		CameraComponent& entityCamera = registry.get<CameraComponent>(entity);
 		m_pipeline->UnregisterViewer(&entityCamera);
@@ -102,8 +109,11 @@ namespace Nz
 
 	void RenderSystem::OnGraphicsDestroy(entt::registry& registry, entt::entity entity)
 	{
-		m_graphicsEntities.erase(entity);
-		m_invalidatedWorldNode.erase(entity);
+		if (auto it = m_graphicsEntities.find(entity); it != m_graphicsEntities.end())
+		{
+			RemoveInvalidated(it->second, m_invalidatedWorldNode);
+			m_graphicsEntities.erase(it);
+		}
 
 		GraphicsComponent& entityGfx = registry.get<GraphicsComponent>(entity);
 		WorldInstance& worldInstance = entityGfx.GetWorldInstance();
@@ -122,27 +132,59 @@ namespace Nz
 
 	void RenderSystem::UpdateInstances(entt::registry& registry)
 	{
-		for (entt::entity entity : m_invalidatedCameraNode)
+		for (CameraEntity* cameraEntity : m_invalidatedCameraNode)
 		{
-			const NodeComponent& entityNode = registry.get<const NodeComponent>(entity);
-			CameraComponent& entityCamera = registry.get<CameraComponent>(entity);
+			if (!cameraEntity)
+				continue; //< Destroyed
+
+			const NodeComponent& entityNode = registry.get<const NodeComponent>(cameraEntity->entity);
+			CameraComponent& entityCamera = registry.get<CameraComponent>(cameraEntity->entity);
 
 			ViewerInstance& viewerInstance = entityCamera.GetViewerInstance();
 			viewerInstance.UpdateViewMatrix(Nz::Matrix4f::ViewMatrix(entityNode.GetPosition(CoordSys::Global), entityNode.GetRotation(CoordSys::Global)));
 
 			m_pipeline->InvalidateViewer(&entityCamera);
+
+			cameraEntity->invalidated.store(false, std::memory_order_relaxed);
 		}
 		m_invalidatedCameraNode.clear();
 
-		for (entt::entity entity : m_invalidatedWorldNode)
+		m_invalidatedWorldNode.erase(std::remove(m_invalidatedWorldNode.begin(), m_invalidatedWorldNode.end(), nullptr), m_invalidatedWorldNode.end());
+
+		auto view = registry.view<const NodeComponent, GraphicsComponent>();
+
+		auto UpdateWorldInstance = [&](const GraphicsEntity* graphicsEntity)
 		{
-			const NodeComponent& entityNode = registry.get<const NodeComponent>(entity);
-			GraphicsComponent& entityGraphics = registry.get<GraphicsComponent>(entity);
+			const NodeComponent& entityNode = view.get<const NodeComponent>(graphicsEntity->entity);
+			GraphicsComponent& entityGraphics = view.get<GraphicsComponent>(graphicsEntity->entity);
 
 			WorldInstance& worldInstance = entityGraphics.GetWorldInstance();
 			worldInstance.UpdateWorldMatrix(entityNode.GetTransformMatrix());
+		};
+
+		// Computing the world matrices (and their inverse) of nodes without parent doesn't touch any shared state, do it concurrently
+		// Other nodes may lazily update their parents and are processed afterwards
+		auto rootEnd = std::partition(m_invalidatedWorldNode.begin(), m_invalidatedWorldNode.end(), [&](const GraphicsEntity* graphicsEntity)
+		{
+			return view.get<const NodeComponent>(graphicsEntity->entity).GetParent() == nullptr;
+		});
+
+		std::size_t rootCount = static_cast<std::size_t>(std::distance(m_invalidatedWorldNode.begin(), rootEnd));
+		ParallelForRange(0, rootCount, [&](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t i = begin; i < end; ++i)
+				UpdateWorldInstance(m_invalidatedWorldNode[i]);
+		}, ComputeGrainSize(rootCount, 256));
+
+		for (std::size_t i = rootCount; i < m_invalidatedWorldNode.size(); ++i)
+			UpdateWorldInstance(m_invalidatedWorldNode[i]);
+
+		for (GraphicsEntity* graphicsEntity : m_invalidatedWorldNode)
+		{
+			GraphicsComponent& entityGraphics = view.get<GraphicsComponent>(graphicsEntity->entity);
+			m_pipeline->InvalidateWorldInstance(&entityGraphics.GetWorldInstance());
 
-			m_pipeline->InvalidateWorldInstance(&worldInstance);
+			graphicsEntity->invalidated.store(false, std::memory_order_relaxed);
 		}
 		m_invalidatedWorldNode.clear();
 	}
@@ -49,6 +49,16 @@ namespace Nz
 		m_combinationMask = std::numeric_limits<UInt64>::max();
 		m_combinationMask <<= optionCount;
 		m_combinationMask = ~m_combinationMask;
+
+		if (Graphics::Instance()->GetShaderModuleCache().IsEnabled())
+			m_shaderAstHash = ShaderModuleCache::ComputeAstHash(m_shaderAst);
+	}
+
+	UberShader::~UberShader()
+	{
+		// Background compilations reference this object
+		for (auto&& [combination, combinationData] : m_combinations)
+			TaskScheduler::WaitFor(combinationData->compilationCounter);
 	}
 
 	UInt64 UberShader::GetOptionFlagByName(const std::string& optionName) const
@@ -60,21 +70,143 @@ namespace Nz
 		return SetBit<UInt64>(0, it->second);
 	}
 
+	/*!
+	* \brief Retrieves a variant of the shader, compiling it if required
+	*
+	* If the variant is being compiled in background, this waits for it (executing other tasks meanwhile).
+	*
+	* \param combination Enabled options
+	*/
 	const std::shared_ptr<ShaderModule>& UberShader::Get(UInt64 combination)
 	{
 		combination &= m_combinationMask;
 
-		auto it = m_combinations.find(combination);
-		if (it == m_combinations.end())
+		Combination* combinationData;
 		{
-			ShaderWriter::States states;
-			states.enabledOptions = combination;
+			std::unique_lock<std::mutex> lock(m_mutex);
+
+			auto it = m_combinations.find(combination);
+			if (it == m_combinations.end())
+			{
+				// Compile on the calling thread
+				lock.unlock();
+				std::shared_ptr<ShaderModule> shaderModule = Compile(combination);
+				lock.lock();
+
+				it = m_combinations.find(combination);
+				if (it == m_combinations.end())
+				{
+					auto newCombination = std::make_unique<Combination>();
+					newCombination->shaderModule = std::move(shaderModule);
+					newCombination->isReady = true;
+
+					it = m_combinations.emplace(combination, std::move(newCombination)).first;
+				}
+			}
+
+			combinationData = it->second.get();
+		}
 
-			std::shared_ptr<ShaderModule> stage = Graphics::Instance()->GetRenderDevice()->InstantiateShaderModule(m_shaderStages, *m_shaderAst, std::move(states));
+		TaskScheduler::WaitFor(combinationData->compilationCounter);
 
-			it = m_combinations.emplace(combination, std::move(stage)).first;
-		}
+		if (combinationData->error)
+			std::rethrow_exception(combinationData->error);
+
+		return combinationData->shaderModule;
+	}
 
-		return it->second;
+	/*!
+	* \brief Checks if a variant of the shader can be retrieved without blocking, and starts compiling it in background if not
+	* \return True if the variant is ready
+	*
+	* \param combination Enabled options
+	*
+	* \see Prewarm
+	*/
+	bool UberShader::IsReady(UInt64 combination)
+	{
+		combination &= m_combinationMask;
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return StartCompilation(combination).isReady;
 	}
+
+	/*!
+	* \brief Starts compiling a variant of the shader in background, if it's not already available
+	*
+	* \param combination Enabled options
+	*/
+	void UberShader::Prewarm(UInt64 combination)
+	{
+		combination &= m_combinationMask;
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		StartCompilation(combination);
+	}
+
+	/*!
+	* \brief Starts compiling multiple variants of the shader in background (for example all variants used by a level materials)
+	*
+	* \param combinations Enabled options of every variant
+	*/
+	void UberShader::Prewarm(const std::vector<UInt64>& combinations)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		for (UInt64 combination : combinations)
+			StartCompilation(combination & m_combinationMask);
+	}
+
+	/*!
+	* \brief Returns the number of shader variants which finished compiling in background since the program started
+	*
+	* This can be used to detect that some variants became ready since the last frame.
+	*/
+	UInt64 UberShader::GetAsyncCompilationCount()
+	{
+		return s_asyncCompilationCount.load(std::memory_order_acquire);
+	}
+
+	std::shared_ptr<ShaderModule> UberShader::Compile(UInt64 combination)
+	{
+		ShaderWriter::States states;
+		states.enabledOptions = combination;
+
+		return Graphics::Instance()->GetShaderModuleCache().Get(m_shaderStages, *m_shaderAst, m_shaderAstHash, states);
+	}
+
+	auto UberShader::StartCompilation(UInt64 combination) -> Combination&
+	{
+		auto it = m_combinations.find(combination);
+		if (it != m_combinations.end())
+			return *it->second;
+
+		Combination& combinationData = *m_combinations.emplace(combination, std::make_unique<Combination>()).first->second;
+
+		TaskScheduler::Submit([this, combination, &combinationData]
+		{
+			std::shared_ptr<ShaderModule> shaderModule;
+			std::exception_ptr error;
+			try
+			{
+				shaderModule = Compile(combination);
+			}
+			catch (...)
+			{
+				error = std::current_exception();
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				combinationData.error = std::move(error);
+				combinationData.shaderModule = std::move(shaderModule);
+				combinationData.isReady = true;
+			}
+
+			s_asyncCompilationCount.fetch_add(1, std::memory_order_release);
+		}, &combinationData.compilationCounter);
+
+		return combinationData;
+	}
+
+	std::atomic<UInt64> UberShader::s_asyncCompilationCount(0);
 }
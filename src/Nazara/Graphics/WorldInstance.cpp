@@ -5,6 +5,7 @@
 #include <Nazara/Graphics/WorldInstance.hpp>
 #include <Nazara/Core/StackVector.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Graphics/InstanceDataArena.hpp>
 #include <Nazara/Graphics/MaterialSettings.hpp>
 #include <Nazara/Graphics/PredefinedShaderStructs.hpp>
 #include <Nazara/Renderer/CommandBufferBuilder.hpp>
@@ -14,40 +15,86 @@
 namespace Nz
 {
 	WorldInstance::WorldInstance() :
+	m_instanceDataArena(&Graphics::Instance()->GetInstanceDataArena()),
 	m_invWorldMatrix(Nz::Matrix4f::Identity()),
 	m_worldMatrix(Nz::Matrix4f::Identity()),
 	m_dataInvalided(true)
 	{
-		Nz::PredefinedInstanceData instanceUboOffsets = Nz::PredefinedInstanceData::GetOffsets();
-
-		m_instanceDataBuffer = Graphics::Instance()->GetRenderDevice()->InstantiateBuffer(BufferType::Uniform);
-		if (!m_instanceDataBuffer->Initialize(instanceUboOffsets.totalSize, Nz::BufferUsage::DeviceLocal | Nz::BufferUsage::Dynamic))
-			throw std::runtime_error("failed to initialize viewer data UBO");
+		// Instance data lives in a buffer shared with other instances
+		m_instanceDataSlot = m_instanceDataArena->Allocate();
 
 		m_shaderBinding = Graphics::Instance()->GetReferencePipelineLayout()->AllocateShaderBinding(Graphics::WorldBindingSet);
 		m_shaderBinding->Update({
 			{
 				0,
 				ShaderBinding::UniformBufferBinding {
-					m_instanceDataBuffer.get(), 0, m_instanceDataBuffer->GetSize()
+					GetInstanceBuffer().get(), GetInstanceBufferOffset(), m_instanceDataArena->GetDataSize()
 				}
 			}
 		});
 	}
 
+	WorldInstance::~WorldInstance()
+	{
+		if (m_instanceDataArena)
+			m_instanceDataArena->Free(m_instanceDataSlot);
+	}
+
+	/*!
+	* \brief Returns the buffer holding this instance data
+	*
+	* This buffer is shared with other instances (there's no non-const overload as it must not be replaced), the data of this instance starts at GetInstanceBufferOffset.
+	*/
+	const std::shared_ptr<AbstractBuffer>& WorldInstance::GetInstanceBuffer() const
+	{
+		return m_instanceDataArena->GetBuffer(m_instanceDataSlot);
+	}
+
+	UInt64 WorldInstance::GetInstanceBufferOffset() const
+	{
+		return m_instanceDataArena->GetOffset(m_instanceDataSlot);
+	}
+
 	void WorldInstance::UpdateBuffers(UploadPool& uploadPool, CommandBufferBuilder& builder)
+	{
+		UpdateInstanceData();
+		m_instanceDataArena->UpdateBuffers(uploadPool, builder);
+	}
+
+	/*!
+	* \brief Writes instance data to the shared instance data arena if it changed
+	*
+	* Contrary to UpdateBuffers, no transfer is recorded: this allows to update many instances before transferring all of them with InstanceDataArena::UpdateBuffers.
+	*/
+	void WorldInstance::UpdateInstanceData()
 	{
 		if (m_dataInvalided)
 		{
 			Nz::PredefinedInstanceData instanceUboOffsets = Nz::PredefinedInstanceData::GetOffsets();
 
-			auto& allocation = uploadPool.Allocate(m_instanceDataBuffer->GetSize());
-			Nz::AccessByOffset<Nz::Matrix4f&>(allocation.mappedPtr, instanceUboOffsets.worldMatrixOffset) = m_worldMatrix;
-			Nz::AccessByOffset<Nz::Matrix4f&>(allocation.mappedPtr, instanceUboOffsets.invWorldMatrixOffset) = m_invWorldMatrix;
-
-			builder.CopyBuffer(allocation, m_instanceDataBuffer.get());
+			void* instanceData = m_instanceDataArena->Update(m_instanceDataSlot);
+			Nz::AccessByOffset<Nz::Matrix4f&>(instanceData, instanceUboOffsets.worldMatrixOffset) = m_worldMatrix;
+			Nz::AccessByOffset<Nz::Matrix4f&>(instanceData, instanceUboOffsets.invWorldMatrixOffset) = m_invWorldMatrix;
 
 			m_dataInvalided = false;
 		}
 	}
+
+	WorldInstance& WorldInstance::operator=(WorldInstance&& instance) noexcept
+	{
+		if (this == &instance)
+			return *this;
+
+		if (m_instanceDataArena)
+			m_instanceDataArena->Free(m_instanceDataSlot);
+
+		m_instanceDataArena = std::move(instance.m_instanceDataArena);
+		m_instanceDataSlot = instance.m_instanceDataSlot;
+		m_invWorldMatrix = instance.m_invWorldMatrix;
+		m_worldMatrix = instance.m_worldMatrix;
+		m_shaderBinding = std::move(instance.m_shaderBinding);
+		m_dataInvalided = instance.m_dataInvalided;
+
+		return *this;
+	}
 }
@@ -918,11 +918,8 @@ namespace Nz
 			if (peer->m_sentReliableCommands.empty())
 				peer->m_nextTimeout = m_serviceTime + outgoingCommand->roundTripTimeout;
 
-			peer->m_sentReliableCommands.emplace_back(std::move(*outgoingCommand));
-
-			peer->m_outgoingReliableCommands.erase(outgoingCommand);
-			outgoingCommand = peer->m_sentReliableCommands.end();
-			--outgoingCommand;
+			// Relink the node instead of moving the command, iterators stay valid and no allocation happens
+			peer->m_sentReliableCommands.splice(peer->m_sentReliableCommands.end(), peer->m_outgoingReliableCommands, outgoingCommand);
 
 			outgoingCommand->sentTime = m_serviceTime;
 
@@ -1204,10 +1201,10 @@ namespace Nz
 				m_packetSize += packetBuffer.dataLength;
 
 				// In order to keep the packet buffer alive until we send it, place it into a temporary queue
-				peer->m_sentUnreliableCommands.emplace_back(std::move(*outgoingCommand));
+				peer->m_sentUnreliableCommands.splice(peer->m_sentUnreliableCommands.end(), peer->m_outgoingUnreliableCommands, outgoingCommand);
 			}
-
-			peer->m_outgoingUnreliableCommands.erase(outgoingCommand);
+			else
+				peer->m_outgoingUnreliableCommands.erase(outgoingCommand);
 
 			++m_bufferCount;
 			++m_commandCount;
@@ -20,6 +20,22 @@
 
 namespace Nz
 {
+	ENetPeer::ENetPeer(ENetHost* host, UInt16 peerId) :
+	m_host(host),
+	m_dispatchedCommands(&host->m_incomingCommandPool),
+	m_outgoingReliableCommands(&host->m_outgoingCommandPool),
+	m_outgoingUnreliableCommands(&host->m_outgoingCommandPool),
+	m_sentReliableCommands(&host->m_outgoingCommandPool),
+	m_sentUnreliableCommands(&host->m_outgoingCommandPool),
+	m_state(ENetPeerState::Disconnected),
+	m_incomingSessionID(0xFF),
+	m_outgoingSessionID(0xFF),
+	m_incomingPeerID(peerId),
+	m_isSimulationEnabled(false)
+	{
+		Reset();
+	}
+
 	void ENetPeer::Disconnect(UInt32 data)
 	{
 		if (m_state == ENetPeerState::Disconnecting ||
@@ -322,8 +338,8 @@ namespace Nz
 			command.roundTripTimeout = m_roundTripTime + 4 * m_roundTripTimeVariance;
 			command.roundTripTimeoutLimit = m_timeoutLimit * command.roundTripTimeout;
 
-			m_outgoingReliableCommands.insert(insertPosition, std::move(command));
-			it = m_sentReliableCommands.erase(it);
+			auto resentCommand = it++;
+			m_outgoingReliableCommands.splice(insertPosition, m_sentReliableCommands, resentCommand);
 
 			if (it == m_sentReliableCommands.begin() && !m_sentReliableCommands.empty())
 			{
@@ -373,9 +389,9 @@ namespace Nz
 
 	void ENetPeer::DispatchIncomingUnreliableCommands(Channel& channel)
 	{
-		std::list<IncomingCommmand>::iterator currentCommand;
-		std::list<IncomingCommmand>::iterator droppedCommand;
-		std::list<IncomingCommmand>::iterator startCommand;
+		ENetCommandList<IncomingCommmand>::iterator currentCommand;
+		ENetCommandList<IncomingCommmand>::iterator droppedCommand;
+		ENetCommandList<IncomingCommmand>::iterator startCommand;
 
 		for (droppedCommand = startCommand = currentCommand = channel.incomingUnreliableCommands.begin();
 		     currentCommand != channel.incomingUnreliableCommands.end();
@@ -879,7 +895,7 @@ namespace Nz
 		RemoveSentReliableCommand(1, 0xFF);
 
 		if (channelCount < m_channels.size())
-			m_channels.resize(channelCount);
+			m_channels.erase(m_channels.begin() + channelCount, m_channels.end());
 
 		m_outgoingPeerID = NetToHost(command->verifyConnect.outgoingPeerID);
 		m_incomingSessionID = command->verifyConnect.incomingSessionID;
@@ -898,9 +914,17 @@ namespace Nz
 		return true;
 	}
 
+	void ENetPeer::InitChannels(std::size_t channelCount)
+	{
+		m_channels.clear();
+		m_channels.reserve(channelCount);
+		for (std::size_t i = 0; i < channelCount; ++i)
+			m_channels.emplace_back(&m_host->m_incomingCommandPool);
+	}
+
 	void ENetPeer::InitIncoming(std::size_t channelCount, const IpAddress& address, ENetProtocolConnect& incomingCommand)
 	{
-		m_channels.resize(channelCount);
+		InitChannels(channelCount);
 		m_address = address;
 
 		m_connectID = incomingCommand.connectID;
@@ -941,7 +965,7 @@ namespace Nz
 
 	void ENetPeer::InitOutgoing(std::size_t channelCount, const IpAddress& address, UInt32 connectId, UInt32 windowSize)
 	{
-		m_channels.resize(channelCount);
+		InitChannels(channelCount);
 
 		m_address = address;
 		m_connectID = connectId;
@@ -973,7 +997,7 @@ namespace Nz
 
 	ENetProtocolCommand ENetPeer::RemoveSentReliableCommand(UInt16 reliableSequenceNumber, UInt8 channelId)
 	{
-		std::list<OutgoingCommand>* commandList = nullptr;
+		ENetCommandList<OutgoingCommand>* commandList = nullptr;
 
 		bool found = false;
 		auto currentCommand = m_sentReliableCommands.begin();
@@ -1130,8 +1154,8 @@ namespace Nz
 				return discardCommand();
 		}
 
-		std::list<IncomingCommmand>* commandList = nullptr;
-		std::list<IncomingCommmand>::reverse_iterator currentCommand;
+		ENetCommandList<IncomingCommmand>* commandList = nullptr;
+		ENetCommandList<IncomingCommmand>::reverse_iterator currentCommand;
 
 		switch (command.header.command & ENetProtocolCommand_Mask)
 		{
@@ -4,10 +4,299 @@
 
 #include <Nazara/Network/NetPacket.hpp>
 #include <Nazara/Core/MemoryView.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <vector>
 #include <Nazara/Network/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		/*
+		* Packet buffers are recycled through per-thread caches (no synchronization at all), one per size class.
+		* When a thread cache grows too large, buffers are moved by batches to a global lock-free stack,
+		* from which threads running out of buffers take a batch back.
+		*/
+
+		constexpr std::size_t MinSizeClassShift = 6; //< 64 bytes
+		constexpr std::size_t SizeClassCount = 11;   //< up to 64KiB, bigger buffers are not pooled
+		constexpr std::size_t BatchSize = 8;
+		constexpr UInt64 StatsFlushInterval = 64;
+
+		constexpr std::size_t GetSizeClassCapacity(std::size_t sizeClass)
+		{
+			return std::size_t(1) << (sizeClass + MinSizeClassShift);
+		}
+
+		// Smallest size class holding buffers of at least this capacity
+		std::size_t GetSizeClassFor(std::size_t capacity)
+		{
+			std::size_t sizeClass = 0;
+			while (sizeClass < SizeClassCount && GetSizeClassCapacity(sizeClass) < capacity)
+				sizeClass++;
+
+			return sizeClass;
+		}
+
+		// Biggest size class whose capacity is lower or equal to this capacity (SizeClassCount if none or if the buffer is too big)
+		std::size_t GetSizeClassOf(std::size_t capacity)
+		{
+			if (capacity < GetSizeClassCapacity(0) || capacity > GetSizeClassCapacity(SizeClassCount - 1))
+				return SizeClassCount;
+
+			std::size_t sizeClass = GetSizeClassFor(capacity);
+			if (sizeClass < SizeClassCount && GetSizeClassCapacity(sizeClass) == capacity)
+				return sizeClass;
+
+			return sizeClass - 1;
+		}
+
+		struct BufferBatch
+		{
+			std::array<std::unique_ptr<ByteArray>, BatchSize> buffers;
+			BufferBatch* next;
+		};
+
+		class GlobalBufferPool
+		{
+			public:
+				GlobalBufferPool() :
+				hitCount(0),
+				missCount(0),
+				retainedBufferCount(0),
+				retainedBytes(0),
+				maxRetainedBytes(64 * 1024 * 1024),
+				maxThreadCachedBuffers(32)
+				{
+					for (auto& head : m_heads)
+						head.store(nullptr, std::memory_order_relaxed);
+				}
+
+				~GlobalBufferPool()
+				{
+					Clear();
+				}
+
+				void Clear()
+				{
+					for (std::size_t sizeClass = 0; sizeClass < SizeClassCount; ++sizeClass)
+					{
+						BufferBatch* batch = m_heads[sizeClass].exchange(nullptr, std::memory_order_acquire);
+						while (batch)
+						{
+							BufferBatch* next = batch->next;
+
+							retainedBufferCount.fetch_sub(BatchSize, std::memory_order_relaxed);
+							retainedBytes.fetch_sub(BatchSize * GetSizeClassCapacity(sizeClass), std::memory_order_relaxed);
+							delete batch;
+
+							batch = next;
+						}
+					}
+				}
+
+				// Returns a batch or nullptr if this size class is empty
+				BufferBatch* Pop(std::size_t sizeClass)
+				{
+					// Taking the whole list at once doesn't suffer from the ABA problem a single pop would have
+					BufferBatch* batch = m_heads[sizeClass].exchange(nullptr, std::memory_order_acquire);
+					if (!batch)
+						return nullptr;
+
+					if (BufferBatch* remaining = batch->next)
+					{
+						BufferBatch* last = remaining;
+						while (last->next)
+							last = last->next;
+
+						PushChain(sizeClass, remaining, last);
+					}
+
+					batch->next = nullptr;
+					return batch;
+				}
+
+				void Push(std::size_t sizeClass, BufferBatch* batch)
+				{
+					PushChain(sizeClass, batch, batch);
+				}
+
+				std::atomic<UInt64> hitCount;
+				std::atomic<UInt64> missCount;
+				std::atomic<Int64> retainedBufferCount;
+				std::atomic<Int64> retainedBytes;
+				std::atomic<UInt64> maxRetainedBytes;
+				std::atomic<std::size_t> maxThreadCachedBuffers;
+
+			private:
+				void PushChain(std::size_t sizeClass, BufferBatch* first, BufferBatch* last)
+				{
+					BufferBatch* head = m_heads[sizeClass].load(std::memory_order_relaxed);
+					do
+					{
+						last->next = head;
+					}
+					while (!m_heads[sizeClass].compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+				}
+
+				std::array<std::atomic<BufferBatch*>, SizeClassCount> m_heads;
+		};
+
+		GlobalBufferPool s_globalPool;
+
+		class ThreadBufferCache
+		{
+			public:
+				ThreadBufferCache() = default;
+
+				~ThreadBufferCache()
+				{
+					// Give buffers back to other threads
+					for (std::size_t sizeClass = 0; sizeClass < SizeClassCount; ++sizeClass)
+					{
+						auto& buffers = m_buffers[sizeClass];
+						while (buffers.size() >= BatchSize)
+							PushBatch(sizeClass);
+
+						m_retainedBufferCount -= buffers.size();
+						m_retainedBytes -= buffers.size() * GetSizeClassCapacity(sizeClass);
+						buffers.clear();
+					}
+
+					FlushStats();
+				}
+
+				std::unique_ptr<ByteArray> Acquire(std::size_t minCapacity)
+				{
+					std::size_t sizeClass = GetSizeClassFor(minCapacity);
+					if (sizeClass >= SizeClassCount)
+					{
+						m_missCount++;
+						CountOperation();
+						return std::make_unique<ByteArray>();
+					}
+
+					auto& buffers = m_buffers[sizeClass];
+					if (buffers.empty())
+					{
+						if (BufferBatch* batch = s_globalPool.Pop(sizeClass))
+						{
+							for (auto& buffer : batch->buffers)
+								buffers.push_back(std::move(buffer));
+
+							delete batch;
+						}
+					}
+
+					if (buffers.empty())
+					{
+						m_missCount++;
+						CountOperation();
+
+						// Allocate the whole size class so that the buffer can be reused for any packet of this class
+						auto buffer = std::make_unique<ByteArray>();
+						buffer->Reserve(GetSizeClassCapacity(sizeClass));
+
+						return buffer;
+					}
+
+					std::unique_ptr<ByteArray> buffer = std::move(buffers.back());
+					buffers.pop_back();
+
+					m_hitCount++;
+					m_retainedBufferCount--;
+					m_retainedBytes -= GetSizeClassCapacity(sizeClass);
+					CountOperation();
+
+					return buffer;
+				}
+
+				void Release(std::unique_ptr<ByteArray> buffer)
+				{
+					std::size_t capacity = buffer->GetCapacity();
+					std::size_t sizeClass = GetSizeClassOf(capacity);
+					if (sizeClass >= SizeClassCount)
+						return; //< Too small or too big to be pooled
+
+					std::size_t classCapacity = GetSizeClassCapacity(sizeClass);
+					Int64 retainedBytes = s_globalPool.retainedBytes.load(std::memory_order_relaxed) + m_retainedBytes;
+					if (UInt64(std::max<Int64>(retainedBytes, 0)) + classCapacity > s_globalPool.maxRetainedBytes.load(std::memory_order_relaxed))
+						return;
+
+					auto& buffers = m_buffers[sizeClass];
+					buffers.push_back(std::move(buffer));
+
+					m_retainedBufferCount++;
+					m_retainedBytes += classCapacity;
+
+					if (buffers.size() > s_globalPool.maxThreadCachedBuffers.load(std::memory_order_relaxed) && buffers.size() >= BatchSize)
+						PushBatch(sizeClass);
+
+					CountOperation();
+				}
+
+				void Clear()
+				{
+					for (std::size_t sizeClass = 0; sizeClass < SizeClassCount; ++sizeClass)
+					{
+						auto& buffers = m_buffers[sizeClass];
+						m_retainedBufferCount -= buffers.size();
+						m_retainedBytes -= buffers.size() * GetSizeClassCapacity(sizeClass);
+						buffers.clear();
+					}
+
+					FlushStats();
+				}
+
+				void FlushStats()
+				{
+					s_globalPool.hitCount.fetch_add(m_hitCount, std::memory_order_relaxed);
+					s_globalPool.missCount.fetch_add(m_missCount, std::memory_order_relaxed);
+					s_globalPool.retainedBufferCount.fetch_add(m_retainedBufferCount, std::memory_order_relaxed);
+					s_globalPool.retainedBytes.fetch_add(m_retainedBytes, std::memory_order_relaxed);
+
+					m_hitCount = 0;
+					m_missCount = 0;
+					m_retainedBufferCount = 0;
+					m_retainedBytes = 0;
+					m_operationCount = 0;
+				}
+
+			private:
+				// Statistics are only published from time to time to avoid contention on global counters
+				void CountOperation()
+				{
+					if (++m_operationCount >= StatsFlushInterval)
+						FlushStats();
+				}
+
+				void PushBatch(std::size_t sizeClass)
+				{
+					auto& buffers = m_buffers[sizeClass];
+
+					BufferBatch* batch = new BufferBatch;
+					for (std::size_t i = 0; i < BatchSize; ++i)
+					{
+						batch->buffers[i] = std::move(buffers.back());
+						buffers.pop_back();
+					}
+
+					s_globalPool.Push(sizeClass, batch);
+				}
+
+				std::array<std::vector<std::unique_ptr<ByteArray>>, SizeClassCount> m_buffers;
+				Int64 m_retainedBufferCount = 0; //< Difference with the value published in the global pool
+				Int64 m_retainedBytes = 0;       //< Difference with the value published in the global pool
+				UInt64 m_hitCount = 0;
+				UInt64 m_missCount = 0;
+				UInt64 m_operationCount = 0;
+		};
+
+		thread_local ThreadBufferCache t_bufferCache;
+	}
+
 	/*!
 	* \ingroup network
 	* \class Nz::NetPacket
@@ -92,6 +381,39 @@ namespace Nz
 		return Serialize(context, packetSize) && Serialize(context, netCode);
 	}
 
+	/*!
+	* \brief Gets the statistics of the buffer pool shared by every packet
+	* \return Pool statistics
+	*
+	* \remark Threads publish their statistics from time to time, values may not include the last operations of other threads
+	*/
+
+	auto NetPacket::GetPoolStats() -> PoolStats
+	{
+		t_bufferCache.FlushStats();
+
+		PoolStats stats;
+		stats.hitCount = s_globalPool.hitCount.load(std::memory_order_relaxed);
+		stats.missCount = s_globalPool.missCount.load(std::memory_order_relaxed);
+		stats.retainedBufferCount = UInt64(std::max<Int64>(s_globalPool.retainedBufferCount.load(std::memory_order_relaxed), 0));
+		stats.retainedBytes = UInt64(std::max<Int64>(s_globalPool.retainedBytes.load(std::memory_order_relaxed), 0));
+
+		return stats;
+	}
+
+	/*!
+	* \brief Sets the limits of the buffer pool shared by every packet
+	*
+	* \param maxThreadCachedBuffers Number of buffers (per size class) a thread keeps for itself before sharing them with other threads
+	* \param maxRetainedBytes Capacity over which released buffers are freed instead of being pooled
+	*/
+
+	void NetPacket::SetPoolLimits(std::size_t maxThreadCachedBuffers, UInt64 maxRetainedBytes)
+	{
+		s_globalPool.maxThreadCachedBuffers.store(maxThreadCachedBuffers, std::memory_order_relaxed);
+		s_globalPool.maxRetainedBytes.store(maxRetainedBytes, std::memory_order_relaxed);
+	}
+
 	/*!
 	* \brief Operation to do when stream is empty
 	*/
@@ -110,10 +432,7 @@ namespace Nz
 		if (!m_buffer)
 			return;
 
-		std::size_t size = m_buffer->GetSize();
-
-		std::lock_guard<std::mutex> lock(s_availableBuffersMutex);
-		s_availableBuffers.emplace_back(std::make_pair(size, std::move(m_buffer)));
+		t_bufferCache.Release(std::move(m_buffer));
 	}
 
 	/*!
@@ -130,21 +449,9 @@ namespace Nz
 	{
 		NazaraAssert(minCapacity >= cursorPos, "Cannot init stream with a smaller capacity than wanted cursor pos");
 
-		{
-			std::lock_guard<std::mutex> lock(s_availableBuffersMutex);
-
-			FreeStream(); //< In case it wasn't released yet
-
-			if (!s_availableBuffers.empty())
-			{
-				m_buffer = std::move(s_availableBuffers.back().second);
-				s_availableBuffers.pop_back();
-			}
-		}
-
-		if (!m_buffer)
-			m_buffer = std::make_unique<ByteArray>();
+		FreeStream(); //< In case it wasn't released yet
 
+		m_buffer = t_bufferCache.Acquire(minCapacity);
 		m_buffer->Resize(minCapacity);
 
 		m_memoryStream.SetBuffer(m_buffer.get(), openMode);
@@ -168,9 +475,7 @@ namespace Nz
 
 	void NetPacket::Uninitialize()
 	{
-		s_availableBuffers.clear();
+		t_bufferCache.Clear();
+		s_globalPool.Clear();
 	}
-
-	std::mutex NetPacket::s_availableBuffersMutex;
-	std::vector<std::pair<std::size_t, std::unique_ptr<ByteArray>>> NetPacket::s_availableBuffers;
 }
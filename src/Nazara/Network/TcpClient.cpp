@@ -141,29 +141,6 @@ namespace Nz
 		}
 	}
 
-	/*!
-	* \brief Checks whether the stream reached the end of the stream
-	* \return true if there is no more available bytes
-	*/
-
-	bool TcpClient::EndOfStream() const
-	{
-		return QueryAvailableBytes() == 0;
-	}
-
-	/*!
-	* \brief Gets the position of the cursor
-	* \return 0
-	*
-	* \remark Produces a NazaraError because it is a special stream
-	*/
-
-	UInt64 TcpClient::GetCursorPos() const
-	{
-		NazaraError("GetCursorPos() cannot be used on sequential streams");
-		return 0;
-	}
-
 	/*!
 	* \brief Gets the size of the raw memory available
 	* \return Size of the memory available
@@ -461,21 +438,6 @@ namespace Nz
 		return Send(ptr, size, nullptr);
 	}
 
-	/*!
-	* \brief Sets the position of the cursor
-	* \return false
-	*
-	* \param offset Offset according to the beginning of the stream
-	*
-	* \remark Produces a NazaraError because it is a special stream
-	*/
-
-	bool TcpClient::SetCursorPos(UInt64 /*offset*/)
-	{
-		NazaraError("SetCursorPos() cannot be used on sequential streams");
-		return false;
-	}
-
 	/*!
 	* \brief Waits for being connected before time out
 	* \return The new socket state, either Connected if connection did succeed or NotConnected if an error occurred
@@ -614,6 +576,44 @@ namespace Nz
 		UpdateState(SocketState::Connected);
 	}
 
+	/*!
+	* \brief Sets the position of the cursor
+	* \return false
+	*
+	* \param offset Offset according to the beginning of the stream
+	*
+	* \remark Produces a NazaraError because it is a special stream
+	*/
+
+	bool TcpClient::SeekStreamCursor(UInt64 /*offset*/)
+	{
+		NazaraError("SetCursorPos() cannot be used on sequential streams");
+		return false;
+	}
+
+	/*!
+	* \brief Gets the position of the cursor
+	* \return 0
+	*
+	* \remark Produces a NazaraError because it is a special stream
+	*/
+
+	UInt64 TcpClient::TellStreamCursor() const
+	{
+		NazaraError("GetCursorPos() cannot be used on sequential streams");
+		return 0;
+	}
+
+	/*!
+	* \brief Checks whether the stream reached the end of the stream
+	* \return true if there is no more available bytes
+	*/
+
+	bool TcpClient::TestStreamEnd() const
+	{
+		return QueryAvailableBytes() == 0;
+	}
+
 	/*!
 	* \brief Writes blocks
 	* \return Number of blocks written
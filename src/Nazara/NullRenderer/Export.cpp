@@ -0,0 +1,15 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/NullRenderer/NullRenderer.hpp>
+
+extern "C"
+{
+	NAZARA_EXPORT Nz::RendererImpl* NazaraRenderer_Instantiate()
+	{
+		std::unique_ptr<Nz::NullRenderer> renderer = std::make_unique<Nz::NullRenderer>();
+		return renderer.release();
+	}
+}
@@ -0,0 +1,58 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullBuffer.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <cstring>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	NullBuffer::NullBuffer(BufferType type) :
+	m_type(type),
+	m_size(0)
+	{
+	}
+
+	bool NullBuffer::Fill(const void* data, UInt64 offset, UInt64 size)
+	{
+		NazaraAssert(offset + size <= m_size, "fill range exceeds buffer size");
+
+		std::memcpy(&m_data[offset], data, size);
+		return true;
+	}
+
+	bool NullBuffer::Initialize(UInt64 size, BufferUsageFlags usage)
+	{
+		// Buffers keep a CPU-side copy of their content so uploads cost what they would cost on a real device (minus the driver)
+		m_data = std::make_unique<UInt8[]>(size);
+		m_size = size;
+		m_usage = usage;
+
+		return true;
+	}
+
+	UInt64 NullBuffer::GetSize() const
+	{
+		return m_size;
+	}
+
+	DataStorage NullBuffer::GetStorage() const
+	{
+		return DataStorage::Hardware;
+	}
+
+	void* NullBuffer::Map(BufferAccess /*access*/, UInt64 offset, UInt64 size)
+	{
+		NazaraAssert(offset + size <= m_size, "map range exceeds buffer size");
+		NazaraUnused(size);
+
+		return &m_data[offset];
+	}
+
+	bool NullBuffer::Unmap()
+	{
+		return true;
+	}
+}
@@ -0,0 +1,122 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullCommandBufferBuilder.hpp>
+#include <Nazara/NullRenderer/NullBuffer.hpp>
+#include <Nazara/NullRenderer/NullCommandBuffer.hpp>
+#include <Nazara/NullRenderer/NullFramebuffer.hpp>
+#include <Nazara/NullRenderer/NullRenderPass.hpp>
+#include <Nazara/NullRenderer/NullRenderPipeline.hpp>
+#include <Nazara/NullRenderer/NullRenderPipelineLayout.hpp>
+#include <Nazara/NullRenderer/NullShaderBinding.hpp>
+#include <Nazara/NullRenderer/NullTexture.hpp>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	void NullCommandBufferBuilder::BeginDebugRegion(const std::string_view& regionName, const Color& color)
+	{
+		m_commandBuffer.BeginDebugRegion(regionName, color);
+	}
+
+	void NullCommandBufferBuilder::BeginRenderPass(const Framebuffer& framebuffer, const RenderPass& renderPass, const Recti& renderRect, const ClearValues* clearValues, std::size_t clearValueCount)
+	{
+		m_commandBuffer.BeginRenderPass(static_cast<const NullFramebuffer&>(framebuffer), static_cast<const NullRenderPass&>(renderPass), renderRect, clearValues, clearValueCount);
+	}
+
+	void NullCommandBufferBuilder::BindIndexBuffer(AbstractBuffer* indexBuffer, UInt64 offset)
+	{
+		m_commandBuffer.BindIndexBuffer(static_cast<const NullBuffer*>(indexBuffer), offset);
+	}
+
+	void NullCommandBufferBuilder::BindPipeline(const RenderPipeline& pipeline)
+	{
+		m_commandBuffer.BindPipeline(&static_cast<const NullRenderPipeline&>(pipeline));
+	}
+
+	void NullCommandBufferBuilder::BindShaderBinding(UInt32 set, const ShaderBinding& binding)
+	{
+		const NullShaderBinding& nullBinding = static_cast<const NullShaderBinding&>(binding);
+
+		m_commandBuffer.BindShaderBinding(nullBinding.GetOwner(), set, &nullBinding);
+	}
+
+	void NullCommandBufferBuilder::BindShaderBinding(const RenderPipelineLayout& pipelineLayout, UInt32 set, const ShaderBinding& binding)
+	{
+		const NullRenderPipelineLayout& nullPipelineLayout = static_cast<const NullRenderPipelineLayout&>(pipelineLayout);
+		const NullShaderBinding& nullBinding = static_cast<const NullShaderBinding&>(binding);
+
+		m_commandBuffer.BindShaderBinding(nullPipelineLayout, set, &nullBinding);
+	}
+
+	void NullCommandBufferBuilder::BindVertexBuffer(UInt32 binding, AbstractBuffer* vertexBuffer, UInt64 offset)
+	{
+		m_commandBuffer.BindVertexBuffer(binding, static_cast<const NullBuffer*>(vertexBuffer), offset);
+	}
+
+	void NullCommandBufferBuilder::CopyBuffer(const RenderBufferView& source, const RenderBufferView& target, UInt64 size, UInt64 sourceOffset, UInt64 targetOffset)
+	{
+		const NullBuffer* sourceBuffer = static_cast<const NullBuffer*>(source.GetBuffer());
+		const NullBuffer* targetBuffer = static_cast<const NullBuffer*>(target.GetBuffer());
+
+		m_commandBuffer.CopyBuffer(sourceBuffer, targetBuffer, size, sourceOffset + source.GetOffset(), targetOffset + target.GetOffset());
+	}
+
+	void NullCommandBufferBuilder::CopyBuffer(const UploadPool::Allocation& allocation, const RenderBufferView& target, UInt64 size, UInt64 sourceOffset, UInt64 targetOffset)
+	{
+		const NullBuffer* targetBuffer = static_cast<const NullBuffer*>(target.GetBuffer());
+
+		m_commandBuffer.CopyBuffer(allocation, targetBuffer, size, sourceOffset, target.GetOffset() + targetOffset);
+	}
+
+	void NullCommandBufferBuilder::Draw(UInt32 vertexCount, UInt32 instanceCount, UInt32 firstVertex, UInt32 firstInstance)
+	{
+		m_commandBuffer.Draw(vertexCount, instanceCount, firstVertex, firstInstance);
+	}
+
+	void NullCommandBufferBuilder::DrawIndexed(UInt32 indexCount, UInt32 instanceCount, UInt32 firstVertex, UInt32 firstInstance)
+	{
+		m_commandBuffer.DrawIndexed(indexCount, instanceCount, firstVertex, firstInstance);
+	}
+
+	void NullCommandBufferBuilder::EndDebugRegion()
+	{
+		m_commandBuffer.EndDebugRegion();
+	}
+
+	void NullCommandBufferBuilder::EndRenderPass()
+	{
+		m_commandBuffer.EndRenderPass();
+	}
+
+	void NullCommandBufferBuilder::NextSubpass()
+	{
+		m_commandBuffer.NextSubpass();
+	}
+
+	void NullCommandBufferBuilder::PreTransferBarrier()
+	{
+		m_commandBuffer.PreTransferBarrier();
+	}
+
+	void NullCommandBufferBuilder::PostTransferBarrier()
+	{
+		m_commandBuffer.PostTransferBarrier();
+	}
+
+	void NullCommandBufferBuilder::SetScissor(const Recti& scissorRegion)
+	{
+		m_commandBuffer.SetScissor(scissorRegion);
+	}
+
+	void NullCommandBufferBuilder::SetViewport(const Recti& viewportRegion)
+	{
+		m_commandBuffer.SetViewport(viewportRegion);
+	}
+
+	void NullCommandBufferBuilder::TextureBarrier(PipelineStageFlags /*srcStageMask*/, PipelineStageFlags /*dstStageMask*/, MemoryAccessFlags /*srcAccessMask*/, MemoryAccessFlags /*dstAccessMask*/, TextureLayout oldLayout, TextureLayout newLayout, const Texture& texture)
+	{
+		m_commandBuffer.TextureBarrier(oldLayout, newLayout, static_cast<const NullTexture&>(texture));
+	}
+}
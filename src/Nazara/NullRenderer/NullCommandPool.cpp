@@ -0,0 +1,38 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullCommandPool.hpp>
+#include <Nazara/NullRenderer/NullCommandBuffer.hpp>
+#include <Nazara/NullRenderer/NullCommandBufferBuilder.hpp>
+#include <cassert>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	CommandBufferPtr NullCommandPool::BuildCommandBuffer(const std::function<void(CommandBufferBuilder& builder)>& callback)
+	{
+		std::unique_ptr<NullCommandBuffer> commandBuffer;
+		if (!m_freeCommandBuffers.empty())
+		{
+			commandBuffer = std::move(m_freeCommandBuffers.back());
+			m_freeCommandBuffers.pop_back();
+		}
+		else
+			commandBuffer = std::make_unique<NullCommandBuffer>(this);
+
+		NullCommandBufferBuilder builder(*commandBuffer);
+		callback(builder);
+
+		return CommandBufferPtr(commandBuffer.release());
+	}
+
+	void NullCommandPool::Release(NullCommandBuffer& commandBuffer)
+	{
+		assert(commandBuffer.GetOwner() == this);
+
+		// Recycle the command buffer, its command list keeps its capacity across frames
+		commandBuffer.Reset();
+		m_freeCommandBuffers.emplace_back(&commandBuffer);
+	}
+}
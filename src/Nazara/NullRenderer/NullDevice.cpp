@@ -0,0 +1,139 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullDevice.hpp>
+#include <Nazara/Renderer/CommandPool.hpp>
+#include <Nazara/Shader/Ast/SanitizeVisitor.hpp>
+#include <Nazara/NullRenderer/NullBuffer.hpp>
+#include <Nazara/NullRenderer/NullCommandPool.hpp>
+#include <Nazara/NullRenderer/NullFramebuffer.hpp>
+#include <Nazara/NullRenderer/NullRenderPass.hpp>
+#include <Nazara/NullRenderer/NullRenderPipeline.hpp>
+#include <Nazara/NullRenderer/NullRenderPipelineLayout.hpp>
+#include <Nazara/NullRenderer/NullShaderModule.hpp>
+#include <Nazara/NullRenderer/NullTexture.hpp>
+#include <Nazara/NullRenderer/NullTextureSampler.hpp>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup nullrenderer
+	* \class Nz::NullDevice
+	* \brief Render device performing no GPU work at all
+	*
+	* Every resource is backed by plain CPU memory and command buffers are recorded into inspectable command lists, submitting them only accumulates statistics.
+	* This allows to run and measure the CPU side of rendering (frame graph baking, pipeline and shader binding management, command recording) without a GPU.
+	*/
+	NullDevice::NullDevice(const RenderDeviceFeatures& enabledFeatures) :
+	m_submittedCommandBufferCount(0),
+	m_enabledFeatures(enabledFeatures),
+	m_deviceInfo(BuildDeviceInfo())
+	{
+		ValidateFeatures(m_deviceInfo.features, m_enabledFeatures);
+	}
+
+	const RenderDeviceInfo& NullDevice::GetDeviceInfo() const
+	{
+		return m_deviceInfo;
+	}
+
+	const RenderDeviceFeatures& NullDevice::GetEnabledFeatures() const
+	{
+		return m_enabledFeatures;
+	}
+
+	std::shared_ptr<AbstractBuffer> NullDevice::InstantiateBuffer(BufferType type)
+	{
+		return std::make_shared<NullBuffer>(type);
+	}
+
+	std::shared_ptr<CommandPool> NullDevice::InstantiateCommandPool(QueueType /*queueType*/)
+	{
+		return std::make_shared<NullCommandPool>();
+	}
+
+	std::shared_ptr<Framebuffer> NullDevice::InstantiateFramebuffer(unsigned int /*width*/, unsigned int /*height*/, const std::shared_ptr<RenderPass>& /*renderPass*/, const std::vector<std::shared_ptr<Texture>>& attachments)
+	{
+		return std::make_shared<NullFramebuffer>(FramebufferType::Texture, attachments);
+	}
+
+	std::shared_ptr<RenderPass> NullDevice::InstantiateRenderPass(std::vector<RenderPass::Attachment> attachments, std::vector<RenderPass::SubpassDescription> subpassDescriptions, std::vector<RenderPass::SubpassDependency> subpassDependencies)
+	{
+		return std::make_shared<NullRenderPass>(std::move(attachments), std::move(subpassDescriptions), std::move(subpassDependencies));
+	}
+
+	std::shared_ptr<RenderPipeline> NullDevice::InstantiateRenderPipeline(RenderPipelineInfo pipelineInfo)
+	{
+		return std::make_shared<NullRenderPipeline>(*this, std::move(pipelineInfo));
+	}
+
+	std::shared_ptr<RenderPipelineLayout> NullDevice::InstantiateRenderPipelineLayout(RenderPipelineLayoutInfo pipelineLayoutInfo)
+	{
+		return std::make_shared<NullRenderPipelineLayout>(std::move(pipelineLayoutInfo));
+	}
+
+	std::shared_ptr<ShaderModule> NullDevice::InstantiateShaderModule(ShaderStageTypeFlags shaderStages, ShaderAst::Statement& shaderAst, const ShaderWriter::States& states)
+	{
+		// No code is generated, but the shader is still validated as other backends would (throwing on errors)
+		if (!states.sanitized)
+		{
+			ShaderAst::SanitizeVisitor::Options options;
+			options.enabledOptions = states.enabledOptions;
+
+			ShaderAst::Sanitize(shaderAst, options);
+		}
+
+		return std::make_shared<NullShaderModule>(shaderStages);
+	}
+
+	std::shared_ptr<ShaderModule> NullDevice::InstantiateShaderModule(ShaderStageTypeFlags shaderStages, ShaderLanguage /*lang*/, const void* /*source*/, std::size_t /*sourceSize*/, const ShaderWriter::States& /*states*/)
+	{
+		return std::make_shared<NullShaderModule>(shaderStages);
+	}
+
+	std::shared_ptr<Texture> NullDevice::InstantiateTexture(const TextureInfo& params)
+	{
+		return std::make_shared<NullTexture>(params);
+	}
+
+	std::shared_ptr<TextureSampler> NullDevice::InstantiateTextureSampler(const TextureSamplerInfo& params)
+	{
+		return std::make_shared<NullTextureSampler>(*this, params);
+	}
+
+	bool NullDevice::IsTextureFormatSupported(PixelFormat format, TextureUsage /*usage*/) const
+	{
+		return format != PixelFormat::Undefined;
+	}
+
+	/*!
+	* \brief Submits a command buffer, which accumulates its statistics and triggers OnCommandBufferSubmit
+	*
+	* \param commandBuffer Recorded command buffer
+	*/
+	void NullDevice::Submit(const NullCommandBuffer& commandBuffer)
+	{
+		m_submittedCommandBufferCount++;
+		m_submittedStats += commandBuffer.GetStats();
+
+		OnCommandBufferSubmit(this, commandBuffer);
+	}
+
+	RenderDeviceInfo NullDevice::BuildDeviceInfo()
+	{
+		RenderDeviceInfo deviceInfo;
+		deviceInfo.name = "Null Device";
+		deviceInfo.type = RenderDeviceType::Software;
+
+		deviceInfo.features.anisotropicFiltering = true;
+		deviceInfo.features.depthClamping = true;
+		deviceInfo.features.nonSolidFaceFilling = true;
+
+		// Use the most common alignment of real devices so uniform buffer layouts match what would be used on a GPU
+		deviceInfo.limits.minUniformBufferOffsetAlignment = 256;
+
+		return deviceInfo;
+	}
+}
@@ -0,0 +1,45 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullRenderImage.hpp>
+#include <Nazara/NullRenderer/NullCommandBuffer.hpp>
+#include <Nazara/NullRenderer/NullCommandBufferBuilder.hpp>
+#include <Nazara/NullRenderer/NullDevice.hpp>
+#include <Nazara/NullRenderer/NullRenderWindow.hpp>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	NullRenderImage::NullRenderImage(NullRenderWindow& owner) :
+	m_owner(owner),
+	m_uploadPool(2 * 1024 * 1024)
+	{
+	}
+
+	void NullRenderImage::Execute(const std::function<void(CommandBufferBuilder& builder)>& callback, QueueTypeFlags /*queueTypeFlags*/)
+	{
+		NullCommandBuffer commandBuffer;
+		NullCommandBufferBuilder builder(commandBuffer);
+		callback(builder);
+
+		m_owner.GetDevice().Submit(commandBuffer);
+	}
+
+	NullUploadPool& NullRenderImage::GetUploadPool()
+	{
+		return m_uploadPool;
+	}
+
+	void NullRenderImage::Present()
+	{
+		m_owner.Present();
+		m_uploadPool.Reset();
+		FlushReleaseQueue();
+	}
+
+	void NullRenderImage::SubmitCommandBuffer(CommandBuffer* commandBuffer, QueueTypeFlags /*queueTypeFlags*/)
+	{
+		m_owner.GetDevice().Submit(*static_cast<NullCommandBuffer*>(commandBuffer));
+	}
+}
@@ -0,0 +1,21 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullRenderPipeline.hpp>
+#include <Nazara/NullRenderer/NullDevice.hpp>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	NullRenderPipeline::NullRenderPipeline(NullDevice& device, RenderPipelineInfo pipelineInfo) :
+	m_pipelineInfo(std::move(pipelineInfo))
+	{
+		ValidatePipelineInfo(device, m_pipelineInfo);
+	}
+
+	const RenderPipelineInfo& NullRenderPipeline::GetPipelineInfo() const
+	{
+		return m_pipelineInfo;
+	}
+}
@@ -0,0 +1,26 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullRenderPipelineLayout.hpp>
+#include <cassert>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	NullRenderPipelineLayout::NullRenderPipelineLayout(RenderPipelineLayoutInfo layoutInfo) :
+	m_layoutInfo(std::move(layoutInfo))
+	{
+	}
+
+	ShaderBindingPtr NullRenderPipelineLayout::AllocateShaderBinding(UInt32 setIndex)
+	{
+		return ShaderBindingPtr(new NullShaderBinding(*this, setIndex));
+	}
+
+	void NullRenderPipelineLayout::Release(NullShaderBinding& binding)
+	{
+		assert(&binding.GetOwner() == this);
+		delete &binding;
+	}
+}
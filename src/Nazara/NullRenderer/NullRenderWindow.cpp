@@ -0,0 +1,144 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullRenderWindow.hpp>
+#include <Nazara/Renderer/RenderWindow.hpp>
+#include <Nazara/NullRenderer/NullCommandPool.hpp>
+#include <Nazara/NullRenderer/NullDevice.hpp>
+#include <cassert>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	/*!
+	* \ingroup nullrenderer
+	* \class Nz::NullRenderWindow
+	* \brief Render window presenting nothing, either bound to a RenderWindow or headless (no window at all)
+	*/
+	NullRenderWindow::NullRenderWindow(RenderWindow& owner) :
+	m_currentFrame(0),
+	m_framebuffer(FramebufferType::Window),
+	m_owner(&owner),
+	m_sizeChanged(false)
+	{
+	}
+
+	/*!
+	* \brief Constructs a headless render window, which can be used as a render target without any windowing system
+	*
+	* \param device Device command buffers are submitted to
+	* \param size Size of the render target
+	*/
+	NullRenderWindow::NullRenderWindow(std::shared_ptr<NullDevice> device, const Vector2ui& size) :
+	m_device(std::move(device)),
+	m_currentFrame(0),
+	m_framebuffer(FramebufferType::Window),
+	m_owner(nullptr),
+	m_size(size),
+	m_sizeChanged(false)
+	{
+		CreateRenderImages();
+	}
+
+	RenderFrame NullRenderWindow::Acquire()
+	{
+		if (m_owner)
+		{
+			if (m_owner->IsMinimized())
+				return RenderFrame();
+
+			Vector2ui size = m_owner->GetSize();
+			if (m_size != size)
+			{
+				OnRenderTargetSizeChange(this, size);
+				m_size = size;
+				m_sizeChanged = true;
+			}
+		}
+
+		bool invalidateFramebuffer = m_sizeChanged;
+		m_sizeChanged = false;
+
+		return RenderFrame(m_renderImages[m_currentFrame].get(), invalidateFramebuffer, m_size, 0);
+	}
+
+	bool NullRenderWindow::Create(RendererImpl* /*renderer*/, RenderSurface* /*surface*/, const RenderWindowParameters& /*parameters*/)
+	{
+		assert(m_owner);
+
+		m_device = std::static_pointer_cast<NullDevice>(m_owner->GetRenderDevice());
+		m_size = m_owner->GetSize();
+
+		CreateRenderImages();
+
+		return true;
+	}
+
+	std::shared_ptr<CommandPool> NullRenderWindow::CreateCommandPool(QueueType /*queueType*/)
+	{
+		return std::make_shared<NullCommandPool>();
+	}
+
+	const NullFramebuffer& NullRenderWindow::GetFramebuffer(std::size_t i) const
+	{
+		assert(i == 0);
+		NazaraUnused(i);
+		return m_framebuffer;
+	}
+
+	std::size_t NullRenderWindow::GetFramebufferCount() const
+	{
+		return 1;
+	}
+
+	const NullRenderPass& NullRenderWindow::GetRenderPass() const
+	{
+		return *m_renderPass;
+	}
+
+	const Vector2ui& NullRenderWindow::GetSize() const
+	{
+		return m_size;
+	}
+
+	void NullRenderWindow::Present()
+	{
+		m_currentFrame = (m_currentFrame + 1) % m_renderImages.size();
+	}
+
+	/*!
+	* \brief Changes the size of a headless render window, the next acquired frame will invalidate its framebuffer
+	*
+	* \param size New size of the render target
+	*
+	* \remark Windows bound to a RenderWindow follow its size instead
+	*/
+	void NullRenderWindow::Resize(const Vector2ui& size)
+	{
+		NazaraAssert(!m_owner, "only headless render windows can be resized");
+
+		if (m_size != size)
+		{
+			OnRenderTargetSizeChange(this, size);
+			m_size = size;
+			m_sizeChanged = true;
+		}
+	}
+
+	void NullRenderWindow::CreateRenderImages()
+	{
+		std::vector<RenderPass::Attachment> attachments;
+		std::vector<RenderPass::SubpassDescription> subpassDescriptions;
+		std::vector<RenderPass::SubpassDependency> subpassDependencies;
+
+		BuildRenderPass(PixelFormat::RGBA8, PixelFormat::Depth24Stencil8, attachments, subpassDescriptions, subpassDependencies);
+		m_renderPass.emplace(std::move(attachments), std::move(subpassDescriptions), std::move(subpassDependencies));
+
+		constexpr std::size_t RenderImageCount = 2;
+
+		m_renderImages.reserve(RenderImageCount);
+		for (std::size_t i = 0; i < RenderImageCount; ++i)
+			m_renderImages.emplace_back(std::make_unique<NullRenderImage>(*this));
+	}
+}
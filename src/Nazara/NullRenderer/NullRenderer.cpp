@@ -0,0 +1,60 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullRenderer.hpp>
+#include <Nazara/Renderer/RenderDevice.hpp>
+#include <Nazara/Renderer/RenderSurface.hpp>
+#include <Nazara/Renderer/RenderWindowImpl.hpp>
+#include <Nazara/NullRenderer/NullRenderWindow.hpp>
+#include <Nazara/NullRenderer/NullSurface.hpp>
+#include <cassert>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	std::unique_ptr<RenderSurface> NullRenderer::CreateRenderSurfaceImpl()
+	{
+		return std::make_unique<NullSurface>();
+	}
+
+	std::unique_ptr<RenderWindowImpl> NullRenderer::CreateRenderWindowImpl(RenderWindow& owner)
+	{
+		return std::make_unique<NullRenderWindow>(owner);
+	}
+
+	std::shared_ptr<RenderDevice> NullRenderer::InstanciateRenderDevice(std::size_t deviceIndex, const RenderDeviceFeatures& enabledFeatures)
+	{
+		assert(deviceIndex == 0);
+		NazaraUnused(deviceIndex);
+
+		return std::make_shared<NullDevice>(enabledFeatures);
+	}
+
+	bool NullRenderer::Prepare(const ParameterList& /*parameters*/)
+	{
+		m_deviceInfos.emplace_back(NullDevice::BuildDeviceInfo());
+
+		return true;
+	}
+
+	RenderAPI NullRenderer::QueryAPI() const
+	{
+		return RenderAPI::Null;
+	}
+
+	std::string NullRenderer::QueryAPIString() const
+	{
+		return "Null renderer";
+	}
+
+	UInt32 NullRenderer::QueryAPIVersion() const
+	{
+		return 100;
+	}
+
+	const std::vector<RenderDeviceInfo>& NullRenderer::QueryRenderDevices() const
+	{
+		return m_deviceInfos;
+	}
+}
@@ -0,0 +1,30 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullShaderBinding.hpp>
+#include <Nazara/NullRenderer/NullRenderPipelineLayout.hpp>
+#include <algorithm>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	void NullShaderBinding::Update(const Binding* bindings, std::size_t bindingCount)
+	{
+		for (std::size_t i = 0; i < bindingCount; ++i)
+		{
+			const Binding& binding = bindings[i];
+
+			auto it = std::lower_bound(m_bindings.begin(), m_bindings.end(), binding.bindingIndex, [](const Binding& lhs, std::size_t bindingIndex) { return lhs.bindingIndex < bindingIndex; });
+			if (it != m_bindings.end() && it->bindingIndex == binding.bindingIndex)
+				*it = binding;
+			else
+				m_bindings.insert(it, binding);
+		}
+	}
+
+	void NullShaderBinding::Release()
+	{
+		m_owner.Release(*this);
+	}
+}
@@ -0,0 +1,19 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullSurface.hpp>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	bool NullSurface::Create(WindowHandle /*handle*/)
+	{
+		return true;
+	}
+
+	void NullSurface::Destroy()
+	{
+		/* nothing to do */
+	}
+}
@@ -0,0 +1,34 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullTexture.hpp>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	PixelFormat NullTexture::GetFormat() const
+	{
+		return m_params.pixelFormat;
+	}
+
+	UInt8 NullTexture::GetLevelCount() const
+	{
+		return m_params.mipmapLevel;
+	}
+
+	Vector3ui NullTexture::GetSize(UInt8 level) const
+	{
+		return Vector3ui(GetLevelSize(m_params.width, level), GetLevelSize(m_params.height, level), GetLevelSize(m_params.depth, level));
+	}
+
+	ImageType NullTexture::GetType() const
+	{
+		return m_params.type;
+	}
+
+	bool NullTexture::Update(const void* /*ptr*/)
+	{
+		return true;
+	}
+}
@@ -0,0 +1,16 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullTextureSampler.hpp>
+#include <Nazara/NullRenderer/NullDevice.hpp>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	NullTextureSampler::NullTextureSampler(NullDevice& device, TextureSamplerInfo samplerInfo) :
+	m_samplerInfo(samplerInfo)
+	{
+		ValidateSamplerInfo(device, m_samplerInfo);
+	}
+}
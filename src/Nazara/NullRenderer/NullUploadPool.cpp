@@ -0,0 +1,75 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Null Renderer"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/NullRenderer/NullUploadPool.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <algorithm>
+#include <cassert>
+#include <Nazara/NullRenderer/Debug.hpp>
+
+namespace Nz
+{
+	auto NullUploadPool::Allocate(UInt64 size) -> Allocation&
+	{
+		return Allocate(size, 1);
+	}
+
+	auto NullUploadPool::Allocate(UInt64 size, UInt64 alignment) -> Allocation&
+	{
+		// Find the first block with enough space
+		Block* bestBlock = nullptr;
+		UInt64 bestOffset = 0;
+		for (Block& block : m_blocks)
+		{
+			UInt64 alignedOffset = Align(block.freeOffset, alignment);
+			if (alignedOffset + size > block.size)
+				continue; //< Not enough space
+
+			bestBlock = &block;
+			bestOffset = alignedOffset;
+			break;
+		}
+
+		// No block found, allocate a new one
+		if (!bestBlock)
+		{
+			// Big allocations get their own block
+			UInt64 blockSize = std::max(m_blockSize, size);
+
+			Block newBlock;
+			newBlock.memory = std::make_unique<UInt8[]>(blockSize);
+			newBlock.size = blockSize;
+
+			bestBlock = &m_blocks.emplace_back(std::move(newBlock));
+			bestOffset = 0;
+		}
+
+		// Now find the proper allocation buffer
+		std::size_t allocationBlockIndex = m_nextAllocationIndex / AllocationPerBlock;
+		std::size_t allocationIndex = m_nextAllocationIndex % AllocationPerBlock;
+
+		if (allocationBlockIndex >= m_allocationBlocks.size())
+		{
+			assert(allocationBlockIndex == m_allocationBlocks.size());
+			m_allocationBlocks.emplace_back(std::make_unique<AllocationBlock>());
+		}
+
+		Allocation& allocationData = (*m_allocationBlocks[allocationBlockIndex])[allocationIndex];
+		allocationData.mappedPtr = bestBlock->memory.get() + bestOffset;
+		allocationData.size = size;
+
+		bestBlock->freeOffset = bestOffset + size;
+		m_nextAllocationIndex++;
+
+		return allocationData;
+	}
+
+	void NullUploadPool::Reset()
+	{
+		for (Block& block : m_blocks)
+			block.freeOffset = 0;
+
+		m_nextAllocationIndex = 0;
+	}
+}
@@ -309,6 +309,7 @@ namespace Nz
 			const auto& vertexBufferInfo = states.vertexBuffers[bufferData.binding];
 
 			GLsizei stride = GLsizei(bufferData.declaration->GetStride());
+			GLuint divisor = (bufferData.declaration->GetInputRate() == VertexInputRate::Instance) ? 1 : 0;
 
 			for (const auto& componentInfo : bufferData.declaration->GetComponents())
 			{
@@ -317,6 +318,7 @@ namespace Nz
 
 				bufferAttribute.pointer = originPtr + vertexBufferInfo.offset + componentInfo.offset;
 				bufferAttribute.stride = stride;
+				bufferAttribute.divisor = divisor;
 				bufferAttribute.vertexBuffer = vertexBufferInfo.vertexBuffer;
 			}
 		}
@@ -208,6 +208,15 @@ namespace Nz
 			case PixelFormat::RGBA32UI:
 				return usage == TextureUsage::ColorAttachment || usage == TextureUsage::InputAttachment || usage == TextureUsage::ShaderSampling || usage == TextureUsage::TransferDestination || usage == TextureUsage::TransferSource;
 
+			case PixelFormat::BC4:
+			case PixelFormat::BC5:
+			{
+				if (!m_referenceContext->IsExtensionSupported(GL::Extension::TextureCompressionRgtc))
+					return false;
+
+				return usage == TextureUsage::InputAttachment || usage == TextureUsage::ShaderSampling || usage == TextureUsage::TransferDestination || usage == TextureUsage::TransferSource;
+			}
+
 			case PixelFormat::DXT1:
 			case PixelFormat::DXT3:
 			case PixelFormat::DXT5:
@@ -42,6 +42,9 @@ namespace Nz::GL
 
 						m_context.glEnableVertexAttribArray(bindingIndex);
 						m_context.glVertexAttribPointer(bindingIndex, attrib.size, attrib.type, attrib.normalized, attrib.stride, attrib.pointer);
+
+						if (attrib.divisor != 0)
+							m_context.glVertexAttribDivisor(bindingIndex, attrib.divisor);
 					}
 
 					bindingIndex++;
@@ -297,6 +297,14 @@ namespace Nz::GL
 		else if (m_supportedExtensions.count("GL_ARB_gl_spirv"))
 			m_extensionStatus[UnderlyingCast(Extension::SpirV)] = ExtensionStatus::ARB;
 
+		// Texture compression (RGTC)
+		if (m_params.type == ContextType::OpenGL && m_params.glMajorVersion >= 3)
+			m_extensionStatus[UnderlyingCast(Extension::TextureCompressionRgtc)] = ExtensionStatus::Core;
+		else if (m_supportedExtensions.count("GL_ARB_texture_compression_rgtc"))
+			m_extensionStatus[UnderlyingCast(Extension::TextureCompressionRgtc)] = ExtensionStatus::ARB;
+		else if (m_supportedExtensions.count("GL_EXT_texture_compression_rgtc"))
+			m_extensionStatus[UnderlyingCast(Extension::TextureCompressionRgtc)] = ExtensionStatus::EXT;
+
 		// Texture compression (S3tc)
 		if (m_supportedExtensions.count("GL_EXT_texture_compression_s3tc"))
 			m_extensionStatus[UnderlyingCast(Extension::TextureCompressionS3tc)] = ExtensionStatus::EXT;
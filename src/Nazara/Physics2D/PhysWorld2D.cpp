@@ -4,8 +4,14 @@
 
 #include <Nazara/Physics2D/PhysWorld2D.hpp>
 #include <Nazara/Physics2D/Arbiter2D.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
 #include <Nazara/Core/StackArray.hpp>
 #include <chipmunk/chipmunk.h>
+#include <chipmunk/chipmunk_private.h>
+#include <chipmunk/cpHastySpace.h>
+#include <algorithm>
+#include <atomic>
 #include <Nazara/Physics2D/Debug.hpp>
 
 namespace Nz
@@ -78,10 +84,82 @@ namespace Nz
 			else
 				return cpSpaceDebugColor{255.f, 0.f, 0.f, 255.f};
 		}
+
+		struct RaycastQueryContext
+		{
+			cpVect start;
+			cpVect end;
+			cpFloat radius;
+			cpShapeFilter filter;
+			PhysWorld2D::RaycastHit* hits;
+			std::size_t hitCount;
+			std::size_t maxHitCount;
+		};
+
+		struct RegionQueryContext
+		{
+			cpBB boundingBox;
+			cpShapeFilter filter;
+			RigidBody2D** bodies;
+			std::size_t bodyCount;
+			std::size_t maxBodyCount;
+		};
+
+		void FillRaycastHit(PhysWorld2D::RaycastHit& hitInfo, const cpSegmentQueryInfo& queryInfo)
+		{
+			hitInfo.fraction = float(queryInfo.alpha);
+			hitInfo.hitNormal.Set(Nz::Vector2<cpFloat>(queryInfo.normal.x, queryInfo.normal.y));
+			hitInfo.hitPos.Set(Nz::Vector2<cpFloat>(queryInfo.point.x, queryInfo.point.y));
+			hitInfo.nearestBody = static_cast<Nz::RigidBody2D*>(cpShapeGetUserData(queryInfo.shape));
+		}
+
+		// Same as cpSpaceSegmentQuery and cpSpaceBBQuery callbacks, except they fill a fixed-size buffer and don't lock the space (which isn't thread-safe)
+		cpFloat RaycastQueryCallback(void* contextPtr, void* shapePtr, void* /*data*/)
+		{
+			RaycastQueryContext& context = *static_cast<RaycastQueryContext*>(contextPtr);
+			cpShape* shape = static_cast<cpShape*>(shapePtr);
+
+			cpSegmentQueryInfo queryInfo;
+			if (!cpShapeFilterReject(cpShapeGetFilter(shape), context.filter) && cpShapeSegmentQuery(shape, context.start, context.end, context.radius, &queryInfo))
+			{
+				if (context.hitCount < context.maxHitCount)
+					FillRaycastHit(context.hits[context.hitCount++], queryInfo);
+				else
+				{
+					// Buffer is full, only keep the closest hits
+					auto farthestHit = std::max_element(context.hits, context.hits + context.hitCount, [](const PhysWorld2D::RaycastHit& lhs, const PhysWorld2D::RaycastHit& rhs) { return lhs.fraction < rhs.fraction; });
+					if (queryInfo.alpha < farthestHit->fraction)
+						FillRaycastHit(*farthestHit, queryInfo);
+				}
+			}
+
+			if (context.hitCount < context.maxHitCount)
+				return 1.0;
+
+			// Hits farther than every kept one don't matter anymore
+			cpFloat farthestFraction = 0.0;
+			for (std::size_t i = 0; i < context.hitCount; ++i)
+				farthestFraction = std::max<cpFloat>(farthestFraction, context.hits[i].fraction);
+
+			return farthestFraction;
+		}
+
+		cpCollisionID RegionQueryCallback(void* contextPtr, void* shapePtr, cpCollisionID id, void* /*data*/)
+		{
+			RegionQueryContext& context = *static_cast<RegionQueryContext*>(contextPtr);
+			cpShape* shape = static_cast<cpShape*>(shapePtr);
+
+			if (context.bodyCount < context.maxBodyCount && !cpShapeFilterReject(cpShapeGetFilter(shape), context.filter) && cpBBIntersects(context.boundingBox, cpShapeGetBB(shape)))
+				context.bodies[context.bodyCount++] = static_cast<Nz::RigidBody2D*>(cpShapeGetUserData(shape));
+
+			return id;
+		}
 	}
 
 	PhysWorld2D::PhysWorld2D() :
 	m_maxStepCount(50),
+	m_isSolverThreaded(false),
+	m_usesSpatialHash(false),
 	m_stepSize(0.005f),
 	m_timestepAccumulator(0.f)
 	{
@@ -89,9 +167,31 @@ namespace Nz
 		cpSpaceSetUserData(m_handle, this);
 	}
 
+	/*!
+	* \brief Constructs a physics world using a multithreaded solver
+	*
+	* Constraints and contacts are then solved by multiple threads (owned by Chipmunk), collision callbacks are still called from the thread calling Step.
+	*
+	* \param solverThreadCount Number of threads solving the world, 0 to use as many as there are CPU cores (Chipmunk may use less threads than asked)
+	*/
+	PhysWorld2D::PhysWorld2D(unsigned int solverThreadCount) :
+	m_maxStepCount(50),
+	m_isSolverThreaded(true),
+	m_usesSpatialHash(false),
+	m_stepSize(0.005f),
+	m_timestepAccumulator(0.f)
+	{
+		m_handle = cpHastySpaceNew();
+		cpHastySpaceSetThreads(m_handle, solverThreadCount);
+		cpSpaceSetUserData(m_handle, this);
+	}
+
 	PhysWorld2D::~PhysWorld2D()
 	{
-		cpSpaceFree(m_handle);
+		if (m_isSolverThreaded)
+			cpHastySpaceFree(m_handle);
+		else
+			cpSpaceFree(m_handle);
 	}
 
 	void PhysWorld2D::DebugDraw(const DebugDrawOptions& options, bool drawShapes, bool drawConstraints, bool drawCollisions)
@@ -156,11 +256,24 @@ namespace Nz
 		return m_maxStepCount;
 	}
 
+	unsigned int PhysWorld2D::GetSolverThreadCount() const
+	{
+		if (m_isSolverThreaded)
+			return static_cast<unsigned int>(cpHastySpaceGetThreads(m_handle));
+		else
+			return 1;
+	}
+
 	float PhysWorld2D::GetStepSize() const
 	{
 		return m_stepSize;
 	}
 
+	bool PhysWorld2D::IsSolverThreaded() const
+	{
+		return m_isSolverThreaded;
+	}
+
 	bool PhysWorld2D::NearestBodyQuery(const Vector2f & from, float maxDistance, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, RigidBody2D** nearestBody)
 	{
 		cpShapeFilter filter = cpShapeFilterNew(collisionGroup, categoryMask, collisionMask);
@@ -205,6 +318,49 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Finds the nearest body of multiple points at once, using the TaskScheduler workers
+	* \return Number of queries which found a body
+	*
+	* \param queries Queries to perform
+	* \param queryCount Number of queries
+	* \param results Array of queryCount results, nearestBody is set to nullptr if nothing was found
+	*/
+	std::size_t PhysWorld2D::NearestBodyQuery(const NearestQuery* queries, std::size_t queryCount, NearestQueryResult* results)
+	{
+		NazaraAssert(queryCount == 0 || (queries && results), "invalid query or result array");
+
+		std::atomic<std::size_t> resultCount(0);
+		ProcessQueries(queryCount, [&](std::size_t begin, std::size_t end)
+		{
+			std::size_t chunkResultCount = 0;
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				const NearestQuery& query = queries[i];
+				NearestQueryResult& result = results[i];
+
+				cpShapeFilter filter = cpShapeFilterNew(query.collisionGroup, query.categoryMask, query.collisionMask);
+
+				cpPointQueryInfo queryInfo;
+				if (cpSpacePointQueryNearest(m_handle, { query.from.x, query.from.y }, query.maxDistance, filter, &queryInfo))
+				{
+					result.closestPoint.Set(Nz::Vector2<cpFloat>(queryInfo.point.x, queryInfo.point.y));
+					result.distance = float(queryInfo.distance);
+					result.fraction.Set(Nz::Vector2<cpFloat>(queryInfo.gradient.x, queryInfo.gradient.y));
+					result.nearestBody = static_cast<Nz::RigidBody2D*>(cpShapeGetUserData(queryInfo.shape));
+
+					chunkResultCount++;
+				}
+				else
+					result.nearestBody = nullptr;
+			}
+
+			resultCount.fetch_add(chunkResultCount, std::memory_order_relaxed);
+		});
+
+		return resultCount.load(std::memory_order_relaxed);
+	}
+
 	void PhysWorld2D::RaycastQuery(const Nz::Vector2f& from, const Nz::Vector2f& to, float radius, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, const std::function<void(const RaycastHit&)>& callback)
 	{
 		using CallbackType = const std::function<void(const RaycastHit&)>;
@@ -251,6 +407,56 @@ namespace Nz
 		return hitInfos->size() != previousSize;
 	}
 
+	/*!
+	* \brief Casts multiple rays at once, using the TaskScheduler workers
+	* \return Total number of hits
+	*
+	* Hits of the query i are written to hitInfos[i * maxHitPerQuery], if a ray hits more than maxHitPerQuery shapes only the closest hits are kept (in no particular order).
+	*
+	* \param queries Rays to cast
+	* \param queryCount Number of rays
+	* \param hitInfos Array of queryCount * maxHitPerQuery hits
+	* \param maxHitPerQuery Maximum number of hits of a single ray
+	* \param hitCounts Array of queryCount values receiving the number of hits of each ray
+	*/
+	std::size_t PhysWorld2D::RaycastQuery(const RaycastQueryInfo* queries, std::size_t queryCount, RaycastHit* hitInfos, std::size_t maxHitPerQuery, std::size_t* hitCounts)
+	{
+		NazaraAssert(queryCount == 0 || (queries && hitCounts), "invalid query or hit count array");
+		NazaraAssert(queryCount == 0 || maxHitPerQuery == 0 || hitInfos, "invalid hit array");
+
+		std::atomic<std::size_t> totalHitCount(0);
+		ProcessQueries(queryCount, [&](std::size_t begin, std::size_t end)
+		{
+			std::size_t chunkHitCount = 0;
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				const RaycastQueryInfo& query = queries[i];
+
+				RaycastQueryContext context;
+				context.start = cpv(query.from.x, query.from.y);
+				context.end = cpv(query.to.x, query.to.y);
+				context.radius = query.radius;
+				context.filter = cpShapeFilterNew(query.collisionGroup, query.categoryMask, query.collisionMask);
+				context.hits = hitInfos + i * maxHitPerQuery;
+				context.hitCount = 0;
+				context.maxHitCount = maxHitPerQuery;
+
+				if (maxHitPerQuery > 0)
+				{
+					cpSpatialIndexSegmentQuery(m_handle->staticShapes, &context, context.start, context.end, 1.0, RaycastQueryCallback, nullptr);
+					cpSpatialIndexSegmentQuery(m_handle->dynamicShapes, &context, context.start, context.end, 1.0, RaycastQueryCallback, nullptr);
+				}
+
+				hitCounts[i] = context.hitCount;
+				chunkHitCount += context.hitCount;
+			}
+
+			totalHitCount.fetch_add(chunkHitCount, std::memory_order_relaxed);
+		});
+
+		return totalHitCount.load(std::memory_order_relaxed);
+	}
+
 	bool PhysWorld2D::RaycastQueryFirst(const Nz::Vector2f& from, const Nz::Vector2f& to, float radius, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, RaycastHit* hitInfo)
 	{
 		cpShapeFilter filter = cpShapeFilterNew(collisionGroup, categoryMask, collisionMask);
@@ -280,6 +486,44 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Casts multiple rays at once and only keeps the first hit of each one, using the TaskScheduler workers
+	* \return Number of rays which hit something
+	*
+	* \param queries Rays to cast
+	* \param queryCount Number of rays
+	* \param hitInfos Array of queryCount hits, nearestBody is set to nullptr if the ray didn't hit anything
+	*/
+	std::size_t PhysWorld2D::RaycastQueryFirst(const RaycastQueryInfo* queries, std::size_t queryCount, RaycastHit* hitInfos)
+	{
+		NazaraAssert(queryCount == 0 || (queries && hitInfos), "invalid query or hit array");
+
+		std::atomic<std::size_t> hitCount(0);
+		ProcessQueries(queryCount, [&](std::size_t begin, std::size_t end)
+		{
+			std::size_t chunkHitCount = 0;
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				const RaycastQueryInfo& query = queries[i];
+
+				cpShapeFilter filter = cpShapeFilterNew(query.collisionGroup, query.categoryMask, query.collisionMask);
+
+				cpSegmentQueryInfo queryInfo;
+				if (cpSpaceSegmentQueryFirst(m_handle, { query.from.x, query.from.y }, { query.to.x, query.to.y }, query.radius, filter, &queryInfo))
+				{
+					FillRaycastHit(hitInfos[i], queryInfo);
+					chunkHitCount++;
+				}
+				else
+					hitInfos[i].nearestBody = nullptr;
+			}
+
+			hitCount.fetch_add(chunkHitCount, std::memory_order_relaxed);
+		});
+
+		return hitCount.load(std::memory_order_relaxed);
+	}
+
 	void PhysWorld2D::RegionQuery(const Nz::Rectf& boundingBox, Nz::UInt32 collisionGroup, Nz::UInt32 categoryMask, Nz::UInt32 collisionMask, const std::function<void(Nz::RigidBody2D*)>& callback)
 	{
 		using CallbackType = const std::function<void(Nz::RigidBody2D*)>;
@@ -308,6 +552,55 @@ namespace Nz
 		cpSpaceBBQuery(m_handle, cpBBNew(boundingBox.x, boundingBox.y, boundingBox.x + boundingBox.width, boundingBox.y + boundingBox.height), filter, callback, bodies);
 	}
 
+	/*!
+	* \brief Finds the bodies intersecting multiple regions at once, using the TaskScheduler workers
+	* \return Total number of bodies found
+	*
+	* Bodies of the query i are written to bodies[i * maxBodyPerQuery], if more than maxBodyPerQuery bodies intersect a region the remaining ones are ignored.
+	* As with the other RegionQuery overloads, a body is reported once per intersecting shape.
+	*
+	* \param queries Regions to query
+	* \param queryCount Number of regions
+	* \param bodies Array of queryCount * maxBodyPerQuery bodies
+	* \param maxBodyPerQuery Maximum number of bodies of a single region
+	* \param bodyCounts Array of queryCount values receiving the number of bodies found in each region
+	*/
+	std::size_t PhysWorld2D::RegionQuery(const RegionQueryInfo* queries, std::size_t queryCount, Nz::RigidBody2D** bodies, std::size_t maxBodyPerQuery, std::size_t* bodyCounts)
+	{
+		NazaraAssert(queryCount == 0 || (queries && bodyCounts), "invalid query or body count array");
+		NazaraAssert(queryCount == 0 || maxBodyPerQuery == 0 || bodies, "invalid body array");
+
+		std::atomic<std::size_t> totalBodyCount(0);
+		ProcessQueries(queryCount, [&](std::size_t begin, std::size_t end)
+		{
+			std::size_t chunkBodyCount = 0;
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				const RegionQueryInfo& query = queries[i];
+
+				RegionQueryContext context;
+				context.boundingBox = cpBBNew(query.boundingBox.x, query.boundingBox.y, query.boundingBox.x + query.boundingBox.width, query.boundingBox.y + query.boundingBox.height);
+				context.filter = cpShapeFilterNew(query.collisionGroup, query.categoryMask, query.collisionMask);
+				context.bodies = bodies + i * maxBodyPerQuery;
+				context.bodyCount = 0;
+				context.maxBodyCount = maxBodyPerQuery;
+
+				if (maxBodyPerQuery > 0)
+				{
+					cpSpatialIndexQuery(m_handle->dynamicShapes, &context, context.boundingBox, RegionQueryCallback, nullptr);
+					cpSpatialIndexQuery(m_handle->staticShapes, &context, context.boundingBox, RegionQueryCallback, nullptr);
+				}
+
+				bodyCounts[i] = context.bodyCount;
+				chunkBodyCount += context.bodyCount;
+			}
+
+			totalBodyCount.fetch_add(chunkBodyCount, std::memory_order_relaxed);
+		});
+
+		return totalBodyCount.load(std::memory_order_relaxed);
+	}
+
 	void PhysWorld2D::RegisterCallbacks(unsigned int collisionId, Callback callbacks)
 	{
 		InitCallbacks(cpSpaceAddWildcardHandler(m_handle, collisionId), std::move(callbacks));
@@ -346,6 +639,24 @@ namespace Nz
 			cpSpaceSetSleepTimeThreshold(m_handle, std::numeric_limits<cpFloat>::infinity());
 	}
 
+	/*!
+	* \brief Changes the number of threads used by the solver
+	*
+	* \param solverThreadCount Number of threads, 0 to use as many as there are CPU cores
+	*
+	* \remark The world must have been constructed with a multithreaded solver
+	*/
+	void PhysWorld2D::SetSolverThreadCount(unsigned int solverThreadCount)
+	{
+		if (!m_isSolverThreaded)
+		{
+			NazaraError("world was not constructed with a multithreaded solver");
+			return;
+		}
+
+		cpHastySpaceSetThreads(m_handle, solverThreadCount);
+	}
+
 	void PhysWorld2D::SetStepSize(float stepSize)
 	{
 		m_stepSize = stepSize;
@@ -361,7 +672,10 @@ namespace Nz
 		{
 			OnPhysWorld2DPreStep(this, invStepCount);
 
-			cpSpaceStep(m_handle, m_stepSize);
+			if (m_isSolverThreaded)
+				cpHastySpaceStep(m_handle, m_stepSize);
+			else
+				cpSpaceStep(m_handle, m_stepSize);
 
 			OnPhysWorld2DPostStep(this, invStepCount);
 			if (!m_rigidPostSteps.empty())
@@ -382,6 +696,7 @@ namespace Nz
 	void PhysWorld2D::UseSpatialHash(float cellSize, std::size_t entityCount)
 	{
 		cpSpaceUseSpatialHash(m_handle, cpFloat(cellSize), int(entityCount));
+		m_usesSpatialHash = true;
 	}
 
 	void PhysWorld2D::InitCallbacks(cpCollisionHandler* handler, Callback callbacks)
@@ -504,6 +819,16 @@ namespace Nz
 		}
 	}
 
+	template<typename F>
+	void PhysWorld2D::ProcessQueries(std::size_t queryCount, F&& func)
+	{
+		// Queries only read the bounding box trees, but the spatial hash stamps the shapes it visits and isn't thread-safe
+		if (m_usesSpatialHash)
+			func(std::size_t(0), queryCount);
+		else
+			ParallelForRange(0, queryCount, func, ComputeGrainSize(queryCount, 32));
+	}
+
 	void PhysWorld2D::OnRigidBodyMoved(RigidBody2D* oldPointer, RigidBody2D* newPointer)
 	{
 		auto it = m_rigidPostSteps.find(oldPointer);
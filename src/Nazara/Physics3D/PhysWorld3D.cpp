@@ -4,7 +4,9 @@
 
 #include <Nazara/Physics3D/PhysWorld3D.hpp>
 #include <Nazara/Core/StackVector.hpp>
+#include <Nazara/Physics3D/RigidBody3D.hpp>
 #include <newton/Newton.h>
+#include <algorithm>
 #include <cassert>
 #include <Nazara/Physics3D/Debug.hpp>
 
@@ -22,20 +24,27 @@ namespace Nz
 		m_materialIds.emplace("default", NewtonMaterialGetDefaultGroupID(m_world));
 	}
 
-	PhysWorld3D::PhysWorld3D(PhysWorld3D&& physWorld) noexcept :
-	m_callbacks(std::move(physWorld.m_callbacks)),
-	m_materialIds(std::move(physWorld.m_materialIds)),
-	m_maxStepCount(std::move(physWorld.m_maxStepCount)),
-	m_world(std::move(physWorld.m_world)),
-	m_gravity(std::move(physWorld.m_gravity)),
-	m_stepSize(std::move(physWorld.m_stepSize)),
-	m_timestepAccumulator(std::move(physWorld.m_timestepAccumulator))
+	PhysWorld3D::PhysWorld3D(PhysWorld3D&& physWorld) noexcept
 	{
+		// An asynchronous step of the other world still references it, members must only be moved once it's over
+		physWorld.WaitForStep();
+
+		m_callbacks = std::move(physWorld.m_callbacks);
+		m_materialIds = std::move(physWorld.m_materialIds);
+		m_maxStepCount = std::move(physWorld.m_maxStepCount);
+		m_stepCounter = std::move(physWorld.m_stepCounter);
+		m_world = std::move(physWorld.m_world);
+		m_gravity = std::move(physWorld.m_gravity);
+		m_stepSize = std::move(physWorld.m_stepSize);
+		m_timestepAccumulator = std::move(physWorld.m_timestepAccumulator);
+
 		NewtonWorldSetUserData(m_world, this);
 	}
 
 	PhysWorld3D::~PhysWorld3D()
 	{
+		WaitForStep();
+
 		if (m_world)
 			NewtonDestroy(m_world);
 	}
@@ -73,6 +82,20 @@ namespace Nz
 		return m_world;
 	}
 
+	/*!
+	* \brief Returns how far the simulation is between its last two steps
+	* \return Interpolation factor between 0 (last step) and 1 (next step)
+	*
+	* This is the time left in the accumulator divided by the step size, and is meant to be passed to RigidBody3D::GetInterpolatedPosition/Rotation
+	* to render bodies smoothly when the frame rate doesn't match the step size.
+	*
+	* \remark Must not be called while an asynchronous step is running
+	*/
+	float PhysWorld3D::GetInterpolationFactor() const
+	{
+		return std::clamp(m_timestepAccumulator / m_stepSize, 0.f, 1.f);
+	}
+
 	int PhysWorld3D::GetMaterial(const std::string& name)
 	{
 		auto it = m_materialIds.find(name);
@@ -96,6 +119,15 @@ namespace Nz
 		return NewtonGetThreadsCount(m_world);
 	}
 
+	/*!
+	* \brief Checks whether an asynchronous step is still running
+	* \return true if the step started by StepAsync hasn't completed yet
+	*/
+	bool PhysWorld3D::IsStepping() const
+	{
+		return m_stepCounter && !m_stepCounter->IsDone();
+	}
+
 	void PhysWorld3D::SetGravity(const Vector3f& gravity)
 	{
 		m_gravity = gravity;
@@ -166,20 +198,65 @@ namespace Nz
 		std::size_t stepCount = 0;
 		while (m_timestepAccumulator >= m_stepSize && stepCount < m_maxStepCount)
 		{
+			// Only the last two steps are needed for interpolation, this uses the same computation as the loop condition
+			bool isLastStep = (m_timestepAccumulator - m_stepSize < m_stepSize || stepCount + 1 >= m_maxStepCount);
+			if (isLastStep)
+				SaveBodyPoses(true);
+
 			NewtonUpdate(m_world, m_stepSize);
 			m_timestepAccumulator -= m_stepSize;
 			stepCount++;
+
+			if (isLastStep)
+				SaveBodyPoses(false);
 		}
 	}
 
+	/*!
+	* \brief Steps the world on a TaskScheduler worker
+	*
+	* This waits for the previous asynchronous step, if any, before starting a new one.
+	* Until the step is over (see WaitForStep), neither the world nor its bodies must be accessed, except for their step poses
+	* (RigidBody3D::GetInterpolatedPosition/Rotation) which are only written at the end of the step, after WaitForStep returns.
+	*
+	* \param timestep Time elapsed since the last step
+	*/
+	void PhysWorld3D::StepAsync(float timestep)
+	{
+		WaitForStep();
+
+		if (!m_stepCounter)
+			m_stepCounter = std::make_unique<TaskScheduler::Counter>();
+
+		TaskScheduler::Submit([this, timestep]
+		{
+			Step(timestep);
+		}, m_stepCounter.get());
+	}
+
+	/*!
+	* \brief Waits for the step started by StepAsync to complete
+	*
+	* The calling thread may run other TaskScheduler tasks while waiting, it does nothing if no asynchronous step is running.
+	*/
+	void PhysWorld3D::WaitForStep()
+	{
+		if (m_stepCounter)
+			TaskScheduler::WaitFor(*m_stepCounter);
+	}
+
 	PhysWorld3D& PhysWorld3D::operator=(PhysWorld3D&& physWorld) noexcept
 	{
+		WaitForStep();
+		physWorld.WaitForStep();
+
 		if (m_world)
 			NewtonDestroy(m_world);
 
 		m_callbacks = std::move(physWorld.m_callbacks);
 		m_materialIds = std::move(physWorld.m_materialIds);
 		m_maxStepCount = std::move(physWorld.m_maxStepCount);
+		m_stepCounter = std::move(physWorld.m_stepCounter);
 		m_world = std::move(physWorld.m_world);
 		m_gravity = std::move(physWorld.m_gravity);
 		m_stepSize = std::move(physWorld.m_stepSize);
@@ -190,6 +267,17 @@ namespace Nz
 		return *this;
 	}
 
+	void PhysWorld3D::SaveBodyPoses(bool previousPoses)
+	{
+		for (NewtonBody* body = NewtonWorldGetFirstBody(m_world); body; body = NewtonWorldGetNextBody(m_world, body))
+		{
+			RigidBody3D* rigidBody = static_cast<RigidBody3D*>(NewtonBodyGetUserData(body));
+			assert(rigidBody);
+
+			rigidBody->SaveStepPose(previousPoses);
+		}
+	}
+
 	int PhysWorld3D::OnAABBOverlap(const NewtonJoint* const contactJoint, float /*timestep*/, int /*threadIndex*/)
 	{
 		RigidBody3D* bodyA = static_cast<RigidBody3D*>(NewtonBodyGetUserData(NewtonJointGetBody0(contactJoint)));
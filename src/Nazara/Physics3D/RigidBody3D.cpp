@@ -32,6 +32,8 @@ namespace Nz
 
 		m_body = NewtonCreateDynamicBody(m_world->GetHandle(), m_geom->GetHandle(m_world), &mat.m11);
 		NewtonBodySetUserData(m_body, this);
+
+		ResetStepPoses();
 	}
 
 	RigidBody3D::RigidBody3D(const RigidBody3D& object) :
@@ -66,6 +68,10 @@ namespace Nz
 	m_forceAccumulator(std::move(object.m_forceAccumulator)),
 	m_torqueAccumulator(std::move(object.m_torqueAccumulator)),
 	m_body(std::move(object.m_body)),
+	m_previousStepRotation(object.m_previousStepRotation),
+	m_stepRotation(object.m_stepRotation),
+	m_previousStepPosition(object.m_previousStepPosition),
+	m_stepPosition(object.m_stepPosition),
 	m_world(object.m_world),
 	m_gravityFactor(object.m_gravityFactor),
 	m_mass(object.m_mass)
@@ -188,6 +194,32 @@ namespace Nz
 		return NewtonBodyGetLinearDamping(m_body);
 	}
 
+	/*!
+	* \brief Interpolates the position of the body between the last two steps of its world
+	* \return Interpolated position
+	*
+	* \param interpolationFactor Interpolation factor, usually PhysWorld3D::GetInterpolationFactor
+	*
+	* \remark Step poses are written at the end of PhysWorld3D::Step, wait for asynchronous steps before calling this
+	*/
+	Vector3f RigidBody3D::GetInterpolatedPosition(float interpolationFactor) const
+	{
+		return Vector3f::Lerp(m_previousStepPosition, m_stepPosition, interpolationFactor);
+	}
+
+	/*!
+	* \brief Interpolates the rotation of the body between the last two steps of its world
+	* \return Interpolated rotation
+	*
+	* \param interpolationFactor Interpolation factor, usually PhysWorld3D::GetInterpolationFactor
+	*
+	* \see GetInterpolatedPosition
+	*/
+	Quaternionf RigidBody3D::GetInterpolatedRotation(float interpolationFactor) const
+	{
+		return Quaternionf::Slerp(m_previousStepRotation, m_stepRotation, interpolationFactor);
+	}
+
 	Vector3f RigidBody3D::GetLinearVelocity() const
 	{
 		Vector3f velocity;
@@ -403,22 +435,52 @@ namespace Nz
 		if (m_body)
 			NewtonDestroyBody(m_body);
 
-		m_body               = std::move(object.m_body);
-		m_forceAccumulator   = std::move(object.m_forceAccumulator);
-		m_geom               = std::move(object.m_geom);
-		m_gravityFactor      = object.m_gravityFactor;
-		m_mass               = object.m_mass;
-		m_torqueAccumulator  = std::move(object.m_torqueAccumulator);
-		m_world              = object.m_world;
+		m_body                 = std::move(object.m_body);
+		m_forceAccumulator     = std::move(object.m_forceAccumulator);
+		m_geom                 = std::move(object.m_geom);
+		m_gravityFactor        = object.m_gravityFactor;
+		m_mass                 = object.m_mass;
+		m_previousStepPosition = object.m_previousStepPosition;
+		m_previousStepRotation = object.m_previousStepRotation;
+		m_stepPosition         = object.m_stepPosition;
+		m_stepRotation         = object.m_stepRotation;
+		m_torqueAccumulator    = std::move(object.m_torqueAccumulator);
+		m_world                = object.m_world;
 
 		NewtonBodySetUserData(m_body, this);
 		return *this;
 	}
 
+	void RigidBody3D::ResetStepPoses()
+	{
+		m_stepPosition = GetPosition();
+		m_stepRotation = GetRotation();
+
+		m_previousStepPosition = m_stepPosition;
+		m_previousStepRotation = m_stepRotation;
+	}
+
+	void RigidBody3D::SaveStepPose(bool previousPose)
+	{
+		if (previousPose)
+		{
+			m_previousStepPosition = GetPosition();
+			m_previousStepRotation = GetRotation();
+		}
+		else
+		{
+			m_stepPosition = GetPosition();
+			m_stepRotation = GetRotation();
+		}
+	}
+
 	void RigidBody3D::UpdateBody(const Matrix4f& transformMatrix)
 	{
 		NewtonBodySetMatrix(m_body, &transformMatrix.m11);
 
+		// Teleport the body instead of interpolating to its new transform
+		ResetStepPoses();
+
 		if (NumberEquals(m_mass, 0.f))
 		{
 			// Moving a static body in Newton does not update bodies at the target location
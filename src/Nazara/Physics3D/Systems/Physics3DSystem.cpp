@@ -3,35 +3,98 @@
 // For conditions of distribution and use, see copyright notice in Prerequisites.hpp
 
 #include <Nazara/Physics3D/Systems/Physics3DSystem.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
 #include <Nazara/Utility/Components/NodeComponent.hpp>
 #include <Nazara/Physics3D/Debug.hpp>
 
 namespace Nz
 {
-	Physics3DSystem::Physics3DSystem(entt::registry& registry)
+	Physics3DSystem::Physics3DSystem(entt::registry& registry) :
+	m_asyncStepping(false),
+	m_interpolation(false),
+	m_parallelSync(false)
 	{
 		m_constructConnection = registry.on_construct<RigidBody3DComponent>().connect<OnConstruct>();
 	}
 
 	Physics3DSystem::~Physics3DSystem()
 	{
+		m_physWorld.WaitForStep();
 		m_constructConnection.release();
 	}
 
 	void Physics3DSystem::Update(entt::registry& registry, float elapsedTime)
 	{
-		m_physWorld.Step(elapsedTime);
+		// In asynchronous mode, replicate the step started by the previous update and start the next one once it's done
+		if (m_asyncStepping)
+			m_physWorld.WaitForStep();
+		else
+			m_physWorld.Step(elapsedTime);
 
+		SyncNodes(registry);
+
+		if (m_asyncStepping)
+			m_physWorld.StepAsync(elapsedTime);
+	}
+
+	void Physics3DSystem::SyncNodes(entt::registry& registry)
+	{
 		// Replicate rigid body position to their node components
-		auto view = registry.view<Nz::NodeComponent, const RigidBody3DComponent>();
-		for (auto [entity, nodeComponent, rigidBodyComponent] : view.each())
+		auto view = registry.view<NodeComponent, const RigidBody3DComponent>();
+
+		float interpolationFactor = m_physWorld.GetInterpolationFactor();
+
+		auto SyncNode = [&](entt::entity entity)
+		{
+			NodeComponent& nodeComponent = view.get<NodeComponent>(entity);
+			const RigidBody3DComponent& rigidBodyComponent = view.get<const RigidBody3DComponent>(entity);
+
+			if (m_interpolation)
+			{
+				nodeComponent.SetPosition(rigidBodyComponent.GetInterpolatedPosition(interpolationFactor), CoordSys::Global);
+				nodeComponent.SetRotation(rigidBodyComponent.GetInterpolatedRotation(interpolationFactor), CoordSys::Global);
+			}
+			else
+			{
+				nodeComponent.SetPosition(rigidBodyComponent.GetPosition(), CoordSys::Global);
+				nodeComponent.SetRotation(rigidBodyComponent.GetRotation(), CoordSys::Global);
+			}
+		};
+
+		if (!m_parallelSync)
+		{
+			for (entt::entity entity : view)
+			{
+				if (!view.get<const RigidBody3DComponent>(entity).IsSleeping())
+					SyncNode(entity);
+			}
+
+			return;
+		}
+
+		// Nodes without parent don't share any state (their children are invalidated by them only) and can be updated concurrently,
+		// the other ones read their parent transform and are updated afterwards
+		m_childEntities.clear();
+		m_rootEntities.clear();
+		for (entt::entity entity : view)
 		{
-			if (rigidBodyComponent.IsSleeping())
+			if (view.get<const RigidBody3DComponent>(entity).IsSleeping())
 				continue;
 
-			nodeComponent.SetPosition(rigidBodyComponent.GetPosition(), CoordSys::Global);
-			nodeComponent.SetRotation(rigidBodyComponent.GetRotation(), CoordSys::Global);
+			if (view.get<NodeComponent>(entity).GetParent())
+				m_childEntities.push_back(entity);
+			else
+				m_rootEntities.push_back(entity);
 		}
+
+		ParallelForRange(0, m_rootEntities.size(), [&](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t i = begin; i < end; ++i)
+				SyncNode(m_rootEntities[i]);
+		}, ComputeGrainSize(m_rootEntities.size(), 256));
+
+		for (entt::entity entity : m_childEntities)
+			SyncNode(entity);
 	}
 
 	void Physics3DSystem::OnConstruct(entt::registry& registry, entt::entity entity)
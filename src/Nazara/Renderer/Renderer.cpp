@@ -78,6 +78,7 @@ namespace Nz
 			NazaraRendererPrefix "NazaraDirect3DRenderer" NazaraRendererDebugSuffix, // Direct3D
 			NazaraRendererPrefix "NazaraMantleRenderer"   NazaraRendererDebugSuffix, // Mantle
 			NazaraRendererPrefix "NazaraMetalRenderer"    NazaraRendererDebugSuffix, // Metal
+			NazaraRendererPrefix "NazaraNullRenderer"     NazaraRendererDebugSuffix, // Null
 			NazaraRendererPrefix "NazaraOpenGLRenderer"   NazaraRendererDebugSuffix, // OpenGL
 			NazaraRendererPrefix "NazaraVulkanRenderer"   NazaraRendererDebugSuffix, // Vulkan
 
@@ -110,6 +111,7 @@ namespace Nz
 
 		RegisterImpl(RenderAPI::OpenGL, [] { return 50; });
 		RegisterImpl(RenderAPI::Vulkan, [] { return 100; });
+		RegisterImpl(RenderAPI::Null, [&] { return (config.preferredAPI == RenderAPI::Null) ? 0 : -1; }); //< never picked unless explicitly requested
 
 		std::sort(implementations.begin(), implementations.end(), [](const auto& lhs, const auto& rhs) { return lhs.score > rhs.score; });
 
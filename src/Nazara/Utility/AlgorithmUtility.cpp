@@ -26,10 +26,17 @@
  */
 
 #include <Nazara/Utility/Algorithm.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
 #include <Nazara/Utility/IndexIterator.hpp>
 #include <Nazara/Utility/Joint.hpp>
 #include <algorithm>
 #include <unordered_map>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+	#define NAZARA_UTILITY_SKINNING_SSE
+	#include <xmmintrin.h>
+#endif
+
 #include <Nazara/Utility/Debug.hpp>
 #include <Nazara/Utility/Mesh.hpp>
 #include <Nazara/Utility/SkeletalMesh.hpp>
@@ -630,6 +637,129 @@ namespace Nz
 				float m_valenceBoostScale;
 				float m_valenceBoostPower;
 		};
+
+		/************************************Skin***********************************/
+
+		inline const Matrix4f& GetSkinningMatrix(const SkinningData& data, UInt32 jointIndex)
+		{
+			return (data.skinningMatrices) ? data.skinningMatrices[jointIndex] : data.joints[jointIndex].GetSkinningMatrix();
+		}
+
+		// Sum of the weighted skinning matrices affecting a vertex, the vertex is then transformed once
+		// Only the 3x4 affine part is used, stored as four columns (the last one holding the translation)
+#ifdef NAZARA_UTILITY_SKINNING_SSE
+		class BlendedMatrix
+		{
+			public:
+				BlendedMatrix() :
+				m_column0(_mm_setzero_ps()),
+				m_column1(_mm_setzero_ps()),
+				m_column2(_mm_setzero_ps()),
+				m_translation(_mm_setzero_ps())
+				{
+				}
+
+				void Add(const Matrix4f& matrix, float weight)
+				{
+					// Matrix4 stores its columns contiguously (m11, m12, m13, m14, m21...)
+					__m128 weights = _mm_set1_ps(weight);
+
+					m_column0 = _mm_add_ps(m_column0, _mm_mul_ps(_mm_loadu_ps(&matrix.m11), weights));
+					m_column1 = _mm_add_ps(m_column1, _mm_mul_ps(_mm_loadu_ps(&matrix.m21), weights));
+					m_column2 = _mm_add_ps(m_column2, _mm_mul_ps(_mm_loadu_ps(&matrix.m31), weights));
+					m_translation = _mm_add_ps(m_translation, _mm_mul_ps(_mm_loadu_ps(&matrix.m41), weights));
+				}
+
+				Vector3f TransformDirection(const Vector3f& direction) const
+				{
+					return ToVector3(Transform(direction));
+				}
+
+				Vector3f TransformPosition(const Vector3f& position) const
+				{
+					return ToVector3(_mm_add_ps(Transform(position), m_translation));
+				}
+
+			private:
+				__m128 Transform(const Vector3f& vec) const
+				{
+					__m128 result = _mm_mul_ps(m_column0, _mm_set1_ps(vec.x));
+					result = _mm_add_ps(result, _mm_mul_ps(m_column1, _mm_set1_ps(vec.y)));
+					result = _mm_add_ps(result, _mm_mul_ps(m_column2, _mm_set1_ps(vec.z)));
+
+					return result;
+				}
+
+				static Vector3f ToVector3(__m128 value)
+				{
+					alignas(16) float components[4];
+					_mm_store_ps(components, value);
+
+					return Vector3f(components[0], components[1], components[2]);
+				}
+
+				__m128 m_column0;
+				__m128 m_column1;
+				__m128 m_column2;
+				__m128 m_translation;
+		};
+#else
+		class BlendedMatrix
+		{
+			public:
+				BlendedMatrix() :
+				m_columns{ Vector3f::Zero(), Vector3f::Zero(), Vector3f::Zero(), Vector3f::Zero() }
+				{
+				}
+
+				void Add(const Matrix4f& matrix, float weight)
+				{
+					m_columns[0] += Vector3f(matrix.m11, matrix.m12, matrix.m13) * weight;
+					m_columns[1] += Vector3f(matrix.m21, matrix.m22, matrix.m23) * weight;
+					m_columns[2] += Vector3f(matrix.m31, matrix.m32, matrix.m33) * weight;
+					m_columns[3] += Vector3f(matrix.m41, matrix.m42, matrix.m43) * weight;
+				}
+
+				Vector3f TransformDirection(const Vector3f& direction) const
+				{
+					return m_columns[0] * direction.x + m_columns[1] * direction.y + m_columns[2] * direction.z;
+				}
+
+				Vector3f TransformPosition(const Vector3f& position) const
+				{
+					return TransformDirection(position) + m_columns[3];
+				}
+
+			private:
+				Vector3f m_columns[4];
+		};
+#endif
+
+		template<bool HasNormal, bool HasTangent>
+		void Skin(const SkinningData& data, unsigned int startVertex, unsigned int vertexCount)
+		{
+			const SkeletalMeshVertex* inputVertex = &data.inputVertex[startVertex];
+			MeshVertex* outputVertex = &data.outputVertex[startVertex];
+
+			for (unsigned int i = 0; i < vertexCount; ++i)
+			{
+				BlendedMatrix matrix;
+				for (int j = 0; j < inputVertex->weightCount; ++j)
+					matrix.Add(GetSkinningMatrix(data, inputVertex->jointIndexes[j]), inputVertex->weights[j]);
+
+				outputVertex->position = matrix.TransformPosition(inputVertex->position);
+				outputVertex->uv = inputVertex->uv;
+
+				if constexpr (HasNormal)
+					outputVertex->normal = matrix.TransformDirection(inputVertex->normal).Normalize();
+
+				if constexpr (HasTangent)
+					outputVertex->tangent = matrix.TransformDirection(inputVertex->tangent).Normalize();
+
+				inputVertex++;
+				outputVertex++;
+			}
+		}
 	}
 
 	/**********************************Compute**********************************/
@@ -720,6 +850,12 @@ namespace Nz
 			*vertexCount = horizontalVertexCount*verticalVertexCount;
 	}
 
+	void ComputeSkinningMatrices(const Joint* joints, std::size_t jointCount, Matrix4f* matrices)
+	{
+		for (std::size_t i = 0; i < jointCount; ++i)
+			matrices[i] = joints[i].GetSkinningMatrix();
+	}
+
 	void ComputeUvSphereIndexVertexCount(unsigned int sliceCount, unsigned int stackCount, unsigned int* indexCount, unsigned int* vertexCount)
 	{
 		if (indexCount)
@@ -1052,96 +1188,33 @@ namespace Nz
 
 	/************************************Skin***********************************/
 
-	void SkinPosition(const SkinningData& skinningInfos, unsigned int startVertex, unsigned int vertexCount)
+	void ParallelSkin(SkinFunction skinFunc, const SkinningData& data, unsigned int startVertex, unsigned int vertexCount, unsigned int grainSize)
 	{
-		const SkeletalMeshVertex* inputVertex = &skinningInfos.inputVertex[startVertex];
-		MeshVertex* outputVertex = &skinningInfos.outputVertex[startVertex];
+		NazaraAssert(skinFunc, "Invalid skinning function");
+		NazaraAssert(data.skinningMatrices, "Skinning matrices must be computed beforehand, as joints update them lazily");
 
-		unsigned int endVertex = startVertex + vertexCount - 1;
-		for (unsigned int i = startVertex; i <= endVertex; ++i)
-		{
-			Vector3f finalPosition(Vector3f::Zero());
+		if (grainSize == 0)
+			grainSize = static_cast<unsigned int>(ComputeGrainSize(vertexCount, 1024)); //< Skinning a vertex is too cheap for smaller tasks
 
-			for (int j = 0; j < inputVertex->weightCount; ++j)
-			{
-				Matrix4f mat(skinningInfos.joints[inputVertex->jointIndexes[j]].GetSkinningMatrix());
-				mat *= inputVertex->weights[j];
-
-				finalPosition += mat.Transform(inputVertex->position);
-			}
-
-			outputVertex->position = finalPosition;
-			outputVertex->uv = inputVertex->uv;
+		ParallelForRange(startVertex, std::size_t(startVertex) + vertexCount, [&](std::size_t begin, std::size_t end)
+		{
+			skinFunc(data, static_cast<unsigned int>(begin), static_cast<unsigned int>(end - begin));
+		}, grainSize);
+	}
 
-			inputVertex++;
-			outputVertex++;
-		}
+	void SkinPosition(const SkinningData& skinningInfos, unsigned int startVertex, unsigned int vertexCount)
+	{
+		Skin<false, false>(skinningInfos, startVertex, vertexCount);
 	}
 
 	void SkinPositionNormal(const SkinningData& skinningInfos, unsigned int startVertex, unsigned int vertexCount)
 	{
-		const SkeletalMeshVertex* inputVertex = &skinningInfos.inputVertex[startVertex];
-		MeshVertex* outputVertex = &skinningInfos.outputVertex[startVertex];
-
-		unsigned int endVertex = startVertex + vertexCount - 1;
-		for (unsigned int i = startVertex; i <= endVertex; ++i)
-		{
-			Vector3f finalPosition(Vector3f::Zero());
-			Vector3f finalNormal(Vector3f::Zero());
-
-			for (int j = 0; j < inputVertex->weightCount; ++j)
-			{
-				Matrix4f mat(skinningInfos.joints[inputVertex->jointIndexes[j]].GetSkinningMatrix());
-				mat *= inputVertex->weights[j];
-
-				finalPosition += mat.Transform(inputVertex->position);
-				finalNormal += mat.Transform(inputVertex->normal, 0.f);
-			}
-
-			finalNormal.Normalize();
-
-			outputVertex->normal = finalNormal;
-			outputVertex->position = finalPosition;
-			outputVertex->uv = inputVertex->uv;
-
-			inputVertex++;
-			outputVertex++;
-		}
+		Skin<true, false>(skinningInfos, startVertex, vertexCount);
 	}
 
 	void SkinPositionNormalTangent(const SkinningData& skinningInfos, unsigned int startVertex, unsigned int vertexCount)
 	{
-		const SkeletalMeshVertex* inputVertex = &skinningInfos.inputVertex[startVertex];
-		MeshVertex* outputVertex = &skinningInfos.outputVertex[startVertex];
-
-		unsigned int endVertex = startVertex + vertexCount - 1;
-		for (unsigned int i = startVertex; i <= endVertex; ++i)
-		{
-			Vector3f finalPosition(Vector3f::Zero());
-			Vector3f finalNormal(Vector3f::Zero());
-			Vector3f finalTangent(Vector3f::Zero());
-
-			for (int j = 0; j < inputVertex->weightCount; ++j)
-			{
-				Matrix4f mat(skinningInfos.joints[inputVertex->jointIndexes[j]].GetSkinningMatrix());
-				mat *= inputVertex->weights[j];
-
-				finalPosition += mat.Transform(inputVertex->position);
-				finalNormal += mat.Transform(inputVertex->normal, 0.f);
-				finalTangent += mat.Transform(inputVertex->tangent, 0.f);
-			}
-
-			finalNormal.Normalize();
-			finalTangent.Normalize();
-
-			outputVertex->normal = finalNormal;
-			outputVertex->position = finalPosition;
-			outputVertex->tangent = finalTangent;
-			outputVertex->uv = inputVertex->uv;
-
-			inputVertex++;
-			outputVertex++;
-		}
+		Skin<true, true>(skinningInfos, startVertex, vertexCount);
 	}
 
 	/*********************************Transform*********************************/
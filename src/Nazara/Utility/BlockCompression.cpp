@@ -0,0 +1,740 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/BlockCompression.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
+#include <Nazara/Math/Algorithm.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define NAZARA_UTILITY_BLOCKCOMPRESSION_SSE2
+	#include <emmintrin.h>
+#endif
+
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz::BlockCompression
+{
+	namespace
+	{
+		constexpr unsigned int BlockPixelCount = BlockDim * BlockDim;
+		constexpr unsigned int ColorRefinementCount = 2;
+
+		using BlockIndices = std::array<UInt8, BlockPixelCount>;
+		using ChannelPalette = std::array<UInt8, 8>;
+		using ColorPalette = std::array<std::array<int, 3>, 4>;
+
+		struct ColorBlock
+		{
+			// Structure of arrays, to process four pixels at once
+			alignas(16) std::array<float, BlockPixelCount> r;
+			alignas(16) std::array<float, BlockPixelCount> g;
+			alignas(16) std::array<float, BlockPixelCount> b;
+			alignas(16) std::array<float, BlockPixelCount> weights; //< transparent pixels have a null weight and are left out of the color fitting
+			bool hasTransparentPixels;
+		};
+
+		struct ColorCandidate
+		{
+			BlockIndices indices;
+			float error;
+			UInt16 color0;
+			UInt16 color1;
+			bool fourColors;
+		};
+
+		std::size_t GetBlockSize(PixelFormat format)
+		{
+			return (format == PixelFormat::DXT1 || format == PixelFormat::BC4) ? 8 : 16;
+		}
+
+		UInt16 ReadUInt16(const UInt8* ptr)
+		{
+			return static_cast<UInt16>(ptr[0] | (ptr[1] << 8));
+		}
+
+		void WriteUInt16(UInt8* ptr, UInt16 value)
+		{
+			ptr[0] = static_cast<UInt8>(value & 0xFF);
+			ptr[1] = static_cast<UInt8>(value >> 8);
+		}
+
+		UInt16 PackRGB565(const std::array<float, 3>& color)
+		{
+			int r = Clamp(static_cast<int>(color[0] * (31.f / 255.f) + 0.5f), 0, 31);
+			int g = Clamp(static_cast<int>(color[1] * (63.f / 255.f) + 0.5f), 0, 63);
+			int b = Clamp(static_cast<int>(color[2] * (31.f / 255.f) + 0.5f), 0, 31);
+
+			return static_cast<UInt16>((r << 11) | (g << 5) | b);
+		}
+
+		std::array<int, 3> UnpackRGB565(UInt16 color)
+		{
+			int r = (color >> 11) & 0x1F;
+			int g = (color >> 5) & 0x3F;
+			int b = color & 0x1F;
+
+			return { (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2) };
+		}
+
+		unsigned int ComputeColorPalette(UInt16 color0, UInt16 color1, bool fourColors, ColorPalette& palette)
+		{
+			palette[0] = UnpackRGB565(color0);
+			palette[1] = UnpackRGB565(color1);
+
+			for (unsigned int c = 0; c < 3; ++c)
+			{
+				if (fourColors)
+				{
+					palette[2][c] = (2 * palette[0][c] + palette[1][c] + 1) / 3;
+					palette[3][c] = (palette[0][c] + 2 * palette[1][c] + 1) / 3;
+				}
+				else
+				{
+					palette[2][c] = (palette[0][c] + palette[1][c] + 1) / 2;
+					palette[3][c] = 0; //< transparent black
+				}
+			}
+
+			return (fourColors) ? 4 : 3;
+		}
+
+		void ComputeChannelPalette(UInt8 value0, UInt8 value1, ChannelPalette& palette)
+		{
+			palette[0] = value0;
+			palette[1] = value1;
+
+			if (value0 > value1)
+			{
+				for (unsigned int i = 2; i < 8; ++i)
+					palette[i] = static_cast<UInt8>(((8 - i) * value0 + (i - 1) * value1 + 3) / 7);
+			}
+			else
+			{
+				for (unsigned int i = 2; i < 6; ++i)
+					palette[i] = static_cast<UInt8>(((6 - i) * value0 + (i - 1) * value1 + 2) / 5);
+
+				palette[6] = 0;
+				palette[7] = 255;
+			}
+		}
+
+		float SelectColorIndices(const ColorBlock& block, const ColorPalette& palette, unsigned int colorCount, BlockIndices& indices)
+		{
+			#ifdef NAZARA_UTILITY_BLOCKCOMPRESSION_SSE2
+			__m128 totalError = _mm_setzero_ps();
+			for (unsigned int i = 0; i < BlockPixelCount; i += 4)
+			{
+				__m128 r = _mm_load_ps(&block.r[i]);
+				__m128 g = _mm_load_ps(&block.g[i]);
+				__m128 b = _mm_load_ps(&block.b[i]);
+				__m128 weights = _mm_load_ps(&block.weights[i]);
+
+				__m128 bestError = _mm_set1_ps(std::numeric_limits<float>::max());
+				__m128i bestIndex = _mm_setzero_si128();
+				for (unsigned int k = 0; k < colorCount; ++k)
+				{
+					__m128 dr = _mm_sub_ps(r, _mm_set1_ps(static_cast<float>(palette[k][0])));
+					__m128 dg = _mm_sub_ps(g, _mm_set1_ps(static_cast<float>(palette[k][1])));
+					__m128 db = _mm_sub_ps(b, _mm_set1_ps(static_cast<float>(palette[k][2])));
+					__m128 error = _mm_mul_ps(weights, _mm_add_ps(_mm_add_ps(_mm_mul_ps(dr, dr), _mm_mul_ps(dg, dg)), _mm_mul_ps(db, db)));
+
+					__m128i closer = _mm_castps_si128(_mm_cmplt_ps(error, bestError));
+					bestError = _mm_min_ps(error, bestError);
+					bestIndex = _mm_or_si128(_mm_and_si128(closer, _mm_set1_epi32(static_cast<int>(k))), _mm_andnot_si128(closer, bestIndex));
+				}
+
+				totalError = _mm_add_ps(totalError, bestError);
+
+				alignas(16) std::array<Int32, 4> pixelIndices;
+				_mm_store_si128(reinterpret_cast<__m128i*>(pixelIndices.data()), bestIndex);
+				for (unsigned int j = 0; j < 4; ++j)
+					indices[i + j] = static_cast<UInt8>(pixelIndices[j]);
+			}
+
+			alignas(16) std::array<float, 4> errors;
+			_mm_store_ps(errors.data(), totalError);
+
+			return errors[0] + errors[1] + errors[2] + errors[3];
+			#else
+			float totalError = 0.f;
+			for (unsigned int i = 0; i < BlockPixelCount; ++i)
+			{
+				float bestError = std::numeric_limits<float>::max();
+				for (unsigned int k = 0; k < colorCount; ++k)
+				{
+					float dr = block.r[i] - palette[k][0];
+					float dg = block.g[i] - palette[k][1];
+					float db = block.b[i] - palette[k][2];
+					float error = block.weights[i] * (dr * dr + dg * dg + db * db);
+					if (error < bestError)
+					{
+						bestError = error;
+						indices[i] = static_cast<UInt8>(k);
+					}
+				}
+
+				totalError += bestError;
+			}
+
+			return totalError;
+			#endif
+		}
+
+		unsigned int SelectChannelIndices(const UInt8* values, const ChannelPalette& palette, BlockIndices& indices)
+		{
+			#ifdef NAZARA_UTILITY_BLOCKCOMPRESSION_SSE2
+			// The sixteen values of a block fit in a single vector
+			__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+			__m128i bestError = _mm_set1_epi8(static_cast<char>(0xFF));
+			__m128i bestIndex = _mm_setzero_si128();
+			for (unsigned int k = 0; k < palette.size(); ++k)
+			{
+				__m128i entry = _mm_set1_epi8(static_cast<char>(palette[k]));
+				__m128i error = _mm_or_si128(_mm_subs_epu8(pixels, entry), _mm_subs_epu8(entry, pixels));
+
+				// There's no unsigned byte comparison, error < bestError <=> min(error, bestError) == error && error != bestError
+				__m128i notGreater = _mm_cmpeq_epi8(_mm_min_epu8(error, bestError), error);
+				__m128i closer = _mm_andnot_si128(_mm_cmpeq_epi8(error, bestError), notGreater);
+
+				bestError = _mm_min_epu8(error, bestError);
+				bestIndex = _mm_or_si128(_mm_and_si128(closer, _mm_set1_epi8(static_cast<char>(k))), _mm_andnot_si128(closer, bestIndex));
+			}
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(indices.data()), bestIndex);
+
+			__m128i zero = _mm_setzero_si128();
+			__m128i errorLow = _mm_unpacklo_epi8(bestError, zero);
+			__m128i errorHigh = _mm_unpackhi_epi8(bestError, zero);
+			__m128i squaredErrors = _mm_add_epi32(_mm_madd_epi16(errorLow, errorLow), _mm_madd_epi16(errorHigh, errorHigh));
+
+			alignas(16) std::array<UInt32, 4> errors;
+			_mm_store_si128(reinterpret_cast<__m128i*>(errors.data()), squaredErrors);
+
+			return errors[0] + errors[1] + errors[2] + errors[3];
+			#else
+			unsigned int totalError = 0;
+			for (unsigned int i = 0; i < BlockPixelCount; ++i)
+			{
+				unsigned int bestError = std::numeric_limits<unsigned int>::max();
+				for (unsigned int k = 0; k < palette.size(); ++k)
+				{
+					int difference = int(values[i]) - int(palette[k]);
+					unsigned int error = static_cast<unsigned int>(difference * difference);
+					if (error < bestError)
+					{
+						bestError = error;
+						indices[i] = static_cast<UInt8>(k);
+					}
+				}
+
+				totalError += bestError;
+			}
+
+			return totalError;
+			#endif
+		}
+
+		bool FitColorEndpoints(const ColorBlock& block, const BlockIndices& indices, bool fourColors, std::array<float, 3>& endpoint0, std::array<float, 3>& endpoint1)
+		{
+			// Least squares fitting of both endpoints, weights being the contribution of the first endpoint to each palette entry
+			constexpr std::array<float, 4> fourColorWeights = { 1.f, 0.f, 2.f / 3.f, 1.f / 3.f };
+			constexpr std::array<float, 4> threeColorWeights = { 1.f, 0.f, 0.5f, 0.f };
+			const std::array<float, 4>& weights = (fourColors) ? fourColorWeights : threeColorWeights;
+
+			float aa = 0.f;
+			float ab = 0.f;
+			float bb = 0.f;
+			std::array<float, 3> ax = { 0.f, 0.f, 0.f };
+			std::array<float, 3> bx = { 0.f, 0.f, 0.f };
+			for (unsigned int i = 0; i < BlockPixelCount; ++i)
+			{
+				if (block.weights[i] == 0.f)
+					continue;
+
+				float alpha = weights[indices[i]];
+				float beta = 1.f - alpha;
+				std::array<float, 3> color = { block.r[i], block.g[i], block.b[i] };
+
+				aa += alpha * alpha;
+				ab += alpha * beta;
+				bb += beta * beta;
+				for (unsigned int c = 0; c < 3; ++c)
+				{
+					ax[c] += alpha * color[c];
+					bx[c] += beta * color[c];
+				}
+			}
+
+			float determinant = aa * bb - ab * ab;
+			if (std::abs(determinant) < 1e-6f)
+				return false;
+
+			for (unsigned int c = 0; c < 3; ++c)
+			{
+				endpoint0[c] = (ax[c] * bb - bx[c] * ab) / determinant;
+				endpoint1[c] = (bx[c] * aa - ax[c] * ab) / determinant;
+			}
+
+			return true;
+		}
+
+		void EvaluateColorEndpoints(const ColorBlock& block, const std::array<float, 3>& endpoint0, const std::array<float, 3>& endpoint1, ColorCandidate& candidate)
+		{
+			UInt16 color0 = PackRGB565(endpoint0);
+			UInt16 color1 = PackRGB565(endpoint1);
+
+			// The four colors mode is selected by color0 > color1, swapping endpoints doesn't change the palette (apart from the order)
+			if (block.hasTransparentPixels)
+			{
+				if (color0 > color1)
+					std::swap(color0, color1);
+			}
+			else if (color0 < color1)
+				std::swap(color0, color1);
+
+			// When both endpoints are equal, DXT1 decoders use the three colors mode, the fourth palette entry must not be used
+			candidate.fourColors = (color0 > color1);
+			candidate.color0 = color0;
+			candidate.color1 = color1;
+
+			ColorPalette palette;
+			unsigned int colorCount = ComputeColorPalette(color0, color1, candidate.fourColors, palette);
+
+			candidate.error = SelectColorIndices(block, palette, colorCount, candidate.indices);
+		}
+
+		void EncodeColor(const UInt8* pixels, bool allowTransparency, UInt8* output)
+		{
+			ColorBlock block;
+			block.hasTransparentPixels = false;
+
+			float weightSum = 0.f;
+			std::array<float, 3> mean = { 0.f, 0.f, 0.f };
+			for (unsigned int i = 0; i < BlockPixelCount; ++i)
+			{
+				block.r[i] = pixels[i * 4 + 0];
+				block.g[i] = pixels[i * 4 + 1];
+				block.b[i] = pixels[i * 4 + 2];
+
+				bool transparent = (allowTransparency && pixels[i * 4 + 3] < 128);
+				block.weights[i] = (transparent) ? 0.f : 1.f;
+				block.hasTransparentPixels |= transparent;
+
+				weightSum += block.weights[i];
+				mean[0] += block.weights[i] * block.r[i];
+				mean[1] += block.weights[i] * block.g[i];
+				mean[2] += block.weights[i] * block.b[i];
+			}
+
+			UInt32 indexBits = 0;
+			if (weightSum > 0.f)
+			{
+				for (float& value : mean)
+					value /= weightSum;
+
+				// Principal axis of the colors, using power iterations on their covariance matrix
+				std::array<float, 6> covariance = { 0.f, 0.f, 0.f, 0.f, 0.f, 0.f }; //< rr, rg, rb, gg, gb, bb
+				for (unsigned int i = 0; i < BlockPixelCount; ++i)
+				{
+					float r = (block.r[i] - mean[0]) * block.weights[i];
+					float g = (block.g[i] - mean[1]) * block.weights[i];
+					float b = (block.b[i] - mean[2]) * block.weights[i];
+
+					covariance[0] += r * r;
+					covariance[1] += r * g;
+					covariance[2] += r * b;
+					covariance[3] += g * g;
+					covariance[4] += g * b;
+					covariance[5] += b * b;
+				}
+
+				// Start from the covariance row of the channel varying the most, a constant starting vector may be orthogonal to the principal axis (for example with red and blue pixels)
+				std::array<std::array<float, 3>, 3> covarianceRows = { {
+					{ covariance[0], covariance[1], covariance[2] },
+					{ covariance[1], covariance[3], covariance[4] },
+					{ covariance[2], covariance[4], covariance[5] }
+				} };
+
+				unsigned int mainChannel = 0;
+				if (covariance[3] > covariance[0])
+					mainChannel = 1;
+				if (covariance[5] > std::max(covariance[0], covariance[3]))
+					mainChannel = 2;
+
+				std::array<float, 3> axis = covarianceRows[mainChannel];
+				for (unsigned int iteration = 0; iteration < 8; ++iteration)
+				{
+					std::array<float, 3> newAxis = {
+						covariance[0] * axis[0] + covariance[1] * axis[1] + covariance[2] * axis[2],
+						covariance[1] * axis[0] + covariance[3] * axis[1] + covariance[4] * axis[2],
+						covariance[2] * axis[0] + covariance[4] * axis[1] + covariance[5] * axis[2]
+					};
+
+					float length = std::max({ std::abs(newAxis[0]), std::abs(newAxis[1]), std::abs(newAxis[2]) });
+					if (length < 1e-6f)
+						break; //< every color is the same
+
+					for (unsigned int c = 0; c < 3; ++c)
+						axis[c] = newAxis[c] / length;
+				}
+
+				// Colors at both ends of the axis are the initial endpoints
+				float minProjection = std::numeric_limits<float>::max();
+				float maxProjection = std::numeric_limits<float>::lowest();
+				std::array<float, 3> endpoint0 = mean;
+				std::array<float, 3> endpoint1 = mean;
+				for (unsigned int i = 0; i < BlockPixelCount; ++i)
+				{
+					if (block.weights[i] == 0.f)
+						continue;
+
+					float projection = block.r[i] * axis[0] + block.g[i] * axis[1] + block.b[i] * axis[2];
+					if (projection < minProjection)
+					{
+						minProjection = projection;
+						endpoint1 = { block.r[i], block.g[i], block.b[i] };
+					}
+
+					if (projection > maxProjection)
+					{
+						maxProjection = projection;
+						endpoint0 = { block.r[i], block.g[i], block.b[i] };
+					}
+				}
+
+				ColorCandidate best;
+				EvaluateColorEndpoints(block, endpoint0, endpoint1, best);
+
+				// Refine endpoints from the chosen indices
+				ColorCandidate candidate = best;
+				for (unsigned int iteration = 0; iteration < ColorRefinementCount && best.error > 0.f; ++iteration)
+				{
+					if (!FitColorEndpoints(block, candidate.indices, candidate.fourColors, endpoint0, endpoint1))
+						break;
+
+					EvaluateColorEndpoints(block, endpoint0, endpoint1, candidate);
+					if (candidate.error >= best.error)
+						break;
+
+					best = candidate;
+				}
+
+				WriteUInt16(&output[0], best.color0);
+				WriteUInt16(&output[2], best.color1);
+
+				for (unsigned int i = 0; i < BlockPixelCount; ++i)
+				{
+					UInt32 index = (block.weights[i] == 0.f) ? 3 : best.indices[i];
+					indexBits |= index << (i * 2);
+				}
+			}
+			else
+			{
+				// Fully transparent block
+				WriteUInt16(&output[0], 0);
+				WriteUInt16(&output[2], 0);
+				indexBits = 0xFFFFFFFF;
+			}
+
+			for (unsigned int i = 0; i < 4; ++i)
+				output[4 + i] = static_cast<UInt8>(indexBits >> (i * 8));
+		}
+
+		void EncodeChannel(const UInt8* pixels, unsigned int channel, UInt8* output)
+		{
+			std::array<UInt8, BlockPixelCount> values;
+			for (unsigned int i = 0; i < BlockPixelCount; ++i)
+				values[i] = pixels[i * 4 + channel];
+
+			auto [minIt, maxIt] = std::minmax_element(values.begin(), values.end());
+			UInt8 minValue = *minIt;
+			UInt8 maxValue = *maxIt;
+
+			ChannelPalette palette;
+			BlockIndices indices;
+			UInt8 value0;
+			UInt8 value1;
+			if (minValue != maxValue)
+			{
+				// Eight values mode, interpolating between the extremes
+				value0 = maxValue;
+				value1 = minValue;
+				ComputeChannelPalette(value0, value1, palette);
+				unsigned int error = SelectChannelIndices(values.data(), palette, indices);
+
+				// Six values mode, with exact 0 and 255 values, may be better when the block contains those
+				if (error > 0 && (minValue == 0 || maxValue == 255))
+				{
+					UInt8 innerMin = 255;
+					UInt8 innerMax = 0;
+					for (UInt8 value : values)
+					{
+						if (value != 0 && value != 255)
+						{
+							innerMin = std::min(innerMin, value);
+							innerMax = std::max(innerMax, value);
+						}
+					}
+
+					if (innerMin > innerMax)
+						innerMin = innerMax = 0; //< only 0 and 255 values
+
+					ChannelPalette innerPalette;
+					BlockIndices innerIndices;
+					ComputeChannelPalette(innerMin, innerMax, innerPalette);
+					if (SelectChannelIndices(values.data(), innerPalette, innerIndices) < error)
+					{
+						value0 = innerMin;
+						value1 = innerMax;
+						indices = innerIndices;
+					}
+				}
+			}
+			else
+			{
+				value0 = maxValue;
+				value1 = maxValue;
+				indices.fill(0);
+			}
+
+			output[0] = value0;
+			output[1] = value1;
+
+			UInt64 indexBits = 0;
+			for (unsigned int i = 0; i < BlockPixelCount; ++i)
+				indexBits |= UInt64(indices[i]) << (i * 3);
+
+			for (unsigned int i = 0; i < 6; ++i)
+				output[2 + i] = static_cast<UInt8>(indexBits >> (i * 8));
+		}
+
+		void EncodeExplicitAlpha(const UInt8* pixels, UInt8* output)
+		{
+			for (unsigned int i = 0; i < BlockPixelCount; i += 2)
+			{
+				unsigned int alpha0 = (pixels[i * 4 + 3] * 15 + 127) / 255;
+				unsigned int alpha1 = (pixels[(i + 1) * 4 + 3] * 15 + 127) / 255;
+
+				output[i / 2] = static_cast<UInt8>(alpha0 | (alpha1 << 4));
+			}
+		}
+
+		void DecodeColor(const UInt8* block, bool allowTransparency, UInt8* pixels)
+		{
+			UInt16 color0 = ReadUInt16(&block[0]);
+			UInt16 color1 = ReadUInt16(&block[2]);
+			bool fourColors = (!allowTransparency || color0 > color1);
+
+			ColorPalette palette;
+			ComputeColorPalette(color0, color1, fourColors, palette);
+
+			for (unsigned int i = 0; i < BlockPixelCount; ++i)
+			{
+				unsigned int index = (block[4 + i / 4] >> ((i % 4) * 2)) & 0x3;
+				for (unsigned int c = 0; c < 3; ++c)
+					pixels[i * 4 + c] = static_cast<UInt8>(palette[index][c]);
+
+				pixels[i * 4 + 3] = (!fourColors && index == 3) ? 0 : 255;
+			}
+		}
+
+		void DecodeChannel(const UInt8* block, unsigned int channel, UInt8* pixels)
+		{
+			ChannelPalette palette;
+			ComputeChannelPalette(block[0], block[1], palette);
+
+			UInt64 indexBits = 0;
+			for (unsigned int i = 0; i < 6; ++i)
+				indexBits |= UInt64(block[2 + i]) << (i * 8);
+
+			for (unsigned int i = 0; i < BlockPixelCount; ++i)
+				pixels[i * 4 + channel] = palette[(indexBits >> (i * 3)) & 0x7];
+		}
+
+		void FetchBlock(const UInt8* pixels, unsigned int width, unsigned int height, unsigned int blockX, unsigned int blockY, UInt8* blockPixels)
+		{
+			// Pixels outside of the image are clamped to the edge
+			for (unsigned int y = 0; y < BlockDim; ++y)
+			{
+				unsigned int pixelY = std::min(blockY * BlockDim + y, height - 1);
+				for (unsigned int x = 0; x < BlockDim; ++x)
+				{
+					unsigned int pixelX = std::min(blockX * BlockDim + x, width - 1);
+					std::memcpy(&blockPixels[(y * BlockDim + x) * 4], &pixels[(std::size_t(pixelY) * width + pixelX) * 4], 4);
+				}
+			}
+		}
+
+		void StoreBlock(const UInt8* blockPixels, unsigned int width, unsigned int height, unsigned int blockX, unsigned int blockY, UInt8* pixels)
+		{
+			unsigned int blockWidth = std::min(BlockDim, width - blockX * BlockDim);
+			unsigned int blockHeight = std::min(BlockDim, height - blockY * BlockDim);
+			for (unsigned int y = 0; y < blockHeight; ++y)
+			{
+				std::size_t pixelY = blockY * BlockDim + y;
+				std::memcpy(&pixels[(pixelY * width + blockX * BlockDim) * 4], &blockPixels[y * BlockDim * 4], blockWidth * 4);
+			}
+		}
+	}
+
+	bool IsFormatSupported(PixelFormat format)
+	{
+		switch (format)
+		{
+			case PixelFormat::BC4:
+			case PixelFormat::BC5:
+			case PixelFormat::DXT1:
+			case PixelFormat::DXT3:
+			case PixelFormat::DXT5:
+				return true;
+
+			default:
+				return false;
+		}
+	}
+
+	void CompressBlock(PixelFormat format, const UInt8* pixels, UInt8* block)
+	{
+		switch (format)
+		{
+			case PixelFormat::BC4:
+				EncodeChannel(pixels, 0, block);
+				break;
+
+			case PixelFormat::BC5:
+				EncodeChannel(pixels, 0, &block[0]);
+				EncodeChannel(pixels, 1, &block[8]);
+				break;
+
+			case PixelFormat::DXT1:
+				EncodeColor(pixels, true, block);
+				break;
+
+			case PixelFormat::DXT3:
+				EncodeExplicitAlpha(pixels, &block[0]);
+				EncodeColor(pixels, false, &block[8]);
+				break;
+
+			case PixelFormat::DXT5:
+				EncodeChannel(pixels, 3, &block[0]);
+				EncodeColor(pixels, false, &block[8]);
+				break;
+
+			default:
+				NazaraError("Pixel format " + PixelFormatInfo::GetName(format) + " cannot be block compressed");
+				break;
+		}
+	}
+
+	void DecompressBlock(PixelFormat format, const UInt8* block, UInt8* pixels)
+	{
+		switch (format)
+		{
+			case PixelFormat::BC4:
+			case PixelFormat::BC5:
+			{
+				for (unsigned int i = 0; i < BlockPixelCount; ++i)
+				{
+					pixels[i * 4 + 1] = 0;
+					pixels[i * 4 + 2] = 0;
+					pixels[i * 4 + 3] = 255;
+				}
+
+				DecodeChannel(&block[0], 0, pixels);
+				if (format == PixelFormat::BC5)
+					DecodeChannel(&block[8], 1, pixels);
+
+				break;
+			}
+
+			case PixelFormat::DXT1:
+				DecodeColor(block, true, pixels);
+				break;
+
+			case PixelFormat::DXT3:
+			{
+				DecodeColor(&block[8], false, pixels);
+				for (unsigned int i = 0; i < BlockPixelCount; ++i)
+					pixels[i * 4 + 3] = static_cast<UInt8>(((block[i / 2] >> ((i % 2) * 4)) & 0xF) * 17);
+
+				break;
+			}
+
+			case PixelFormat::DXT5:
+				DecodeColor(&block[8], false, pixels);
+				DecodeChannel(&block[0], 3, pixels);
+				break;
+
+			default:
+				NazaraError("Pixel format " + PixelFormatInfo::GetName(format) + " cannot be block decompressed");
+				break;
+		}
+	}
+
+	void CompressLevel(PixelFormat format, const UInt8* pixels, unsigned int width, unsigned int height, unsigned int depth, UInt8* blocks)
+	{
+		NazaraAssert(IsFormatSupported(format), "Unsupported format");
+
+		unsigned int blockCountX = (width + BlockDim - 1) / BlockDim;
+		unsigned int blockCountY = (height + BlockDim - 1) / BlockDim;
+		std::size_t blockSize = GetBlockSize(format);
+		std::size_t blockRowSize = blockCountX * blockSize;
+		std::size_t sliceSize = std::size_t(width) * height * 4;
+
+		// Block rows of every slice are compressed in parallel
+		std::size_t blockRowCount = std::size_t(blockCountY) * depth;
+		ParallelForRange(0, blockRowCount, [&](std::size_t begin, std::size_t end)
+		{
+			alignas(16) std::array<UInt8, BlockPixelCount * 4> blockPixels;
+			for (std::size_t row = begin; row < end; ++row)
+			{
+				const UInt8* slicePixels = &pixels[(row / blockCountY) * sliceSize];
+				unsigned int blockY = static_cast<unsigned int>(row % blockCountY);
+
+				UInt8* dst = &blocks[row * blockRowSize];
+				for (unsigned int blockX = 0; blockX < blockCountX; ++blockX)
+				{
+					FetchBlock(slicePixels, width, height, blockX, blockY, blockPixels.data());
+					CompressBlock(format, blockPixels.data(), &dst[blockX * blockSize]);
+				}
+			}
+		}, ComputeGrainSize(blockRowCount, std::max<std::size_t>(256 / blockCountX, 1)));
+	}
+
+	void DecompressLevel(PixelFormat format, const UInt8* blocks, unsigned int width, unsigned int height, unsigned int depth, UInt8* pixels)
+	{
+		NazaraAssert(IsFormatSupported(format), "Unsupported format");
+
+		unsigned int blockCountX = (width + BlockDim - 1) / BlockDim;
+		unsigned int blockCountY = (height + BlockDim - 1) / BlockDim;
+		std::size_t blockSize = GetBlockSize(format);
+		std::size_t blockRowSize = blockCountX * blockSize;
+		std::size_t sliceSize = std::size_t(width) * height * 4;
+
+		std::size_t blockRowCount = std::size_t(blockCountY) * depth;
+		ParallelForRange(0, blockRowCount, [&](std::size_t begin, std::size_t end)
+		{
+			alignas(16) std::array<UInt8, BlockPixelCount * 4> blockPixels;
+			for (std::size_t row = begin; row < end; ++row)
+			{
+				UInt8* slicePixels = &pixels[(row / blockCountY) * sliceSize];
+				unsigned int blockY = static_cast<unsigned int>(row % blockCountY);
+
+				const UInt8* src = &blocks[row * blockRowSize];
+				for (unsigned int blockX = 0; blockX < blockCountX; ++blockX)
+				{
+					DecompressBlock(format, &src[blockX * blockSize], blockPixels.data());
+					StoreBlock(blockPixels.data(), width, height, blockX, blockY, slicePixels);
+				}
+			}
+		}, ComputeGrainSize(blockRowCount, std::max<std::size_t>(1024 / blockCountX, 1)));
+	}
+}
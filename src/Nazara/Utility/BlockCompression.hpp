@@ -0,0 +1,29 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_UTILITY_BLOCKCOMPRESSION_HPP
+#define NAZARA_UTILITY_BLOCKCOMPRESSION_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Utility/Enums.hpp>
+
+// Encoders and decoders of block compressed formats (DXT1/BC1, DXT3/BC2, DXT5/BC3, BC4 and BC5), working on 4x4 blocks of RGBA8 pixels.
+// BC4 compresses the red channel and BC5 the red and green channels, other channels being decoded as zero (and alpha as opaque).
+namespace Nz::BlockCompression
+{
+	constexpr unsigned int BlockDim = 4;
+
+	bool IsFormatSupported(PixelFormat format);
+
+	void CompressBlock(PixelFormat format, const UInt8* pixels, UInt8* block);
+	void DecompressBlock(PixelFormat format, const UInt8* block, UInt8* pixels);
+
+	// Compress/decompress every slice of a level, block rows being processed in parallel
+	void CompressLevel(PixelFormat format, const UInt8* pixels, unsigned int width, unsigned int height, unsigned int depth, UInt8* blocks);
+	void DecompressLevel(PixelFormat format, const UInt8* blocks, unsigned int width, unsigned int height, unsigned int depth, UInt8* pixels);
+}
+
+#endif // NAZARA_UTILITY_BLOCKCOMPRESSION_HPP
@@ -86,6 +86,10 @@ namespace Nz
 		D3DFMT_DXT3                 = DDS_FourCC('D', 'X', 'T', '3'),
 		D3DFMT_DXT4                 = DDS_FourCC('D', 'X', 'T', '4'),
 		D3DFMT_DXT5                 = DDS_FourCC('D', 'X', 'T', '5'),
+		D3DFMT_ATI1                 = DDS_FourCC('A', 'T', 'I', '1'),
+		D3DFMT_ATI2                 = DDS_FourCC('A', 'T', 'I', '2'),
+		D3DFMT_BC4U                 = DDS_FourCC('B', 'C', '4', 'U'),
+		D3DFMT_BC5U                 = DDS_FourCC('B', 'C', '5', 'U'),
 
 		D3DFMT_D16_LOCKABLE         = 70,
 		D3DFMT_D32                  = 71,
@@ -369,6 +373,10 @@ namespace Nz
 		UInt32 reserved;
 	};
 
+	NAZARA_UTILITY_API bool Serialize(SerializationContext& context, const DDSHeader& header);
+	NAZARA_UTILITY_API bool Serialize(SerializationContext& context, const DDSHeaderDX10Ext& header);
+	NAZARA_UTILITY_API bool Serialize(SerializationContext& context, const DDSPixelFormat& pixelFormat);
+
 	NAZARA_UTILITY_API bool Unserialize(SerializationContext& context, DDSHeader* header);
 	NAZARA_UTILITY_API bool Unserialize(SerializationContext& context, DDSHeaderDX10Ext* header);
 	NAZARA_UTILITY_API bool Unserialize(SerializationContext& context, DDSPixelFormat* pixelFormat);
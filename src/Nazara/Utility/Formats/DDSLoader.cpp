@@ -76,7 +76,8 @@ namespace Nz
 				if (header.flags & DDSD_DEPTH)
 					depth = std::max(header.depth, 1U);
 
-				unsigned int levelCount = (parameters.levelCount > 0) ? std::min(parameters.levelCount, static_cast<UInt8>(header.levelCount)) : header.levelCount;
+				UInt32 fileLevelCount = (header.flags & DDSD_MIPMAPCOUNT) ? std::max(header.levelCount, 1U) : 1U;
+				unsigned int levelCount = (parameters.levelCount > 0) ? std::min<UInt32>(parameters.levelCount, fileLevelCount) : fileLevelCount;
 
 				// First, identify the type
 				ImageType type;
@@ -88,31 +89,73 @@ namespace Nz
 				if (!IdentifyPixelFormat(header, headerDX10, &format))
 					return nullptr;
 
-				std::shared_ptr<Image> image = std::make_shared<Image>(type, format, width, height, depth, levelCount);
+				// Array layers and cubemap faces are stored one after the other, each one with its whole mipmap chain
+				unsigned int layerCount = 1;
+				switch (type)
+				{
+					case ImageType::Cubemap:
+						layerCount = 6;
+						break;
+
+					case ImageType::E1D_Array:
+						// Layers of 1D arrays are the rows of the image
+						layerCount = headerDX10.arraySize;
+						height = layerCount;
+						break;
+
+					case ImageType::E2D_Array:
+						layerCount = headerDX10.arraySize;
+						depth = layerCount;
+						break;
+
+					default:
+						break;
+				}
 
-				// Read all mipmap levels
-				for (unsigned int i = 0; i < image->GetLevelCount(); i++)
+				// Image levels are smaller than the previous one in every dimension, layers included
+				if ((type == ImageType::E1D_Array || type == ImageType::E2D_Array) && levelCount > 1)
 				{
-					std::size_t byteCount = PixelFormatInfo::ComputeSize(format, width, height, depth);
+					NazaraError("Array textures with mipmaps are not supported, only their first level can be loaded (using a level count of 1)");
+					return nullptr;
+				}
 
-					UInt8* ptr = image->GetPixels(0, 0, 0, i);
+				std::shared_ptr<Image> image = std::make_shared<Image>(type, format, width, height, depth, levelCount);
 
-					if (byteStream.Read(ptr, byteCount) != byteCount)
+				for (unsigned int layer = 0; layer < layerCount; ++layer)
+				{
+					for (unsigned int i = 0; i < fileLevelCount; i++)
 					{
-						NazaraError("Failed to read level #" + NumberToString(i));
-						return nullptr;
-					}
+						unsigned int levelWidth = std::max(width >> i, 1U);
+						unsigned int levelHeight = (type == ImageType::E1D_Array) ? 1U : std::max(height >> i, 1U);
+						unsigned int levelDepth = (layerCount > 1) ? 1U : std::max(depth >> i, 1U);
 
-					if (width > 1)
-						width >>= 1;
+						std::size_t byteCount = PixelFormatInfo::ComputeSize(format, levelWidth, levelHeight, levelDepth);
+						if (i >= levelCount)
+						{
+							// Skip levels we're not interested in
+							if (!stream.SetCursorPos(stream.GetCursorPos() + byteCount))
+							{
+								NazaraError("Failed to skip level #" + NumberToString(i));
+								return nullptr;
+							}
 
-					if (height > 1)
-						height >>= 1;
+							continue;
+						}
 
-					if (depth > 1)
-						depth >>= 1;
-				}
+						UInt8* ptr = (type == ImageType::E1D_Array) ? image->GetPixels(0, layer, 0, i) : image->GetPixels(0, 0, layer, i);
+						if (!ptr)
+						{
+							NazaraError("Failed to get level #" + NumberToString(i) + " of layer #" + NumberToString(layer));
+							return nullptr;
+						}
 
+						if (byteStream.Read(ptr, byteCount) != byteCount)
+						{
+							NazaraError("Failed to read level #" + NumberToString(i));
+							return nullptr;
+						}
+					}
+				}
 
 				if (parameters.loadFormat != PixelFormat::Undefined)
 					image->Convert(parameters.loadFormat);
@@ -199,7 +242,17 @@ namespace Nz
 							break;
 
 						case D3DFMT_DXT5:
-							*format = PixelFormat::DXT3;
+							*format = PixelFormat::DXT5;
+							break;
+
+						case D3DFMT_ATI1:
+						case D3DFMT_BC4U:
+							*format = PixelFormat::BC4;
+							break;
+
+						case D3DFMT_ATI2:
+						case D3DFMT_BC5U:
+							*format = PixelFormat::BC5;
 							break;
 
 						case D3DFMT_DX10:
@@ -232,11 +285,31 @@ namespace Nz
 								case DXGI_FORMAT_R16G16B16A16_UNORM:
 									*format = PixelFormat::RGBA16UI;
 									break;
+								case DXGI_FORMAT_R8G8B8A8_UNORM:
+									*format = PixelFormat::RGBA8;
+									break;
+								case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:
+									*format = PixelFormat::RGBA8_SRGB;
+									break;
+								case DXGI_FORMAT_BC1_UNORM:
+									*format = PixelFormat::DXT1;
+									break;
+								case DXGI_FORMAT_BC2_UNORM:
+									*format = PixelFormat::DXT3;
+									break;
+								case DXGI_FORMAT_BC3_UNORM:
+									*format = PixelFormat::DXT5;
+									break;
+								case DXGI_FORMAT_BC4_UNORM:
+									*format = PixelFormat::BC4;
+									break;
+								case DXGI_FORMAT_BC5_UNORM:
+									*format = PixelFormat::BC5;
+									break;
 
 								default:
-									//TODO
-									NazaraError("TODO");
-									break;
+									NazaraError("Unhandled DXGI format (" + NumberToString(UInt32(headerExt.dxgiFormat)) + ')');
+									return false;
 							}
 							break;
 						}
@@ -0,0 +1,232 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/Formats/DDSSaver.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <Nazara/Utility/Formats/DDSConstants.hpp>
+#include <cstring>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		bool FormatQuerier(const std::string_view& extension)
+		{
+			return extension == "dds";
+		}
+
+		bool SetupPixelFormat(PixelFormat format, DDSPixelFormat* pixelFormat, DXGI_FORMAT* dxgiFormat)
+		{
+			pixelFormat->size = 32;
+			*dxgiFormat = DXGI_FORMAT_UNKNOWN;
+
+			auto SetupMasks = [&](UInt32 bpp, UInt32 redMask, UInt32 greenMask, UInt32 blueMask, UInt32 alphaMask)
+			{
+				pixelFormat->flags = DDPF_RGB;
+				if (alphaMask != 0)
+					pixelFormat->flags |= DDPF_ALPHAPIXELS;
+
+				pixelFormat->bpp = bpp;
+				pixelFormat->redMask = redMask;
+				pixelFormat->greenMask = greenMask;
+				pixelFormat->blueMask = blueMask;
+				pixelFormat->alphaMask = alphaMask;
+			};
+
+			switch (format)
+			{
+				case PixelFormat::DXT1:
+					pixelFormat->flags = DDPF_FOURCC;
+					pixelFormat->fourCC = D3DFMT_DXT1;
+					return true;
+
+				case PixelFormat::DXT3:
+					pixelFormat->flags = DDPF_FOURCC;
+					pixelFormat->fourCC = D3DFMT_DXT3;
+					return true;
+
+				case PixelFormat::DXT5:
+					pixelFormat->flags = DDPF_FOURCC;
+					pixelFormat->fourCC = D3DFMT_DXT5;
+					return true;
+
+				// Formats without a legacy FourCC use the DX10 extended header
+				case PixelFormat::BC4:
+					*dxgiFormat = DXGI_FORMAT_BC4_UNORM;
+					break;
+
+				case PixelFormat::BC5:
+					*dxgiFormat = DXGI_FORMAT_BC5_UNORM;
+					break;
+
+				case PixelFormat::RGB32F:
+					*dxgiFormat = DXGI_FORMAT_R32G32B32_FLOAT;
+					break;
+
+				case PixelFormat::RGBA32F:
+					*dxgiFormat = DXGI_FORMAT_R32G32B32A32_FLOAT;
+					break;
+
+				case PixelFormat::BGR8:
+					SetupMasks(24, 0x00FF0000, 0x0000FF00, 0x000000FF, 0);
+					return true;
+
+				case PixelFormat::BGRA8:
+					SetupMasks(32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+					return true;
+
+				case PixelFormat::RGB8:
+					SetupMasks(24, 0x000000FF, 0x0000FF00, 0x00FF0000, 0);
+					return true;
+
+				case PixelFormat::RGBA8:
+					SetupMasks(32, 0x000000FF, 0x0000FF00, 0x00FF0000, 0xFF000000);
+					return true;
+
+				default:
+					return false;
+			}
+
+			pixelFormat->flags = DDPF_FOURCC;
+			pixelFormat->fourCC = D3DFMT_DX10;
+			return true;
+		}
+
+		bool SaveToStream(const Image& image, const std::string& format, Stream& stream, const ImageParams& parameters)
+		{
+			NazaraUnused(format);
+			NazaraUnused(parameters);
+
+			if (!image.IsValid())
+			{
+				NazaraError("Invalid image");
+				return false;
+			}
+
+			ImageType type = image.GetType();
+			if (type != ImageType::E1D && type != ImageType::E2D && type != ImageType::E3D && type != ImageType::Cubemap)
+			{
+				NazaraError("Image type 0x" + NumberToString(UnderlyingCast(type), 16) + " is not in a supported format");
+				return false;
+			}
+
+			Image tempImage(image); //< We're using COW here to prevent Image copy unless required
+
+			DDSHeader header;
+			std::memset(&header, 0, sizeof(header));
+
+			DXGI_FORMAT dxgiFormat;
+			if (!SetupPixelFormat(tempImage.GetFormat(), &header.format, &dxgiFormat))
+			{
+				// Formats which can't be stored as-is are saved as RGBA8
+				if (!tempImage.Convert(PixelFormat::RGBA8))
+				{
+					NazaraError("Failed to convert image to suitable format");
+					return false;
+				}
+
+				SetupPixelFormat(PixelFormat::RGBA8, &header.format, &dxgiFormat);
+			}
+
+			PixelFormat pixelFormat = tempImage.GetFormat();
+			UInt8 levelCount = tempImage.GetLevelCount();
+
+			header.size = 124;
+			header.flags = DDSD_CAPS | DDSD_WIDTH | DDSD_HEIGHT | DDSD_PIXELFORMAT | DDSD_MIPMAPCOUNT;
+			header.width = tempImage.GetWidth();
+			header.height = tempImage.GetHeight();
+			header.levelCount = levelCount;
+			header.ddsCaps[0] = DDSCAPS_TEXTURE;
+
+			if (PixelFormatInfo::IsCompressed(pixelFormat))
+			{
+				header.flags |= DDSD_LINEARSIZE;
+				header.pitch = UInt32(PixelFormatInfo::ComputeSize(pixelFormat, header.width, header.height, 1));
+			}
+			else
+			{
+				header.flags |= DDSD_PITCH;
+				header.pitch = header.width * PixelFormatInfo::GetBytesPerPixel(pixelFormat);
+			}
+
+			if (levelCount > 1)
+				header.ddsCaps[0] |= DDSCAPS_COMPLEX | DDSCAPS_MIPMAP;
+
+			DDSHeaderDX10Ext headerDX10;
+			headerDX10.dxgiFormat = dxgiFormat;
+			headerDX10.miscFlag = 0;
+			headerDX10.arraySize = 1;
+			headerDX10.reserved = 0;
+
+			unsigned int faceCount = 1;
+			switch (type)
+			{
+				case ImageType::Cubemap:
+					faceCount = 6;
+					header.ddsCaps[0] |= DDSCAPS_COMPLEX;
+					header.ddsCaps[1] = DDSCAPS2_CUBEMAP | DDSCAPS2_CUBEMAP_ALLFACES;
+					headerDX10.miscFlag = D3D10_RESOURCE_MISC_TEXTURECUBE;
+					headerDX10.resourceDimension = D3D10_RESOURCE_DIMENSION_TEXTURE2D;
+					break;
+
+				case ImageType::E1D:
+					headerDX10.resourceDimension = D3D10_RESOURCE_DIMENSION_TEXTURE1D;
+					break;
+
+				case ImageType::E3D:
+					header.flags |= DDSD_DEPTH;
+					header.depth = tempImage.GetDepth();
+					header.ddsCaps[0] |= DDSCAPS_COMPLEX;
+					header.ddsCaps[1] = DDSCAPS2_VOLUME;
+					headerDX10.resourceDimension = D3D10_RESOURCE_DIMENSION_TEXTURE3D;
+					break;
+
+				default:
+					headerDX10.resourceDimension = D3D10_RESOURCE_DIMENSION_TEXTURE2D;
+					break;
+			}
+
+			ByteStream byteStream(&stream);
+			byteStream.SetDataEndianness(Endianness::LittleEndian);
+
+			byteStream << DDS_Magic << header;
+			if (header.format.fourCC == D3DFMT_DX10)
+				byteStream << headerDX10;
+
+			// Cubemap faces are stored one after the other, each one with its whole mipmap chain
+			for (unsigned int face = 0; face < faceCount; ++face)
+			{
+				for (UInt8 level = 0; level < levelCount; ++level)
+				{
+					unsigned int depth = (faceCount > 1) ? 1 : tempImage.GetDepth(level);
+					std::size_t byteCount = PixelFormatInfo::ComputeSize(pixelFormat, tempImage.GetWidth(level), tempImage.GetHeight(level), depth);
+
+					if (byteStream.Write(tempImage.GetConstPixels(0, 0, face, level), byteCount) != byteCount)
+					{
+						NazaraError("Failed to write level #" + NumberToString(level));
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+	}
+
+	namespace Loaders
+	{
+		ImageSaver::Entry GetImageSaver_DDS()
+		{
+			ImageSaver::Entry entry;
+			entry.formatSupport = FormatQuerier;
+			entry.streamSaver = SaveToStream;
+
+			return entry;
+		}
+	}
+}
@@ -0,0 +1,18 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_FORMATS_DDSSAVER_HPP
+#define NAZARA_FORMATS_DDSSAVER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Utility/Image.hpp>
+
+namespace Nz::Loaders
+{
+	ImageSaver::Entry GetImageSaver_DDS();
+}
+
+#endif // NAZARA_FORMATS_DDSSAVER_HPP
@@ -45,6 +45,18 @@ namespace Nz
 			});
 		}
 
+		// Buffer reads so lines can be read without seeking back, reset it at the end
+		Nz::CallOnExit resetBuffering;
+		if (!stream.IsBufferingEnabled() && !stream.IsMemoryMapped() && !stream.IsSequential())
+		{
+			stream.EnableBuffering(true);
+
+			resetBuffering.Reset([&stream] ()
+			{
+				stream.EnableBuffering(false);
+			});
+		}
+
 		m_keepLastLine = false;
 		m_lineCount = 0;
 		m_materials.clear();
@@ -637,7 +649,7 @@ namespace Nz
 
 				m_lineCount++;
 
-				m_currentLine = m_currentStream->ReadLine();
+				m_currentLine = m_currentStream->ReadLineView();
 				if (std::size_t p = m_currentLine.find('#'); p != m_currentLine.npos)
 				{
 					if (p > 0)
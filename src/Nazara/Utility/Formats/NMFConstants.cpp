@@ -0,0 +1,138 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/Formats/NMFConstants.hpp>
+#include <Nazara/Core/Algorithm.hpp>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	bool Serialize(SerializationContext& context, const NMFBlob& blob)
+	{
+		if (!Serialize(context, blob.offset))
+			return false;
+		if (!Serialize(context, blob.size))
+			return false;
+		if (!Serialize(context, blob.storedSize))
+			return false;
+
+		return true;
+	}
+
+	bool Serialize(SerializationContext& context, const NMFHeader& header)
+	{
+		if (!Serialize(context, header.magic))
+			return false;
+		if (!Serialize(context, header.version))
+			return false;
+		if (!Serialize(context, header.flags))
+			return false;
+		if (!Serialize(context, UnderlyingCast(header.animationType)))
+			return false;
+		if (!Serialize(context, header.declarationCount))
+			return false;
+		if (!Serialize(context, header.materialCount))
+			return false;
+		if (!Serialize(context, header.subMeshCount))
+			return false;
+		if (!Serialize(context, header.jointCount))
+			return false;
+		if (!Serialize(context, header.dataOffset))
+			return false;
+		if (!Serialize(context, header.dataSize))
+			return false;
+		if (!Serialize(context, header.aabb))
+			return false;
+
+		return true;
+	}
+
+	bool Serialize(SerializationContext& context, const NMFSubMesh& subMesh)
+	{
+		if (!Serialize(context, subMesh.aabb))
+			return false;
+		if (!Serialize(context, subMesh.indices))
+			return false;
+		if (!Serialize(context, subMesh.vertices))
+			return false;
+		if (!Serialize(context, subMesh.declarationIndex))
+			return false;
+		if (!Serialize(context, subMesh.indexCount))
+			return false;
+		if (!Serialize(context, subMesh.materialIndex))
+			return false;
+		if (!Serialize(context, subMesh.vertexCount))
+			return false;
+		if (!Serialize(context, subMesh.largeIndices))
+			return false;
+
+		return true;
+	}
+
+	bool Unserialize(SerializationContext& context, NMFBlob* blob)
+	{
+		if (!Unserialize(context, &blob->offset))
+			return false;
+		if (!Unserialize(context, &blob->size))
+			return false;
+		if (!Unserialize(context, &blob->storedSize))
+			return false;
+
+		return true;
+	}
+
+	bool Unserialize(SerializationContext& context, NMFHeader* header)
+	{
+		if (!Unserialize(context, &header->magic))
+			return false;
+		if (!Unserialize(context, &header->version))
+			return false;
+		if (!Unserialize(context, &header->flags))
+			return false;
+
+		UInt32 enumValue;
+		if (!Unserialize(context, &enumValue))
+			return false;
+		header->animationType = static_cast<NMFAnimationType>(enumValue);
+
+		if (!Unserialize(context, &header->declarationCount))
+			return false;
+		if (!Unserialize(context, &header->materialCount))
+			return false;
+		if (!Unserialize(context, &header->subMeshCount))
+			return false;
+		if (!Unserialize(context, &header->jointCount))
+			return false;
+		if (!Unserialize(context, &header->dataOffset))
+			return false;
+		if (!Unserialize(context, &header->dataSize))
+			return false;
+		if (!Unserialize(context, &header->aabb))
+			return false;
+
+		return true;
+	}
+
+	bool Unserialize(SerializationContext& context, NMFSubMesh* subMesh)
+	{
+		if (!Unserialize(context, &subMesh->aabb))
+			return false;
+		if (!Unserialize(context, &subMesh->indices))
+			return false;
+		if (!Unserialize(context, &subMesh->vertices))
+			return false;
+		if (!Unserialize(context, &subMesh->declarationIndex))
+			return false;
+		if (!Unserialize(context, &subMesh->indexCount))
+			return false;
+		if (!Unserialize(context, &subMesh->materialIndex))
+			return false;
+		if (!Unserialize(context, &subMesh->vertexCount))
+			return false;
+		if (!Unserialize(context, &subMesh->largeIndices))
+			return false;
+
+		return true;
+	}
+}
@@ -0,0 +1,84 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_LOADERS_NMF_CONSTANTS_HPP
+#define NAZARA_LOADERS_NMF_CONSTANTS_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Core/SerializationContext.hpp>
+#include <Nazara/Math/Box.hpp>
+#include <Nazara/Utility/Config.hpp>
+
+// Nazara Mesh Format (.nmf), a binary mesh container storing final vertex/index buffers
+//
+// Layout (little-endian):
+// - NMFHeader
+// - Vertex declarations, animation path, materials, skeleton joints and submeshes descriptions
+// - Padding up to header.dataOffset (aligned to NMF_DataAlignment)
+// - Raw (or LZ4 compressed) vertex and index buffers contents, each one aligned to NMF_DataAlignment
+//
+// Buffers contents are stored as they are in memory, allowing them to be copied (or decompressed) straight into buffers.
+namespace Nz
+{
+	constexpr UInt32 NMF_Magic = 0x20464D4E; // "NMF "
+	constexpr UInt32 NMF_Version = 1;
+	constexpr UInt64 NMF_DataAlignment = 16;
+
+	enum NMFFlags : UInt32
+	{
+		NMFFlag_LZ4 = 0x1 //< Some blobs may be LZ4 compressed (when their stored size is different from their size)
+	};
+
+	enum class NMFAnimationType : UInt32
+	{
+		Static   = 0,
+		Skeletal = 1
+	};
+
+	struct NMFHeader
+	{
+		UInt32 magic;
+		UInt32 version;
+		UInt32 flags;
+		NMFAnimationType animationType;
+		UInt32 declarationCount;
+		UInt32 materialCount;
+		UInt32 subMeshCount;
+		UInt32 jointCount;
+		UInt64 dataOffset;
+		UInt64 dataSize;
+		Boxf aabb;
+	};
+
+	struct NMFBlob
+	{
+		UInt64 offset; //< relative to header.dataOffset
+		UInt64 size;
+		UInt64 storedSize;
+	};
+
+	struct NMFSubMesh
+	{
+		Boxf aabb;
+		NMFBlob indices;
+		NMFBlob vertices;
+		UInt32 declarationIndex;
+		UInt32 indexCount;
+		UInt32 materialIndex;
+		UInt32 vertexCount;
+		UInt8 largeIndices;
+	};
+
+	NAZARA_UTILITY_API bool Serialize(SerializationContext& context, const NMFBlob& blob);
+	NAZARA_UTILITY_API bool Serialize(SerializationContext& context, const NMFHeader& header);
+	NAZARA_UTILITY_API bool Serialize(SerializationContext& context, const NMFSubMesh& subMesh);
+
+	NAZARA_UTILITY_API bool Unserialize(SerializationContext& context, NMFBlob* blob);
+	NAZARA_UTILITY_API bool Unserialize(SerializationContext& context, NMFHeader* header);
+	NAZARA_UTILITY_API bool Unserialize(SerializationContext& context, NMFSubMesh* subMesh);
+}
+
+#endif // NAZARA_LOADERS_NMF_CONSTANTS_HPP
@@ -0,0 +1,506 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/Formats/NMFLoader.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Utility/IndexBuffer.hpp>
+#include <Nazara/Utility/Joint.hpp>
+#include <Nazara/Utility/Mesh.hpp>
+#include <Nazara/Utility/SkeletalMesh.hpp>
+#include <Nazara/Utility/Skeleton.hpp>
+#include <Nazara/Utility/StaticMesh.hpp>
+#include <Nazara/Utility/VertexBuffer.hpp>
+#include <Nazara/Utility/VertexMapper.hpp>
+#include <Nazara/Utility/Formats/NMFConstants.hpp>
+#include <lz4.h>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		bool IsSupported(const std::string_view& extension)
+		{
+			return (extension == "nmf");
+		}
+
+		Ternary Check(Stream& stream, const MeshParams& parameters)
+		{
+			bool skip;
+			if (parameters.custom.GetBooleanParameter("SkipNativeNMFLoader", &skip) && skip)
+				return Ternary::False;
+
+			ByteStream byteStream(&stream);
+			byteStream.SetDataEndianness(Endianness::LittleEndian);
+
+			UInt32 magic;
+			UInt32 version;
+			byteStream >> magic >> version;
+
+			return (magic == NMF_Magic && version == NMF_Version) ? Ternary::True : Ternary::False;
+		}
+
+		std::shared_ptr<VertexDeclaration> ReadDeclaration(ByteStream& byteStream)
+		{
+			UInt8 inputRate;
+			UInt32 componentCount;
+			byteStream >> inputRate >> componentCount;
+
+			if (inputRate > UnderlyingCast(VertexInputRate::Vertex))
+			{
+				NazaraError("Invalid vertex input rate");
+				return nullptr;
+			}
+
+			if (componentCount > 64)
+			{
+				NazaraError("Too many vertex components (" + std::to_string(componentCount) + ")");
+				return nullptr;
+			}
+
+			std::vector<VertexDeclaration::ComponentEntry> components(componentCount);
+			for (std::size_t i = 0; i < componentCount; ++i)
+			{
+				Int8 component;
+				UInt8 type;
+				UInt32 componentIndex;
+				byteStream >> component >> type >> componentIndex;
+
+				if (component < UnderlyingCast(VertexComponent::Unused) || component > UnderlyingCast(VertexComponent::Max))
+				{
+					NazaraError("Invalid vertex component #" + std::to_string(i));
+					return nullptr;
+				}
+
+				if (type >= ComponentTypeCount || !VertexDeclaration::IsTypeSupported(static_cast<ComponentType>(type)))
+				{
+					NazaraError("Invalid vertex component type #" + std::to_string(i));
+					return nullptr;
+				}
+
+				VertexDeclaration::ComponentEntry& entry = components[i];
+				entry.component = static_cast<VertexComponent>(component);
+				entry.componentIndex = componentIndex;
+				entry.type = static_cast<ComponentType>(type);
+
+				if (entry.componentIndex != 0 && entry.component != VertexComponent::Userdata)
+				{
+					NazaraError("Only userdata components can have non-zero component indexes");
+					return nullptr;
+				}
+
+				if (entry.component != VertexComponent::Unused)
+				{
+					for (std::size_t j = 0; j < i; ++j)
+					{
+						if (components[j].component == entry.component && components[j].componentIndex == entry.componentIndex)
+						{
+							NazaraError("Duplicate vertex component found");
+							return nullptr;
+						}
+					}
+				}
+			}
+
+			// Reuse predefined declarations when possible, as many systems compare declarations by pointer
+			for (std::size_t i = 0; i < VertexLayoutCount; ++i)
+			{
+				const std::shared_ptr<VertexDeclaration>& declaration = VertexDeclaration::Get(static_cast<VertexLayout>(i));
+				if (UnderlyingCast(declaration->GetInputRate()) != inputRate || declaration->GetComponentCount() != componentCount)
+					continue;
+
+				bool match = true;
+				for (std::size_t j = 0; j < componentCount; ++j)
+				{
+					const VertexDeclaration::Component& component = declaration->GetComponent(j);
+					if (component.component != components[j].component || component.type != components[j].type || component.componentIndex != components[j].componentIndex)
+					{
+						match = false;
+						break;
+					}
+				}
+
+				if (match)
+					return declaration;
+			}
+
+			return std::make_shared<VertexDeclaration>(static_cast<VertexInputRate>(inputRate), components);
+		}
+
+		bool ReadMaterial(ByteStream& byteStream, ParameterList* materialData)
+		{
+			UInt32 parameterCount;
+			byteStream >> parameterCount;
+
+			for (UInt32 i = 0; i < parameterCount; ++i)
+			{
+				std::string name;
+				UInt8 type;
+				byteStream >> name >> type;
+
+				switch (static_cast<ParameterType>(type))
+				{
+					case ParameterType::Boolean:
+					{
+						UInt8 value;
+						byteStream >> value;
+						materialData->SetParameter(name, value != 0);
+						break;
+					}
+
+					case ParameterType::Color:
+					{
+						Color value;
+						byteStream >> value;
+						materialData->SetParameter(name, value);
+						break;
+					}
+
+					case ParameterType::Double:
+					{
+						double value;
+						byteStream >> value;
+						materialData->SetParameter(name, value);
+						break;
+					}
+
+					case ParameterType::Integer:
+					{
+						Int64 value;
+						byteStream >> value;
+						materialData->SetParameter(name, static_cast<long long>(value));
+						break;
+					}
+
+					case ParameterType::None:
+						materialData->SetParameter(name);
+						break;
+
+					case ParameterType::String:
+					{
+						std::string value;
+						byteStream >> value;
+						materialData->SetParameter(name, value);
+						break;
+					}
+
+					case ParameterType::Pointer:
+					case ParameterType::Userdata:
+					default:
+						NazaraError("Invalid material parameter type for " + name);
+						return false;
+				}
+			}
+
+			return true;
+		}
+
+		std::shared_ptr<Mesh> Load(Stream& stream, const MeshParams& parameters)
+		{
+			UInt64 startPos = stream.GetCursorPos();
+			UInt64 streamSize = stream.GetSize();
+
+			ByteStream byteStream(&stream);
+			byteStream.SetDataEndianness(Endianness::LittleEndian);
+
+			NMFHeader header;
+			byteStream >> header;
+
+			if (header.magic != NMF_Magic || header.version != NMF_Version)
+			{
+				NazaraError("Invalid NMF header");
+				return nullptr;
+			}
+
+			if (header.dataOffset > streamSize - startPos || header.dataSize > streamSize - startPos - header.dataOffset)
+			{
+				NazaraError("NMF data exceeds stream size");
+				return nullptr;
+			}
+
+			// Every description takes at least a byte, this prevents huge allocations on corrupted files
+			if (header.declarationCount > header.dataOffset || header.materialCount > header.dataOffset || header.subMeshCount > header.dataOffset || header.jointCount > header.dataOffset)
+			{
+				NazaraError("Invalid NMF header counts");
+				return nullptr;
+			}
+
+			bool isSkeletal = (header.animationType == NMFAnimationType::Skeletal);
+			if (!isSkeletal && header.animationType != NMFAnimationType::Static)
+			{
+				NazaraError("Invalid animation type");
+				return nullptr;
+			}
+
+			std::vector<std::shared_ptr<VertexDeclaration>> declarations(header.declarationCount);
+			for (auto& declaration : declarations)
+			{
+				declaration = ReadDeclaration(byteStream);
+				if (!declaration)
+					return nullptr;
+			}
+
+			std::string animationPath;
+			byteStream >> animationPath;
+
+			std::vector<ParameterList> materials(header.materialCount);
+			for (ParameterList& materialData : materials)
+			{
+				if (!ReadMaterial(byteStream, &materialData))
+					return nullptr;
+			}
+
+			// Skeletal meshes can still be loaded as static meshes (with their skinning data left in the vertices)
+			bool loadSkeletal = isSkeletal && parameters.animated;
+
+			std::shared_ptr<Mesh> mesh = std::make_shared<Mesh>();
+			if (loadSkeletal)
+				mesh->CreateSkeletal(header.jointCount);
+			else
+				mesh->CreateStatic();
+
+			if (isSkeletal)
+			{
+				Joint* joints = (loadSkeletal) ? mesh->GetSkeleton()->GetJoints() : nullptr;
+				for (UInt32 i = 0; i < header.jointCount; ++i)
+				{
+					std::string name;
+					Int32 parentIndex;
+					Vector3f position;
+					Quaternionf rotation;
+					Vector3f scale;
+					Matrix4f inverseBindMatrix;
+					byteStream >> name >> parentIndex >> position >> rotation >> scale >> inverseBindMatrix;
+
+					if (parentIndex >= Int32(header.jointCount))
+					{
+						NazaraError("Joint #" + std::to_string(i) + " has an invalid parent");
+						return nullptr;
+					}
+
+					if (!joints)
+						continue;
+
+					Joint& joint = joints[i];
+					if (parentIndex >= 0)
+						joint.SetParent(joints[parentIndex]);
+
+					joint.SetName(name);
+					joint.SetPosition(position);
+					joint.SetRotation(rotation);
+					joint.SetScale(scale);
+					joint.SetInverseBindMatrix(inverseBindMatrix);
+				}
+			}
+
+			std::vector<NMFSubMesh> subMeshes(header.subMeshCount);
+			for (NMFSubMesh& subMesh : subMeshes)
+				byteStream >> subMesh;
+
+			if (stream.GetCursorPos() > startPos + header.dataOffset)
+			{
+				NazaraError("NMF descriptions overlap with data");
+				return nullptr;
+			}
+
+			// Memory-mapped streams are read in place, sparing a copy
+			const UInt8* mappedData = nullptr;
+			if (stream.IsMemoryMapped() && !stream.IsBufferingEnabled())
+				mappedData = static_cast<const UInt8*>(stream.GetMappedPointer()) + startPos + header.dataOffset;
+
+			std::vector<UInt8> readBuffer;
+			auto ReadBlob = [&](const NMFBlob& blob, void* buffer) -> bool
+			{
+				if (blob.offset > header.dataSize || blob.storedSize > header.dataSize - blob.offset)
+				{
+					NazaraError("Blob exceeds data size");
+					return false;
+				}
+
+				bool compressed = (blob.storedSize != blob.size);
+				if (compressed && ((header.flags & NMFFlag_LZ4) == 0 || blob.size > LZ4_MAX_INPUT_SIZE || blob.storedSize > UInt64(std::numeric_limits<int>::max())))
+				{
+					NazaraError("Invalid blob size");
+					return false;
+				}
+
+				const UInt8* data;
+				if (mappedData)
+					data = mappedData + blob.offset;
+				else
+				{
+					if (!stream.SetCursorPos(startPos + header.dataOffset + blob.offset))
+					{
+						NazaraError("Failed to set stream cursor position");
+						return false;
+					}
+
+					if (!compressed)
+						return stream.Read(buffer, blob.size) == blob.size;
+
+					readBuffer.resize(blob.storedSize);
+					if (stream.Read(readBuffer.data(), blob.storedSize) != blob.storedSize)
+						return false;
+
+					data = readBuffer.data();
+				}
+
+				if (compressed)
+					return LZ4_decompress_safe(reinterpret_cast<const char*>(data), static_cast<char*>(buffer), int(blob.storedSize), int(blob.size)) == int(blob.size);
+
+				std::memcpy(buffer, data, blob.size);
+				return true;
+			};
+
+			bool transform = (parameters.matrix != Matrix4f::Identity());
+			bool transformTexCoords = (parameters.texCoordOffset != Vector2f::Zero() || parameters.texCoordScale != Vector2f::Unit());
+
+			for (std::size_t i = 0; i < subMeshes.size(); ++i)
+			{
+				const NMFSubMesh& subMeshData = subMeshes[i];
+				if (subMeshData.declarationIndex >= declarations.size())
+				{
+					NazaraError("Submesh #" + std::to_string(i) + " has an invalid vertex declaration index");
+					return nullptr;
+				}
+
+				if (subMeshData.materialIndex >= header.materialCount)
+				{
+					NazaraError("Submesh #" + std::to_string(i) + " has an invalid material index");
+					return nullptr;
+				}
+
+				const std::shared_ptr<VertexDeclaration>& declaration = declarations[subMeshData.declarationIndex];
+				if (subMeshData.vertices.size != UInt64(subMeshData.vertexCount) * declaration->GetStride() || subMeshData.indices.size != UInt64(subMeshData.indexCount) * ((subMeshData.largeIndices) ? sizeof(UInt32) : sizeof(UInt16)))
+				{
+					NazaraError("Submesh #" + std::to_string(i) + " has invalid buffer sizes");
+					return nullptr;
+				}
+
+				std::shared_ptr<VertexBuffer> vertexBuffer = std::make_shared<VertexBuffer>(declaration, subMeshData.vertexCount, parameters.storage, parameters.vertexBufferFlags);
+				{
+					void* vertices = vertexBuffer->MapRaw(BufferAccess::DiscardAndWrite);
+					bool result = ReadBlob(subMeshData.vertices, vertices);
+					vertexBuffer->Unmap();
+
+					if (!result)
+					{
+						NazaraError("Failed to read vertices of submesh #" + std::to_string(i));
+						return nullptr;
+					}
+				}
+
+				std::shared_ptr<IndexBuffer> indexBuffer;
+				if (subMeshData.indexCount > 0)
+				{
+					indexBuffer = std::make_shared<IndexBuffer>(subMeshData.largeIndices != 0, subMeshData.indexCount, parameters.storage, parameters.indexBufferFlags);
+
+					void* indices = indexBuffer->MapRaw(BufferAccess::DiscardAndWrite);
+					bool result = ReadBlob(subMeshData.indices, indices);
+					indexBuffer->Unmap();
+
+					if (!result)
+					{
+						NazaraError("Failed to read indices of submesh #" + std::to_string(i));
+						return nullptr;
+					}
+				}
+
+				std::shared_ptr<SubMesh> subMesh;
+				if (loadSkeletal)
+					subMesh = std::make_shared<SkeletalMesh>(std::move(vertexBuffer), std::move(indexBuffer));
+				else
+				{
+					// Vertices are stored ready to use, parameters are only applied when they differ from defaults
+					if (transform || transformTexCoords)
+					{
+						VertexMapper vertexMapper(*vertexBuffer, BufferAccess::ReadWrite);
+
+						if (transform)
+						{
+							// Make sure the normal matrix won't rescale our normals
+							Matrix4f normalMatrix = parameters.matrix;
+							if (normalMatrix.HasScale())
+								normalMatrix.ApplyScale(1.f / normalMatrix.GetScale());
+
+							if (auto posPtr = vertexMapper.GetComponentPtr<Vector3f>(VertexComponent::Position))
+							{
+								for (UInt32 j = 0; j < subMeshData.vertexCount; ++j)
+									posPtr[j] = parameters.matrix.Transform(posPtr[j]);
+							}
+
+							if (auto normalPtr = vertexMapper.GetComponentPtr<Vector3f>(VertexComponent::Normal))
+							{
+								for (UInt32 j = 0; j < subMeshData.vertexCount; ++j)
+									normalPtr[j] = normalMatrix.Transform(normalPtr[j], 0.f);
+							}
+
+							if (auto tangentPtr = vertexMapper.GetComponentPtr<Vector3f>(VertexComponent::Tangent))
+							{
+								for (UInt32 j = 0; j < subMeshData.vertexCount; ++j)
+									tangentPtr[j] = normalMatrix.Transform(tangentPtr[j], 0.f);
+							}
+						}
+
+						if (transformTexCoords)
+						{
+							if (auto uvPtr = vertexMapper.GetComponentPtr<Vector2f>(VertexComponent::TexCoord))
+							{
+								for (UInt32 j = 0; j < subMeshData.vertexCount; ++j)
+									uvPtr[j] = parameters.texCoordOffset + uvPtr[j] * parameters.texCoordScale;
+							}
+						}
+					}
+
+					std::shared_ptr<StaticMesh> staticMesh = std::make_shared<StaticMesh>(std::move(vertexBuffer), std::move(indexBuffer));
+					if (transform)
+						staticMesh->GenerateAABB();
+					else
+						staticMesh->SetAABB(subMeshData.aabb);
+
+					subMesh = std::move(staticMesh);
+				}
+
+				if (loadSkeletal)
+					static_cast<SkeletalMesh&>(*subMesh).SetAABB(subMeshData.aabb);
+
+				subMesh->SetMaterialIndex(subMeshData.materialIndex);
+				mesh->AddSubMesh(std::move(subMesh));
+			}
+
+			mesh->SetMaterialCount(materials.size());
+			for (std::size_t i = 0; i < materials.size(); ++i)
+				mesh->SetMaterialData(i, std::move(materials[i]));
+
+			if (!animationPath.empty())
+				mesh->SetAnimation(std::filesystem::u8path(animationPath));
+
+			if (parameters.center && !loadSkeletal)
+				mesh->Recenter();
+
+			// Leave the stream after the data, as if it had been read entirely
+			stream.SetCursorPos(startPos + header.dataOffset + header.dataSize);
+
+			return mesh;
+		}
+	}
+
+	namespace Loaders
+	{
+		MeshLoader::Entry GetMeshLoader_NMF()
+		{
+			MeshLoader::Entry loader;
+			loader.extensionSupport = IsSupported;
+			loader.streamChecker = Check;
+			loader.streamLoader = Load;
+
+			return loader;
+		}
+	}
+}
@@ -0,0 +1,18 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_FORMATS_NMFLOADER_HPP
+#define NAZARA_FORMATS_NMFLOADER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Utility/Mesh.hpp>
+
+namespace Nz::Loaders
+{
+	MeshLoader::Entry GetMeshLoader_NMF();
+}
+
+#endif // NAZARA_FORMATS_NMFLOADER_HPP
@@ -0,0 +1,360 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/Formats/NMFSaver.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/CallOnExit.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
+#include <Nazara/Utility/Buffer.hpp>
+#include <Nazara/Utility/IndexBuffer.hpp>
+#include <Nazara/Utility/Joint.hpp>
+#include <Nazara/Utility/SkeletalMesh.hpp>
+#include <Nazara/Utility/StaticMesh.hpp>
+#include <Nazara/Utility/VertexBuffer.hpp>
+#include <Nazara/Utility/Formats/NMFConstants.hpp>
+#include <lz4.h>
+#include <algorithm>
+#include <vector>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		struct BlobData
+		{
+			const UInt8* data;
+			std::vector<UInt8> compressedData;
+			NMFBlob* blob;
+		};
+
+		UInt64 Align(UInt64 offset)
+		{
+			return (offset + NMF_DataAlignment - 1) / NMF_DataAlignment * NMF_DataAlignment;
+		}
+
+		bool IsSupported(const std::string_view& extension)
+		{
+			return (extension == "nmf");
+		}
+
+		void WriteMaterial(ByteStream& byteStream, const ParameterList& materialData)
+		{
+			// Pointers and userdata can't be stored
+			std::vector<std::string> names;
+			materialData.ForEach([&](const ParameterList& list, const std::string& name)
+			{
+				ParameterType type;
+				if (list.GetParameterType(name, &type) && type != ParameterType::Pointer && type != ParameterType::Userdata)
+					names.push_back(name);
+			});
+
+			byteStream << UInt32(names.size());
+			for (const std::string& name : names)
+			{
+				ParameterType type;
+				materialData.GetParameterType(name, &type);
+
+				byteStream << name << UInt8(type);
+				switch (type)
+				{
+					case ParameterType::Boolean:
+					{
+						bool value;
+						materialData.GetBooleanParameter(name, &value);
+						byteStream << UInt8((value) ? 1 : 0);
+						break;
+					}
+
+					case ParameterType::Color:
+					{
+						Color value;
+						materialData.GetColorParameter(name, &value);
+						byteStream << value;
+						break;
+					}
+
+					case ParameterType::Double:
+					{
+						double value;
+						materialData.GetDoubleParameter(name, &value);
+						byteStream << value;
+						break;
+					}
+
+					case ParameterType::Integer:
+					{
+						long long value;
+						materialData.GetIntegerParameter(name, &value);
+						byteStream << Int64(value);
+						break;
+					}
+
+					case ParameterType::String:
+					{
+						std::string value;
+						materialData.GetStringParameter(name, &value);
+						byteStream << value;
+						break;
+					}
+
+					case ParameterType::None:
+					case ParameterType::Pointer:
+					case ParameterType::Userdata:
+						break;
+				}
+			}
+		}
+
+		bool SaveToStream(const Mesh& mesh, const std::string& format, Stream& stream, const MeshParams& parameters)
+		{
+			NazaraUnused(format);
+
+			if (!mesh.IsValid())
+			{
+				NazaraError("Invalid mesh");
+				return false;
+			}
+
+			bool compress = false;
+			parameters.custom.GetBooleanParameter("NativeNMFSaver_Compress", &compress);
+
+			bool isSkeletal = (mesh.GetAnimationType() == AnimationType::Skeletal);
+
+			NMFHeader header;
+			header.magic = NMF_Magic;
+			header.version = NMF_Version;
+			header.flags = (compress) ? UInt32(NMFFlag_LZ4) : 0;
+			header.animationType = (isSkeletal) ? NMFAnimationType::Skeletal : NMFAnimationType::Static;
+			header.materialCount = UInt32(mesh.GetMaterialCount());
+			header.subMeshCount = UInt32(mesh.GetSubMeshCount());
+			header.jointCount = (isSkeletal) ? UInt32(mesh.GetJointCount()) : 0;
+			header.aabb = mesh.GetAABB();
+
+			// Map every buffer and gather their content
+			std::vector<const VertexDeclaration*> declarations;
+			std::vector<NMFSubMesh> subMeshes(header.subMeshCount);
+			std::vector<BlobData> blobs;
+			blobs.reserve(subMeshes.size() * 2);
+
+			// Buffers may be shared between submeshes, map them only once
+			std::vector<std::pair<const Buffer*, const UInt8*>> mappedBuffers;
+			CallOnExit unmapBuffers([&]
+			{
+				for (const auto& pair : mappedBuffers)
+					pair.first->Unmap();
+			});
+
+			auto MapBuffer = [&](const Buffer* buffer) -> const UInt8*
+			{
+				auto it = std::find_if(mappedBuffers.begin(), mappedBuffers.end(), [&](const auto& pair) { return pair.first == buffer; });
+				if (it != mappedBuffers.end())
+					return it->second;
+
+				const UInt8* data = static_cast<const UInt8*>(buffer->Map(BufferAccess::ReadOnly));
+				if (data)
+					mappedBuffers.emplace_back(buffer, data);
+
+				return data;
+			};
+
+			UInt64 dataSize = 0;
+			for (std::size_t i = 0; i < subMeshes.size(); ++i)
+			{
+				const SubMesh& subMesh = *mesh.GetSubMesh(i);
+				const VertexBuffer& vertexBuffer = (isSkeletal) ? *static_cast<const SkeletalMesh&>(subMesh).GetVertexBuffer() : *static_cast<const StaticMesh&>(subMesh).GetVertexBuffer();
+				const std::shared_ptr<const IndexBuffer>& indexBuffer = subMesh.GetIndexBuffer();
+
+				const VertexDeclaration* declaration = vertexBuffer.GetVertexDeclaration().get();
+				auto it = std::find(declarations.begin(), declarations.end(), declaration);
+				if (it == declarations.end())
+					it = declarations.insert(declarations.end(), declaration);
+
+				NMFSubMesh& subMeshData = subMeshes[i];
+				subMeshData.aabb = subMesh.GetAABB();
+				subMeshData.declarationIndex = UInt32(std::distance(declarations.begin(), it));
+				subMeshData.materialIndex = UInt32(subMesh.GetMaterialIndex());
+				subMeshData.vertexCount = UInt32(vertexBuffer.GetVertexCount());
+				subMeshData.vertices.size = vertexBuffer.GetVertexCount() * vertexBuffer.GetStride();
+
+				const UInt8* vertices = MapBuffer(vertexBuffer.GetBuffer().get());
+				if (!vertices)
+				{
+					NazaraError("Failed to map vertex buffer #" + std::to_string(i));
+					return false;
+				}
+
+				blobs.push_back({ vertices + vertexBuffer.GetStartOffset(), {}, &subMeshData.vertices });
+
+				if (indexBuffer)
+				{
+					subMeshData.indexCount = UInt32(indexBuffer->GetIndexCount());
+					subMeshData.indices.size = indexBuffer->GetIndexCount() * indexBuffer->GetStride();
+					subMeshData.largeIndices = (indexBuffer->HasLargeIndices()) ? 1 : 0;
+
+					const UInt8* indices = MapBuffer(indexBuffer->GetBuffer().get());
+					if (!indices)
+					{
+						NazaraError("Failed to map index buffer #" + std::to_string(i));
+						return false;
+					}
+
+					blobs.push_back({ indices + indexBuffer->GetStartOffset(), {}, &subMeshData.indices });
+				}
+				else
+				{
+					subMeshData.indexCount = 0;
+					subMeshData.indices = { 0, 0, 0 };
+					subMeshData.largeIndices = 0;
+				}
+			}
+
+			// Blobs are compressed independently, which allows to compress them in parallel
+			if (compress)
+			{
+				ParallelFor(0, blobs.size(), [&](std::size_t blobIndex)
+				{
+					BlobData& blobData = blobs[blobIndex];
+					if (blobData.blob->size == 0 || blobData.blob->size > LZ4_MAX_INPUT_SIZE)
+						return;
+
+					int size = int(blobData.blob->size);
+					blobData.compressedData.resize(LZ4_compressBound(size));
+
+					int compressedSize = LZ4_compress_default(reinterpret_cast<const char*>(blobData.data), reinterpret_cast<char*>(blobData.compressedData.data()), size, int(blobData.compressedData.size()));
+					if (compressedSize <= 0 || compressedSize >= size)
+						blobData.compressedData.clear(); //< store uncompressed data
+					else
+						blobData.compressedData.resize(compressedSize);
+				});
+			}
+
+			for (BlobData& blobData : blobs)
+			{
+				blobData.blob->offset = Align(dataSize);
+				blobData.blob->storedSize = (!blobData.compressedData.empty()) ? blobData.compressedData.size() : blobData.blob->size;
+
+				dataSize = blobData.blob->offset + blobData.blob->storedSize;
+			}
+
+			header.declarationCount = UInt32(declarations.size());
+			header.dataSize = dataSize;
+
+			// Serialize everything but the buffers contents first, to know where they start
+			ByteArray descriptions;
+			{
+				ByteStream descriptionStream(&descriptions, OpenModeFlags(OpenMode::WriteOnly));
+				descriptionStream.SetDataEndianness(Endianness::LittleEndian);
+
+				for (const VertexDeclaration* declaration : declarations)
+				{
+					descriptionStream << UInt8(declaration->GetInputRate()) << UInt32(declaration->GetComponentCount());
+					for (const VertexDeclaration::Component& component : declaration->GetComponents())
+						descriptionStream << Int8(component.component) << UInt8(component.type) << UInt32(component.componentIndex);
+				}
+
+				descriptionStream << mesh.GetAnimation().generic_u8string();
+
+				for (std::size_t i = 0; i < mesh.GetMaterialCount(); ++i)
+					WriteMaterial(descriptionStream, mesh.GetMaterialData(i));
+
+				if (isSkeletal)
+				{
+					const Skeleton* skeleton = mesh.GetSkeleton();
+					const Joint* joints = skeleton->GetJoints();
+					for (std::size_t i = 0; i < header.jointCount; ++i)
+					{
+						const Joint& joint = joints[i];
+
+						// Parent joints are referenced by index
+						Int32 parentIndex = -1;
+						const Node* parent = joint.GetParent();
+						if (parent)
+						{
+							for (std::size_t j = 0; j < header.jointCount; ++j)
+							{
+								if (&joints[j] == parent)
+								{
+									parentIndex = Int32(j);
+									break;
+								}
+							}
+						}
+
+						descriptionStream << joint.GetName() << parentIndex;
+						descriptionStream << joint.GetPosition() << joint.GetRotation() << joint.GetScale();
+						descriptionStream << joint.GetInverseBindMatrix();
+					}
+				}
+
+				for (const NMFSubMesh& subMesh : subMeshes)
+					descriptionStream << subMesh;
+			}
+
+			ByteArray headerData;
+			{
+				// Header has a fixed size, serialize it once to know it
+				ByteStream headerStream(&headerData, OpenModeFlags(OpenMode::WriteOnly));
+				headerStream.SetDataEndianness(Endianness::LittleEndian);
+				headerStream << header;
+			}
+
+			header.dataOffset = Align(headerData.GetSize() + descriptions.GetSize());
+
+			ByteStream byteStream(&stream);
+			byteStream.SetDataEndianness(Endianness::LittleEndian);
+			byteStream << header;
+
+			UInt64 offset = headerData.GetSize();
+			auto WriteData = [&](const void* data, UInt64 size) -> bool
+			{
+				if (byteStream.Write(data, size) != size)
+				{
+					NazaraError("Failed to write to stream");
+					return false;
+				}
+
+				offset += size;
+				return true;
+			};
+
+			auto WritePadding = [&](UInt64 targetOffset) -> bool
+			{
+				static const UInt8 padding[NMF_DataAlignment] = {};
+
+				NazaraAssert(targetOffset >= offset && targetOffset - offset <= NMF_DataAlignment, "Invalid padding");
+				return WriteData(padding, targetOffset - offset);
+			};
+
+			if (!WriteData(descriptions.GetConstBuffer(), descriptions.GetSize()))
+				return false;
+
+			for (const BlobData& blobData : blobs)
+			{
+				if (!WritePadding(header.dataOffset + blobData.blob->offset))
+					return false;
+
+				const UInt8* data = (!blobData.compressedData.empty()) ? blobData.compressedData.data() : blobData.data;
+				if (!WriteData(data, blobData.blob->storedSize))
+					return false;
+			}
+
+			return true;
+		}
+	}
+
+	namespace Loaders
+	{
+		MeshSaver::Entry GetMeshSaver_NMF()
+		{
+			MeshSaver::Entry entry;
+			entry.formatSupport = IsSupported;
+			entry.streamSaver = SaveToStream;
+
+			return entry;
+		}
+	}
+}
@@ -4,16 +4,491 @@
 
 #include <Nazara/Utility/Formats/OBJParser.hpp>
 #include <Nazara/Core/CallOnExit.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
 #include <Nazara/Core/StringExt.hpp>
 #include <Nazara/Utility/Config.hpp>
 #include <tsl/ordered_map.h>
+#include <algorithm>
 #include <cctype>
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <memory>
+#include <string_view>
 #include <unordered_map>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
 {
+	namespace
+	{
+		// Files are split in chunks of at least this size, parsed concurrently
+		constexpr std::size_t MinChunkSize = 1024 * 1024;
+
+		constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
+
+		enum class IndexComponent
+		{
+			Normal,
+			Position,
+			TexCoord
+		};
+
+		// Negative (relative) indices are resolved once the number of elements preceding the chunk is known
+		struct RelativeIndex
+		{
+			std::size_t vertexIndex;
+			IndexComponent component;
+			long long localIndex; //< one-based index from the chunk beginning, may be negative
+		};
+
+		// Consecutive faces sharing the same group and material
+		struct FaceRun
+		{
+			std::string materialName;
+			std::string meshName;
+			std::vector<OBJParser::Face> faces;
+			std::vector<OBJParser::FaceVertex> vertices;
+			std::vector<RelativeIndex> relativeIndices;
+			std::vector<std::size_t> faceLines;
+			bool materialNameSet = false;
+			bool meshNameSet = false;
+		};
+
+		struct UnparsedLine
+		{
+			std::size_t line;
+			std::string text;
+		};
+
+		struct ChunkData
+		{
+			std::filesystem::path mtlLib;
+			std::vector<FaceRun> runs;
+			std::vector<UnparsedLine> unparsedLines;
+			std::vector<Vector3f> normals;
+			std::vector<Vector4f> positions;
+			std::vector<Vector3f> texCoords;
+			std::size_t lineCount = 0;
+			bool hasMtlLib = false;
+		};
+
+		bool IsBlank(char c)
+		{
+			return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+		}
+
+		bool IsDigit(char c)
+		{
+			return c >= '0' && c <= '9';
+		}
+
+		void SkipBlanks(const char*& ptr, const char* end)
+		{
+			while (ptr < end && IsBlank(*ptr))
+				++ptr;
+		}
+
+		bool StartsWithNoCase(const char* ptr, const char* end, const char* prefix)
+		{
+			for (; *prefix != '\0'; ++ptr, ++prefix)
+			{
+				if (ptr == end || std::tolower(*ptr) != *prefix)
+					return false;
+			}
+
+			return true;
+		}
+
+		bool ParseInteger(const char*& ptr, const char* end, long long* value)
+		{
+			const char* p = ptr;
+
+			bool negative = false;
+			if (p < end && (*p == '-' || *p == '+'))
+				negative = (*p++ == '-');
+
+			if (p == end || !IsDigit(*p))
+				return false;
+
+			long long result = 0;
+			for (; p < end && IsDigit(*p); ++p)
+			{
+				if (result > std::numeric_limits<long long>::max() / 10 - 10)
+					return false;
+
+				result = result * 10 + (*p - '0');
+			}
+
+			*value = (negative) ? -result : result;
+			ptr = p;
+			return true;
+		}
+
+		// Parses a decimal floating-point number, like strtof without its locale handling and its cost
+		bool ParseFloat(const char*& ptr, const char* end, float* value)
+		{
+			static constexpr double powersOfTen[] = {
+				1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+				1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+			};
+
+			const char* p = ptr;
+
+			bool negative = false;
+			if (p < end && (*p == '-' || *p == '+'))
+				negative = (*p++ == '-');
+
+			if (StartsWithNoCase(p, end, "nan"))
+			{
+				*value = std::numeric_limits<float>::quiet_NaN();
+				ptr = p + 3;
+				return true;
+			}
+
+			if (StartsWithNoCase(p, end, "inf"))
+			{
+				*value = (negative) ? -std::numeric_limits<float>::infinity() : std::numeric_limits<float>::infinity();
+				ptr = p + ((StartsWithNoCase(p, end, "infinity")) ? 8 : 3);
+				return true;
+			}
+
+			// Only the 19 first significant digits are kept, which is way more than what a float can hold
+			UInt64 mantissa = 0;
+			int significantDigits = 0;
+			int exponent = 0;
+			bool hasDigits = false;
+
+			for (; p < end && IsDigit(*p); ++p)
+			{
+				hasDigits = true;
+				if (significantDigits < 19)
+				{
+					mantissa = mantissa * 10 + (*p - '0');
+					if (mantissa != 0)
+						significantDigits++;
+				}
+				else
+					exponent++;
+			}
+
+			if (p < end && *p == '.')
+			{
+				++p;
+				for (; p < end && IsDigit(*p); ++p)
+				{
+					hasDigits = true;
+					if (significantDigits < 19)
+					{
+						mantissa = mantissa * 10 + (*p - '0');
+						if (mantissa != 0)
+							significantDigits++;
+
+						exponent--;
+					}
+				}
+			}
+
+			if (!hasDigits)
+				return false;
+
+			if (p < end && (*p == 'e' || *p == 'E'))
+			{
+				const char* exponentPtr = p + 1;
+
+				long long exponentValue;
+				if (ParseInteger(exponentPtr, end, &exponentValue))
+				{
+					exponent += int(std::clamp(exponentValue, -1000LL, 1000LL));
+					p = exponentPtr;
+				}
+			}
+
+			double result = double(mantissa);
+			if (mantissa != 0)
+			{
+				if (exponent < 0)
+				{
+					if (exponent >= -22)
+						result /= powersOfTen[-exponent];
+					else
+						result *= std::pow(10.0, exponent);
+				}
+				else if (exponent > 0)
+				{
+					if (exponent <= 22)
+						result *= powersOfTen[exponent];
+					else
+						result *= std::pow(10.0, exponent);
+				}
+			}
+
+			*value = float((negative) ? -result : result);
+			ptr = p;
+			return true;
+		}
+
+		// Parses up to maxCount blank-separated floats, stopping on the first invalid one (like sscanf would)
+		std::size_t ParseFloats(const char* ptr, const char* end, float* values, std::size_t maxCount)
+		{
+			std::size_t count = 0;
+			while (count < maxCount)
+			{
+				SkipBlanks(ptr, end);
+				if (!ParseFloat(ptr, end, &values[count]))
+					break;
+
+				count++;
+			}
+
+			return count;
+		}
+
+		// Parses a face vertex (p, p/t, p//n or p/t/n)
+		bool ParseFaceVertex(const char*& ptr, const char* end, long long* position, long long* texCoord, long long* normal)
+		{
+			*normal = 0;
+			*texCoord = 0;
+
+			if (!ParseInteger(ptr, end, position))
+				return false;
+
+			if (ptr < end && *ptr == '/')
+			{
+				++ptr;
+				if (ptr < end && *ptr != '/' && !ParseInteger(ptr, end, texCoord))
+					return false;
+
+				if (ptr < end && *ptr == '/')
+				{
+					++ptr;
+					if (!ParseInteger(ptr, end, normal))
+						return false;
+				}
+			}
+
+			return ptr == end || IsBlank(*ptr);
+		}
+
+		FaceRun& StartRun(ChunkData& chunk)
+		{
+			FaceRun& previousRun = chunk.runs.back();
+			if (previousRun.faces.empty())
+				return previousRun;
+
+			FaceRun& run = chunk.runs.emplace_back();
+			run.materialName = chunk.runs[chunk.runs.size() - 2].materialName;
+			run.materialNameSet = chunk.runs[chunk.runs.size() - 2].materialNameSet;
+			run.meshName = chunk.runs[chunk.runs.size() - 2].meshName;
+			run.meshNameSet = chunk.runs[chunk.runs.size() - 2].meshNameSet;
+
+			return run;
+		}
+
+		void ParseChunk(const char* begin, const char* end, ChunkData& chunk)
+		{
+			chunk.runs.emplace_back();
+
+			auto Unrecognized = [&](const char* lineBegin, const char* lineEnd)
+			{
+				#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
+				chunk.unparsedLines.push_back({ chunk.lineCount, std::string(lineBegin, lineEnd) });
+				#else
+				NazaraUnused(lineBegin);
+				NazaraUnused(lineEnd);
+				#endif
+			};
+
+			const char* lineBegin = begin;
+			while (lineBegin < end)
+			{
+				const char* lineEnd = static_cast<const char*>(std::memchr(lineBegin, '\n', end - lineBegin));
+				const char* nextLine = (lineEnd) ? lineEnd + 1 : end;
+				if (!lineEnd)
+					lineEnd = end;
+
+				chunk.lineCount++;
+
+				// Strip comments and blanks
+				if (const char* comment = static_cast<const char*>(std::memchr(lineBegin, '#', lineEnd - lineBegin)))
+					lineEnd = comment;
+
+				SkipBlanks(lineBegin, lineEnd);
+				while (lineEnd > lineBegin && IsBlank(lineEnd[-1]))
+					--lineEnd;
+
+				const char* line = lineBegin;
+				std::size_t lineSize = lineEnd - lineBegin;
+				lineBegin = nextLine;
+
+				if (lineSize == 0)
+					continue;
+
+				switch (std::tolower(line[0]))
+				{
+					case 'f': //< Face
+					{
+						if (lineSize < 2 || !IsBlank(line[1]))
+						{
+							Unrecognized(line, lineEnd);
+							break;
+						}
+
+						FaceRun& run = chunk.runs.back();
+
+						OBJParser::Face face;
+						face.firstVertex = run.vertices.size();
+						face.vertexCount = 0;
+
+						bool error = false;
+						const char* ptr = line + 1;
+						for (;;)
+						{
+							SkipBlanks(ptr, lineEnd);
+							if (ptr == lineEnd)
+								break;
+
+							long long p, t, n;
+							if (!ParseFaceVertex(ptr, lineEnd, &p, &t, &n))
+							{
+								error = true;
+								break;
+							}
+
+							std::size_t vertexIndex = run.vertices.size();
+							OBJParser::FaceVertex& vertex = run.vertices.emplace_back();
+
+							auto SetIndex = [&](std::size_t& index, long long value, IndexComponent component, std::size_t localCount)
+							{
+								if (value >= 0)
+									index = static_cast<std::size_t>(value);
+								else
+								{
+									index = InvalidIndex;
+									run.relativeIndices.push_back({ vertexIndex, component, static_cast<long long>(localCount) + value + 1 });
+								}
+							};
+
+							SetIndex(vertex.normal, n, IndexComponent::Normal, chunk.normals.size());
+							SetIndex(vertex.position, p, IndexComponent::Position, chunk.positions.size());
+							SetIndex(vertex.texCoord, t, IndexComponent::TexCoord, chunk.texCoords.size());
+
+							face.vertexCount++;
+						}
+
+						if (error || face.vertexCount < 3)
+						{
+							// Remove vertices
+							run.vertices.resize(face.firstVertex);
+							while (!run.relativeIndices.empty() && run.relativeIndices.back().vertexIndex >= face.firstVertex)
+								run.relativeIndices.pop_back();
+
+							Unrecognized(line, lineEnd);
+							break;
+						}
+
+						run.faces.push_back(face);
+						run.faceLines.push_back(chunk.lineCount);
+						break;
+					}
+
+					case 'm': //< MTLLib
+					{
+						if (!StartsWithNoCase(line, lineEnd, "mtllib ") || lineSize <= 7)
+						{
+							Unrecognized(line, lineEnd);
+							break;
+						}
+
+						chunk.mtlLib = std::string(line + 7, lineEnd);
+						chunk.hasMtlLib = true;
+						break;
+					}
+
+					case 'g': //< Group (inside a mesh)
+					case 'o': //< Object (defines a mesh)
+					{
+						const char* name = line + 1;
+						SkipBlanks(name, lineEnd);
+						if (lineSize <= 2 || !IsBlank(line[1]) || name == lineEnd)
+						{
+							Unrecognized(line, lineEnd);
+							break;
+						}
+
+						FaceRun& run = StartRun(chunk);
+						run.meshName.assign(name, lineEnd);
+						run.meshNameSet = true;
+						break;
+					}
+
+					case 's': //< Smooth
+					{
+						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
+						std::string_view param;
+						if (lineSize > 2 && IsBlank(line[1]))
+							param = std::string_view(line + 2, lineEnd - line - 2);
+
+						if (param != "all" && param != "on" && param != "off" && (param.empty() || !IsNumber(param)))
+							Unrecognized(line, lineEnd);
+						#endif
+						break;
+					}
+
+					case 'u': //< Usemtl
+					{
+						if (!StartsWithNoCase(line, lineEnd, "usemtl ") || lineSize <= 7)
+						{
+							Unrecognized(line, lineEnd);
+							break;
+						}
+
+						FaceRun& run = StartRun(chunk);
+						run.materialName.assign(line + 7, lineEnd);
+						run.materialNameSet = true;
+						break;
+					}
+
+					case 'v': //< Position/Normal/Texcoords
+					{
+						if (lineSize >= 2 && IsBlank(line[1]))
+						{
+							Vector4f vertex(Vector3f::Zero(), 1.f);
+							if (ParseFloats(line + 2, lineEnd, &vertex.x, 4) >= 1)
+								chunk.positions.push_back(vertex);
+							else
+								Unrecognized(line, lineEnd);
+						}
+						else if (lineSize >= 3 && std::tolower(line[1]) == 'n' && IsBlank(line[2]))
+						{
+							Vector3f normal(Vector3f::Zero());
+							if (ParseFloats(line + 3, lineEnd, &normal.x, 3) == 3)
+								chunk.normals.push_back(normal);
+							else
+								Unrecognized(line, lineEnd);
+						}
+						else if (lineSize >= 3 && std::tolower(line[1]) == 't' && IsBlank(line[2]))
+						{
+							Vector3f uvw(Vector3f::Zero());
+							if (ParseFloats(line + 3, lineEnd, &uvw.x, 3) >= 2)
+								chunk.texCoords.push_back(uvw);
+							else
+								Unrecognized(line, lineEnd);
+						}
+						else
+							Unrecognized(line, lineEnd);
+
+						break;
+					}
+
+					default:
+						Unrecognized(line, lineEnd);
+						break;
+				}
+			}
+		}
+	}
+
 	bool OBJParser::Check(Stream& stream)
 	{
 		m_currentStream = &stream;
@@ -33,6 +508,18 @@ namespace Nz
 			});
 		}
 
+		// Buffer reads so lines can be read without seeking back, reset it at the end
+		Nz::CallOnExit resetBuffering;
+		if (!stream.IsBufferingEnabled() && !stream.IsMemoryMapped() && !stream.IsSequential())
+		{
+			stream.EnableBuffering(true);
+
+			resetBuffering.Reset([&stream] ()
+			{
+				stream.EnableBuffering(false);
+			});
+		}
+
 		unsigned int failureCount = 0;
 		while (Advance(false))
 		{
@@ -93,20 +580,6 @@ namespace Nz
 		m_keepLastLine = false;
 		m_lineCount = 0;
 
-		// Force stream in text mode, reset it at the end
-		Nz::CallOnExit resetTextMode;
-		if ((stream.GetStreamOptions() & StreamOption::Text) == 0)
-		{
-			stream.EnableTextMode(true);
-
-			resetTextMode.Reset([&stream] ()
-			{
-				stream.EnableTextMode(false);
-			});
-		}
-
-		std::string matName, meshName;
-		matName = meshName = "default";
 		m_meshes.clear();
 		m_mtlLib.clear();
 
@@ -114,336 +587,197 @@ namespace Nz
 		m_positions.clear();
 		m_texCoords.clear();
 
-		// Reserve some space for incoming vertices
-		m_normals.reserve(reservedVertexCount);
-		m_positions.reserve(reservedVertexCount);
-		m_texCoords.reserve(reservedVertexCount);
-
-		// Sort meshes by material and group
-		using MatPair = std::pair<Mesh, unsigned int>;
-		tsl::ordered_map<std::string, tsl::ordered_map<std::string, MatPair>> meshesByName;
-
-		UInt32 faceReserve = 0;
-		UInt32 vertexReserve = 0;
-		unsigned int matCount = 0;
-		auto GetMaterial = [&] (const std::string& mesh, const std::string& mat) -> Mesh*
+		// Memory-mapped streams are parsed in place, others are read entirely first
+		std::vector<char> content;
+		const char* data;
+		std::size_t dataSize;
+		if (stream.IsMemoryMapped() && !stream.IsBufferingEnabled())
 		{
-			auto& map = meshesByName[mesh];
-			auto it = map.find(mat);
-			if (it == map.end())
-				it = map.insert(std::make_pair(mat, MatPair(Mesh(), matCount++))).first;
+			UInt64 cursorPos = stream.GetCursorPos();
+			data = static_cast<const char*>(stream.GetMappedPointer()) + cursorPos;
+			dataSize = static_cast<std::size_t>(stream.GetSize() - cursorPos);
 
-			Mesh& meshData = it.value().first;
-
-			meshData.faces.reserve(faceReserve);
-			meshData.vertices.reserve(vertexReserve);
-			faceReserve = 0;
-			vertexReserve = 0;
-
-			return &meshData;
-		};
-
-		// On prépare le mesh par défaut
-		Mesh* currentMesh = nullptr;
-
-		while (Advance(false))
+			stream.SetCursorPos(stream.GetSize());
+		}
+		else
 		{
-			switch (std::tolower(m_currentLine[0]))
+			constexpr std::size_t blockSize = 1024 * 1024;
+
+			std::size_t readSize = 0;
+			for (;;)
 			{
-				case '#': //< Comment
-					// Some softwares write comments to gives the number of vertex/faces an importer can expect
-					unsigned int data;
-					if (std::sscanf(m_currentLine.data(), "# position count: %u", &data) == 1)
-						m_positions.reserve(data);
-					else if (std::sscanf(m_currentLine.data(), "# normal count: %u", &data) == 1)
-						m_normals.reserve(data);
-					else if (std::sscanf(m_currentLine.data(), "# texcoords count: %u", &data) == 1)
-						m_texCoords.reserve(data);
-					else if (std::sscanf(m_currentLine.data(), "# face count: %u", &data) == 1)
-						faceReserve = data;
-					else if (std::sscanf(m_currentLine.data(), "# vertex count: %u", &data) == 1)
-						vertexReserve = data;
+				content.resize(readSize + blockSize);
 
+				std::size_t read = stream.Read(&content[readSize], blockSize);
+				readSize += read;
+				if (read < blockSize)
 					break;
+			}
+			content.resize(readSize);
 
-				case 'f': //< Face
-				{
-					if (m_currentLine.size() < 7) // Since we only treat triangles, this is the minimum length of a face line (f 1 2 3)
-					{
-						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-						if (!UnrecognizedLine())
-							return false;
-						#endif
-						break;
-					}
-
-					std::size_t vertexCount = std::count(m_currentLine.begin(), m_currentLine.end(), ' ');
-					if (vertexCount < 3)
-					{
-						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-						if (!UnrecognizedLine())
-							return false;
-						#endif
-						break;
-					}
-
-					if (!currentMesh)
-						currentMesh = GetMaterial(meshName, matName);
+			data = content.data();
+			dataSize = content.size();
+		}
 
-					Face face;
-					face.firstVertex = currentMesh->vertices.size();
-					face.vertexCount = vertexCount;
+		// Split the content in line-aligned chunks, parsed concurrently
+		std::size_t chunkCount = std::clamp<std::size_t>(dataSize / MinChunkSize, 1, std::size_t(TaskScheduler::GetWorkerCount()) * 4);
 
-					currentMesh->vertices.resize(face.firstVertex + vertexCount, FaceVertex{0, 0, 0});
+		std::vector<const char*> chunkBoundaries(chunkCount + 1);
+		chunkBoundaries[0] = data;
+		chunkBoundaries[chunkCount] = data + dataSize;
+		for (std::size_t i = 1; i < chunkCount; ++i)
+		{
+			const char* ptr = std::max(data + dataSize * i / chunkCount, chunkBoundaries[i - 1]);
+			const char* lineEnd = static_cast<const char*>(std::memchr(ptr, '\n', data + dataSize - ptr));
+			chunkBoundaries[i] = (lineEnd) ? lineEnd + 1 : data + dataSize;
+		}
 
-					bool error = false;
-					unsigned int pos = 2;
-					for (unsigned int i = 0; i < vertexCount; ++i)
-					{
-						int offset;
-						int n = 0;
-						int p = 0;
-						int t = 0;
+		std::vector<ChunkData> chunks(chunkCount);
+		ParallelFor(0, chunkCount, [&](std::size_t chunkIndex)
+		{
+			ParseChunk(chunkBoundaries[chunkIndex], chunkBoundaries[chunkIndex + 1], chunks[chunkIndex]);
+		}, 1);
 
-						if (std::sscanf(&m_currentLine[pos], "%d/%d/%d%n", &p, &t, &n, &offset) != 3)
-						{
-							if (std::sscanf(&m_currentLine[pos], "%d//%d%n", &p, &n, &offset) != 2)
-							{
-								if (std::sscanf(&m_currentLine[pos], "%d/%d%n", &p, &t, &offset) != 2)
-								{
-									if (std::sscanf(&m_currentLine[pos], "%d%n", &p, &offset) != 1)
-									{
-										#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-										if (!UnrecognizedLine())
-											return false;
-										#endif
-										error = true;
-										break;
-									}
-								}
-							}
-						}
+		#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
+		std::size_t firstLine = 0;
+		for (const ChunkData& chunk : chunks)
+		{
+			for (const UnparsedLine& unparsedLine : chunk.unparsedLines)
+			{
+				m_currentLine = unparsedLine.text;
+				m_lineCount = static_cast<unsigned int>(firstLine + unparsedLine.line);
+				if (!UnrecognizedLine())
+					return false;
+			}
 
-						if (p < 0)
-						{
-							p += static_cast<int>(m_positions.size());
-							if (p < 0)
-							{
-								Error("Vertex index out of range (" + std::to_string(p) + " < 0");
-								error = true;
-								break;
-							}
+			firstLine += chunk.lineCount;
+		}
+		#endif
 
-							++p;
-						}
+		// Merge vertex data
+		std::size_t normalCount = 0;
+		std::size_t positionCount = 0;
+		std::size_t texCoordCount = 0;
+		for (const ChunkData& chunk : chunks)
+		{
+			normalCount += chunk.normals.size();
+			positionCount += chunk.positions.size();
+			texCoordCount += chunk.texCoords.size();
 
-						if (n < 0)
-						{
-							n += static_cast<int>(m_normals.size());
-							if (n < 0)
-							{
-								Error("Normal index out of range (" + std::to_string(n) + " < 0");
-								error = true;
-								break;
-							}
+			if (chunk.hasMtlLib)
+				m_mtlLib = chunk.mtlLib;
+		}
 
-							++n;
-						}
+		m_normals.reserve(std::max(normalCount, reservedVertexCount));
+		m_positions.reserve(std::max(positionCount, reservedVertexCount));
+		m_texCoords.reserve(std::max(texCoordCount, reservedVertexCount));
 
-						if (t < 0)
-						{
-							t += static_cast<int>(m_texCoords.size());
-							if (t < 0)
-							{
-								Error("Texture coordinates index out of range (" + std::to_string(t) + " < 0");
-								error = true;
-								break;
-							}
+		// Sort meshes by material and group
+		using MatPair = std::pair<Mesh, unsigned int>;
+		tsl::ordered_map<std::string, tsl::ordered_map<std::string, MatPair>> meshesByName;
 
-							++t;
-						}
+		unsigned int matCount = 0;
+		auto GetMaterial = [&] (const std::string& mesh, const std::string& mat) -> Mesh*
+		{
+			auto& map = meshesByName[mesh];
+			auto it = map.find(mat);
+			if (it == map.end())
+				it = map.insert(std::make_pair(mat, MatPair(Mesh(), matCount++))).first;
 
-						if (static_cast<std::size_t>(p) > m_positions.size())
-						{
-							Error("Vertex index out of range (" + std::to_string(p) + " >= " + std::to_string(m_positions.size()) + ')');
-							error = true;
-							break;
-						}
-						else if (n != 0 && static_cast<std::size_t>(n) > m_normals.size())
-						{
-							Error("Normal index out of range (" + std::to_string(n) + " >= " + std::to_string(m_normals.size()) + ')');
-							error = true;
-							break;
-						}
-						else if (t != 0 && static_cast<std::size_t>(t) > m_texCoords.size())
-						{
-							Error("TexCoord index out of range (" + std::to_string(t) + " >= " + std::to_string(m_texCoords.size()) + ')');
-							error = true;
-							break;
-						}
+			return &it.value().first;
+		};
 
-						currentMesh->vertices[face.firstVertex + i].normal = static_cast<UInt32>(n);
-						currentMesh->vertices[face.firstVertex + i].position = static_cast<UInt32>(p);
-						currentMesh->vertices[face.firstVertex + i].texCoord = static_cast<UInt32>(t);
+		auto IndexToString = [](std::size_t index) -> std::string
+		{
+			return (index != InvalidIndex) ? std::to_string(index) : "< 0";
+		};
 
-						pos += offset;
-					}
+		std::string matName, meshName;
+		matName = meshName = "default";
 
-					if (!error)
-						currentMesh->faces.push_back(std::move(face));
-					else
-						currentMesh->vertices.resize(face.firstVertex); //< Remove vertices
+		std::size_t firstChunkLine = 0;
+		for (ChunkData& chunk : chunks)
+		{
+			std::size_t firstNormal = m_normals.size();
+			std::size_t firstPosition = m_positions.size();
+			std::size_t firstTexCoord = m_texCoords.size();
 
-					break;
-				}
+			m_normals.insert(m_normals.end(), chunk.normals.begin(), chunk.normals.end());
+			m_positions.insert(m_positions.end(), chunk.positions.begin(), chunk.positions.end());
+			m_texCoords.insert(m_texCoords.end(), chunk.texCoords.begin(), chunk.texCoords.end());
 
-				case 'm': //< MTLLib
-				{
-					const char prefix[] = "mtllib ";
-					if (!StartsWith(m_currentLine, prefix))
-					{
-#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-						if (!UnrecognizedLine())
-							return false;
-#endif
+			for (FaceRun& run : chunk.runs)
+			{
+				if (run.meshNameSet)
+					meshName = std::move(run.meshName);
 
-						break;
-					}
+				if (run.materialNameSet)
+					matName = std::move(run.materialName);
 
-					m_mtlLib = m_currentLine.substr(sizeof(prefix) - 1);
-					break;
-				}
+				if (run.faces.empty())
+					continue;
 
-				case 'g': //< Group (inside a mesh)
-				case 'o': //< Object (defines a mesh)
+				for (const RelativeIndex& relativeIndex : run.relativeIndices)
 				{
-					if (m_currentLine.size() <= 2 || m_currentLine[1] != ' ')
+					OBJParser::FaceVertex& vertex = run.vertices[relativeIndex.vertexIndex];
+
+					auto Resolve = [&](std::size_t& index, std::size_t firstIndex)
 					{
-#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-						if (!UnrecognizedLine())
-							return false;
-#endif
-						break;
-					}
+						long long absoluteIndex = static_cast<long long>(firstIndex) + relativeIndex.localIndex;
+						index = (absoluteIndex > 0) ? static_cast<std::size_t>(absoluteIndex) : InvalidIndex;
+					};
 
-					std::string objectName = m_currentLine.substr(2);
-					if (objectName.empty())
+					switch (relativeIndex.component)
 					{
-						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-						if (!UnrecognizedLine())
-							return false;
-						#endif
-						break;
+						case IndexComponent::Normal:   Resolve(vertex.normal, firstNormal); break;
+						case IndexComponent::Position: Resolve(vertex.position, firstPosition); break;
+						case IndexComponent::TexCoord: Resolve(vertex.texCoord, firstTexCoord); break;
 					}
-
-					meshName = objectName;
-					currentMesh = nullptr;
-					break;
 				}
 
-#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-				case 's': //< Smooth
-					if (m_currentLine.size() <= 2 || m_currentLine[1] == ' ')
-					{
-						std::string param = m_currentLine.substr(2);
-						if (param != "all" && param != "on" && param != "off" && !IsNumber(param))
-						{
-							if (!UnrecognizedLine())
-								return false;
-						}
-					}
-					else if (!UnrecognizedLine())
-						return false;
-					break;
-#endif
+				Mesh* currentMesh = GetMaterial(meshName, matName);
 
-				case 'u': //< Usemtl
+				for (std::size_t i = 0; i < run.faces.size(); ++i)
 				{
-					const char prefix[] = "usemtl ";
-					if (!StartsWith(m_currentLine, prefix))
-					{
-#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-						if (!UnrecognizedLine())
-							return false;
-#endif
-
-						break;
-					}
+					const Face& face = run.faces[i];
+					const FaceVertex* vertices = &run.vertices[face.firstVertex];
 
-					std::string newMatName = m_currentLine.substr(sizeof(prefix) - 1);
-					if (newMatName.empty())
+					bool error = false;
+					for (std::size_t j = 0; j < face.vertexCount; ++j)
 					{
-#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-						if (!UnrecognizedLine())
-							return false;
-#endif
+						const FaceVertex& vertex = vertices[j];
+
+						std::string message;
+						if (vertex.position == 0 || vertex.position > positionCount)
+							message = "Vertex index out of range (" + IndexToString(vertex.position) + " > " + std::to_string(positionCount) + ')';
+						else if (vertex.normal > normalCount)
+							message = "Normal index out of range (" + IndexToString(vertex.normal) + " > " + std::to_string(normalCount) + ')';
+						else if (vertex.texCoord > texCoordCount)
+							message = "TexCoord index out of range (" + IndexToString(vertex.texCoord) + " > " + std::to_string(texCoordCount) + ')';
+						else
+							continue;
+
+						m_lineCount = static_cast<unsigned int>(firstChunkLine + run.faceLines[i]);
+						Error(message);
+						error = true;
 						break;
 					}
 
-					matName = std::move(newMatName);
-					currentMesh = nullptr;
-					break;
-				}
-
-				case 'v': //< Position/Normal/Texcoords
-				{
-					if (m_currentLine.size() < 7)
-					{
-#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-						if (!UnrecognizedLine())
-							return false;
-#endif
-						break;
-					}
+					if (error)
+						continue;
 
-					if (std::isspace(m_currentLine[1]))
-					{
-						Vector4f vertex(Vector3f::Zero(), 1.f);
-						unsigned int paramCount = std::sscanf(&m_currentLine[2], " %f %f %f %f", &vertex.x, &vertex.y, &vertex.z, &vertex.w);
-						if (paramCount >= 1)
-							m_positions.push_back(vertex);
-						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-						else if (!UnrecognizedLine())
-							return false;
-						#endif
-					}
-					else if (m_currentLine[1] == 'n' && std::isspace(m_currentLine[2]))
-					{
-						Vector3f normal(Vector3f::Zero());
-						unsigned int paramCount = std::sscanf(&m_currentLine[3], " %f %f %f", &normal.x, &normal.y, &normal.z);
-						if (paramCount == 3)
-							m_normals.push_back(normal);
-						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-						else if (!UnrecognizedLine())
-							return false;
-						#endif
-					}
-					else if (m_currentLine[1] == 't' && std::isspace(m_currentLine[2]))
-					{
-						Vector3f uvw(Vector3f::Zero());
-						unsigned int paramCount = std::sscanf(&m_currentLine[3], " %f %f %f", &uvw.x, &uvw.y, &uvw.z);
-						if (paramCount >= 2)
-							m_texCoords.push_back(uvw);
-						#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-						else if (!UnrecognizedLine())
-							return false;
-						#endif
-					}
-					#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-					else if (!UnrecognizedLine())
-						return false;
-					#endif
+					Face& newFace = currentMesh->faces.emplace_back();
+					newFace.firstVertex = currentMesh->vertices.size();
+					newFace.vertexCount = face.vertexCount;
 
-					break;
+					currentMesh->vertices.insert(currentMesh->vertices.end(), vertices, vertices + face.vertexCount);
 				}
-
-				default:
-					#if NAZARA_UTILITY_STRICT_RESOURCE_PARSING
-					if (!UnrecognizedLine())
-						return false;
-					#endif
-					break;
 			}
+
+			firstChunkLine += chunk.lineCount;
+
+			// Release chunk memory as soon as possible
+			chunk = ChunkData();
 		}
 
 		std::unordered_map<std::string, unsigned int> materials;
@@ -644,7 +978,7 @@ namespace Nz
 
 				m_lineCount++;
 
-				m_currentLine = m_currentStream->ReadLine();
+				m_currentLine = m_currentStream->ReadLineView();
 				if (std::size_t p = m_currentLine.find('#'); p != m_currentLine.npos)
 				{
 					if (p > 0)
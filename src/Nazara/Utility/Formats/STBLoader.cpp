@@ -8,6 +8,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Stream.hpp>
 #include <Nazara/Utility/Image.hpp>
+#include <limits>
 #include <unordered_set>
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
@@ -37,6 +38,22 @@ namespace Nz
 
 		static stbi_io_callbacks callbacks = {Read, Skip, Eof};
 
+		// Memory-mapped streams are handed to stb_image directly, sparing its internal copies
+		bool GetMappedRemaining(Stream& stream, const stbi_uc** data, int* length)
+		{
+			if (!stream.IsMemoryMapped() || stream.IsBufferingEnabled())
+				return false;
+
+			UInt64 cursorPos = stream.GetCursorPos();
+			UInt64 remaining = stream.GetSize() - cursorPos;
+			if (remaining > static_cast<UInt64>(std::numeric_limits<int>::max()))
+				return false;
+
+			*data = static_cast<const stbi_uc*>(stream.GetMappedPointer()) + cursorPos;
+			*length = static_cast<int>(remaining);
+			return true;
+		}
+
 		bool IsSupported(const std::string_view& extension)
 		{
 			static std::unordered_set<std::string_view> supportedExtensions = {"bmp", "gif", "hdr", "jpg", "jpeg", "pic", "png", "ppm", "pgm", "psd", "tga"};
@@ -50,10 +67,16 @@ namespace Nz
 				return Ternary::False;
 
 			int width, height, bpp;
-			if (stbi_info_from_callbacks(&callbacks, &stream, &width, &height, &bpp))
-				return Ternary::True;
+			int result;
+
+			const stbi_uc* data;
+			int length;
+			if (GetMappedRemaining(stream, &data, &length))
+				result = stbi_info_from_memory(data, length, &width, &height, &bpp);
 			else
-				return Ternary::False;
+				result = stbi_info_from_callbacks(&callbacks, &stream, &width, &height, &bpp);
+
+			return (result) ? Ternary::True : Ternary::False;
 		}
 
 		std::shared_ptr<Image> Load(Stream& stream, const ImageParams& parameters)
@@ -62,7 +85,18 @@ namespace Nz
 			// Ceci à cause d'un bug de STB lorsqu'il s'agit de charger certaines images (ex: JPG) en "default"
 
 			int width, height, bpp;
-			UInt8* ptr = stbi_load_from_callbacks(&callbacks, &stream, &width, &height, &bpp, STBI_rgb_alpha);
+			UInt8* ptr;
+
+			const stbi_uc* data;
+			int length;
+			if (GetMappedRemaining(stream, &data, &length))
+			{
+				ptr = stbi_load_from_memory(data, length, &width, &height, &bpp, STBI_rgb_alpha);
+				stream.SetCursorPos(stream.GetSize());
+			}
+			else
+				ptr = stbi_load_from_callbacks(&callbacks, &stream, &width, &height, &bpp, STBI_rgb_alpha);
+
 			if (!ptr)
 			{
 				NazaraError("Failed to load image: " + std::string(stbi_failure_reason()));
@@ -5,11 +5,17 @@
 #include <Nazara/Utility/Image.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
 #include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Utility/BlockCompression.hpp>
 #include <Nazara/Utility/Config.hpp>
+#include <Nazara/Utility/ImageResampler.hpp>
 #include <Nazara/Utility/PixelFormat.hpp>
 #include <Nazara/Utility/Utility.hpp>
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <vector>
 #include <Nazara/Utility/Debug.hpp>
 
 ///TODO: Rajouter des warnings (Formats compressés avec les méthodes Copy/Update, tests taille dans Copy)
@@ -32,6 +38,70 @@ namespace Nz
 		{
 			return &base[(width*(height*z + y) + x)*bpp];
 		}
+
+		inline UInt8* GetPixelPtr(UInt8* base, PixelFormat format, unsigned int x, unsigned int y, unsigned int z, unsigned int width, unsigned int height)
+		{
+			if (!PixelFormatInfo::IsCompressed(format))
+				return GetPixelPtr(base, PixelFormatInfo::GetBytesPerPixel(format), x, y, z, width, height);
+
+			// Pointer to the block containing the pixel
+			std::size_t offset = PixelFormatInfo::ComputeSize(format, width, height, z);
+			offset += PixelFormatInfo::ComputeSize(format, width, y - y % BlockCompression::BlockDim, 1);
+			offset += PixelFormatInfo::ComputeSize(format, x - x % BlockCompression::BlockDim, 1, 1);
+
+			return &base[offset];
+		}
+
+		bool IsBlockConversionSupported(PixelFormat srcFormat, PixelFormat dstFormat)
+		{
+			// Block compressed formats are converted through RGBA8
+			bool srcCompressed = PixelFormatInfo::IsCompressed(srcFormat);
+			bool dstCompressed = PixelFormatInfo::IsCompressed(dstFormat);
+			if (!srcCompressed && !dstCompressed)
+				return false;
+
+			if (srcCompressed)
+			{
+				if (!BlockCompression::IsFormatSupported(srcFormat))
+					return false;
+			}
+			else if (srcFormat != PixelFormat::RGBA8 && !PixelFormatInfo::IsConversionSupported(srcFormat, PixelFormat::RGBA8))
+				return false;
+
+			if (dstCompressed)
+				return BlockCompression::IsFormatSupported(dstFormat);
+			else
+				return dstFormat == PixelFormat::RGBA8 || PixelFormatInfo::IsConversionSupported(PixelFormat::RGBA8, dstFormat);
+		}
+
+		bool ConvertBlockCompressedLevel(PixelFormat srcFormat, PixelFormat dstFormat, const UInt8* src, UInt8* dst, unsigned int width, unsigned int height, unsigned int depth)
+		{
+			std::size_t pixelCount = std::size_t(width) * height * depth;
+
+			std::unique_ptr<UInt8[]> rgbaPixels;
+			const UInt8* rgba = src;
+			if (PixelFormatInfo::IsCompressed(srcFormat))
+			{
+				UInt8* decompressed = (dstFormat == PixelFormat::RGBA8) ? dst : (rgbaPixels = std::make_unique<UInt8[]>(pixelCount * 4)).get();
+				BlockCompression::DecompressLevel(srcFormat, src, width, height, depth, decompressed);
+				rgba = decompressed;
+			}
+			else if (srcFormat != PixelFormat::RGBA8)
+			{
+				rgbaPixels = std::make_unique<UInt8[]>(pixelCount * 4);
+				if (!PixelFormatInfo::Convert(srcFormat, PixelFormat::RGBA8, src, &src[pixelCount * PixelFormatInfo::GetBytesPerPixel(srcFormat)], rgbaPixels.get()))
+					return false;
+
+				rgba = rgbaPixels.get();
+			}
+
+			if (PixelFormatInfo::IsCompressed(dstFormat))
+				BlockCompression::CompressLevel(dstFormat, rgba, width, height, depth, dst);
+			else if (dstFormat != PixelFormat::RGBA8)
+				return PixelFormatInfo::Convert(PixelFormat::RGBA8, dstFormat, rgba, &rgba[pixelCount * 4], dst);
+
+			return true;
+		}
 	}
 
 	bool ImageParams::IsValid() const
@@ -85,7 +155,7 @@ namespace Nz
 			return false;
 		}
 
-		if (!PixelFormatInfo::IsConversionSupported(m_sharedImage->format, newFormat))
+		if (!PixelFormatInfo::IsConversionSupported(m_sharedImage->format, newFormat) && !IsBlockConversionSupported(m_sharedImage->format, newFormat))
 		{
 			NazaraError("Conversion from " + PixelFormatInfo::GetName(m_sharedImage->format) + " to " + PixelFormatInfo::GetName(newFormat) + " is not supported");
 			return false;
@@ -103,26 +173,45 @@ namespace Nz
 		// Les images 3D et cubemaps sont stockés de la même façon
 		unsigned int depth = (m_sharedImage->type == ImageType::Cubemap) ? 6 : m_sharedImage->depth;
 
+		PixelFormat srcFormat = m_sharedImage->format;
+		std::size_t srcPixelSize = PixelFormatInfo::GetBytesPerPixel(srcFormat);
+		std::size_t dstPixelSize = PixelFormatInfo::GetBytesPerPixel(newFormat);
+
+		// Block compressed formats are compressed/decompressed by block rows, which are made of multiple pixel rows
+		bool blockCompressed = PixelFormatInfo::IsCompressed(srcFormat) || PixelFormatInfo::IsCompressed(newFormat);
+
 		for (unsigned int i = 0; i < levels.size(); ++i)
 		{
-			unsigned int pixelsPerFace = width * height;
-			levels[i] = std::make_unique<UInt8[]>(pixelsPerFace * depth * PixelFormatInfo::GetBytesPerPixel(newFormat));
+			const UInt8* src = m_sharedImage->levels[i].get();
+
+			// Faces/slices are stored one after the other, a level can be converted as a single range of rows
+			std::size_t rowCount = std::size_t(height) * depth;
+			levels[i].reset(new UInt8[PixelFormatInfo::ComputeSize(newFormat, width, height, depth)]); //< every byte is written by the conversion, skip make_unique zero-initialization
 
 			UInt8* dst = levels[i].get();
-			UInt8* src = m_sharedImage->levels[i].get();
-			unsigned int srcStride = pixelsPerFace * PixelFormatInfo::GetBytesPerPixel(m_sharedImage->format);
-			unsigned int dstStride = pixelsPerFace * PixelFormatInfo::GetBytesPerPixel(newFormat);
+			std::size_t srcRowSize = width * srcPixelSize;
+			std::size_t dstRowSize = width * dstPixelSize;
 
-			for (unsigned int d = 0; d < depth; ++d)
+			std::atomic_bool failed(false);
+			if (blockCompressed)
+				failed = !ConvertBlockCompressedLevel(srcFormat, newFormat, src, dst, width, height, depth);
+			else
 			{
-				if (!PixelFormatInfo::Convert(m_sharedImage->format, newFormat, src, &src[srcStride], dst))
+				// Rows are converted in parallel, by chunks of at least 16K pixels to keep the scheduling overhead low
+				ParallelForRange(0, rowCount, [&](std::size_t begin, std::size_t end)
 				{
-					NazaraError("Failed to convert image");
-					return false;
-				}
+					if (failed.load(std::memory_order_relaxed))
+						return;
+
+					if (!PixelFormatInfo::Convert(srcFormat, newFormat, &src[begin * srcRowSize], &src[end * srcRowSize], &dst[begin * dstRowSize]))
+						failed = true;
+				}, ComputeGrainSize(rowCount, std::max<std::size_t>(16 * 1024 / width, 1)));
+			}
 
-				src += srcStride;
-				dst += dstStride;
+			if (failed)
+			{
+				NazaraError("Failed to convert image");
+				return false;
 			}
 
 			if (width > 1)
@@ -560,6 +649,40 @@ namespace Nz
 		return true;
 	}
 
+	bool Image::GenerateMipmaps(ImageFilter filter)
+	{
+		#if NAZARA_UTILITY_SAFE
+		if (m_sharedImage == &emptyImage)
+		{
+			NazaraError("Image must be valid");
+			return false;
+		}
+		#endif
+
+		if (!ImageResampler::IsFormatSupported(m_sharedImage->format))
+		{
+			NazaraError("Cannot generate mipmaps of " + PixelFormatInfo::GetName(m_sharedImage->format) + " images");
+			return false;
+		}
+
+		// Level storage halves the layer count of arrays like a spatial dimension, resampling them would drop layers
+		if (m_sharedImage->type == ImageType::E1D_Array || m_sharedImage->type == ImageType::E2D_Array)
+		{
+			NazaraError("Cannot generate mipmaps of array images");
+			return false;
+		}
+
+		EnsureOwnership();
+		SetLevelCount(GetMaxLevel());
+
+		// Each level is resampled from the previous one, their faces and rows being resampled in parallel
+		ImageResampler resampler(m_sharedImage->format, filter);
+		for (UInt8 level = 1; level < m_sharedImage->levels.size(); ++level)
+			resampler.Resample(m_sharedImage->type, m_sharedImage->levels[level - 1].get(), GetResampledSize(level - 1), m_sharedImage->levels[level].get(), GetResampledSize(level));
+
+		return true;
+	}
+
 	const UInt8* Image::GetConstPixels(unsigned int x, unsigned int y, unsigned int z, UInt8 level) const
 	{
 		#if NAZARA_UTILITY_SAFE
@@ -601,7 +724,7 @@ namespace Nz
 		}
 		#endif
 
-		return GetPixelPtr(m_sharedImage->levels[level].get(), PixelFormatInfo::GetBytesPerPixel(m_sharedImage->format), x, y, z, width, height);
+		return GetPixelPtr(m_sharedImage->levels[level].get(), m_sharedImage->format, x, y, z, width, height);
 	}
 
 	unsigned int Image::GetDepth(UInt8 level) const
@@ -647,29 +770,12 @@ namespace Nz
 
 	std::size_t Image::GetMemoryUsage() const
 	{
-		unsigned int width = m_sharedImage->width;
-		unsigned int height = m_sharedImage->height;
-		unsigned int depth = m_sharedImage->depth;
-
-		unsigned int size = 0;
-		for (unsigned int i = 0; i < m_sharedImage->levels.size(); ++i)
-		{
-			size += width * height * depth;
-
-			if (width > 1)
-				width >>= 1;
-
-			if (height > 1)
-				height >>= 1;
+		// Summing levels sizes also takes block compressed formats into account
+		std::size_t size = 0;
+		for (UInt8 i = 0; i < m_sharedImage->levels.size(); ++i)
+			size += GetMemoryUsage(i);
 
-			if (depth > 1)
-				depth >>= 1;
-		}
-
-		if (m_sharedImage->type == ImageType::Cubemap)
-			size *= 6;
-
-		return size * PixelFormatInfo::GetBytesPerPixel(m_sharedImage->format);
+		return size;
 	}
 
 	std::size_t Image::GetMemoryUsage(UInt8 level) const
@@ -770,7 +876,7 @@ namespace Nz
 
 		EnsureOwnership();
 
-		return GetPixelPtr(m_sharedImage->levels[level].get(), PixelFormatInfo::GetBytesPerPixel(m_sharedImage->format), x, y, z, width, height);
+		return GetPixelPtr(m_sharedImage->levels[level].get(), m_sharedImage->format, x, y, z, width, height);
 	}
 
 	Vector3ui Image::GetSize(UInt8 level) const
@@ -1155,6 +1261,99 @@ namespace Nz
 		return true;
 	}
 
+	bool Image::Resize(const Vector3ui& size, ImageFilter filter)
+	{
+		#if NAZARA_UTILITY_SAFE
+		if (m_sharedImage == &emptyImage)
+		{
+			NazaraError("Image must be valid");
+			return false;
+		}
+
+		if (size.x == 0 || size.y == 0 || size.z == 0)
+		{
+			NazaraError("Invalid size");
+			return false;
+		}
+		#endif
+
+		if (!ImageResampler::IsFormatSupported(m_sharedImage->format))
+		{
+			NazaraError("Cannot resize " + PixelFormatInfo::GetName(m_sharedImage->format) + " images");
+			return false;
+		}
+
+		// Only spatial dimensions can be resized, not the layer count of arrays
+		ImageType type = m_sharedImage->type;
+		bool validSize;
+		switch (type)
+		{
+			case ImageType::E1D:
+				validSize = (size.y == 1 && size.z == 1);
+				break;
+
+			case ImageType::E1D_Array:
+				validSize = (size.y == m_sharedImage->height && size.z == 1);
+				break;
+
+			case ImageType::E2D:
+				validSize = (size.z == 1);
+				break;
+
+			case ImageType::E2D_Array:
+				validSize = (size.z == m_sharedImage->depth);
+				break;
+
+			case ImageType::E3D:
+				validSize = true;
+				break;
+
+			case ImageType::Cubemap:
+				validSize = (size.x == size.y && size.z == 1);
+				break;
+
+			default:
+				NazaraError("Image type not handled (0x" + NumberToString(UnderlyingCast(type), 16) + ')');
+				return false;
+		}
+
+		if (!validSize)
+		{
+			NazaraError("Size " + size.ToString() + " is not valid for this image type");
+			return false;
+		}
+
+		if (size == GetSize())
+			return true;
+
+		// Mipmaps are regenerated from the resized image
+		UInt8 levelCount = std::min(UInt8(m_sharedImage->levels.size()), GetMaxLevel(type, size.x, size.y, size.z));
+		if (levelCount > 1 && (type == ImageType::E1D_Array || type == ImageType::E2D_Array))
+		{
+			NazaraError("Cannot resize array images with mipmaps");
+			return false;
+		}
+		SharedImage::PixelContainer levels(levelCount);
+		std::vector<Vector3ui> levelSizes(levelCount);
+		for (UInt8 i = 0; i < levelCount; ++i)
+		{
+			levelSizes[i] = Vector3ui(GetLevelSize(size.x, i), GetLevelSize(size.y, i), (type == ImageType::Cubemap) ? 6 : GetLevelSize(size.z, i));
+			levels[i].reset(new UInt8[PixelFormatInfo::ComputeSize(m_sharedImage->format, levelSizes[i].x, levelSizes[i].y, levelSizes[i].z)]);
+		}
+
+		ImageResampler resampler(m_sharedImage->format, filter);
+		resampler.Resample(type, m_sharedImage->levels[0].get(), GetResampledSize(0), levels[0].get(), levelSizes[0]);
+		for (UInt8 i = 1; i < levelCount; ++i)
+			resampler.Resample(type, levels[i - 1].get(), levelSizes[i - 1], levels[i].get(), levelSizes[i]);
+
+		SharedImage* newImage = new SharedImage(1, type, m_sharedImage->format, std::move(levels), size.x, size.y, size.z);
+
+		ReleaseImage();
+		m_sharedImage = newImage;
+
+		return true;
+	}
+
 	bool Image::SaveToFile(const std::filesystem::path& filePath, const ImageParams& params)
 	{
 		Utility* utility = Utility::Instance();
@@ -1406,8 +1605,8 @@ namespace Nz
 
 	UInt8 Image::GetMaxLevel(unsigned int width, unsigned int height, unsigned int depth)
 	{
-		// Le niveau maximal est le niveau requis pour la plus grande taille
-		return std::max(IntegralLog2(std::max({width, height, depth})), 1U);
+		// Le niveau maximal est le niveau requis pour la plus grande taille (jusqu'à 1x1x1 inclus)
+		return static_cast<UInt8>(IntegralLog2(std::max({width, height, depth})) + 1);
 	}
 
 	UInt8 Image::GetMaxLevel(ImageType type, unsigned int width, unsigned int height, unsigned int depth)
@@ -1476,6 +1675,13 @@ namespace Nz
 		}
 	}
 
+	Vector3ui Image::GetResampledSize(UInt8 level) const
+	{
+		// Cubemaps are resampled as an array of six faces
+		unsigned int depth = (m_sharedImage->type == ImageType::Cubemap) ? 6 : GetLevelSize(m_sharedImage->depth, level);
+		return Vector3ui(GetLevelSize(m_sharedImage->width, level), GetLevelSize(m_sharedImage->height, level), depth);
+	}
+
 	void Image::ReleaseImage()
 	{
 		if (m_sharedImage == &emptyImage)
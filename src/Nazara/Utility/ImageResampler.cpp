@@ -0,0 +1,512 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/ImageResampler.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
+#include <Nazara/Math/Algorithm.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+	#define NAZARA_UTILITY_RESAMPLER_SSE
+	#include <xmmintrin.h>
+#endif
+
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		constexpr float KaiserAlpha = 4.f;
+		constexpr float KaiserWidth = 3.f;
+		constexpr unsigned int RowChunkSize = 64; //< Destination rows resampled together, sharing their horizontally filtered source rows
+
+		float BesselI0(float x)
+		{
+			// Power series of the modified Bessel function of the first kind, sum of ((x/2)^k / k!)^2
+			float halfX = x * 0.5f;
+			float sum = 1.f;
+			float term = 1.f;
+			for (unsigned int k = 1; k < 32; ++k)
+			{
+				term *= halfX / k;
+
+				float squaredTerm = term * term;
+				sum += squaredTerm;
+				if (squaredTerm < sum * 1e-8f)
+					break;
+			}
+
+			return sum;
+		}
+
+		float EvaluateFilter(ImageFilter filter, float x)
+		{
+			switch (filter)
+			{
+				case ImageFilter::Box:
+					return (x >= -0.5f && x < 0.5f) ? 1.f : 0.f;
+
+				case ImageFilter::Kaiser:
+				{
+					if (std::abs(x) >= KaiserWidth)
+						return 0.f;
+
+					float sinc = (x != 0.f) ? std::sin(Pi<float> * x) / (Pi<float> * x) : 1.f;
+					float ratio = x / KaiserWidth;
+
+					return sinc * BesselI0(KaiserAlpha * std::sqrt(1.f - ratio * ratio)) / BesselI0(KaiserAlpha);
+				}
+
+				case ImageFilter::Triangle:
+					return std::max(1.f - std::abs(x), 0.f);
+			}
+
+			NazaraError("Image filter not handled (0x" + NumberToString(UnderlyingCast(filter), 16) + ')');
+			return 0.f;
+		}
+
+		float GetFilterSupport(ImageFilter filter)
+		{
+			switch (filter)
+			{
+				case ImageFilter::Box:
+					return 0.5f;
+
+				case ImageFilter::Kaiser:
+					return KaiserWidth;
+
+				case ImageFilter::Triangle:
+					return 1.f;
+			}
+
+			NazaraError("Image filter not handled (0x" + NumberToString(UnderlyingCast(filter), 16) + ')');
+			return 0.f;
+		}
+
+		float LinearToSrgb(float value)
+		{
+			return (value <= 0.0031308f) ? value * 12.92f : 1.055f * std::pow(value, 1.f / 2.4f) - 0.055f;
+		}
+
+		float SrgbToLinear(float value)
+		{
+			return (value <= 0.04045f) ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+		}
+
+		void AccumulateRow(float* dst, const float* src, float weight, std::size_t count)
+		{
+			std::size_t i = 0;
+
+			#ifdef NAZARA_UTILITY_RESAMPLER_SSE
+			__m128 weights = _mm_set1_ps(weight);
+			for (; i + 4 <= count; i += 4)
+				_mm_storeu_ps(&dst[i], _mm_add_ps(_mm_loadu_ps(&dst[i]), _mm_mul_ps(weights, _mm_loadu_ps(&src[i]))));
+			#endif
+
+			for (; i < count; ++i)
+				dst[i] += weight * src[i];
+		}
+
+		void FilterRow(const float* src, unsigned int channelCount, std::size_t dstWidth, const UInt32* offsets, const UInt32* indices, const float* weights, float* dst)
+		{
+			#ifdef NAZARA_UTILITY_RESAMPLER_SSE
+			if (channelCount == 4)
+			{
+				// One pixel per vector
+				for (std::size_t i = 0; i < dstWidth; ++i)
+				{
+					__m128 sum = _mm_setzero_ps();
+					for (UInt32 tap = offsets[i]; tap < offsets[i + 1]; ++tap)
+						sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights[tap]), _mm_loadu_ps(&src[indices[tap] * 4])));
+
+					_mm_storeu_ps(&dst[i * 4], sum);
+				}
+
+				return;
+			}
+			#endif
+
+			for (std::size_t i = 0; i < dstWidth; ++i)
+			{
+				float* pixel = &dst[i * channelCount];
+				std::fill(pixel, pixel + channelCount, 0.f);
+
+				for (UInt32 tap = offsets[i]; tap < offsets[i + 1]; ++tap)
+				{
+					const float* srcPixel = &src[indices[tap] * channelCount];
+					for (unsigned int c = 0; c < channelCount; ++c)
+						pixel[c] += weights[tap] * srcPixel[c];
+				}
+			}
+		}
+	}
+
+	/*!
+	* \ingroup utility
+	* \class Nz::ImageResampler
+	* \brief Utility class that resamples image levels using a separable filter
+	*
+	* Each channel is filtered independently in linear space, sRGB formats are converted to linear space before filtering (except for their alpha channel).
+	*/
+
+	ImageResampler::ImageResampler(PixelFormat format, ImageFilter filter) :
+	m_filter(filter),
+	m_alphaChannel(-1),
+	m_channelCount(0),
+	m_isFloat(false),
+	m_isSrgb(false)
+	{
+		switch (format)
+		{
+			case PixelFormat::A8:
+				m_alphaChannel = 0;
+				[[fallthrough]];
+			case PixelFormat::L8:
+			case PixelFormat::R8:
+				m_channelCount = 1;
+				break;
+
+			case PixelFormat::LA8:
+				m_alphaChannel = 1;
+				[[fallthrough]];
+			case PixelFormat::RG8:
+				m_channelCount = 2;
+				break;
+
+			case PixelFormat::BGR8_SRGB:
+			case PixelFormat::RGB8_SRGB:
+				m_isSrgb = true;
+				[[fallthrough]];
+			case PixelFormat::BGR8:
+			case PixelFormat::RGB8:
+				m_channelCount = 3;
+				break;
+
+			case PixelFormat::BGRA8_SRGB:
+			case PixelFormat::RGBA8_SRGB:
+				m_isSrgb = true;
+				[[fallthrough]];
+			case PixelFormat::BGRA8:
+			case PixelFormat::RGBA8:
+				m_alphaChannel = 3;
+				m_channelCount = 4;
+				break;
+
+			case PixelFormat::R32F:
+				m_channelCount = 1;
+				m_isFloat = true;
+				break;
+
+			case PixelFormat::RG32F:
+				m_channelCount = 2;
+				m_isFloat = true;
+				break;
+
+			case PixelFormat::RGB32F:
+				m_channelCount = 3;
+				m_isFloat = true;
+				break;
+
+			case PixelFormat::RGBA32F:
+				m_alphaChannel = 3;
+				m_channelCount = 4;
+				m_isFloat = true;
+				break;
+
+			default:
+				NazaraError("Pixel format " + PixelFormatInfo::GetName(format) + " cannot be resampled");
+				break;
+		}
+
+		for (unsigned int i = 0; i < 256; ++i)
+		{
+			m_linearTable[i] = i / 255.f;
+			m_srgbTable[i] = SrgbToLinear(i / 255.f);
+		}
+	}
+
+	/*!
+	* \brief Resamples a level
+	*
+	* \param type Type of the image, telling which axes are filtered
+	* \param src Pixels of the source level
+	* \param srcSize Size of the source level (depth being the slice count of arrays and 6 for cubemaps)
+	* \param dst Pixels of the destination level
+	* \param dstSize Size of the destination level
+	*
+	* \remark Slices of arrays and faces of cubemaps are resampled independently, destination slice i coming from source slice i
+	* \remark Rows are resampled in parallel
+	*/
+	void ImageResampler::Resample(ImageType type, const UInt8* src, const Vector3ui& srcSize, UInt8* dst, const Vector3ui& dstSize) const
+	{
+		NazaraAssert(m_channelCount > 0, "Unsupported pixel format");
+		NazaraAssert(src && dst, "Invalid pixels");
+		NazaraAssert(srcSize.x > 0 && srcSize.y > 0 && srcSize.z > 0, "Invalid source size");
+		NazaraAssert(dstSize.x > 0 && dstSize.y > 0 && dstSize.z > 0, "Invalid destination size");
+
+		bool filterY = (type != ImageType::E1D && type != ImageType::E1D_Array);
+		bool filterZ = (type == ImageType::E3D);
+
+		NazaraAssert(filterY || srcSize.y >= dstSize.y, "Array layers cannot be resampled");
+		NazaraAssert(filterZ || srcSize.z >= dstSize.z, "Array layers cannot be resampled");
+
+		Contributions xContributions = ComputeContributions(srcSize.x, dstSize.x);
+		Contributions yContributions = (filterY) ? ComputeContributions(srcSize.y, dstSize.y) : ComputeIdentity(dstSize.y);
+
+		std::size_t pixelSize = m_channelCount * ((m_isFloat) ? sizeof(float) : sizeof(UInt8));
+		std::size_t srcSliceSize = std::size_t(srcSize.x) * srcSize.y * pixelSize;
+		std::size_t dstRowSize = std::size_t(dstSize.x) * pixelSize;
+		std::size_t dstSliceSize = dstRowSize * dstSize.y;
+		std::size_t dstRowLength = std::size_t(dstSize.x) * m_channelCount; //< floats per filtered row
+		std::size_t minRowCount = std::max<std::size_t>(4096 / dstSize.x, 1);
+
+		// Calls func(slice, rowBegin, rowEnd) for chunks of rows of [begin, end) not crossing slices, with rows being numbered across slices
+		auto ForEachRowChunk = [&](std::size_t begin, std::size_t end, unsigned int rowsPerSlice, auto&& func)
+		{
+			while (begin < end)
+			{
+				unsigned int slice = static_cast<unsigned int>(begin / rowsPerSlice);
+				unsigned int rowBegin = static_cast<unsigned int>(begin % rowsPerSlice);
+				unsigned int rowEnd = static_cast<unsigned int>(std::min<std::size_t>({ rowBegin + RowChunkSize, rowsPerSlice, rowBegin + (end - begin) }));
+
+				func(slice, rowBegin, rowEnd);
+
+				begin += rowEnd - rowBegin;
+			}
+		};
+
+		if (!filterZ)
+		{
+			std::size_t rowCount = std::size_t(dstSize.y) * dstSize.z;
+			ParallelForRange(0, rowCount, [&](std::size_t begin, std::size_t end)
+			{
+				std::vector<float> rows;
+				ForEachRowChunk(begin, end, dstSize.y, [&](unsigned int slice, unsigned int rowBegin, unsigned int rowEnd)
+				{
+					rows.resize((rowEnd - rowBegin) * dstRowLength);
+					ResampleRows(&src[slice * srcSliceSize], srcSize, xContributions, yContributions, rowBegin, rowEnd, rows.data());
+
+					for (unsigned int y = rowBegin; y < rowEnd; ++y)
+						EncodeRow(&rows[(y - rowBegin) * dstRowLength], dstSize.x, &dst[slice * dstSliceSize + y * dstRowSize]);
+				});
+			}, ComputeGrainSize(rowCount, minRowCount));
+		}
+		else
+		{
+			// Every source slice is first resampled in two dimensions, then destination slices are blended from them
+			Contributions zContributions = ComputeContributions(srcSize.z, dstSize.z);
+
+			std::size_t planeLength = dstRowLength * dstSize.y;
+			std::vector<float> planes(planeLength * srcSize.z);
+
+			std::size_t planeRowCount = std::size_t(dstSize.y) * srcSize.z;
+			ParallelForRange(0, planeRowCount, [&](std::size_t begin, std::size_t end)
+			{
+				ForEachRowChunk(begin, end, dstSize.y, [&](unsigned int slice, unsigned int rowBegin, unsigned int rowEnd)
+				{
+					ResampleRows(&src[slice * srcSliceSize], srcSize, xContributions, yContributions, rowBegin, rowEnd, &planes[slice * planeLength + rowBegin * dstRowLength]);
+				});
+			}, ComputeGrainSize(planeRowCount, minRowCount));
+
+			std::size_t rowCount = std::size_t(dstSize.y) * dstSize.z;
+			ParallelForRange(0, rowCount, [&](std::size_t begin, std::size_t end)
+			{
+				std::vector<float> row(dstRowLength);
+				for (std::size_t i = begin; i < end; ++i)
+				{
+					std::size_t slice = i / dstSize.y;
+					std::size_t y = i % dstSize.y;
+
+					std::fill(row.begin(), row.end(), 0.f);
+					for (UInt32 tap = zContributions.offsets[slice]; tap < zContributions.offsets[slice + 1]; ++tap)
+						AccumulateRow(row.data(), &planes[zContributions.indices[tap] * planeLength + y * dstRowLength], zContributions.weights[tap], dstRowLength);
+
+					EncodeRow(row.data(), dstSize.x, &dst[slice * dstSliceSize + y * dstRowSize]);
+				}
+			}, ComputeGrainSize(rowCount, minRowCount));
+		}
+	}
+
+	/*!
+	* \brief Checks whether images of a pixel format can be resampled
+	* \return true If it can be
+	*
+	* \param format Pixel format to check
+	*/
+	bool ImageResampler::IsFormatSupported(PixelFormat format)
+	{
+		switch (format)
+		{
+			case PixelFormat::A8:
+			case PixelFormat::BGR8:
+			case PixelFormat::BGR8_SRGB:
+			case PixelFormat::BGRA8:
+			case PixelFormat::BGRA8_SRGB:
+			case PixelFormat::L8:
+			case PixelFormat::LA8:
+			case PixelFormat::R8:
+			case PixelFormat::R32F:
+			case PixelFormat::RG8:
+			case PixelFormat::RG32F:
+			case PixelFormat::RGB8:
+			case PixelFormat::RGB8_SRGB:
+			case PixelFormat::RGB32F:
+			case PixelFormat::RGBA8:
+			case PixelFormat::RGBA8_SRGB:
+			case PixelFormat::RGBA32F:
+				return true;
+
+			default:
+				return false;
+		}
+	}
+
+	auto ImageResampler::ComputeContributions(unsigned int srcSize, unsigned int dstSize) const -> Contributions
+	{
+		// When downsampling, the filter is stretched to cover every source pixel
+		float scale = float(dstSize) / srcSize;
+		float filterScale = std::min(scale, 1.f);
+		float support = GetFilterSupport(m_filter) / filterScale;
+
+		Contributions contributions;
+		contributions.offsets.reserve(dstSize + 1);
+
+		for (unsigned int i = 0; i < dstSize; ++i)
+		{
+			std::size_t firstTap = contributions.weights.size();
+			contributions.offsets.push_back(static_cast<UInt32>(firstTap));
+
+			float center = (i + 0.5f) / scale;
+			int first = static_cast<int>(std::floor(center - support));
+			int last = static_cast<int>(std::ceil(center + support));
+
+			float weightSum = 0.f;
+			for (int j = first; j <= last; ++j)
+			{
+				float weight = EvaluateFilter(m_filter, (j + 0.5f - center) * filterScale);
+				if (weight == 0.f)
+					continue;
+
+				// Pixels outside of the image are clamped to the edge
+				contributions.indices.push_back(static_cast<UInt32>(Clamp(j, 0, static_cast<int>(srcSize) - 1)));
+				contributions.weights.push_back(weight);
+				weightSum += weight;
+			}
+
+			if (std::abs(weightSum) > 1e-6f)
+			{
+				for (std::size_t tap = firstTap; tap < contributions.weights.size(); ++tap)
+					contributions.weights[tap] /= weightSum;
+			}
+			else
+			{
+				// Fallback on the nearest pixel
+				contributions.indices.resize(firstTap);
+				contributions.weights.resize(firstTap);
+
+				contributions.indices.push_back(std::min(static_cast<UInt32>(center), srcSize - 1));
+				contributions.weights.push_back(1.f);
+			}
+		}
+
+		contributions.offsets.push_back(static_cast<UInt32>(contributions.weights.size()));
+
+		return contributions;
+	}
+
+	void ImageResampler::DecodeRow(const UInt8* src, unsigned int width, float* dst) const
+	{
+		if (m_isFloat)
+		{
+			std::memcpy(dst, src, std::size_t(width) * m_channelCount * sizeof(float));
+			return;
+		}
+
+		std::array<const float*, 4> tables;
+		for (unsigned int c = 0; c < m_channelCount; ++c)
+			tables[c] = (m_isSrgb && static_cast<int>(c) != m_alphaChannel) ? m_srgbTable.data() : m_linearTable.data();
+
+		std::size_t count = std::size_t(width) * m_channelCount;
+		for (std::size_t i = 0; i < count; i += m_channelCount)
+		{
+			for (unsigned int c = 0; c < m_channelCount; ++c)
+				dst[i + c] = tables[c][src[i + c]];
+		}
+	}
+
+	void ImageResampler::EncodeRow(const float* src, unsigned int width, UInt8* dst) const
+	{
+		if (m_isFloat)
+		{
+			std::memcpy(dst, src, std::size_t(width) * m_channelCount * sizeof(float));
+			return;
+		}
+
+		std::size_t count = std::size_t(width) * m_channelCount;
+		for (std::size_t i = 0; i < count; i += m_channelCount)
+		{
+			for (unsigned int c = 0; c < m_channelCount; ++c)
+			{
+				float value = Clamp(src[i + c], 0.f, 1.f);
+				if (m_isSrgb && static_cast<int>(c) != m_alphaChannel)
+					value = LinearToSrgb(value);
+
+				dst[i + c] = static_cast<UInt8>(value * 255.f + 0.5f);
+			}
+		}
+	}
+
+	void ImageResampler::ResampleRows(const UInt8* srcSlice, const Vector3ui& srcSize, const Contributions& xContributions, const Contributions& yContributions, unsigned int rowBegin, unsigned int rowEnd, float* dstRows) const
+	{
+		std::size_t dstWidth = xContributions.offsets.size() - 1;
+		std::size_t dstRowLength = dstWidth * m_channelCount;
+		std::size_t srcRowSize = std::size_t(srcSize.x) * m_channelCount * ((m_isFloat) ? sizeof(float) : sizeof(UInt8));
+
+		// Source rows used by this chunk of destination rows, which are filtered horizontally only once
+		auto tapBegin = yContributions.indices.begin() + yContributions.offsets[rowBegin];
+		auto tapEnd = yContributions.indices.begin() + yContributions.offsets[rowEnd];
+		auto [firstRowIt, lastRowIt] = std::minmax_element(tapBegin, tapEnd);
+		UInt32 firstRow = *firstRowIt;
+		UInt32 lastRow = *lastRowIt;
+
+		std::vector<float> decodedRow(std::size_t(srcSize.x) * m_channelCount);
+		std::vector<float> filteredRows((lastRow - firstRow + 1) * dstRowLength);
+		for (UInt32 y = firstRow; y <= lastRow; ++y)
+		{
+			DecodeRow(&srcSlice[y * srcRowSize], srcSize.x, decodedRow.data());
+			FilterRow(decodedRow.data(), m_channelCount, dstWidth, xContributions.offsets.data(), xContributions.indices.data(), xContributions.weights.data(), &filteredRows[(y - firstRow) * dstRowLength]);
+		}
+
+		for (unsigned int y = rowBegin; y < rowEnd; ++y)
+		{
+			float* dstRow = &dstRows[(y - rowBegin) * dstRowLength];
+			std::fill(dstRow, dstRow + dstRowLength, 0.f);
+
+			for (UInt32 tap = yContributions.offsets[y]; tap < yContributions.offsets[y + 1]; ++tap)
+				AccumulateRow(dstRow, &filteredRows[(yContributions.indices[tap] - firstRow) * dstRowLength], yContributions.weights[tap], dstRowLength);
+		}
+	}
+
+	auto ImageResampler::ComputeIdentity(unsigned int dstSize) -> Contributions
+	{
+		Contributions contributions;
+		contributions.indices.resize(dstSize);
+		contributions.offsets.resize(dstSize + 1);
+		contributions.weights.assign(dstSize, 1.f);
+
+		for (unsigned int i = 0; i < dstSize; ++i)
+		{
+			contributions.indices[i] = i;
+			contributions.offsets[i] = i;
+		}
+		contributions.offsets[dstSize] = dstSize;
+
+		return contributions;
+	}
+}
@@ -0,0 +1,53 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_UTILITY_IMAGERESAMPLER_HPP
+#define NAZARA_UTILITY_IMAGERESAMPLER_HPP
+
+#include <Nazara/Prerequisites.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Utility/Enums.hpp>
+#include <array>
+#include <vector>
+
+namespace Nz
+{
+	class ImageResampler
+	{
+		public:
+			ImageResampler(PixelFormat format, ImageFilter filter);
+			~ImageResampler() = default;
+
+			void Resample(ImageType type, const UInt8* src, const Vector3ui& srcSize, UInt8* dst, const Vector3ui& dstSize) const;
+
+			static bool IsFormatSupported(PixelFormat format);
+
+		private:
+			struct Contributions
+			{
+				std::vector<UInt32> indices;
+				std::vector<UInt32> offsets; //< taps of destination pixel i are in [offsets[i], offsets[i + 1])
+				std::vector<float> weights;
+			};
+
+			Contributions ComputeContributions(unsigned int srcSize, unsigned int dstSize) const;
+			void DecodeRow(const UInt8* src, unsigned int width, float* dst) const;
+			void EncodeRow(const float* src, unsigned int width, UInt8* dst) const;
+			void ResampleRows(const UInt8* srcSlice, const Vector3ui& srcSize, const Contributions& xContributions, const Contributions& yContributions, unsigned int rowBegin, unsigned int rowEnd, float* dstRows) const;
+
+			static Contributions ComputeIdentity(unsigned int dstSize);
+
+			std::array<float, 256> m_linearTable;
+			std::array<float, 256> m_srgbTable;
+			ImageFilter m_filter;
+			int m_alphaChannel;
+			unsigned int m_channelCount;
+			bool m_isFloat;
+			bool m_isSrgb;
+	};
+}
+
+#endif // NAZARA_UTILITY_IMAGERESAMPLER_HPP
@@ -5,6 +5,8 @@
 #include <Nazara/Utility/PixelFormat.hpp>
 #include <Nazara/Core/Endianness.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <Nazara/Utility/SimdPixelConverters.hpp>
 #include <Nazara/Utility/Debug.hpp>
 
 namespace Nz
@@ -13,7 +15,7 @@ namespace Nz
 	{
 		inline UInt8 c4to5(UInt8 c)
 		{
-			return static_cast<UInt8>(c * (31.f/15.f));
+			return static_cast<UInt8>((c * 31) / 15);
 		}
 
 		inline UInt8 c4to8(UInt8 c)
@@ -23,12 +25,12 @@ namespace Nz
 
 		inline UInt8 c5to4(UInt8 c)
 		{
-			return static_cast<UInt8>(c * (15.f/31.f));
+			return static_cast<UInt8>((c * 15) / 31);
 		}
 
 		inline UInt8 c5to8(UInt8 c)
 		{
-			return static_cast<UInt8>(c * (255.f/31.f));
+			return static_cast<UInt8>((c * 255) / 31);
 		}
 
 		inline UInt8 c8to4(UInt8 c)
@@ -38,7 +40,7 @@ namespace Nz
 
 		inline UInt8 c8to5(UInt8 c)
 		{
-			return static_cast<UInt8>(c * (31.f/255.f));
+			return static_cast<UInt8>((c * 31) / 255);
 		}
 
 		template<PixelFormat from, PixelFormat to>
@@ -121,7 +123,7 @@ namespace Nz
 				start += 1;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		template<>
@@ -249,7 +251,7 @@ namespace Nz
 				start += 3;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		template<>
@@ -352,7 +354,7 @@ namespace Nz
 				start += 4;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		template<>
@@ -514,7 +516,7 @@ namespace Nz
 				start += 1;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		template<>
@@ -645,7 +647,7 @@ namespace Nz
 				start += 2;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		template<>
@@ -1004,7 +1006,7 @@ namespace Nz
 				start += 2;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		template<>
@@ -1129,7 +1131,7 @@ namespace Nz
 				start += 3;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		template<>
@@ -1285,7 +1287,7 @@ namespace Nz
 				start += 4;
 			}
 
-			return dst;
+			return reinterpret_cast<UInt8*>(ptr);
 		}
 
 		template<>
@@ -1303,6 +1305,70 @@ namespace Nz
 		{
 			PixelFormatInfo::SetConvertFunction(Format1, Format2, &ConvertPixels<Format1, Format2>);
 		}
+
+#ifdef NAZARA_UTILITY_SIMD_PIXEL_CONVERTERS
+		template<PixelFormat From, PixelFormat To, std::size_t(*Kernel)(const UInt8* src, UInt8* dst, std::size_t pixelCount)>
+		UInt8* ConvertPixelsSimd(const UInt8* start, const UInt8* end, UInt8* dst)
+		{
+			std::size_t srcPixelSize = PixelFormatInfo::GetBytesPerPixel(From);
+			std::size_t convertedCount = Kernel(start, dst, (end - start) / srcPixelSize);
+
+			// Pixels which didn't fill a whole vector are left to the scalar converter
+			return ConvertPixels<From, To>(start + convertedCount * srcPixelSize, end, dst + convertedCount * PixelFormatInfo::GetBytesPerPixel(To));
+		}
+
+		template<PixelFormat Format1, PixelFormat Format2, std::size_t(*Kernel)(const UInt8* src, UInt8* dst, std::size_t pixelCount)>
+		void RegisterSimdConverter()
+		{
+			PixelFormatInfo::SetConvertFunction(Format1, Format2, &ConvertPixelsSimd<Format1, Format2, Kernel>);
+		}
+
+		void RegisterSimdConverters()
+		{
+			using namespace SimdPixelConverters;
+
+			if (!HardwareInfo::Initialize())
+				return;
+
+			if (HardwareInfo::HasCapability(ProcessorCap::SSE2))
+			{
+				RegisterSimdConverter<PixelFormat::BGRA8,  PixelFormat::RGBA4,  &EncodeRGBA4_SSE2<true>>();
+				RegisterSimdConverter<PixelFormat::BGRA8,  PixelFormat::RGB5A1, &EncodeRGB5A1_SSE2<true>>();
+				RegisterSimdConverter<PixelFormat::BGRA8,  PixelFormat::RGBA8,  &SwapRedBlue_SSE2>();
+				RegisterSimdConverter<PixelFormat::L8,     PixelFormat::BGRA8,  &ExpandL8_SSE2>();
+				RegisterSimdConverter<PixelFormat::L8,     PixelFormat::RGBA8,  &ExpandL8_SSE2>();
+				RegisterSimdConverter<PixelFormat::LA8,    PixelFormat::BGRA8,  &ExpandLA8_SSE2>();
+				RegisterSimdConverter<PixelFormat::LA8,    PixelFormat::RGBA8,  &ExpandLA8_SSE2>();
+				RegisterSimdConverter<PixelFormat::RGBA4,  PixelFormat::BGRA8,  &DecodeRGBA4_SSE2<true>>();
+				RegisterSimdConverter<PixelFormat::RGBA4,  PixelFormat::RGBA8,  &DecodeRGBA4_SSE2<false>>();
+				RegisterSimdConverter<PixelFormat::RGB5A1, PixelFormat::BGRA8,  &DecodeRGB5A1_SSE2<true>>();
+				RegisterSimdConverter<PixelFormat::RGB5A1, PixelFormat::RGBA8,  &DecodeRGB5A1_SSE2<false>>();
+				RegisterSimdConverter<PixelFormat::RGBA8,  PixelFormat::BGRA8,  &SwapRedBlue_SSE2>();
+				RegisterSimdConverter<PixelFormat::RGBA8,  PixelFormat::RGBA4,  &EncodeRGBA4_SSE2<false>>();
+				RegisterSimdConverter<PixelFormat::RGBA8,  PixelFormat::RGB5A1, &EncodeRGB5A1_SSE2<false>>();
+			}
+
+			if (HardwareInfo::HasCapability(ProcessorCap::SSSE3))
+			{
+				RegisterSimdConverter<PixelFormat::BGR8,  PixelFormat::BGRA8, &Expand24To32_SSSE3<false>>();
+				RegisterSimdConverter<PixelFormat::BGR8,  PixelFormat::RGBA8, &Expand24To32_SSSE3<true>>();
+				RegisterSimdConverter<PixelFormat::BGRA8, PixelFormat::BGR8,  &Shrink32To24_SSSE3<false>>();
+				RegisterSimdConverter<PixelFormat::BGRA8, PixelFormat::RGB8,  &Shrink32To24_SSSE3<true>>();
+				RegisterSimdConverter<PixelFormat::RGB8,  PixelFormat::BGRA8, &Expand24To32_SSSE3<true>>();
+				RegisterSimdConverter<PixelFormat::RGB8,  PixelFormat::RGBA8, &Expand24To32_SSSE3<false>>();
+				RegisterSimdConverter<PixelFormat::RGBA8, PixelFormat::BGR8,  &Shrink32To24_SSSE3<true>>();
+				RegisterSimdConverter<PixelFormat::RGBA8, PixelFormat::RGB8,  &Shrink32To24_SSSE3<false>>();
+			}
+
+			if (HardwareInfo::HasCapability(ProcessorCap::AVX2))
+			{
+				RegisterSimdConverter<PixelFormat::BGRA8, PixelFormat::RGBA8, &SwapRedBlue_AVX2>();
+				RegisterSimdConverter<PixelFormat::L8,    PixelFormat::BGRA8, &ExpandL8_AVX2>();
+				RegisterSimdConverter<PixelFormat::L8,    PixelFormat::RGBA8, &ExpandL8_AVX2>();
+				RegisterSimdConverter<PixelFormat::RGBA8, PixelFormat::BGRA8, &SwapRedBlue_AVX2>();
+			}
+		}
+#endif
 	}
 
 	bool PixelFormatInfo::Flip(PixelFlipping flipping, PixelFormat format, unsigned int width, unsigned int height, unsigned int depth, const void* src, void* dst)
@@ -1424,6 +1490,8 @@ namespace Nz
 
 		// Setup informations about every pixel format
 		SetupPixelFormat(PixelFormat::A8,               PixelFormatDescription("A8",               PixelFormatContent::ColorRGBA,    0,                  0,                  0,                  0xFF,               PixelFormatSubType::Unsigned));
+		SetupPixelFormat(PixelFormat::BC4,              PixelFormatDescription("BC4",              PixelFormatContent::ColorRGBA,    8,                                                                              PixelFormatSubType::Compressed));
+		SetupPixelFormat(PixelFormat::BC5,              PixelFormatDescription("BC5",              PixelFormatContent::ColorRGBA,    16,                                                                             PixelFormatSubType::Compressed));
 		SetupPixelFormat(PixelFormat::BGR8,             PixelFormatDescription("BGR8",             PixelFormatContent::ColorRGBA,    0x0000FF,           0x00FF00,           0xFF0000,           0,                  PixelFormatSubType::Unsigned));
 		SetupPixelFormat(PixelFormat::BGR8_SRGB,        PixelFormatDescription("BGR8_SRGB",        PixelFormatContent::ColorRGBA,    0x0000FF,           0x00FF00,           0xFF0000,           0,                  PixelFormatSubType::Unsigned));
 		SetupPixelFormat(PixelFormat::BGRA8,            PixelFormatDescription("BGRA8",            PixelFormatContent::ColorRGBA,    0x0000FF00,         0x00FF0000,         0xFF000000,         0x000000FF,         PixelFormatSubType::Unsigned));
@@ -1709,6 +1777,11 @@ namespace Nz
 		RegisterConverter<PixelFormat::RGBA8, PixelFormat::RGBA4>();
 		RegisterConverter<PixelFormat::RGBA8, PixelFormat::RGBA8_SRGB>();
 
+		#ifdef NAZARA_UTILITY_SIMD_PIXEL_CONVERTERS
+		// Replace the most common converters by vectorized ones, depending on the processor capabilities
+		RegisterSimdConverters();
+		#endif
+
 		return true;
 	}
 
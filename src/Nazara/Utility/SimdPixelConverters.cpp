@@ -0,0 +1,424 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/SimdPixelConverters.hpp>
+
+#ifdef NAZARA_UTILITY_SIMD_PIXEL_CONVERTERS
+
+#include <immintrin.h>
+#include <Nazara/Utility/Debug.hpp>
+
+// Kernels are built for their own instruction set whatever the compiler flags are, HardwareInfo decides at runtime which ones may be called
+#if defined(__GNUC__) || defined(__clang__)
+	#define NAZARA_UTILITY_SIMD_TARGET(instructionSet) __attribute__((target(instructionSet)))
+#else
+	#define NAZARA_UTILITY_SIMD_TARGET(instructionSet)
+#endif
+
+namespace Nz::SimdPixelConverters
+{
+	namespace
+	{
+		NAZARA_UTILITY_SIMD_TARGET("sse2")
+		inline __m128i PackUInt32ToUInt16(__m128i first, __m128i second)
+		{
+			// _mm_packus_epi32 is SSE4.1, sign-extend the 16bits values so the signed saturation of _mm_packs_epi32 keeps them as-is
+			first = _mm_srai_epi32(_mm_slli_epi32(first, 16), 16);
+			second = _mm_srai_epi32(_mm_slli_epi32(second, 16), 16);
+
+			return _mm_packs_epi32(first, second);
+		}
+
+		template<bool SwapRedBlue>
+		NAZARA_UTILITY_SIMD_TARGET("sse2")
+		inline __m128i EncodeRGBA4(__m128i pixels)
+		{
+			__m128i red;
+			__m128i blue;
+			if constexpr (SwapRedBlue)
+			{
+				red = _mm_and_si128(_mm_srli_epi32(pixels, 8), _mm_set1_epi32(0xF000));
+				blue = _mm_and_si128(pixels, _mm_set1_epi32(0x00F0));
+			}
+			else
+			{
+				red = _mm_and_si128(_mm_slli_epi32(pixels, 8), _mm_set1_epi32(0xF000));
+				blue = _mm_and_si128(_mm_srli_epi32(pixels, 16), _mm_set1_epi32(0x00F0));
+			}
+
+			__m128i green = _mm_and_si128(_mm_srli_epi32(pixels, 4), _mm_set1_epi32(0x0F00));
+			__m128i alpha = _mm_srli_epi32(pixels, 28);
+
+			return _mm_or_si128(_mm_or_si128(red, green), _mm_or_si128(blue, alpha));
+		}
+
+		template<bool SwapRedBlue>
+		NAZARA_UTILITY_SIMD_TARGET("sse2")
+		inline __m128i EncodeRGB5A1(__m128i pixels)
+		{
+			const __m128i byteMask = _mm_set1_epi32(0x00FF00FF);
+			const __m128i factor = _mm_set1_epi16(249);
+
+			// Every 16bits lane holds a channel: red and blue (swapped for BGRA8) in the first one, green and alpha in the second one
+			// c8to5(c) == (c * 249) >> 11 for every 8bits value, and c * 249 fits in 16bits
+			__m128i redBlue = _mm_srli_epi16(_mm_mullo_epi16(_mm_and_si128(pixels, byteMask), factor), 11);
+			__m128i green = _mm_srli_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi32(pixels, 8), byteMask), factor), 11);
+
+			__m128i red;
+			__m128i blue;
+			if constexpr (SwapRedBlue)
+			{
+				red = _mm_and_si128(_mm_srli_epi32(redBlue, 5), _mm_set1_epi32(0xF800));
+				blue = _mm_and_si128(_mm_slli_epi32(redBlue, 1), _mm_set1_epi32(0x003E));
+			}
+			else
+			{
+				red = _mm_and_si128(_mm_slli_epi32(redBlue, 11), _mm_set1_epi32(0xF800));
+				blue = _mm_srli_epi32(redBlue, 15);
+			}
+
+			green = _mm_and_si128(_mm_slli_epi32(green, 6), _mm_set1_epi32(0x07C0));
+			__m128i alpha = _mm_and_si128(_mm_cmpgt_epi32(_mm_srli_epi32(pixels, 24), _mm_set1_epi32(0xF)), _mm_set1_epi32(1));
+
+			return _mm_or_si128(_mm_or_si128(red, green), _mm_or_si128(blue, alpha));
+		}
+
+		template<bool SwapRedBlue>
+		NAZARA_UTILITY_SIMD_TARGET("sse2")
+		std::size_t DecodeRGBA4Pixels(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+		{
+			const __m128i lowMask = _mm_set1_epi16(0x00F0);
+			const __m128i highMask = _mm_set1_epi16(static_cast<short>(0xF000));
+
+			std::size_t i = 0;
+			for (; i + 8 <= pixelCount; i += 8)
+			{
+				__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i * 2]));
+
+				// c4to8(c) == c << 4, channels are moved to the high nibble of their output byte
+				__m128i red = _mm_and_si128(_mm_srli_epi16(pixels, 8), lowMask);
+				__m128i green = _mm_and_si128(_mm_slli_epi16(pixels, 4), highMask);
+				__m128i blue = _mm_and_si128(pixels, lowMask);
+				__m128i alpha = _mm_slli_epi16(pixels, 12);
+
+				__m128i firstHalf = _mm_or_si128((SwapRedBlue) ? blue : red, green);
+				__m128i secondHalf = _mm_or_si128((SwapRedBlue) ? red : blue, alpha);
+
+				__m128i* output = reinterpret_cast<__m128i*>(&dst[i * 4]);
+				_mm_storeu_si128(output + 0, _mm_unpacklo_epi16(firstHalf, secondHalf));
+				_mm_storeu_si128(output + 1, _mm_unpackhi_epi16(firstHalf, secondHalf));
+			}
+
+			return i;
+		}
+
+		template<bool SwapRedBlue>
+		NAZARA_UTILITY_SIMD_TARGET("sse2")
+		std::size_t DecodeRGB5A1Pixels(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+		{
+			const __m128i channelMask = _mm_set1_epi16(0x1F);
+			const __m128i factor = _mm_set1_epi16(1053);
+
+			std::size_t i = 0;
+			for (; i + 8 <= pixelCount; i += 8)
+			{
+				__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i * 2]));
+
+				// c5to8(c) == (c * 1053) >> 7 for every 5bits value, and c * 1053 fits in 16bits
+				__m128i red = _mm_srli_epi16(_mm_mullo_epi16(_mm_srli_epi16(pixels, 11), factor), 7);
+				__m128i green = _mm_srli_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(pixels, 6), channelMask), factor), 7);
+				__m128i blue = _mm_srli_epi16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(pixels, 1), channelMask), factor), 7);
+				__m128i alpha = _mm_srai_epi16(_mm_slli_epi16(pixels, 15), 7); //< 0xFF00 if alpha bit is set
+
+				__m128i firstHalf = _mm_or_si128((SwapRedBlue) ? blue : red, _mm_slli_epi16(green, 8));
+				__m128i secondHalf = _mm_or_si128((SwapRedBlue) ? red : blue, alpha);
+
+				__m128i* output = reinterpret_cast<__m128i*>(&dst[i * 4]);
+				_mm_storeu_si128(output + 0, _mm_unpacklo_epi16(firstHalf, secondHalf));
+				_mm_storeu_si128(output + 1, _mm_unpackhi_epi16(firstHalf, secondHalf));
+			}
+
+			return i;
+		}
+
+		template<bool SwapRedBlue>
+		NAZARA_UTILITY_SIMD_TARGET("sse2")
+		std::size_t EncodeRGBA4Pixels(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+		{
+			std::size_t i = 0;
+			for (; i + 8 <= pixelCount; i += 8)
+			{
+				const __m128i* input = reinterpret_cast<const __m128i*>(&src[i * 4]);
+				__m128i first = EncodeRGBA4<SwapRedBlue>(_mm_loadu_si128(input + 0));
+				__m128i second = EncodeRGBA4<SwapRedBlue>(_mm_loadu_si128(input + 1));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[i * 2]), PackUInt32ToUInt16(first, second));
+			}
+
+			return i;
+		}
+
+		template<bool SwapRedBlue>
+		NAZARA_UTILITY_SIMD_TARGET("sse2")
+		std::size_t EncodeRGB5A1Pixels(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+		{
+			std::size_t i = 0;
+			for (; i + 8 <= pixelCount; i += 8)
+			{
+				const __m128i* input = reinterpret_cast<const __m128i*>(&src[i * 4]);
+				__m128i first = EncodeRGB5A1<SwapRedBlue>(_mm_loadu_si128(input + 0));
+				__m128i second = EncodeRGB5A1<SwapRedBlue>(_mm_loadu_si128(input + 1));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[i * 2]), PackUInt32ToUInt16(first, second));
+			}
+
+			return i;
+		}
+
+		template<bool SwapRedBlue>
+		NAZARA_UTILITY_SIMD_TARGET("ssse3")
+		std::size_t Expand24To32Pixels(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+		{
+			const __m128i shuffleMask = (SwapRedBlue) ? _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1)
+			                                          : _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+			const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000));
+
+			// 16 pixels are read from three vectors, so we never read past the end of the source
+			std::size_t i = 0;
+			for (; i + 16 <= pixelCount; i += 16)
+			{
+				const __m128i* input = reinterpret_cast<const __m128i*>(&src[i * 3]);
+				__m128i first = _mm_loadu_si128(input + 0);
+				__m128i second = _mm_loadu_si128(input + 1);
+				__m128i third = _mm_loadu_si128(input + 2);
+
+				__m128i* output = reinterpret_cast<__m128i*>(&dst[i * 4]);
+				_mm_storeu_si128(output + 0, _mm_or_si128(_mm_shuffle_epi8(first, shuffleMask), alpha));
+				_mm_storeu_si128(output + 1, _mm_or_si128(_mm_shuffle_epi8(_mm_alignr_epi8(second, first, 12), shuffleMask), alpha));
+				_mm_storeu_si128(output + 2, _mm_or_si128(_mm_shuffle_epi8(_mm_alignr_epi8(third, second, 8), shuffleMask), alpha));
+				_mm_storeu_si128(output + 3, _mm_or_si128(_mm_shuffle_epi8(_mm_srli_si128(third, 4), shuffleMask), alpha));
+			}
+
+			return i;
+		}
+
+		template<bool SwapRedBlue>
+		NAZARA_UTILITY_SIMD_TARGET("ssse3")
+		std::size_t Shrink32To24Pixels(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+		{
+			const __m128i shuffleMask = (SwapRedBlue) ? _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)
+			                                          : _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+
+			// 16 pixels are written as three vectors, so we never write past the end of the destination
+			std::size_t i = 0;
+			for (; i + 16 <= pixelCount; i += 16)
+			{
+				const __m128i* input = reinterpret_cast<const __m128i*>(&src[i * 4]);
+				__m128i first = _mm_shuffle_epi8(_mm_loadu_si128(input + 0), shuffleMask);
+				__m128i second = _mm_shuffle_epi8(_mm_loadu_si128(input + 1), shuffleMask);
+				__m128i third = _mm_shuffle_epi8(_mm_loadu_si128(input + 2), shuffleMask);
+				__m128i fourth = _mm_shuffle_epi8(_mm_loadu_si128(input + 3), shuffleMask);
+
+				__m128i* output = reinterpret_cast<__m128i*>(&dst[i * 3]);
+				_mm_storeu_si128(output + 0, _mm_or_si128(first, _mm_slli_si128(second, 12)));
+				_mm_storeu_si128(output + 1, _mm_or_si128(_mm_srli_si128(second, 4), _mm_slli_si128(third, 8)));
+				_mm_storeu_si128(output + 2, _mm_or_si128(_mm_srli_si128(third, 8), _mm_slli_si128(fourth, 4)));
+			}
+
+			return i;
+		}
+	}
+
+	NAZARA_UTILITY_SIMD_TARGET("sse2")
+	std::size_t SwapRedBlue_SSE2(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+	{
+		const __m128i greenAlphaMask = _mm_set1_epi32(static_cast<int>(0xFF00FF00));
+
+		std::size_t i = 0;
+		for (; i + 4 <= pixelCount; i += 4)
+		{
+			__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i * 4]));
+
+			__m128i redBlue = _mm_andnot_si128(greenAlphaMask, pixels);
+			redBlue = _mm_or_si128(_mm_slli_epi32(redBlue, 16), _mm_srli_epi32(redBlue, 16));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[i * 4]), _mm_or_si128(_mm_and_si128(pixels, greenAlphaMask), redBlue));
+		}
+
+		return i;
+	}
+
+	NAZARA_UTILITY_SIMD_TARGET("avx2")
+	std::size_t SwapRedBlue_AVX2(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+	{
+		const __m256i shuffleMask = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+		                                             2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+		std::size_t i = 0;
+		for (; i + 8 <= pixelCount; i += 8)
+		{
+			__m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[i * 4]));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(&dst[i * 4]), _mm256_shuffle_epi8(pixels, shuffleMask));
+		}
+
+		return i;
+	}
+
+	NAZARA_UTILITY_SIMD_TARGET("sse2")
+	std::size_t ExpandL8_SSE2(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+	{
+		const __m128i alpha = _mm_set1_epi8(static_cast<char>(0xFF));
+
+		std::size_t i = 0;
+		for (; i + 16 <= pixelCount; i += 16)
+		{
+			__m128i luminance = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
+
+			// LL pairs and LA pairs, interleaved as LLLA
+			__m128i lowLL = _mm_unpacklo_epi8(luminance, luminance);
+			__m128i highLL = _mm_unpackhi_epi8(luminance, luminance);
+			__m128i lowLA = _mm_unpacklo_epi8(luminance, alpha);
+			__m128i highLA = _mm_unpackhi_epi8(luminance, alpha);
+
+			__m128i* output = reinterpret_cast<__m128i*>(&dst[i * 4]);
+			_mm_storeu_si128(output + 0, _mm_unpacklo_epi16(lowLL, lowLA));
+			_mm_storeu_si128(output + 1, _mm_unpackhi_epi16(lowLL, lowLA));
+			_mm_storeu_si128(output + 2, _mm_unpacklo_epi16(highLL, highLA));
+			_mm_storeu_si128(output + 3, _mm_unpackhi_epi16(highLL, highLA));
+		}
+
+		return i;
+	}
+
+	NAZARA_UTILITY_SIMD_TARGET("avx2")
+	std::size_t ExpandL8_AVX2(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+	{
+		// Both 128bits lanes hold the same 16 luminance values, shuffles are done per lane
+		const __m256i firstMask = _mm256_setr_epi8(0, 0, 0, -1, 1, 1, 1, -1, 2, 2, 2, -1, 3, 3, 3, -1,
+		                                           4, 4, 4, -1, 5, 5, 5, -1, 6, 6, 6, -1, 7, 7, 7, -1);
+		const __m256i secondMask = _mm256_setr_epi8(8, 8, 8, -1, 9, 9, 9, -1, 10, 10, 10, -1, 11, 11, 11, -1,
+		                                            12, 12, 12, -1, 13, 13, 13, -1, 14, 14, 14, -1, 15, 15, 15, -1);
+		const __m256i alpha = _mm256_set1_epi32(static_cast<int>(0xFF000000));
+
+		std::size_t i = 0;
+		for (; i + 16 <= pixelCount; i += 16)
+		{
+			__m256i luminance = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i])));
+
+			__m256i* output = reinterpret_cast<__m256i*>(&dst[i * 4]);
+			_mm256_storeu_si256(output + 0, _mm256_or_si256(_mm256_shuffle_epi8(luminance, firstMask), alpha));
+			_mm256_storeu_si256(output + 1, _mm256_or_si256(_mm256_shuffle_epi8(luminance, secondMask), alpha));
+		}
+
+		return i;
+	}
+
+	NAZARA_UTILITY_SIMD_TARGET("sse2")
+	std::size_t ExpandLA8_SSE2(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+	{
+		const __m128i luminanceMask = _mm_set1_epi16(0x00FF);
+
+		std::size_t i = 0;
+		for (; i + 8 <= pixelCount; i += 8)
+		{
+			__m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i * 2]));
+
+			__m128i luminance = _mm_and_si128(pixels, luminanceMask);
+			luminance = _mm_or_si128(luminance, _mm_slli_epi16(luminance, 8));
+
+			__m128i* output = reinterpret_cast<__m128i*>(&dst[i * 4]);
+			_mm_storeu_si128(output + 0, _mm_unpacklo_epi16(luminance, pixels));
+			_mm_storeu_si128(output + 1, _mm_unpackhi_epi16(luminance, pixels));
+		}
+
+		return i;
+	}
+
+	// GCC ignores the target attribute of a template defined after its declaration, only explicit specializations get it
+	template<>
+	NAZARA_UTILITY_SIMD_TARGET("sse2")
+	std::size_t DecodeRGBA4_SSE2<false>(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+	{
+		return DecodeRGBA4Pixels<false>(src, dst, pixelCount);
+	}
+
+	template<>
+	NAZARA_UTILITY_SIMD_TARGET("sse2")
+	std::size_t DecodeRGBA4_SSE2<true>(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+	{
+		return DecodeRGBA4Pixels<true>(src, dst, pixelCount);
+	}
+
+	template<>
+	NAZARA_UTILITY_SIMD_TARGET("sse2")
+	std::size_t DecodeRGB5A1_SSE2<false>(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+	{
+		return DecodeRGB5A1Pixels<false>(src, dst, pixelCount);
+	}
+
+	template<>
+	NAZARA_UTILITY_SIMD_TARGET("sse2")
+	std::size_t DecodeRGB5A1_SSE2<true>(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+	{
+		return DecodeRGB5A1Pixels<true>(src, dst, pixelCount);
+	}
+
+	template<>
+	NAZARA_UTILITY_SIMD_TARGET("sse2")
+	std::size_t EncodeRGBA4_SSE2<false>(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+	{
+		return EncodeRGBA4Pixels<false>(src, dst, pixelCount);
+	}
+
+	template<>
+	NAZARA_UTILITY_SIMD_TARGET("sse2")
+	std::size_t EncodeRGBA4_SSE2<true>(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+	{
+		return EncodeRGBA4Pixels<true>(src, dst, pixelCount);
+	}
+
+	template<>
+	NAZARA_UTILITY_SIMD_TARGET("sse2")
+	std::size_t EncodeRGB5A1_SSE2<false>(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+	{
+		return EncodeRGB5A1Pixels<false>(src, dst, pixelCount);
+	}
+
+	template<>
+	NAZARA_UTILITY_SIMD_TARGET("sse2")
+	std::size_t EncodeRGB5A1_SSE2<true>(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+	{
+		return EncodeRGB5A1Pixels<true>(src, dst, pixelCount);
+	}
+
+	template<>
+	NAZARA_UTILITY_SIMD_TARGET("ssse3")
+	std::size_t Expand24To32_SSSE3<false>(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+	{
+		return Expand24To32Pixels<false>(src, dst, pixelCount);
+	}
+
+	template<>
+	NAZARA_UTILITY_SIMD_TARGET("ssse3")
+	std::size_t Expand24To32_SSSE3<true>(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+	{
+		return Expand24To32Pixels<true>(src, dst, pixelCount);
+	}
+
+	template<>
+	NAZARA_UTILITY_SIMD_TARGET("ssse3")
+	std::size_t Shrink32To24_SSSE3<false>(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+	{
+		return Shrink32To24Pixels<false>(src, dst, pixelCount);
+	}
+
+	template<>
+	NAZARA_UTILITY_SIMD_TARGET("ssse3")
+	std::size_t Shrink32To24_SSSE3<true>(const UInt8* src, UInt8* dst, std::size_t pixelCount)
+	{
+		return Shrink32To24Pixels<true>(src, dst, pixelCount);
+	}
+}
+
+#endif
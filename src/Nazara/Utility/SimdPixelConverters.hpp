@@ -0,0 +1,46 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#pragma once
+
+#ifndef NAZARA_UTILITY_SIMDPIXELCONVERTERS_HPP
+#define NAZARA_UTILITY_SIMDPIXELCONVERTERS_HPP
+
+#include <Nazara/Prerequisites.hpp>
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+	#define NAZARA_UTILITY_SIMD_PIXEL_CONVERTERS
+#endif
+
+#ifdef NAZARA_UTILITY_SIMD_PIXEL_CONVERTERS
+
+// Vectorized kernels of the most common pixel conversions, each one must only be called if the processor supports its instruction set.
+// Kernels convert as many pixels as they can in full vectors and return that count, remaining pixels are left to the scalar converters.
+namespace Nz::SimdPixelConverters
+{
+	// RGBA8 <=> BGRA8
+	std::size_t SwapRedBlue_SSE2(const UInt8* src, UInt8* dst, std::size_t pixelCount);
+	std::size_t SwapRedBlue_AVX2(const UInt8* src, UInt8* dst, std::size_t pixelCount);
+
+	// L8 => RGBA8/BGRA8 and LA8 => RGBA8/BGRA8
+	std::size_t ExpandL8_SSE2(const UInt8* src, UInt8* dst, std::size_t pixelCount);
+	std::size_t ExpandL8_AVX2(const UInt8* src, UInt8* dst, std::size_t pixelCount);
+	std::size_t ExpandLA8_SSE2(const UInt8* src, UInt8* dst, std::size_t pixelCount);
+
+	// RGBA4/RGB5A1 => RGBA8 (or BGRA8 when SwapRedBlue is true)
+	template<bool SwapRedBlue> std::size_t DecodeRGBA4_SSE2(const UInt8* src, UInt8* dst, std::size_t pixelCount);
+	template<bool SwapRedBlue> std::size_t DecodeRGB5A1_SSE2(const UInt8* src, UInt8* dst, std::size_t pixelCount);
+
+	// RGBA8 (or BGRA8 when SwapRedBlue is true) => RGBA4/RGB5A1
+	template<bool SwapRedBlue> std::size_t EncodeRGBA4_SSE2(const UInt8* src, UInt8* dst, std::size_t pixelCount);
+	template<bool SwapRedBlue> std::size_t EncodeRGB5A1_SSE2(const UInt8* src, UInt8* dst, std::size_t pixelCount);
+
+	// RGB8/BGR8 <=> RGBA8/BGRA8, SwapRedBlue is true when the channel order differs (RGB8 <=> BGRA8 for example)
+	template<bool SwapRedBlue> std::size_t Expand24To32_SSSE3(const UInt8* src, UInt8* dst, std::size_t pixelCount);
+	template<bool SwapRedBlue> std::size_t Shrink32To24_SSSE3(const UInt8* src, UInt8* dst, std::size_t pixelCount);
+}
+
+#endif
+
+#endif // NAZARA_UTILITY_SIMDPIXELCONVERTERS_HPP
@@ -0,0 +1,340 @@
+// Copyright (C) 2020 Jérôme Leclercq
+// This file is part of the "Nazara Engine - Utility module"
+// For conditions of distribution and use, see copyright notice in Config.hpp
+
+#include <Nazara/Utility/TransformHierarchy.hpp>
+#include <Nazara/Core/ParallelAlgorithm.hpp>
+#include <Nazara/Utility/Node.hpp>
+#include <Nazara/Utility/Debug.hpp>
+
+namespace Nz
+{
+	namespace
+	{
+		template<typename T>
+		void ApplyOrder(std::vector<T>& values, const std::vector<std::size_t>& order)
+		{
+			std::vector<T> orderedValues;
+			orderedValues.reserve(order.size());
+
+			for (std::size_t index : order)
+				orderedValues.push_back(std::move(values[index]));
+
+			values = std::move(orderedValues);
+		}
+	}
+
+	/*!
+	* \ingroup utility
+	* \class Nz::TransformHierarchy
+	* \brief Utility class storing a whole transform hierarchy in contiguous arrays
+	*
+	* Unlike Node, global transforms are not computed lazily: nodes are sorted by depth and Update recomputes every invalidated node (and its children) in a single pass, depth level by depth level.
+	* Every node whose global transform changed is then reported at once by the OnTransformsUpdated signal.
+	*
+	* Nodes are referenced by identifiers which stay valid until the node is destroyed, their storage order is an implementation detail.
+	* Nodes inherit position, rotation and scale from their parent, like Node does by default.
+	*/
+
+	TransformHierarchy::TransformHierarchy() :
+	m_firstDirtyIndex(InvalidIndex),
+	m_orderInvalidated(false)
+	{
+	}
+
+	/*!
+	* \brief Creates a node with an identity transform
+	* \return Identifier of the new node
+	*
+	* \param parent Optional parent node
+	*/
+	std::size_t TransformHierarchy::CreateNode(std::size_t parent)
+	{
+		std::size_t parentIndex = (parent != InvalidNode) ? GetIndex(parent) : InvalidIndex;
+
+		std::size_t node;
+		if (!m_freeNodes.empty())
+		{
+			node = m_freeNodes.back();
+			m_freeNodes.pop_back();
+		}
+		else
+		{
+			node = m_nodeIndices.size();
+			m_nodeIndices.emplace_back();
+		}
+
+		std::size_t index = m_indexNodes.size();
+		m_nodeIndices[node] = index;
+
+		Transform identity = { Quaternionf::Identity(), Vector3f::Zero(), Vector3f::Unit() };
+
+		m_depths.push_back((parentIndex != InvalidIndex) ? m_depths[parentIndex] + 1 : 0);
+		m_dirtyFlags.push_back(0);
+		m_globalTransforms.push_back(identity);
+		m_indexNodes.push_back(node);
+		m_localTransforms.push_back(identity);
+		m_parentIndices.push_back(parentIndex);
+		m_transformMatrices.push_back(Matrix4f::Identity());
+
+		// Appending a node keeps the depth order as long as it's not shallower than the last one
+		if (!m_orderInvalidated)
+		{
+			std::size_t depth = m_depths.back();
+			if (depth == m_levelOffsets.size())
+				m_levelOffsets.push_back(index);
+			else if (depth + 1 != m_levelOffsets.size())
+				m_orderInvalidated = true;
+		}
+
+		Invalidate(index);
+
+		return node;
+	}
+
+	/*!
+	* \brief Destroys a node
+	*
+	* Children of the destroyed node become root nodes, keeping their local transform.
+	*
+	* \param node Node identifier
+	*/
+	void TransformHierarchy::DestroyNode(std::size_t node)
+	{
+		std::size_t index = GetIndex(node);
+
+		// Storage is reclaimed (and children detached) on the next reordering
+		m_indexNodes[index] = InvalidNode;
+		m_nodeIndices[node] = InvalidIndex;
+		m_freeNodes.push_back(node);
+
+		m_orderInvalidated = true;
+	}
+
+	/*!
+	* \brief Gets the parent of a node
+	* \return Parent node identifier or InvalidNode if the node has no parent
+	*
+	* \param node Node identifier
+	*/
+	std::size_t TransformHierarchy::GetParent(std::size_t node) const
+	{
+		std::size_t parentIndex = m_parentIndices[GetIndex(node)];
+		return (parentIndex != InvalidIndex) ? m_indexNodes[parentIndex] : InvalidNode;
+	}
+
+	/*!
+	* \brief Changes the parent of a node
+	*
+	* The local transform of the node is kept.
+	*
+	* \param node Node identifier
+	* \param parent New parent node identifier or InvalidNode to make it a root node
+	*
+	* \remark Produces a NazaraError if parent is a child of node
+	*/
+	void TransformHierarchy::SetParent(std::size_t node, std::size_t parent)
+	{
+		std::size_t index = GetIndex(node);
+		std::size_t parentIndex = (parent != InvalidNode) ? GetIndex(parent) : InvalidIndex;
+
+		for (std::size_t ancestorIndex = parentIndex; ancestorIndex != InvalidIndex; ancestorIndex = m_parentIndices[ancestorIndex])
+		{
+			if (ancestorIndex == index)
+			{
+				NazaraError("A node cannot be a child of itself");
+				return;
+			}
+		}
+
+		if (m_parentIndices[index] == parentIndex)
+			return;
+
+		m_parentIndices[index] = parentIndex;
+		m_orderInvalidated = true;
+
+		Invalidate(index);
+	}
+
+	/*!
+	* \brief Recomputes the global transforms of invalidated nodes and of their children
+	*
+	* Nodes of the same depth are processed together, which makes this a linear pass over the nodes starting from the first invalidated one.
+	* Once done, OnTransformsUpdated is signaled with every updated node.
+	*
+	* \param useParallelism Update nodes of the same depth using the TaskScheduler workers
+	*/
+	void TransformHierarchy::Update(bool useParallelism)
+	{
+		if (m_orderInvalidated)
+			Reorder();
+
+		std::size_t nodeCount = m_indexNodes.size();
+		if (m_firstDirtyIndex >= nodeCount)
+			return;
+
+		std::size_t level = std::upper_bound(m_levelOffsets.begin(), m_levelOffsets.end(), m_firstDirtyIndex) - m_levelOffsets.begin() - 1;
+		for (; level < m_levelOffsets.size(); ++level)
+		{
+			// Nodes of a level only depend on the previous ones
+			std::size_t levelBegin = std::max(m_levelOffsets[level], m_firstDirtyIndex);
+			std::size_t levelEnd = (level + 1 < m_levelOffsets.size()) ? m_levelOffsets[level + 1] : nodeCount;
+
+			if (useParallelism)
+			{
+				ParallelForRange(levelBegin, levelEnd, [this](std::size_t begin, std::size_t end)
+				{
+					UpdateRange(begin, end);
+				}, ComputeGrainSize(levelEnd - levelBegin, 1024));
+			}
+			else
+				UpdateRange(levelBegin, levelEnd);
+		}
+
+		m_updatedNodes.clear();
+		for (std::size_t i = m_firstDirtyIndex; i < nodeCount; ++i)
+		{
+			if (m_dirtyFlags[i])
+			{
+				m_updatedNodes.push_back(m_indexNodes[i]);
+				m_dirtyFlags[i] = 0;
+			}
+		}
+
+		m_firstDirtyIndex = InvalidIndex;
+
+		OnTransformsUpdated(this, m_updatedNodes);
+	}
+
+	void TransformHierarchy::Reorder()
+	{
+		std::size_t nodeCount = m_indexNodes.size();
+
+		// Compute depths, walking up the hierarchy until a node of known depth is found
+		constexpr std::size_t UnknownDepth = std::numeric_limits<std::size_t>::max();
+		m_depths.assign(nodeCount, UnknownDepth);
+
+		std::size_t levelCount = 0;
+		std::vector<std::size_t> path;
+		for (std::size_t i = 0; i < nodeCount; ++i)
+		{
+			if (m_indexNodes[i] == InvalidNode || m_depths[i] != UnknownDepth)
+				continue;
+
+			path.clear();
+
+			std::size_t depth;
+			std::size_t index = i;
+			for (;;)
+			{
+				path.push_back(index);
+
+				std::size_t& parentIndex = m_parentIndices[index];
+				if (parentIndex != InvalidIndex && m_indexNodes[parentIndex] == InvalidNode)
+				{
+					// Parent was destroyed
+					parentIndex = InvalidIndex;
+					m_dirtyFlags[index] = 1;
+				}
+
+				if (parentIndex == InvalidIndex)
+				{
+					depth = 0;
+					break;
+				}
+
+				if (m_depths[parentIndex] != UnknownDepth)
+				{
+					depth = m_depths[parentIndex] + 1;
+					break;
+				}
+
+				index = parentIndex;
+			}
+
+			for (auto it = path.rbegin(); it != path.rend(); ++it)
+				m_depths[*it] = depth++;
+
+			levelCount = std::max(levelCount, depth);
+		}
+
+		// Sort nodes by depth (counting sort, keeping the previous order in each level), dropping destroyed nodes
+		m_levelOffsets.assign(levelCount, 0);
+		for (std::size_t i = 0; i < nodeCount; ++i)
+		{
+			if (m_indexNodes[i] != InvalidNode && m_depths[i] + 1 < levelCount)
+				m_levelOffsets[m_depths[i] + 1]++;
+		}
+
+		for (std::size_t level = 1; level < levelCount; ++level)
+			m_levelOffsets[level] += m_levelOffsets[level - 1];
+
+		std::vector<std::size_t> order(GetNodeCount());
+		std::vector<std::size_t> newIndices(nodeCount, InvalidIndex);
+		{
+			std::vector<std::size_t> levelCursors = m_levelOffsets;
+			for (std::size_t i = 0; i < nodeCount; ++i)
+			{
+				if (m_indexNodes[i] == InvalidNode)
+					continue;
+
+				std::size_t newIndex = levelCursors[m_depths[i]]++;
+				newIndices[i] = newIndex;
+				order[newIndex] = i;
+			}
+		}
+
+		for (std::size_t& parentIndex : m_parentIndices)
+		{
+			if (parentIndex != InvalidIndex)
+				parentIndex = newIndices[parentIndex];
+		}
+
+		ApplyOrder(m_depths, order);
+		ApplyOrder(m_dirtyFlags, order);
+		ApplyOrder(m_globalTransforms, order);
+		ApplyOrder(m_indexNodes, order);
+		ApplyOrder(m_localTransforms, order);
+		ApplyOrder(m_parentIndices, order);
+		ApplyOrder(m_transformMatrices, order);
+
+		for (std::size_t i = 0; i < order.size(); ++i)
+			m_nodeIndices[m_indexNodes[i]] = i;
+
+		m_firstDirtyIndex = std::find(m_dirtyFlags.begin(), m_dirtyFlags.end(), 1) - m_dirtyFlags.begin();
+		if (m_firstDirtyIndex == m_dirtyFlags.size())
+			m_firstDirtyIndex = InvalidIndex;
+
+		m_orderInvalidated = false;
+	}
+
+	void TransformHierarchy::UpdateRange(std::size_t begin, std::size_t end)
+	{
+		for (std::size_t i = begin; i < end; ++i)
+		{
+			std::size_t parentIndex = m_parentIndices[i];
+			bool parentUpdated = (parentIndex != InvalidIndex && m_dirtyFlags[parentIndex]);
+			if (!m_dirtyFlags[i] && !parentUpdated)
+				continue;
+
+			m_dirtyFlags[i] = 1; //< Lets children know they have to be updated as well
+
+			const Transform& localTransform = m_localTransforms[i];
+			Transform& globalTransform = m_globalTransforms[i];
+			if (parentIndex != InvalidIndex)
+			{
+				// Same as Node::UpdateDerived, with every inheritance enabled
+				const Transform& parentTransform = m_globalTransforms[parentIndex];
+
+				globalTransform.position = parentTransform.rotation * (parentTransform.scale * localTransform.position) + parentTransform.position;
+				globalTransform.rotation = parentTransform.rotation * Node::ScaleQuaternion(parentTransform.scale, localTransform.rotation);
+				globalTransform.rotation.Normalize();
+				globalTransform.scale = localTransform.scale * parentTransform.scale;
+			}
+			else
+				globalTransform = localTransform;
+
+			m_transformMatrices[i].MakeTransform(globalTransform.position, globalTransform.rotation, globalTransform.scale);
+		}
+	}
+}
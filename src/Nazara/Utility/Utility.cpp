@@ -17,10 +17,13 @@
 #include <Nazara/Utility/Skeleton.hpp>
 #include <Nazara/Utility/VertexDeclaration.hpp>
 #include <Nazara/Utility/Formats/DDSLoader.hpp>
+#include <Nazara/Utility/Formats/DDSSaver.hpp>
 #include <Nazara/Utility/Formats/FreeTypeLoader.hpp>
 #include <Nazara/Utility/Formats/MD2Loader.hpp>
 #include <Nazara/Utility/Formats/MD5AnimLoader.hpp>
 #include <Nazara/Utility/Formats/MD5MeshLoader.hpp>
+#include <Nazara/Utility/Formats/NMFLoader.hpp>
+#include <Nazara/Utility/Formats/NMFSaver.hpp>
 #include <Nazara/Utility/Formats/OBJLoader.hpp>
 #include <Nazara/Utility/Formats/OBJSaver.hpp>
 #include <Nazara/Utility/Formats/PCXLoader.hpp>
@@ -77,10 +80,13 @@ namespace Nz
 		// Mesh
 		m_meshLoader.RegisterLoader(Loaders::GetMeshLoader_MD2()); // .md2 (v8)
 		m_meshLoader.RegisterLoader(Loaders::GetMeshLoader_MD5Mesh()); // .md5mesh (v10)
+		m_meshLoader.RegisterLoader(Loaders::GetMeshLoader_NMF()); // .nmf (Nazara precompiled mesh)
+		m_meshSaver.RegisterSaver(Loaders::GetMeshSaver_NMF()); // .nmf (Nazara precompiled mesh)
 		m_meshLoader.RegisterLoader(Loaders::GetMeshLoader_OBJ()); // .obj
 
 		// Image
 		m_imageLoader.RegisterLoader(Loaders::GetImageLoader_DDS()); // DDS Loader (DirectX format)
+		m_imageSaver.RegisterSaver(Loaders::GetImageSaver_DDS()); // DDS Saver (DirectX format)
 		m_imageLoader.RegisterLoader(Loaders::GetImageLoader_PCX()); // .pcx loader (1, 4, 8, 24 bits)
 	}
 
@@ -35,6 +35,11 @@ namespace Nz
 		};
 	}
 	VertexDeclaration::VertexDeclaration(VertexInputRate inputRate, std::initializer_list<ComponentEntry> components) :
+	VertexDeclaration(inputRate, std::vector<ComponentEntry>(components))
+	{
+	}
+
+	VertexDeclaration::VertexDeclaration(VertexInputRate inputRate, const std::vector<ComponentEntry>& components) :
 	m_inputRate(inputRate)
 	{
 		ErrorFlags errFlags(ErrorMode::ThrowException);
@@ -341,6 +346,32 @@ namespace Nz
 			});
 
 			NazaraAssert(s_declarations[UnderlyingCast(VertexLayout::Matrix4)]->GetStride() == sizeof(Matrix4f), "Invalid stride for declaration VertexLayout::Matrix4");
+
+			// VertexLayout::Matrix4_Instance : Matrix4f (per instance)
+			s_declarations[UnderlyingCast(VertexLayout::Matrix4_Instance)] = NewDeclaration(VertexInputRate::Instance, {
+				{
+					VertexComponent::Userdata,
+					ComponentType::Float4,
+					0
+				},
+				{
+					VertexComponent::Userdata,
+					ComponentType::Float4,
+					1
+				},
+				{
+					VertexComponent::Userdata,
+					ComponentType::Float4,
+					2
+				},
+				{
+					VertexComponent::Userdata,
+					ComponentType::Float4,
+					3
+				}
+			});
+
+			NazaraAssert(s_declarations[UnderlyingCast(VertexLayout::Matrix4_Instance)]->GetStride() == sizeof(Matrix4f), "Invalid stride for declaration VertexLayout::Matrix4_Instance");
 		}
 		catch (const std::exception& e)
 		{
@@ -1,11 +1,56 @@
 #include <Nazara/Audio/Audio.hpp>
 #include <Nazara/Audio/Music.hpp>
 #include <catch2/catch.hpp>
+#include <array>
 #include <chrono>
 #include <thread>
+#include <vector>
 
 std::filesystem::path GetResourceDir();
 
+namespace
+{
+	// 16 bits PCM WAV file with a sawtooth wave on every channel
+	std::vector<Nz::UInt8> GenerateWav(Nz::UInt16 channelCount, Nz::UInt32 sampleRate, Nz::UInt32 frameCount)
+	{
+		std::vector<Nz::UInt8> data;
+		auto Write16 = [&](Nz::UInt16 value)
+		{
+			data.push_back(Nz::UInt8(value & 0xFF));
+			data.push_back(Nz::UInt8(value >> 8));
+		};
+
+		auto Write32 = [&](Nz::UInt32 value)
+		{
+			Write16(Nz::UInt16(value & 0xFFFF));
+			Write16(Nz::UInt16(value >> 16));
+		};
+
+		Nz::UInt32 dataSize = frameCount * channelCount * sizeof(Nz::Int16);
+
+		data.insert(data.end(), { 'R', 'I', 'F', 'F' });
+		Write32(36 + dataSize);
+		data.insert(data.end(), { 'W', 'A', 'V', 'E', 'f', 'm', 't', ' ' });
+		Write32(16);
+		Write16(1); //< PCM
+		Write16(channelCount);
+		Write32(sampleRate);
+		Write32(sampleRate * channelCount * sizeof(Nz::Int16));
+		Write16(Nz::UInt16(channelCount * sizeof(Nz::Int16)));
+		Write16(16);
+		data.insert(data.end(), { 'd', 'a', 't', 'a' });
+		Write32(dataSize);
+
+		for (Nz::UInt32 frame = 0; frame < frameCount; ++frame)
+		{
+			for (Nz::UInt16 channel = 0; channel < channelCount; ++channel)
+				Write16(Nz::UInt16((frame * 64 + channel) & 0xFFFF));
+		}
+
+		return data;
+	}
+}
+
 SCENARIO("Music", "[AUDIO][MUSIC]")
 {
 	GIVEN("A music")
@@ -48,4 +93,73 @@ SCENARIO("Music", "[AUDIO][MUSIC]")
 			}
 		}
 	}
+
+	GIVEN("Multiple musics")
+	{
+		std::array<Nz::Music, 4> musics;
+		for (Nz::Music& music : musics)
+			REQUIRE(music.OpenFromFile(GetResourceDir() / "Engine/Audio/The_Brabanconne.ogg"));
+
+		WHEN("We play them at once")
+		{
+			Nz::Audio::Instance()->SetGlobalVolume(0.f);
+
+			Nz::AudioStreamer& audioStreamer = Nz::Audio::Instance()->GetAudioStreamer();
+			for (Nz::Music& music : musics)
+				music.Play();
+
+			THEN("They are all streamed by the audio streamer")
+			{
+				CHECK(audioStreamer.GetStreamedSourceCount() == musics.size());
+
+				std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+				for (Nz::Music& music : musics)
+				{
+					CHECK(music.GetStatus() == Nz::SoundStatus::Playing);
+					CHECK(music.GetPlayingOffset() >= 1400);
+				}
+
+				musics[0].SetPlayingOffset(30000);
+				CHECK(musics[0].GetStatus() == Nz::SoundStatus::Playing);
+				CHECK(musics[0].GetPlayingOffset() >= 30000);
+
+				for (Nz::Music& music : musics)
+					music.Stop();
+
+				CHECK(audioStreamer.GetStreamedSourceCount() == 0);
+			}
+
+			Nz::Audio::Instance()->SetGlobalVolume(100.f);
+		}
+	}
+
+	GIVEN("A 5.1 music")
+	{
+		constexpr Nz::UInt32 SampleRate = 44100;
+		std::vector<Nz::UInt8> wavData = GenerateWav(6, SampleRate, 4 * SampleRate);
+
+		Nz::Music music;
+		REQUIRE(music.OpenFromMemory(wavData.data(), wavData.size()));
+		CHECK(music.GetFormat() == Nz::AudioFormat::I16_5_1);
+		CHECK(music.GetSampleCount() == 6 * 4 * SampleRate);
+
+		WHEN("We play it")
+		{
+			Nz::Audio::Instance()->SetGlobalVolume(0.f);
+
+			music.Play();
+
+			THEN("It keeps streaming after the first decoded samples")
+			{
+				// The decoded samples buffer holds one second, six channels frames must not be split at its end
+				std::this_thread::sleep_for(std::chrono::milliseconds(2500));
+				CHECK(music.GetStatus() == Nz::SoundStatus::Playing);
+				CHECK(music.GetPlayingOffset() >= 2400);
+
+				music.Stop();
+			}
+
+			Nz::Audio::Instance()->SetGlobalVolume(100.f);
+		}
+	}
 }
@@ -1,5 +1,9 @@
 #include <Nazara/Audio/SoundBuffer.hpp>
+#include <Nazara/Audio/SoundBufferCache.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <catch2/catch.hpp>
+#include <array>
+#include <cstring>
 
 std::filesystem::path GetResourceDir();
 
@@ -18,5 +22,63 @@ SCENARIO("SoundBuffer", "[AUDIO][SOUNDBUFFER]")
 				REQUIRE(soundBuffer->GetDuration() >= 8000);
 			}
 		}
+
+		WHEN("We load our sounds asynchronously")
+		{
+			std::array<std::shared_ptr<Nz::SoundBuffer>, 4> soundBuffers;
+
+			Nz::TaskScheduler::Counter counter;
+			for (std::size_t i = 0; i < soundBuffers.size(); ++i)
+			{
+				Nz::SoundBuffer::LoadFromFileAsync(GetResourceDir() / "Engine/Audio/Cat.flac", [&soundBuffers, i](std::shared_ptr<Nz::SoundBuffer> soundBuffer)
+				{
+					soundBuffers[i] = std::move(soundBuffer);
+				}, &counter);
+			}
+
+			Nz::TaskScheduler::WaitFor(counter);
+
+			THEN("They are all loaded")
+			{
+				for (const auto& soundBuffer : soundBuffers)
+				{
+					REQUIRE(soundBuffer);
+					CHECK(soundBuffer->GetDuration() <= 8500);
+					CHECK(soundBuffer->GetDuration() >= 8000);
+				}
+			}
+		}
+	}
+
+	GIVEN("A sound buffer cache")
+	{
+		std::filesystem::path cacheDirectory = std::filesystem::temp_directory_path() / "NazaraSoundBufferCacheTest";
+		std::filesystem::remove_all(cacheDirectory);
+
+		Nz::SoundBufferCache cache(cacheDirectory);
+		REQUIRE(cache.IsEnabled());
+
+		WHEN("We load the same sound twice")
+		{
+			std::shared_ptr<Nz::SoundBuffer> decodedBuffer = cache.LoadFromFile(GetResourceDir() / "Engine/Audio/Cat.flac", Nz::SoundBufferParams());
+			REQUIRE(decodedBuffer);
+
+			std::shared_ptr<Nz::SoundBuffer> cachedBuffer = cache.LoadFromFile(GetResourceDir() / "Engine/Audio/Cat.flac", Nz::SoundBufferParams());
+			REQUIRE(cachedBuffer);
+
+			THEN("The second load comes from the cache and is identical")
+			{
+				Nz::SoundBufferCache::Stats stats = cache.GetStats();
+				CHECK(stats.missCount == 1);
+				CHECK(stats.hitCount == 1);
+
+				CHECK(cachedBuffer->GetFormat() == decodedBuffer->GetFormat());
+				CHECK(cachedBuffer->GetSampleRate() == decodedBuffer->GetSampleRate());
+				REQUIRE(cachedBuffer->GetSampleCount() == decodedBuffer->GetSampleCount());
+				CHECK(std::memcmp(cachedBuffer->GetSamples(), decodedBuffer->GetSamples(), decodedBuffer->GetSampleCount() * sizeof(Nz::Int16)) == 0);
+			}
+		}
+
+		std::filesystem::remove_all(cacheDirectory);
 	}
 }
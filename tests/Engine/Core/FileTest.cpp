@@ -1,5 +1,6 @@
 #include <Nazara/Core/File.hpp>
 #include <catch2/catch.hpp>
+#include <string>
 
 std::filesystem::path GetResourceDir();
 
@@ -80,4 +81,131 @@ SCENARIO("File", "[CORE][FILE]")
 			}
 		}
 	}
+
+	GIVEN("A buffered file")
+	{
+		std::filesystem::path filePath = "Buffered File.txt";
+
+		Nz::File file(filePath, Nz::OpenMode_ReadWrite | Nz::OpenMode::Truncate);
+		REQUIRE(file.IsOpen());
+
+		file.EnableBuffering(true, 16);
+		CHECK(file.IsBufferingEnabled());
+		CHECK(file.GetBufferSize() == 16);
+
+		std::string content;
+		for (unsigned int i = 0; i < 100; ++i)
+		{
+			std::string line = "Line " + std::to_string(i) + "\n";
+			REQUIRE(file.Write(line));
+
+			content += line;
+		}
+
+		std::string longLine(100, 'x');
+		REQUIRE(file.Write(longLine));
+		content += longLine;
+
+		CHECK(file.GetCursorPos() == content.size());
+
+		WHEN("We read it back line by line")
+		{
+			REQUIRE(file.SetCursorPos(0));
+			CHECK(file.GetSize() == content.size());
+
+			bool linesMatch = true;
+			for (unsigned int i = 0; i < 100; ++i)
+			{
+				if (file.ReadLineView() != "Line " + std::to_string(i))
+					linesMatch = false;
+			}
+
+			THEN("Every line is read correctly, even if longer than the buffer")
+			{
+				CHECK(linesMatch);
+				CHECK(file.ReadLine() == longLine);
+				CHECK(file.EndOfStream());
+			}
+		}
+
+		WHEN("We move the cursor around while reading")
+		{
+			REQUIRE(file.SetCursorPos(0));
+
+			char buffer[4];
+			REQUIRE(file.Read(buffer, 4) == 4);
+			REQUIRE(file.SetCursorPos(1));
+			REQUIRE(file.Read(buffer, 3) == 3);
+			CHECK(std::string(buffer, 3) == "ine");
+
+			REQUIRE(file.SetCursorPos(content.size() - 2));
+			REQUIRE(file.Read(buffer, 4) == 2);
+			CHECK(file.EndOfStream());
+		}
+
+		WHEN("We overwrite data after reading some")
+		{
+			REQUIRE(file.SetCursorPos(0));
+
+			char buffer[7];
+			REQUIRE(file.Read(buffer, 4) == 4);
+			REQUIRE(file.Write("XX"));
+			CHECK(file.GetCursorPos() == 6);
+
+			REQUIRE(file.SetCursorPos(0));
+			REQUIRE(file.Read(buffer, 7) == 7);
+
+			THEN("Data is written where the cursor was")
+			{
+				CHECK(std::string(buffer, 7) == "LineXX\n");
+				CHECK(file.ReadLine() == "Line 1");
+			}
+		}
+
+		WHEN("We close the file without flushing it")
+		{
+			REQUIRE(file.Write("End"));
+			file.Close();
+
+			THEN("Pending data is written")
+			{
+				CHECK(std::filesystem::file_size(filePath) == content.size() + 3);
+			}
+		}
+
+		file.Close();
+		std::filesystem::remove(filePath);
+	}
+
+	GIVEN("A text file with Windows line endings")
+	{
+		std::filesystem::path filePath = "Text File.txt";
+		{
+			Nz::File file(filePath, Nz::OpenMode::WriteOnly | Nz::OpenMode::Truncate);
+			REQUIRE(file.Write("First\r\nSecond\r\n\r\nFourth", 23) == 23);
+		}
+
+		for (std::size_t bufferSize : { 0, 2, 3, 64 })
+		{
+			WHEN("We read it with a buffer of size " + std::to_string(bufferSize))
+			{
+				Nz::File file(filePath, Nz::OpenMode::ReadOnly | Nz::OpenMode::Text);
+				REQUIRE(file.IsOpen());
+
+				if (bufferSize > 0)
+					file.EnableBuffering(true, bufferSize);
+
+				THEN("\\r\\n is treated as a line separator")
+				{
+					CHECK(file.ReadLine() == "First");
+					CHECK(file.ReadLine() == "Second");
+					CHECK(file.ReadLine() == "");
+					CHECK(file.ReadLine() == "Fourth");
+					CHECK(file.EndOfStream());
+				}
+			}
+		}
+
+		std::filesystem::remove(filePath);
+	}
 }
@@ -0,0 +1,107 @@
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/MappedFile.hpp>
+#include <catch2/catch.hpp>
+#include <cstring>
+#include <string>
+
+SCENARIO("MappedFile", "[CORE][MAPPEDFILE]")
+{
+	GIVEN("A text file mapped in memory")
+	{
+		{
+			Nz::File file("Mapped File.txt", Nz::OpenMode::WriteOnly | Nz::OpenMode::Truncate);
+			REQUIRE(file.IsOpen());
+
+			file.Write("First line\nSecond line\r\nLast line", 33);
+		}
+
+		Nz::MappedFile mappedFile("Mapped File.txt");
+		REQUIRE(mappedFile.IsOpen());
+		CHECK(mappedFile.IsMemoryMapped());
+		CHECK(mappedFile.IsReadable());
+		CHECK_FALSE(mappedFile.IsWritable());
+		CHECK(mappedFile.GetSize() == 33U);
+		CHECK(mappedFile.GetFileName() == "Mapped File.txt");
+
+		WHEN("We access its content")
+		{
+			THEN("It's directly available in memory")
+			{
+				REQUIRE(mappedFile.GetData() != nullptr);
+				CHECK(mappedFile.GetMappedPointer() == mappedFile.GetData());
+				CHECK(std::memcmp(mappedFile.GetData(), "First line\n", 11) == 0);
+			}
+		}
+
+		WHEN("We read it")
+		{
+			char buffer[6];
+			REQUIRE(mappedFile.Read(buffer, 5) == 5);
+			buffer[5] = '\0';
+
+			CHECK(std::string(buffer) == "First");
+			CHECK(mappedFile.GetCursorPos() == 5U);
+
+			REQUIRE(mappedFile.SetCursorPos(28));
+			CHECK(mappedFile.Read(buffer, 6) == 5);
+			CHECK(mappedFile.EndOfStream());
+
+			CHECK(mappedFile.SetCursorPos(100));
+			CHECK(mappedFile.GetCursorPos() == 33U);
+		}
+
+		WHEN("We read it line by line")
+		{
+			mappedFile.EnableTextMode(true);
+
+			std::string_view firstLine = mappedFile.ReadLineView();
+			std::string_view secondLine = mappedFile.ReadLineView();
+			std::string_view lastLine = mappedFile.ReadLineView();
+
+			THEN("Lines are views in the mapped memory")
+			{
+				CHECK(firstLine == "First line");
+				CHECK(firstLine.data() == reinterpret_cast<const char*>(mappedFile.GetData()));
+				CHECK(secondLine == "Second line");
+				CHECK(lastLine == "Last line");
+				CHECK(mappedFile.EndOfStream());
+			}
+		}
+
+		WHEN("We read it through the read buffer")
+		{
+			mappedFile.EnableBuffering(true);
+			mappedFile.EnableTextMode(true);
+
+			CHECK(mappedFile.ReadLine() == "First line");
+			CHECK(mappedFile.ReadLine() == "Second line");
+			CHECK(mappedFile.GetCursorPos() == 24U);
+		}
+
+		WHEN("We close it")
+		{
+			mappedFile.Close();
+
+			THEN("Its memory is released")
+			{
+				CHECK_FALSE(mappedFile.IsOpen());
+				CHECK(mappedFile.GetData() == nullptr);
+				CHECK(mappedFile.GetSize() == 0U);
+			}
+		}
+
+		mappedFile.Close();
+		std::filesystem::remove("Mapped File.txt");
+	}
+
+	GIVEN("A file which doesn't exist")
+	{
+		Nz::MappedFile mappedFile;
+
+		THEN("It can't be mapped")
+		{
+			CHECK_FALSE(mappedFile.Open("Missing File.txt"));
+			CHECK_FALSE(mappedFile.IsOpen());
+		}
+	}
+}
@@ -0,0 +1,133 @@
+#include <Nazara/Core/ParallelAlgorithm.hpp>
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <vector>
+
+SCENARIO("ParallelAlgorithm", "[CORE][PARALLELALGORITHM]")
+{
+	GIVEN("A task scheduler with four workers")
+	{
+		Nz::TaskScheduler::Uninitialize();
+		Nz::TaskScheduler::SetWorkerCount(4);
+		REQUIRE(Nz::TaskScheduler::Initialize());
+
+		WHEN("We run a parallel for over a large range")
+		{
+			std::vector<int> visitCount(100'000, 0);
+			Nz::ParallelFor(0, visitCount.size(), [&](std::size_t i)
+			{
+				visitCount[i]++;
+			}, 64);
+
+			THEN("Every index is processed exactly once")
+			{
+				CHECK(std::all_of(visitCount.begin(), visitCount.end(), [](int count) { return count == 1; }));
+			}
+		}
+
+		WHEN("We split a range into chunks")
+		{
+			std::atomic<std::size_t> elementCount = 0;
+			std::atomic<bool> chunkTooLarge = false;
+			Nz::ParallelForRange(10, 10'010, [&](std::size_t begin, std::size_t end)
+			{
+				if (end - begin > 100)
+					chunkTooLarge = true;
+
+				elementCount += end - begin;
+			}, 100);
+
+			THEN("Chunks respect the grain size and cover the whole range")
+			{
+				CHECK_FALSE(chunkTooLarge);
+				CHECK(elementCount == 10'000);
+			}
+		}
+
+		WHEN("We reduce a range")
+		{
+			std::vector<Nz::UInt64> values(123'457);
+			std::iota(values.begin(), values.end(), 1);
+
+			Nz::UInt64 sum = Nz::ParallelReduce(0, values.size(), Nz::UInt64(0), [&](std::size_t begin, std::size_t end, Nz::UInt64 init)
+			{
+				return std::accumulate(values.begin() + begin, values.begin() + end, init);
+			}, [](Nz::UInt64 lhs, Nz::UInt64 rhs) { return lhs + rhs; }, 1000);
+
+			THEN("The result matches the sequential one")
+			{
+				CHECK(sum == Nz::UInt64(123'457) * 123'458 / 2);
+			}
+		}
+
+		WHEN("We reduce floats twice")
+		{
+			std::mt19937 randomGenerator(42);
+			std::uniform_real_distribution<float> distribution(-1000.f, 1000.f);
+
+			std::vector<float> values(50'000);
+			for (float& value : values)
+				value = distribution(randomGenerator);
+
+			auto Reduce = [&]
+			{
+				return Nz::ParallelReduce(0, values.size(), 0.f, [&](std::size_t begin, std::size_t end, float init)
+				{
+					return std::accumulate(values.begin() + begin, values.begin() + end, init);
+				}, [](float lhs, float rhs) { return lhs + rhs; }, 512);
+			};
+
+			THEN("Results are bit-identical")
+			{
+				CHECK(Reduce() == Reduce());
+			}
+		}
+
+		WHEN("We sort a large array")
+		{
+			std::mt19937 randomGenerator(1337);
+			std::vector<unsigned int> values(200'000);
+			for (unsigned int& value : values)
+				value = randomGenerator();
+
+			std::vector<unsigned int> expected = values;
+			std::sort(expected.begin(), expected.end());
+
+			Nz::ParallelSort(values.begin(), values.end(), std::less<>(), 1000);
+
+			THEN("It matches std::sort")
+			{
+				CHECK(values == expected);
+			}
+
+			AND_WHEN("We sort it in reverse order")
+			{
+				Nz::ParallelSort(values.begin(), values.end(), std::greater<>());
+				CHECK(std::is_sorted(values.begin(), values.end(), std::greater<>()));
+			}
+		}
+
+		WHEN("We nest parallel loops")
+		{
+			std::atomic<std::size_t> count = 0;
+			Nz::ParallelFor(0, 32, [&](std::size_t)
+			{
+				Nz::ParallelFor(0, 32, [&](std::size_t)
+				{
+					count++;
+				}, 4);
+			}, 1);
+
+			THEN("Every inner iteration ran")
+			{
+				CHECK(count == 32 * 32);
+			}
+		}
+
+		Nz::TaskScheduler::Uninitialize();
+		Nz::TaskScheduler::SetWorkerCount(0);
+	}
+}
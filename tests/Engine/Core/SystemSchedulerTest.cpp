@@ -0,0 +1,91 @@
+#include <Nazara/Core/SystemScheduler.hpp>
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace
+{
+	struct PositionComponent {};
+	struct VelocityComponent {};
+	struct SpriteComponent {};
+}
+
+SCENARIO("SystemScheduler", "[CORE][SYSTEMSCHEDULER]")
+{
+	GIVEN("Systems accessing components")
+	{
+		Nz::SystemScheduler scheduler;
+
+		std::mutex mutex;
+		std::vector<std::string> executionOrder;
+		auto Log = [&](std::string name)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			executionOrder.push_back(std::move(name));
+		};
+
+		auto IndexOf = [&](const std::string& name)
+		{
+			return std::find(executionOrder.begin(), executionOrder.end(), name) - executionOrder.begin();
+		};
+
+		float receivedTime = 0.f;
+		scheduler.AddSystem(Nz::SystemScheduler::Access().Read<VelocityComponent>().Write<PositionComponent>(), [&](float elapsedTime)
+		{
+			receivedTime = elapsedTime;
+			Log("Movement");
+		});
+
+		scheduler.AddSystem(Nz::SystemScheduler::Access().Write<VelocityComponent>(), [&](float /*elapsedTime*/) { Log("Gravity"); });
+		scheduler.AddSystem(Nz::SystemScheduler::Access().Read<const PositionComponent>().Write<SpriteComponent>(), [&](float /*elapsedTime*/) { Log("Animation"); });
+		scheduler.AddSystem(Nz::SystemScheduler::Access().Read<PositionComponent, SpriteComponent>(), [&](float /*elapsedTime*/) { Log("Culling"); });
+		scheduler.AddSystem(Nz::SystemScheduler::Access().Exclusive(), [&](float /*elapsedTime*/) { Log("Render"); });
+		scheduler.AddSystem(Nz::SystemScheduler::Access().Read<PositionComponent>(), [&](float /*elapsedTime*/) { Log("Network"); });
+
+		CHECK(scheduler.GetSystemCount() == 6);
+
+		WHEN("We check their accesses")
+		{
+			THEN("Only writes conflict")
+			{
+				auto reader = Nz::SystemScheduler::Access().Read<PositionComponent>();
+				auto writer = Nz::SystemScheduler::Access().Write<PositionComponent>();
+				auto otherWriter = Nz::SystemScheduler::Access().Write<VelocityComponent>();
+
+				CHECK_FALSE(reader.Conflicts(reader));
+				CHECK(reader.Conflicts(writer));
+				CHECK(writer.Conflicts(reader));
+				CHECK(writer.Conflicts(writer));
+				CHECK_FALSE(writer.Conflicts(otherWriter));
+				CHECK(Nz::SystemScheduler::Access().Exclusive().Conflicts(Nz::SystemScheduler::Access()));
+			}
+		}
+
+		for (bool useParallelism : { false, true })
+		{
+			std::string description = (useParallelism) ? "We update them concurrently" : "We update them sequentially";
+			WHEN(description)
+			{
+				for (unsigned int i = 0; i < 20; ++i)
+				{
+					executionOrder.clear();
+					scheduler.Update(0.5f, useParallelism);
+
+					REQUIRE(executionOrder.size() == 6);
+					CHECK(receivedTime == 0.5f);
+
+					// Conflicting systems run in the order they were added
+					CHECK(IndexOf("Movement") < IndexOf("Gravity"));
+					CHECK(IndexOf("Movement") < IndexOf("Animation"));
+					CHECK(IndexOf("Animation") < IndexOf("Culling"));
+
+					// Exclusive systems are barriers
+					CHECK(IndexOf("Render") == 4);
+					CHECK(IndexOf("Network") == 5);
+				}
+			}
+		}
+	}
+}
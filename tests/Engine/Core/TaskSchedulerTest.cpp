@@ -0,0 +1,204 @@
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <catch2/catch.hpp>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+SCENARIO("TaskScheduler", "[CORE][TASKSCHEDULER]")
+{
+	GIVEN("A task scheduler with four workers")
+	{
+		Nz::TaskScheduler::Uninitialize();
+		Nz::TaskScheduler::SetWorkerCount(4);
+		REQUIRE(Nz::TaskScheduler::Initialize());
+
+		WHEN("We add tasks and run them")
+		{
+			std::atomic<int> sum = 0;
+			for (int i = 1; i <= 100; ++i)
+				Nz::TaskScheduler::AddTask([&sum, i] { sum += i; });
+
+			Nz::TaskScheduler::Run();
+			Nz::TaskScheduler::WaitForTasks();
+
+			THEN("Every task has been executed")
+			{
+				CHECK(sum == 5050);
+			}
+		}
+
+		WHEN("We submit tasks with a counter")
+		{
+			std::array<int, 1000> values;
+			values.fill(0);
+
+			Nz::TaskScheduler::Counter counter;
+			for (std::size_t i = 0; i < values.size(); ++i)
+				Nz::TaskScheduler::Submit([&values, i] { values[i] = static_cast<int>(i) * 2; }, &counter);
+
+			Nz::TaskScheduler::WaitFor(counter);
+
+			THEN("Waiting on the counter ensures they were all executed")
+			{
+				CHECK(counter.IsDone());
+				for (std::size_t i = 0; i < values.size(); ++i)
+					CHECK(values[i] == static_cast<int>(i) * 2);
+			}
+		}
+
+		WHEN("We submit tasks depending on other tasks")
+		{
+			std::atomic<int> firstStage = 0;
+			std::atomic<int> secondStageErrors = 0;
+
+			Nz::TaskScheduler::Counter firstCounter;
+			Nz::TaskScheduler::Counter secondCounter;
+			for (int i = 0; i < 64; ++i)
+				Nz::TaskScheduler::Submit([&] { firstStage++; }, &firstCounter);
+
+			for (int i = 0; i < 64; ++i)
+			{
+				Nz::TaskScheduler::Submit([&]
+				{
+					if (firstStage != 64)
+						secondStageErrors++;
+				}, &secondCounter, &firstCounter);
+			}
+
+			Nz::TaskScheduler::WaitFor(secondCounter);
+
+			THEN("Dependent tasks only ran once their dependency was complete")
+			{
+				CHECK(firstStage == 64);
+				CHECK(secondStageErrors == 0);
+			}
+		}
+
+		WHEN("Tasks submit other tasks")
+		{
+			std::atomic<int> leafCount = 0;
+			Nz::TaskScheduler::Counter counter;
+
+			for (int i = 0; i < 16; ++i)
+			{
+				Nz::TaskScheduler::Submit([&]
+				{
+					Nz::TaskScheduler::Counter childCounter;
+					for (int j = 0; j < 16; ++j)
+						Nz::TaskScheduler::Submit([&] { leafCount++; }, &childCounter);
+
+					Nz::TaskScheduler::WaitFor(childCounter);
+				}, &counter);
+			}
+
+			Nz::TaskScheduler::WaitFor(counter);
+
+			THEN("Nested tasks are executed and can be waited from inside a task")
+			{
+				CHECK(leafCount == 16 * 16);
+			}
+		}
+
+		WHEN("We submit a task too large to be stored inline")
+		{
+			std::array<Nz::UInt64, 32> bigData;
+			bigData.fill(3);
+
+			Nz::UInt64 result = 0;
+			Nz::TaskScheduler::Counter counter;
+			Nz::TaskScheduler::Submit([bigData, &result]
+			{
+				for (Nz::UInt64 value : bigData)
+					result += value;
+			}, &counter);
+
+			Nz::TaskScheduler::WaitFor(counter);
+
+			THEN("It is executed as well")
+			{
+				CHECK(result == 3 * 32);
+			}
+		}
+
+		WHEN("We destroy a task without running it")
+		{
+			auto sharedValue = std::make_shared<int>(42);
+			{
+				Nz::TaskScheduler::Task task([sharedValue] {});
+				CHECK(task.IsValid());
+				CHECK(sharedValue.use_count() == 2);
+
+				Nz::TaskScheduler::Task movedTask(std::move(task));
+				CHECK_FALSE(task.IsValid());
+				CHECK(sharedValue.use_count() == 2);
+			}
+
+			THEN("Captured objects are released")
+			{
+				CHECK(sharedValue.use_count() == 1);
+			}
+		}
+
+		WHEN("Short-lived threads submit tasks")
+		{
+			std::atomic<unsigned int> result = 0;
+			for (unsigned int i = 0; i < 32; ++i)
+			{
+				std::thread thread([&]
+				{
+					Nz::TaskScheduler::Counter counter;
+					for (unsigned int j = 0; j < 4; ++j)
+						Nz::TaskScheduler::Submit([&] { result++; }, &counter);
+
+					Nz::TaskScheduler::WaitFor(counter);
+				});
+				thread.join();
+			}
+
+			THEN("Every task has been executed")
+			{
+				CHECK(result == 32 * 4);
+			}
+		}
+
+		WHEN("We uninitialize the scheduler while tasks are pending")
+		{
+			std::atomic<bool> unblock = false;
+
+			Nz::TaskScheduler::Counter blockingCounter;
+			for (unsigned int i = 0; i < 4; ++i)
+			{
+				Nz::TaskScheduler::Submit([&]
+				{
+					while (!unblock)
+						std::this_thread::yield();
+				}, &blockingCounter);
+			}
+
+			Nz::TaskScheduler::Counter dependentCounter;
+			for (unsigned int i = 0; i < 64; ++i)
+				Nz::TaskScheduler::Submit([] {}, &dependentCounter, &blockingCounter);
+
+			std::thread unblockThread([&]
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(50));
+				unblock = true;
+			});
+
+			Nz::TaskScheduler::Uninitialize();
+			unblockThread.join();
+
+			THEN("Counters of the discarded tasks are released")
+			{
+				CHECK(blockingCounter.IsDone());
+				CHECK(dependentCounter.IsDone());
+			}
+		}
+
+		Nz::TaskScheduler::Uninitialize();
+		Nz::TaskScheduler::SetWorkerCount(0);
+	}
+}
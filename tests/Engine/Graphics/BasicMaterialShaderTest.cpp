@@ -0,0 +1,116 @@
+#include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Shader/GlslWriter.hpp>
+#include <Nazara/Shader/ShaderLangParser.hpp>
+#include <Nazara/Shader/Ast/AstReflect.hpp>
+#include <catch2/catch.hpp>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+namespace
+{
+	const Nz::UInt8 r_basicMaterialShader[] = {
+		#include <Nazara/Graphics/Resources/Shaders/basicmaterial.nzsl.h>
+	};
+
+	std::size_t CountOccurrences(std::string_view str, std::string_view pattern)
+	{
+		std::size_t count = 0;
+		for (std::size_t pos = str.find(pattern); pos != str.npos; pos = str.find(pattern, pos + pattern.size()))
+			count++;
+
+		return count;
+	}
+}
+
+SCENARIO("BasicMaterial shader", "[GRAPHICS][BASICMATERIAL]")
+{
+	GIVEN("The basic material shader")
+	{
+		Nz::ShaderAst::StatementPtr shaderAst = Nz::ShaderLang::Parse(std::string_view(reinterpret_cast<const char*>(r_basicMaterialShader), sizeof(r_basicMaterialShader)));
+		REQUIRE(shaderAst);
+
+		std::unordered_map<std::string, std::size_t> optionIndexes;
+
+		Nz::ShaderAst::AstReflect::Callbacks callbacks;
+		callbacks.onOptionDeclaration = [&](const std::string& optionName, const Nz::ShaderAst::ExpressionType& /*optionType*/)
+		{
+			std::size_t optionIndex = optionIndexes.size();
+			optionIndexes[optionName] = optionIndex;
+		};
+
+		Nz::ShaderAst::AstReflect reflect;
+		reflect.Reflect(*shaderAst, callbacks);
+
+		REQUIRE(optionIndexes.count("HAS_DIFFUSE_TEXTURE") == 1);
+		REQUIRE(optionIndexes.count("INSTANCED") == 1);
+
+		for (bool instanced : { false, true })
+		{
+			WHEN("We generate the GLSL vertex shader with INSTANCED = " + std::string((instanced) ? "true" : "false"))
+			{
+				Nz::ShaderWriter::States states;
+				states.enabledOptions = 1ULL << optionIndexes["HAS_DIFFUSE_TEXTURE"];
+				if (instanced)
+					states.enabledOptions |= 1ULL << optionIndexes["INSTANCED"];
+
+				states.sanitized = true;
+
+				Nz::ShaderAst::StatementPtr sanitizedAst = Nz::GlslWriter::Sanitize(*shaderAst, states.enabledOptions);
+				REQUIRE(sanitizedAst);
+
+				Nz::GlslWriter writer;
+				std::string output = writer.Generate(Nz::ShaderStageType::Vertex, *sanitizedAst, {}, states);
+
+				THEN("Input struct members have unique names")
+				{
+					std::size_t structBegin = output.find("struct VertIn");
+					REQUIRE(structBegin != output.npos);
+
+					std::size_t structEnd = output.find("};", structBegin);
+					REQUIRE(structEnd != output.npos);
+
+					std::set<std::string> memberNames;
+					std::string_view structBody = std::string_view(output).substr(structBegin, structEnd - structBegin);
+					for (std::size_t lineBegin = structBody.find('{') + 1; lineBegin < structBody.size();)
+					{
+						std::size_t lineEnd = structBody.find('\n', lineBegin);
+						if (lineEnd == structBody.npos)
+							lineEnd = structBody.size();
+
+						std::string_view line = Nz::Trim(structBody.substr(lineBegin, lineEnd - lineBegin));
+						if (!line.empty())
+						{
+							std::size_t nameBegin = line.rfind(' ');
+							REQUIRE(nameBegin != line.npos);
+							CHECK(memberNames.emplace(line.substr(nameBegin + 1)).second);
+						}
+
+						lineBegin = lineEnd + 1;
+					}
+
+					CHECK_FALSE(memberNames.empty());
+				}
+
+				THEN("Each vertex input location is declared once")
+				{
+					for (unsigned int location = 0; location < 6; ++location)
+						CHECK(CountOccurrences(output, "layout(location = " + std::to_string(location) + ") in ") <= 1);
+
+					if (instanced)
+					{
+						CHECK(CountOccurrences(output, "layout(location = 0) in vec4 ") == 1);
+						CHECK(CountOccurrences(output, "layout(location = 4) in vec3 ") == 1);
+						CHECK(CountOccurrences(output, "layout(location = 5) in vec2 ") == 1);
+					}
+					else
+					{
+						CHECK(CountOccurrences(output, "layout(location = 0) in vec3 ") == 1);
+						CHECK(CountOccurrences(output, "layout(location = 1) in vec2 ") == 1);
+						CHECK(CountOccurrences(output, "layout(location = 4) in ") == 0);
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,132 @@
+#include <Nazara/Graphics/CullingList.hpp>
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <vector>
+
+SCENARIO("CullingList", "[GRAPHICS][CULLINGLIST]")
+{
+	// Looking along +X with a 90° FOV, the frustum half-width is equal to the distance from the eye
+	Nz::Frustumf frustum;
+	frustum.Build(Nz::DegreeAnglef(90.f), 1.f, 1.f, 1000.f, Nz::Vector3f::Zero(), Nz::Vector3f::UnitX());
+
+	GIVEN("A few renderables, inside, crossing and outside of the frustum")
+	{
+		std::vector<int> renderables = { 0, 1, 2, 3 };
+
+		Nz::CullingList<int> cullingList;
+
+		Nz::CullingList<int>::BoxEntry insideEntry = cullingList.RegisterBoxTest(&renderables[0]);
+		insideEntry.UpdateBox(Nz::Boxf(9.f, -1.f, -1.f, 2.f, 2.f, 2.f));
+
+		Nz::CullingList<int>::BoxEntry crossingEntry = cullingList.RegisterBoxTest(&renderables[1]);
+		crossingEntry.UpdateBox(Nz::Boxf(9.f, 5.f, -1.f, 2.f, 10.f, 2.f));
+
+		Nz::CullingList<int>::BoxEntry behindEntry = cullingList.RegisterBoxTest(&renderables[2]);
+		behindEntry.UpdateBox(Nz::Boxf(-11.f, -1.f, -1.f, 2.f, 2.f, 2.f));
+
+		Nz::CullingList<int>::NoTestEntry noTestEntry = cullingList.RegisterNoTest(&renderables[3]);
+
+		WHEN("We cull them")
+		{
+			bool forceInvalidation = true;
+			std::size_t visibilityHash = cullingList.Cull(frustum, &forceInvalidation);
+
+			THEN("Only visible renderables are returned")
+			{
+				CHECK(cullingList.GetFullyVisibleResults() == std::vector<const int*>{ &renderables[0], &renderables[3] });
+				CHECK(cullingList.GetPartiallyVisibleResults() == std::vector<const int*>{ &renderables[1] });
+				CHECK_FALSE(forceInvalidation);
+			}
+
+			AND_THEN("Culling again gives the same hash")
+			{
+				CHECK(cullingList.Cull(frustum) == visibilityHash);
+			}
+
+			AND_WHEN("A renderable moves behind the camera")
+			{
+				insideEntry.UpdateBox(Nz::Boxf(-21.f, -1.f, -1.f, 2.f, 2.f, 2.f));
+
+				THEN("It is culled and the hash changes")
+				{
+					CHECK(cullingList.Cull(frustum) != visibilityHash);
+					CHECK(cullingList.GetFullyVisibleResults() == std::vector<const int*>{ &renderables[3] });
+				}
+			}
+
+			AND_WHEN("A visible renderable forces invalidation")
+			{
+				crossingEntry.ForceInvalidation();
+
+				THEN("The next cull reports it, once")
+				{
+					CHECK(cullingList.Cull(frustum, &forceInvalidation) == visibilityHash);
+					CHECK(forceInvalidation);
+
+					cullingList.Cull(frustum, &forceInvalidation);
+					CHECK_FALSE(forceInvalidation);
+				}
+			}
+
+			AND_WHEN("A renderable is released")
+			{
+				insideEntry = Nz::CullingList<int>::BoxEntry();
+
+				THEN("Remaining entries keep their bounds")
+				{
+					cullingList.Cull(frustum);
+					CHECK(cullingList.GetFullyVisibleResults() == std::vector<const int*>{ &renderables[3] });
+					CHECK(cullingList.GetPartiallyVisibleResults() == std::vector<const int*>{ &renderables[1] });
+				}
+			}
+		}
+
+		WHEN("We fill the list without culling")
+		{
+			cullingList.FillWithAllEntries();
+
+			THEN("Every renderable is returned")
+			{
+				CHECK(cullingList.GetFullyVisibleResults().size() == 4);
+				CHECK(cullingList.GetPartiallyVisibleResults().empty());
+			}
+		}
+	}
+
+	GIVEN("Enough renderables to cull them in parallel")
+	{
+		constexpr std::size_t RenderableCount = 10'000;
+
+		std::vector<int> renderables(RenderableCount);
+
+		Nz::CullingList<int> cullingList;
+
+		std::vector<Nz::CullingList<int>::BoxEntry> entries;
+		std::vector<const int*> expectedResults;
+		for (std::size_t i = 0; i < RenderableCount; ++i)
+		{
+			// One out of three renderables is behind the camera
+			float x = (i % 3 == 0) ? -10.f : 10.f;
+
+			auto& entry = entries.emplace_back(cullingList.RegisterBoxTest(&renderables[i]));
+			entry.UpdateBox(Nz::Boxf(x, -1.f, -1.f, 1.f, 1.f, 1.f));
+
+			if (i % 3 != 0)
+				expectedResults.push_back(&renderables[i]);
+		}
+
+		WHEN("We cull them")
+		{
+			std::size_t visibilityHash = cullingList.Cull(frustum);
+
+			THEN("Results are in registration order and stable")
+			{
+				CHECK(cullingList.GetFullyVisibleResults() == expectedResults);
+				CHECK(cullingList.GetPartiallyVisibleResults().empty());
+
+				CHECK(cullingList.Cull(frustum) == visibilityHash);
+				CHECK(cullingList.GetFullyVisibleResults() == expectedResults);
+			}
+		}
+	}
+}
@@ -0,0 +1,212 @@
+#include <Nazara/Core/Primitive.hpp>
+#include <Nazara/Graphics/BasicMaterial.hpp>
+#include <Nazara/Graphics/ForwardFramePipeline.hpp>
+#include <Nazara/Graphics/GraphicalMesh.hpp>
+#include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Graphics/Material.hpp>
+#include <Nazara/Graphics/MaterialPipeline.hpp>
+#include <Nazara/Graphics/Model.hpp>
+#include <Nazara/Graphics/UberShader.hpp>
+#include <Nazara/Graphics/WorldInstance.hpp>
+#include <Nazara/Graphics/Components/CameraComponent.hpp>
+#include <Nazara/NullRenderer/NullDevice.hpp>
+#include <Nazara/NullRenderer/NullRenderWindow.hpp>
+#include <Nazara/Renderer/RenderFrame.hpp>
+#include <Nazara/Renderer/Renderer.hpp>
+#include <Nazara/Utility/Mesh.hpp>
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <variant>
+#include <vector>
+
+namespace
+{
+	void WaitForShaders(const Nz::MaterialPipeline& pipeline)
+	{
+		// Shaders are compiled in background, block on them so the first frame draws everything
+		for (const auto& shader : pipeline.GetInfo().shaders)
+		{
+			if (shader.uberShader)
+				shader.uberShader->Get(shader.enabledOptions);
+		}
+
+		if (const Nz::MaterialPipeline* instancedPipeline = pipeline.GetInstancedPipeline(); instancedPipeline && instancedPipeline != &pipeline)
+			WaitForShaders(*instancedPipeline);
+	}
+}
+
+SCENARIO("ForwardFramePipeline", "[GRAPHICS][FORWARDFRAMEPIPELINE]")
+{
+	// Utility and Shader are already initialized by main, only bring up the modules above them
+	// Platform is skipped as the null renderer never opens a window, this keeps the test runnable without a display
+	Nz::Renderer::Config rendererConfig;
+	rendererConfig.preferredAPI = Nz::RenderAPI::Null;
+
+	Nz::Renderer renderer(rendererConfig);
+	Nz::Graphics graphics(Nz::Graphics::Config{});
+
+	std::shared_ptr<Nz::NullDevice> device = std::dynamic_pointer_cast<Nz::NullDevice>(graphics.GetRenderDevice());
+	REQUIRE(device);
+
+	GIVEN("Five boxes using two materials, one of them behind the camera")
+	{
+		Nz::NullRenderWindow renderTarget(device, Nz::Vector2ui(640, 480));
+
+		Nz::MeshParams meshParams;
+		meshParams.storage = Nz::DataStorage::Software;
+
+		Nz::Mesh mesh;
+		mesh.CreateStatic();
+		mesh.BuildSubMesh(Nz::Primitive::Box(Nz::Vector3f::Unit()), meshParams);
+		mesh.SetMaterialCount(1);
+
+		std::shared_ptr<Nz::GraphicalMesh> graphicalMesh = std::make_shared<Nz::GraphicalMesh>(mesh);
+
+		std::vector<std::shared_ptr<Nz::Material>> materials;
+		for (std::size_t i = 0; i < 2; ++i)
+		{
+			std::shared_ptr<Nz::Material> material = std::make_shared<Nz::Material>(Nz::BasicMaterial::GetSettings());
+			material->EnableDepthBuffer(true);
+
+			Nz::BasicMaterial basicMat(*material);
+			basicMat.SetDiffuseColor((i == 0) ? Nz::Color::Red : Nz::Color::Blue);
+
+			WaitForShaders(*material->GetPipeline());
+
+			materials.push_back(std::move(material));
+		}
+
+		// The first three models share a material and should be merged in a single instanced draw
+		std::array<Nz::Vector3f, 5> positions = {
+			Nz::Vector3f(-2.f, 0.f, -10.f),
+			Nz::Vector3f( 0.f, 0.f, -10.f),
+			Nz::Vector3f( 2.f, 0.f, -10.f),
+			Nz::Vector3f( 0.f, 0.f,  10.f), //< behind the camera
+			Nz::Vector3f( 0.f, 2.f, -10.f)
+		};
+
+		std::vector<std::unique_ptr<Nz::Model>> models;
+		std::vector<Nz::WorldInstance> worldInstances(positions.size());
+
+		Nz::ForwardFramePipeline framePipeline;
+		for (std::size_t i = 0; i < positions.size(); ++i)
+		{
+			auto& model = models.emplace_back(std::make_unique<Nz::Model>(graphicalMesh));
+			model->SetMaterial(0, materials[(i < 4) ? 0 : 1]);
+
+			worldInstances[i].UpdateWorldMatrix(Nz::Matrix4f::Translate(positions[i]));
+
+			framePipeline.RegisterInstancedDrawable(&worldInstances[i], model.get());
+		}
+
+		Nz::CameraComponent camera(&renderTarget);
+		framePipeline.RegisterViewer(&camera);
+
+		constexpr std::size_t FrameCount = 3;
+
+		std::vector<Nz::NullCommandBuffer::DrawIndexedData> indexedDraws;
+		std::vector<Nz::NullCommandBuffer::DrawData> draws;
+
+		NazaraSlotType(Nz::NullDevice, OnCommandBufferSubmit) onSubmit;
+		onSubmit.Connect(device->OnCommandBufferSubmit, [&](Nz::NullDevice* /*device*/, const Nz::NullCommandBuffer& commandBuffer)
+		{
+			for (const auto& command : commandBuffer.GetCommands())
+			{
+				if (const auto* drawIndexed = std::get_if<Nz::NullCommandBuffer::DrawIndexedData>(&command))
+					indexedDraws.push_back(*drawIndexed);
+				else if (const auto* draw = std::get_if<Nz::NullCommandBuffer::DrawData>(&command))
+					draws.push_back(*draw);
+			}
+		});
+
+		auto RenderFrames = [&]
+		{
+			device->ResetSubmittedStats();
+			indexedDraws.clear();
+			draws.clear();
+
+			for (std::size_t i = 0; i < FrameCount; ++i)
+			{
+				Nz::RenderFrame frame = renderTarget.Acquire();
+				framePipeline.Render(frame);
+				frame.Present();
+			}
+		};
+
+		WHEN("We render a few frames")
+		{
+			RenderFrames();
+
+			THEN("Visible boxes are drawn with one instanced draw per material")
+			{
+				const Nz::ForwardFramePipeline::RenderStats& pipelineStats = framePipeline.GetRenderStats();
+				CHECK(pipelineStats.drawCount == 2);
+				CHECK(pipelineStats.instancedDrawCount == 1);
+				CHECK(pipelineStats.materialBindCount == 2);
+				CHECK(pipelineStats.pipelineBindCount == 2);
+				CHECK(pipelineStats.indexBufferBindCount == 1);
+				CHECK(pipelineStats.vertexBufferBindCount == 3);
+				CHECK(pipelineStats.worldBindCount == 1);
+
+				REQUIRE(indexedDraws.size() == 2 * FrameCount);
+				for (std::size_t i = 0; i < FrameCount; ++i)
+				{
+					std::array<Nz::UInt32, 2> instanceCounts = { indexedDraws[i * 2].instanceCount, indexedDraws[i * 2 + 1].instanceCount };
+					std::sort(instanceCounts.begin(), instanceCounts.end());
+
+					CHECK(instanceCounts[0] == 1);
+					CHECK(instanceCounts[1] == 3);
+					CHECK(indexedDraws[i * 2].indexCount == 36);
+					CHECK(indexedDraws[i * 2 + 1].indexCount == 36);
+				}
+			}
+
+			THEN("Submitted command buffers match the forward pass and the final blit")
+			{
+				// Each frame: two indexed draws in the forward pass and a fullscreen triangle to blit it on the render target
+				REQUIRE(draws.size() == FrameCount);
+				for (const auto& draw : draws)
+				{
+					CHECK(draw.vertexCount == 3);
+					CHECK(draw.instanceCount == 1);
+				}
+
+				const Nz::NullCommandBuffer::Stats& deviceStats = device->GetSubmittedStats();
+				CHECK(deviceStats.drawCount == 3 * FrameCount);
+				CHECK(deviceStats.instanceCount == 5 * FrameCount);
+				CHECK(deviceStats.vertexCount == (4 * 36 + 3) * FrameCount);
+				CHECK(deviceStats.renderPassCount == 2 * FrameCount);
+				CHECK(deviceStats.pipelineBindCount == 3 * FrameCount);
+				CHECK(deviceStats.indexBufferBindCount == 1 * FrameCount);
+				CHECK(deviceStats.vertexBufferBindCount == 4 * FrameCount);
+				// Viewer, world instances and both materials for the forward pass, the forward output for the blit
+				CHECK(deviceStats.shaderBindingBindCount == 5 * FrameCount);
+			}
+		}
+
+		WHEN("The box behind the camera moves in front of it")
+		{
+			RenderFrames();
+
+			worldInstances[3].UpdateWorldMatrix(Nz::Matrix4f::Translate(Nz::Vector3f(0.f, -2.f, -10.f)));
+			framePipeline.InvalidateWorldInstance(&worldInstances[3]);
+
+			RenderFrames();
+
+			THEN("It joins the instanced draw")
+			{
+				const Nz::ForwardFramePipeline::RenderStats& pipelineStats = framePipeline.GetRenderStats();
+				CHECK(pipelineStats.drawCount == 2);
+				CHECK(pipelineStats.instancedDrawCount == 1);
+
+				REQUIRE(indexedDraws.size() == 2 * FrameCount);
+				for (std::size_t i = 0; i < FrameCount; ++i)
+					CHECK(std::max(indexedDraws[i * 2].instanceCount, indexedDraws[i * 2 + 1].instanceCount) == 4);
+
+				CHECK(device->GetSubmittedStats().instanceCount == 6 * FrameCount);
+			}
+		}
+	}
+}
@@ -0,0 +1,169 @@
+#include <Nazara/Graphics/InstanceDataArena.hpp>
+#include <Nazara/NullRenderer/NullBuffer.hpp>
+#include <Nazara/NullRenderer/NullCommandBuffer.hpp>
+#include <Nazara/NullRenderer/NullCommandBufferBuilder.hpp>
+#include <Nazara/NullRenderer/NullDevice.hpp>
+#include <Nazara/NullRenderer/NullUploadPool.hpp>
+#include <catch2/catch.hpp>
+#include <cstring>
+#include <variant>
+#include <vector>
+
+namespace
+{
+	std::vector<Nz::NullCommandBuffer::CopyBufferFromMemoryData> GetCopies(const Nz::NullCommandBuffer& commandBuffer)
+	{
+		std::vector<Nz::NullCommandBuffer::CopyBufferFromMemoryData> copies;
+		for (const auto& command : commandBuffer.GetCommands())
+		{
+			if (const auto* copy = std::get_if<Nz::NullCommandBuffer::CopyBufferFromMemoryData>(&command))
+				copies.push_back(*copy);
+		}
+
+		return copies;
+	}
+}
+
+SCENARIO("InstanceDataArena", "[GRAPHICS][INSTANCEDATAARENA]")
+{
+	std::shared_ptr<Nz::NullDevice> device = std::make_shared<Nz::NullDevice>();
+
+	// Slots are aligned on this
+	Nz::UInt64 alignment = device->GetDeviceInfo().limits.minUniformBufferOffsetAlignment;
+	REQUIRE(alignment >= 64);
+
+	GIVEN("An arena with four slots per page")
+	{
+		Nz::InstanceDataArena arena(device, 64, 4);
+		CHECK(arena.GetDataSize() == 64);
+
+		std::vector<std::size_t> slots;
+		for (std::size_t i = 0; i < 4; ++i)
+			slots.push_back(arena.Allocate());
+
+		WHEN("We fill the first page")
+		{
+			THEN("Slots are contiguous in the same buffer")
+			{
+				CHECK(slots == std::vector<std::size_t>{ 0, 1, 2, 3 });
+				for (std::size_t i = 0; i < slots.size(); ++i)
+				{
+					CHECK(arena.GetBuffer(slots[i]) == arena.GetBuffer(slots[0]));
+					CHECK(arena.GetOffset(slots[i]) == i * alignment);
+				}
+			}
+		}
+
+		WHEN("We allocate past the first page")
+		{
+			std::size_t slot = arena.Allocate();
+
+			THEN("A new buffer is allocated")
+			{
+				CHECK(slot == 4);
+				CHECK(arena.GetBuffer(slot) != arena.GetBuffer(slots[0]));
+				CHECK(arena.GetOffset(slot) == 0);
+			}
+		}
+
+		WHEN("We free a slot and allocate again")
+		{
+			arena.Free(slots[1]);
+
+			THEN("The freed slot is reused before growing")
+			{
+				CHECK(arena.Allocate() == slots[1]);
+				CHECK(arena.Allocate() == 4);
+			}
+		}
+
+		WHEN("We update slots of two pages")
+		{
+			std::size_t secondPageSlot = arena.Allocate();
+
+			std::memset(arena.Update(slots[0]), 0xAA, 64);
+			std::memset(arena.Update(slots[3]), 0xBB, 64);
+			std::memset(arena.Update(secondPageSlot), 0xCC, 64);
+
+			Nz::NullUploadPool uploadPool(64 * 1024);
+			Nz::NullCommandBuffer commandBuffer;
+			Nz::NullCommandBufferBuilder builder(commandBuffer);
+			arena.UpdateBuffers(uploadPool, builder);
+
+			THEN("Close dirty slots are transferred with a single copy per page")
+			{
+				auto copies = GetCopies(commandBuffer);
+				REQUIRE(copies.size() == 2);
+
+				CHECK(copies[0].target == arena.GetBuffer(slots[0]).get());
+				CHECK(copies[0].targetOffset == 0);
+				CHECK(copies[0].size == 4 * alignment);
+				CHECK(static_cast<const Nz::UInt8*>(copies[0].memory)[0] == 0xAA);
+				CHECK(static_cast<const Nz::UInt8*>(copies[0].memory)[3 * alignment + 63] == 0xBB);
+
+				CHECK(copies[1].target == arena.GetBuffer(secondPageSlot).get());
+				CHECK(copies[1].targetOffset == 0);
+				CHECK(copies[1].size == alignment);
+				CHECK(static_cast<const Nz::UInt8*>(copies[1].memory)[0] == 0xCC);
+			}
+
+			AND_WHEN("We transfer again without updating anything")
+			{
+				Nz::NullCommandBuffer secondCommandBuffer;
+				Nz::NullCommandBufferBuilder secondBuilder(secondCommandBuffer);
+				arena.UpdateBuffers(uploadPool, secondBuilder);
+
+				THEN("Nothing is copied")
+				{
+					CHECK(GetCopies(secondCommandBuffer).empty());
+				}
+			}
+		}
+
+		WHEN("We free a slot after updating it")
+		{
+			arena.Update(slots[2]);
+			arena.Free(slots[2]);
+
+			Nz::NullUploadPool uploadPool(64 * 1024);
+			Nz::NullCommandBuffer commandBuffer;
+			Nz::NullCommandBufferBuilder builder(commandBuffer);
+			arena.UpdateBuffers(uploadPool, builder);
+
+			THEN("Its data isn't transferred")
+			{
+				CHECK(GetCopies(commandBuffer).empty());
+			}
+		}
+	}
+
+	GIVEN("An arena with dirty slots far from each other")
+	{
+		Nz::InstanceDataArena arena(device, 16, 16);
+
+		std::vector<std::size_t> slots;
+		for (std::size_t i = 0; i < 16; ++i)
+			slots.push_back(arena.Allocate());
+
+		arena.Update(slots[0]);
+		arena.Update(slots[Nz::InstanceDataArena::MaxCoalescedGap + 2]);
+
+		WHEN("We transfer them")
+		{
+			Nz::NullUploadPool uploadPool(64 * 1024);
+			Nz::NullCommandBuffer commandBuffer;
+			Nz::NullCommandBufferBuilder builder(commandBuffer);
+			arena.UpdateBuffers(uploadPool, builder);
+
+			THEN("Each one gets its own copy")
+			{
+				auto copies = GetCopies(commandBuffer);
+				REQUIRE(copies.size() == 2);
+				CHECK(copies[0].targetOffset == 0);
+				CHECK(copies[0].size == alignment);
+				CHECK(copies[1].targetOffset == (Nz::InstanceDataArena::MaxCoalescedGap + 2) * alignment);
+				CHECK(copies[1].size == alignment);
+			}
+		}
+	}
+}
@@ -0,0 +1,132 @@
+#include <Nazara/Graphics/RenderQueue.hpp>
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+	struct RenderData
+	{
+		Nz::UInt64 key;
+		std::size_t id;
+	};
+
+	std::vector<std::size_t> SortAndGetIds(Nz::RenderQueue<RenderData>& renderQueue)
+	{
+		renderQueue.Sort([](const RenderData& data) { return data.key; });
+
+		std::vector<std::size_t> ids;
+		for (const RenderData& data : renderQueue)
+			ids.push_back(data.id);
+
+		return ids;
+	}
+
+	std::vector<std::size_t> StableSortIds(std::vector<RenderData> dataList)
+	{
+		std::stable_sort(dataList.begin(), dataList.end(), [](const RenderData& lhs, const RenderData& rhs) { return lhs.key < rhs.key; });
+
+		std::vector<std::size_t> ids;
+		for (const RenderData& data : dataList)
+			ids.push_back(data.id);
+
+		return ids;
+	}
+
+	template<typename KeyGenerator>
+	void CheckAgainstStableSort(std::size_t elementCount, KeyGenerator&& keyGenerator)
+	{
+		Nz::RenderQueue<RenderData> renderQueue;
+		std::vector<RenderData> dataList;
+		for (std::size_t i = 0; i < elementCount; ++i)
+		{
+			RenderData data{ keyGenerator(), i };
+			dataList.push_back(data);
+			renderQueue.Insert(std::move(data));
+		}
+
+		std::vector<std::size_t> ids = SortAndGetIds(renderQueue);
+		CHECK(renderQueue.size() == elementCount);
+		CHECK(ids == StableSortIds(dataList));
+	}
+}
+
+SCENARIO("RenderQueue", "[GRAPHICS][RENDERQUEUE]")
+{
+	std::mt19937_64 randomGenerator(42);
+
+	GIVEN("An empty render queue")
+	{
+		Nz::RenderQueue<RenderData> renderQueue;
+
+		THEN("Sorting it does nothing")
+		{
+			CHECK(SortAndGetIds(renderQueue).empty());
+			CHECK(renderQueue.empty());
+		}
+	}
+
+	GIVEN("A render queue with a single element")
+	{
+		Nz::RenderQueue<RenderData> renderQueue;
+		renderQueue.Insert({ 42, 0 });
+
+		THEN("Sorting it keeps the element")
+		{
+			CHECK(SortAndGetIds(renderQueue) == std::vector<std::size_t>{ 0 });
+		}
+	}
+
+	// Sizes below and above the threshold where radix sort is used
+	for (std::size_t elementCount : { 10, 63, 64, 1000, 100'000 })
+	{
+		GIVEN("A render queue of " + std::to_string(elementCount) + " elements")
+		{
+			WHEN("Keys are random 64 bits values")
+			{
+				CheckAgainstStableSort(elementCount, [&] { return randomGenerator(); });
+			}
+
+			WHEN("Many keys are equal")
+			{
+				std::uniform_int_distribution<Nz::UInt64> dis(0, 7);
+				CheckAgainstStableSort(elementCount, [&] { return dis(randomGenerator) << 40; });
+			}
+
+			WHEN("Keys only differ in their lower bits")
+			{
+				// Most radix passes are skipped as every key share the same digit
+				CheckAgainstStableSort(elementCount, [&] { return 0xDEADBEEF00000000ULL | (randomGenerator() & 0xFFF); });
+			}
+
+			WHEN("Every key is the same")
+			{
+				CheckAgainstStableSort(elementCount, [&] { return 0x1234ULL; });
+			}
+		}
+	}
+
+	GIVEN("A render queue which is sorted, cleared and filled again")
+	{
+		Nz::RenderQueue<RenderData> renderQueue;
+		for (std::size_t i = 0; i < 1000; ++i)
+			renderQueue.Insert({ randomGenerator(), i });
+
+		SortAndGetIds(renderQueue);
+		renderQueue.Clear();
+
+		std::vector<RenderData> dataList;
+		for (std::size_t i = 0; i < 500; ++i)
+		{
+			RenderData data{ randomGenerator() % 100, i };
+			dataList.push_back(data);
+			renderQueue.Insert(std::move(data));
+		}
+
+		THEN("Only new elements are sorted")
+		{
+			CHECK(SortAndGetIds(renderQueue) == StableSortIds(dataList));
+		}
+	}
+}
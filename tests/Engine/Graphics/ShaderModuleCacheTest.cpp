@@ -0,0 +1,143 @@
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Graphics/ShaderModuleCache.hpp>
+#include <Nazara/NullRenderer/NullDevice.hpp>
+#include <Nazara/Shader/ShaderLangParser.hpp>
+#include <catch2/catch.hpp>
+#include <filesystem>
+#include <vector>
+
+namespace
+{
+	const Nz::UInt8 r_basicMaterialShader[] = {
+		#include <Nazara/Graphics/Resources/Shaders/basicmaterial.nzsl.h>
+	};
+
+	// Keeps the code of the last module instantiated from generated code
+	class RecordingDevice : public Nz::NullDevice
+	{
+		public:
+			using NullDevice::InstantiateShaderModule;
+
+			std::shared_ptr<Nz::ShaderModule> InstantiateShaderModule(Nz::ShaderStageTypeFlags shaderStages, Nz::ShaderLanguage lang, const void* source, std::size_t sourceSize, const Nz::ShaderWriter::States& states) override
+			{
+				lastCode.assign(static_cast<const Nz::UInt8*>(source), static_cast<const Nz::UInt8*>(source) + sourceSize);
+				return NullDevice::InstantiateShaderModule(shaderStages, lang, source, sourceSize, states);
+			}
+
+			std::vector<Nz::UInt8> lastCode;
+	};
+
+	std::size_t CountCacheEntries(const std::filesystem::path& cacheDirectory)
+	{
+		std::size_t entryCount = 0;
+		for (const auto& entry : std::filesystem::directory_iterator(cacheDirectory))
+		{
+			if (entry.path().extension() == ".spv")
+				entryCount++;
+		}
+
+		return entryCount;
+	}
+}
+
+SCENARIO("ShaderModuleCache", "[GRAPHICS][SHADERMODULECACHE]")
+{
+	const std::filesystem::path cacheDirectory = "ShaderModuleCacheTest";
+	std::filesystem::remove_all(cacheDirectory);
+
+	std::shared_ptr<RecordingDevice> device = std::make_shared<RecordingDevice>();
+
+	Nz::ShaderAst::StatementPtr shaderAst = Nz::ShaderLang::Parse(std::string_view(reinterpret_cast<const char*>(r_basicMaterialShader), sizeof(r_basicMaterialShader)));
+	REQUIRE(shaderAst);
+
+	Nz::ByteArray astHash = Nz::ShaderModuleCache::ComputeAstHash(shaderAst);
+	Nz::ShaderStageTypeFlags shaderStages = Nz::ShaderStageType::Fragment | Nz::ShaderStageType::Vertex;
+
+	GIVEN("A cache for a backend which doesn't consume SPIR-V")
+	{
+		Nz::ShaderModuleCache cache(device, Nz::RenderAPI::OpenGL, cacheDirectory);
+
+		THEN("It is disabled")
+		{
+			CHECK_FALSE(cache.IsEnabled());
+			CHECK(cache.Get(shaderStages, *shaderAst, astHash, {}));
+			CHECK(cache.GetStats().missCount == 0);
+		}
+	}
+
+	GIVEN("A SPIR-V cache")
+	{
+		Nz::ShaderModuleCache cache(device, Nz::RenderAPI::Vulkan, cacheDirectory);
+		REQUIRE(cache.IsEnabled());
+
+		Nz::ShaderWriter::States states;
+
+		WHEN("We request the same module twice")
+		{
+			CHECK(cache.Get(shaderStages, *shaderAst, astHash, states));
+			std::vector<Nz::UInt8> generatedCode = device->lastCode;
+
+			CHECK(cache.Get(shaderStages, *shaderAst, astHash, states));
+
+			THEN("The second one comes from the cache")
+			{
+				CHECK(cache.GetStats().missCount == 1);
+				CHECK(cache.GetStats().hitCount == 1);
+				CHECK(CountCacheEntries(cacheDirectory) == 1);
+
+				REQUIRE(generatedCode.size() >= sizeof(Nz::UInt32));
+				CHECK(device->lastCode == generatedCode);
+			}
+
+			AND_WHEN("We request it through another cache using the same directory")
+			{
+				Nz::ShaderModuleCache otherCache(device, Nz::RenderAPI::Vulkan, cacheDirectory);
+				CHECK(otherCache.Get(shaderStages, *shaderAst, astHash, states));
+
+				THEN("It is found on disk")
+				{
+					CHECK(otherCache.GetStats().hitCount == 1);
+					CHECK(otherCache.GetStats().missCount == 0);
+					CHECK(device->lastCode == generatedCode);
+				}
+			}
+
+			AND_WHEN("We request it with different options")
+			{
+				states.enabledOptions = 1;
+				CHECK(cache.Get(shaderStages, *shaderAst, astHash, states));
+
+				THEN("A new module is generated")
+				{
+					CHECK(cache.GetStats().missCount == 2);
+					CHECK(cache.GetStats().hitCount == 1);
+					CHECK(CountCacheEntries(cacheDirectory) == 2);
+					CHECK(device->lastCode != generatedCode);
+				}
+			}
+		}
+
+		WHEN("A cache entry is corrupted")
+		{
+			CHECK(cache.Get(shaderStages, *shaderAst, astHash, states));
+			std::vector<Nz::UInt8> generatedCode = device->lastCode;
+
+			for (const auto& entry : std::filesystem::directory_iterator(cacheDirectory))
+			{
+				Nz::File file(entry.path(), Nz::OpenMode::WriteOnly | Nz::OpenMode::Truncate);
+				file.Write("bad!", 4);
+			}
+
+			CHECK(cache.Get(shaderStages, *shaderAst, astHash, states));
+
+			THEN("It is ignored and generated again")
+			{
+				CHECK(cache.GetStats().missCount == 2);
+				CHECK(cache.GetStats().hitCount == 0);
+				CHECK(device->lastCode == generatedCode);
+			}
+		}
+	}
+
+	std::filesystem::remove_all(cacheDirectory);
+}
@@ -0,0 +1,122 @@
+#include <Nazara/Core/ParallelAlgorithm.hpp>
+#include <Nazara/Graphics/Graphics.hpp>
+#include <Nazara/Graphics/UberShader.hpp>
+#include <Nazara/Renderer/Renderer.hpp>
+#include <Nazara/Shader/ShaderLangParser.hpp>
+#include <catch2/catch.hpp>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string_view>
+
+namespace
+{
+	// The BROKEN option makes the shader reference an unknown identifier
+	const char s_shaderSource[] = R"(
+option RED: bool;
+option BROKEN: bool;
+
+struct FragOut
+{
+	[location(0)] color: vec4<f32>
+}
+
+[entry(frag)]
+fn main() -> FragOut
+{
+	let output: FragOut;
+	output.color = vec4<f32>(0.0, 0.0, 1.0, 1.0);
+
+	const if (RED)
+		output.color = vec4<f32>(1.0, 0.0, 0.0, 1.0);
+
+	const if (BROKEN)
+		output.color = undefinedColor;
+
+	return output;
+}
+)";
+}
+
+SCENARIO("UberShader", "[GRAPHICS][UBERSHADER]")
+{
+	// The null renderer validates shaders without generating any code
+	Nz::Renderer::Config rendererConfig;
+	rendererConfig.preferredAPI = Nz::RenderAPI::Null;
+
+	Nz::Renderer renderer(rendererConfig);
+	Nz::Graphics graphics(Nz::Graphics::Config{});
+
+	GIVEN("An uber shader with a broken option")
+	{
+		Nz::UberShader uberShader(Nz::ShaderStageType::Fragment, Nz::ShaderLang::Parse(std::string_view(s_shaderSource)));
+
+		Nz::UInt64 redFlag = uberShader.GetOptionFlagByName("RED");
+		Nz::UInt64 brokenFlag = uberShader.GetOptionFlagByName("BROKEN");
+		REQUIRE(redFlag != 0);
+		REQUIRE(brokenFlag != 0);
+
+		WHEN("We prewarm several variants at once")
+		{
+			Nz::UInt64 asyncCompilationCount = Nz::UberShader::GetAsyncCompilationCount();
+
+			uberShader.Prewarm({ 0, redFlag, brokenFlag, redFlag | brokenFlag });
+
+			THEN("Valid variants complete and errors are reported when retrieving broken ones")
+			{
+				CHECK(uberShader.Get(0));
+				CHECK(uberShader.Get(redFlag));
+				CHECK_THROWS_WITH(uberShader.Get(brokenFlag), Catch::Contains("undefinedColor"));
+				CHECK_THROWS(uberShader.Get(redFlag | brokenFlag));
+
+				// Every variant was compiled in background, once
+				CHECK(Nz::UberShader::GetAsyncCompilationCount() - asyncCompilationCount == 4);
+
+				CHECK(uberShader.IsReady(0));
+				CHECK(uberShader.IsReady(redFlag));
+				CHECK(uberShader.IsReady(brokenFlag));
+			}
+		}
+
+		WHEN("We retrieve variants from multiple threads")
+		{
+			constexpr std::size_t RequestCount = 64;
+
+			std::array<Nz::UInt64, 4> combinations = { 0, redFlag, brokenFlag, redFlag | brokenFlag };
+			std::array<const Nz::ShaderModule*, RequestCount> shaderModules = {};
+			std::array<bool, RequestCount> failed = {};
+
+			Nz::ParallelFor(0, RequestCount, [&](std::size_t i)
+			{
+				Nz::UInt64 combination = combinations[i % combinations.size()];
+				if (i % 3 == 0)
+					uberShader.Prewarm(combination);
+
+				try
+				{
+					shaderModules[i] = uberShader.Get(combination).get();
+				}
+				catch (const std::exception&)
+				{
+					failed[i] = true;
+				}
+			}, 1);
+
+			THEN("Every request for a variant gets the same module or the same error")
+			{
+				for (std::size_t i = 0; i < RequestCount; ++i)
+				{
+					Nz::UInt64 combination = combinations[i % combinations.size()];
+					bool isBroken = (combination & brokenFlag) != 0;
+
+					CHECK(failed[i] == isBroken);
+					if (!isBroken)
+					{
+						CHECK(shaderModules[i] != nullptr);
+						CHECK(shaderModules[i] == shaderModules[i % combinations.size()]);
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,132 @@
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <catch2/catch.hpp>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace
+{
+	Nz::UInt32 ReadIndex(const Nz::ENetPacketRef& packet)
+	{
+		Nz::UInt32 index;
+		REQUIRE(packet->data.GetDataSize() == sizeof(index));
+		std::memcpy(&index, packet->data.GetConstData() + Nz::NetPacket::HeaderSize, sizeof(index));
+
+		return index;
+	}
+
+	bool ServiceUntil(const std::vector<Nz::ENetHost*>& hosts, const std::function<void(Nz::ENetHost& host, Nz::ENetEvent& event)>& eventCallback, const std::function<bool()>& predicate)
+	{
+		auto start = std::chrono::steady_clock::now();
+		while (!predicate())
+		{
+			if (std::chrono::steady_clock::now() - start > std::chrono::seconds(5))
+				return false;
+
+			for (Nz::ENetHost* host : hosts)
+			{
+				Nz::ENetEvent event;
+				if (host->Service(&event, 1) > 0)
+				{
+					do
+					{
+						eventCallback(*host, event);
+					}
+					while (host->CheckEvents(&event));
+				}
+			}
+		}
+
+		return true;
+	}
+}
+
+SCENARIO("ENetHost", "[NETWORK][ENETHOST]")
+{
+	GIVEN("A server and a client connected over loopback")
+	{
+		std::random_device rd;
+		std::uniform_int_distribution<Nz::UInt16> dis(1025, 65535);
+
+		Nz::UInt16 port = dis(rd);
+
+		Nz::ENetHost server;
+		REQUIRE(server.Create(Nz::NetProtocol::IPv4, port, 1, 1));
+
+		Nz::ENetHost client;
+		REQUIRE(client.Create(Nz::IpAddress::LoopbackIpV4, 1, 1));
+
+		Nz::ENetPeer* clientPeer = client.Connect(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), port), 1);
+		REQUIRE(clientPeer);
+
+		std::vector<Nz::UInt32> serverReceived;
+		std::vector<Nz::UInt32> clientReceived;
+		auto eventCallback = [&](Nz::ENetHost& host, Nz::ENetEvent& event)
+		{
+			if (event.type != Nz::ENetEventType::Receive)
+				return;
+
+			Nz::UInt32 index = ReadIndex(event.packet);
+			if (&host == &server)
+			{
+				serverReceived.push_back(index);
+
+				// Echo it, acknowledgements of the client packets are sent along
+				event.peer->Send(0, Nz::ENetPacketFlag_Reliable, Nz::NetPacket(1, &index, sizeof(index)));
+			}
+			else
+				clientReceived.push_back(index);
+		};
+
+		REQUIRE(ServiceUntil({ &server, &client }, eventCallback, [&] { return clientPeer->IsConnected(); }));
+
+		WHEN("The client sends reliable packets which are acknowledged, several times")
+		{
+			constexpr std::size_t RoundCount = 20;
+			constexpr std::size_t PacketPerRound = 32;
+
+			std::vector<std::size_t> clientCommandCounts;
+			std::vector<std::size_t> serverCommandCounts;
+
+			Nz::UInt32 packetIndex = 0;
+			for (std::size_t round = 0; round < RoundCount; ++round)
+			{
+				for (std::size_t i = 0; i < PacketPerRound; ++i)
+				{
+					Nz::UInt32 index = packetIndex++;
+					clientPeer->Send(0, Nz::ENetPacketFlag_Reliable, Nz::NetPacket(1, &index, sizeof(index)));
+				}
+
+				REQUIRE(ServiceUntil({ &server, &client }, eventCallback, [&] { return clientReceived.size() == packetIndex; }));
+
+				clientCommandCounts.push_back(client.GetAllocatedCommandCount());
+				serverCommandCounts.push_back(server.GetAllocatedCommandCount());
+			}
+
+			THEN("Every packet is received in order")
+			{
+				std::vector<Nz::UInt32> expected(packetIndex);
+				for (Nz::UInt32 i = 0; i < packetIndex; ++i)
+					expected[i] = i;
+
+				CHECK(serverReceived == expected);
+				CHECK(clientReceived == expected);
+			}
+
+			THEN("Acknowledged commands are reused instead of allocating new ones")
+			{
+				CHECK(clientCommandCounts.front() > 0);
+				CHECK(serverCommandCounts.front() > 0);
+
+				// Only a round of commands is in flight at any time
+				CHECK(clientCommandCounts.back() == clientCommandCounts.front());
+				CHECK(serverCommandCounts.back() == serverCommandCounts.front());
+				CHECK(clientCommandCounts.back() <= 4 * PacketPerRound);
+				CHECK(serverCommandCounts.back() <= 4 * PacketPerRound);
+			}
+		}
+	}
+}
@@ -0,0 +1,110 @@
+#include <Nazara/Network/NetPacket.hpp>
+#include <catch2/catch.hpp>
+#include <thread>
+#include <vector>
+
+SCENARIO("NetPacket", "[NETWORK][NETPACKET]")
+{
+	GIVEN("A packet with some data")
+	{
+		Nz::NetPacket packet(42);
+		packet << Nz::UInt32(0xDEADBEEF) << std::string("Nazara");
+
+		WHEN("We move it into another packet")
+		{
+			Nz::NetPacket other(std::move(packet));
+
+			THEN("Data can be read back from the other packet")
+			{
+				Nz::NetPacket received(other.GetNetCode(), other.GetConstData() + Nz::NetPacket::HeaderSize, other.GetDataSize());
+
+				Nz::UInt32 value;
+				std::string str;
+				received >> value >> str;
+
+				CHECK(received.GetNetCode() == 42);
+				CHECK(value == 0xDEADBEEF);
+				CHECK(str == "Nazara");
+			}
+		}
+	}
+
+	GIVEN("The packet buffer pool")
+	{
+		WHEN("We create and destroy packets repeatedly")
+		{
+			{
+				Nz::NetPacket warmupPacket(1, 100);
+			}
+
+			Nz::NetPacket::PoolStats statsBefore = Nz::NetPacket::GetPoolStats();
+
+			for (int i = 0; i < 100; ++i)
+				Nz::NetPacket packet(1, 100);
+
+			Nz::NetPacket::PoolStats statsAfter = Nz::NetPacket::GetPoolStats();
+
+			THEN("Buffers are reused")
+			{
+				CHECK(statsAfter.hitCount - statsBefore.hitCount == 100);
+				CHECK(statsAfter.missCount == statsBefore.missCount);
+				CHECK(statsAfter.retainedBufferCount >= 1);
+				CHECK(statsAfter.retainedBytes >= 100 + Nz::NetPacket::HeaderSize);
+			}
+		}
+
+		WHEN("Packets are created on a thread and destroyed on another")
+		{
+			constexpr std::size_t packetCount = 1000;
+
+			std::vector<Nz::NetPacket> packets;
+			std::thread producer([&]
+			{
+				for (std::size_t i = 0; i < packetCount; ++i)
+					packets.emplace_back(Nz::UInt16(i + 1), 200);
+			});
+			producer.join();
+
+			packets.clear();
+
+			Nz::NetPacket::PoolStats statsBefore = Nz::NetPacket::GetPoolStats();
+
+			std::thread consumer([&]
+			{
+				for (std::size_t i = 0; i < packetCount; ++i)
+					packets.emplace_back(Nz::UInt16(i + 1), 200);
+
+				packets.clear();
+			});
+			consumer.join();
+
+			Nz::NetPacket::PoolStats statsAfter = Nz::NetPacket::GetPoolStats();
+
+			THEN("Buffers released by one thread are reused by other threads")
+			{
+				CHECK(statsAfter.hitCount - statsBefore.hitCount > packetCount / 2);
+			}
+		}
+
+		WHEN("The pool isn't allowed to retain memory")
+		{
+			Nz::NetPacket::SetPoolLimits(32, 0);
+
+			Nz::NetPacket::PoolStats statsBefore;
+			{
+				Nz::NetPacket packet(1, 100);
+				statsBefore = Nz::NetPacket::GetPoolStats();
+			}
+
+			Nz::NetPacket::PoolStats statsAfter = Nz::NetPacket::GetPoolStats();
+
+			Nz::NetPacket::SetPoolLimits(32, 64 * 1024 * 1024);
+
+			THEN("Released buffers are freed")
+			{
+				CHECK(statsAfter.retainedBufferCount == statsBefore.retainedBufferCount);
+				CHECK(statsAfter.retainedBytes == statsBefore.retainedBytes);
+			}
+		}
+	}
+}
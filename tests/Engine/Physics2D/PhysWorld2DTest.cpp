@@ -1,5 +1,6 @@
 #include <Nazara/Physics2D/PhysWorld2D.hpp>
 #include <catch2/catch.hpp>
+#include <algorithm>
 
 Nz::RigidBody2D CreateBody(Nz::PhysWorld2D& world, const Nz::Vector2f& position, bool isMoving = true, const Nz::Vector2f& lengths = Nz::Vector2f::Unit());
 
@@ -98,6 +99,102 @@ SCENARIO("PhysWorld2D", "[PHYSICS2D][PHYSWORLD2D]")
 				CHECK(results[0] == &bodies[0]);
 			}
 		}
+
+		WHEN("We batch queries")
+		{
+			Nz::Vector2f end = (numberOfBodiesPerLign + 1) * 10.f * Nz::Vector2f::UnitY();
+
+			std::vector<Nz::PhysWorld2D::RaycastQueryInfo> rayQueries;
+			for (int i = 0; i != numberOfBodiesPerLign + 1; ++i)
+			{
+				Nz::PhysWorld2D::RaycastQueryInfo& query = rayQueries.emplace_back();
+				query.from = Nz::Vector2f(10.f * i, -2.f);
+				query.to = Nz::Vector2f(10.f * i, end.y);
+				query.radius = 1.f;
+				query.collisionGroup = collisionGroup;
+				query.categoryMask = categoryMask;
+				query.collisionMask = collisionMask;
+			}
+
+			THEN("First ray collisions should match the single queries")
+			{
+				std::vector<Nz::PhysWorld2D::RaycastHit> hits(rayQueries.size());
+				CHECK(world.RaycastQueryFirst(rayQueries.data(), rayQueries.size(), hits.data()) == numberOfBodiesPerLign);
+
+				for (int i = 0; i != numberOfBodiesPerLign; ++i)
+				{
+					CHECK(hits[i].nearestBody == &bodies[i * numberOfBodiesPerLign]);
+					CHECK(hits[i].hitPos == Nz::Vector2f(10.f * i, 0.f));
+				}
+
+				CHECK(hits.back().nearestBody == nullptr);
+			}
+
+			THEN("Ray collisions should be truncated to the closest ones")
+			{
+				const std::size_t maxHitPerQuery = 2;
+				std::vector<Nz::PhysWorld2D::RaycastHit> hits(rayQueries.size() * maxHitPerQuery);
+				std::vector<std::size_t> hitCounts(rayQueries.size());
+				CHECK(world.RaycastQuery(rayQueries.data(), rayQueries.size(), hits.data(), maxHitPerQuery, hitCounts.data()) == numberOfBodiesPerLign * maxHitPerQuery);
+
+				for (int i = 0; i != numberOfBodiesPerLign; ++i)
+				{
+					REQUIRE(hitCounts[i] == maxHitPerQuery);
+
+					std::vector<Nz::RigidBody2D*> hitBodies = { hits[i * maxHitPerQuery].nearestBody, hits[i * maxHitPerQuery + 1].nearestBody };
+					std::sort(hitBodies.begin(), hitBodies.end());
+					CHECK(hitBodies[0] == &bodies[i * numberOfBodiesPerLign]);
+					CHECK(hitBodies[1] == &bodies[i * numberOfBodiesPerLign + 1]);
+				}
+
+				CHECK(hitCounts.back() == 0);
+			}
+
+			THEN("Nearest bodies and regions should match the single queries")
+			{
+				Nz::PhysWorld2D::NearestQuery nearestQueries[2];
+				nearestQueries[0].from = -Nz::Vector2f::UnitY();
+				nearestQueries[0].maxDistance = 2.f;
+				nearestQueries[1].from = Nz::Vector2f(-50.f, -50.f);
+				nearestQueries[1].maxDistance = 2.f;
+
+				Nz::PhysWorld2D::NearestQueryResult nearestResults[2];
+				CHECK(world.NearestBodyQuery(nearestQueries, 2, nearestResults) == 1);
+				CHECK(nearestResults[0].nearestBody == &bodies[0]);
+				CHECK(nearestResults[0].distance == Approx(1.f));
+				CHECK(nearestResults[1].nearestBody == nullptr);
+
+				Nz::PhysWorld2D::RegionQueryInfo regionQuery;
+				regionQuery.boundingBox = Nz::Rectf(-5.f, -5.f, 5.f, 5.f);
+
+				Nz::RigidBody2D* regionBodies[4];
+				std::size_t regionBodyCount;
+				CHECK(world.RegionQuery(&regionQuery, 1, regionBodies, 4, &regionBodyCount) == 1);
+				REQUIRE(regionBodyCount == 1);
+				CHECK(regionBodies[0] == &bodies[0]);
+			}
+		}
+	}
+
+	GIVEN("A physic world using a multithreaded solver")
+	{
+		Nz::PhysWorld2D world(2);
+
+		CHECK(world.IsSolverThreaded());
+		CHECK(world.GetSolverThreadCount() >= 1);
+
+		Nz::RigidBody2D body = CreateBody(world, Nz::Vector2f::Zero());
+		body.SetVelocity(Nz::Vector2f::UnitX());
+
+		WHEN("We step it")
+		{
+			world.Step(1.f);
+
+			THEN("Bodies should move as usual")
+			{
+				CHECK(body.GetPosition().x == Approx(1.f).margin(0.01f));
+			}
+		}
 	}
 
 	GIVEN("Three entities, a character, a wall and a trigger zone")
@@ -0,0 +1,550 @@
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/ByteStream.hpp>
+#include <Nazara/Core/ErrorFlags.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Utility/Image.hpp>
+#include <Nazara/Utility/Formats/DDSConstants.hpp>
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+	bool IsFilledWith(const Nz::Image& image, Nz::UInt8 level, Nz::UInt8 value)
+	{
+		const Nz::UInt8* pixels = image.GetConstPixels(0, 0, 0, level);
+		return std::all_of(pixels, pixels + image.GetMemoryUsage(level), [&](Nz::UInt8 byte) { return byte == value; });
+	}
+
+	std::array<int, 4> ComputeMaxError(const Nz::Image& image, const std::vector<Nz::UInt8>& reference)
+	{
+		std::array<int, 4> maxError = { 0, 0, 0, 0 };
+
+		const Nz::UInt8* pixels = image.GetConstPixels();
+		for (std::size_t i = 0; i < reference.size(); ++i)
+			maxError[i % 4] = std::max(maxError[i % 4], std::abs(int(pixels[i]) - int(reference[i])));
+
+		return maxError;
+	}
+
+	// DX10 DDS file storing an array of RGBA8 layers, each one followed by its mipmaps, every byte of a level is set to layer * 16 + level
+	Nz::ByteArray BuildDDSArray(Nz::D3D10_RESOURCE_DIMENSION dimension, unsigned int width, unsigned int height, unsigned int layerCount, unsigned int levelCount)
+	{
+		Nz::DDSHeader header;
+		std::memset(&header, 0, sizeof(header));
+		header.size = 124;
+		header.flags = Nz::DDSD_CAPS | Nz::DDSD_WIDTH | Nz::DDSD_PIXELFORMAT | Nz::DDSD_MIPMAPCOUNT;
+		header.width = width;
+		header.height = height;
+		header.levelCount = levelCount;
+		header.format.size = 32;
+		header.format.flags = Nz::DDPF_FOURCC;
+		header.format.fourCC = Nz::D3DFMT_DX10;
+		header.ddsCaps[0] = Nz::DDSCAPS_TEXTURE;
+
+		if (dimension != Nz::D3D10_RESOURCE_DIMENSION_TEXTURE1D)
+			header.flags |= Nz::DDSD_HEIGHT;
+
+		Nz::DDSHeaderDX10Ext headerDX10;
+		headerDX10.dxgiFormat = Nz::DXGI_FORMAT_R8G8B8A8_UNORM;
+		headerDX10.resourceDimension = dimension;
+		headerDX10.miscFlag = 0;
+		headerDX10.arraySize = layerCount;
+		headerDX10.reserved = 0;
+
+		Nz::ByteArray data;
+		Nz::ByteStream byteStream(&data);
+		byteStream.SetDataEndianness(Nz::Endianness::LittleEndian);
+		byteStream << Nz::DDS_Magic << header << headerDX10;
+
+		for (unsigned int layer = 0; layer < layerCount; ++layer)
+		{
+			for (unsigned int level = 0; level < levelCount; ++level)
+			{
+				std::vector<Nz::UInt8> levelData(std::max(width >> level, 1U) * std::max(height >> level, 1U) * 4, Nz::UInt8(layer * 16 + level));
+				byteStream.Write(levelData.data(), levelData.size());
+			}
+		}
+
+		return data;
+	}
+}
+
+SCENARIO("Image", "[UTILITY][IMAGE]")
+{
+	GIVEN("A RGBA8 image")
+	{
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8, 16, 8);
+
+		std::mt19937 randomEngine(42);
+		std::uniform_int_distribution<unsigned int> distribution(0, 255);
+
+		std::vector<Nz::UInt8> pixels(image.GetMemoryUsage());
+		for (Nz::UInt8& byte : pixels)
+			byte = static_cast<Nz::UInt8>(distribution(randomEngine));
+
+		REQUIRE(image.Update(pixels.data()));
+
+		WHEN("We generate its mipmaps using a box filter")
+		{
+			REQUIRE(image.GenerateMipmaps(Nz::ImageFilter::Box));
+
+			THEN("Every pixel of the second level is the average of four pixels of the first level")
+			{
+				REQUIRE(image.GetLevelCount() == 5);
+				CHECK(image.GetSize(1) == Nz::Vector3ui(8, 4, 1));
+				CHECK(image.GetSize(4) == Nz::Vector3ui(1, 1, 1));
+
+				const Nz::UInt8* level = image.GetConstPixels(0, 0, 0, 1);
+				for (unsigned int y = 0; y < 4; ++y)
+				{
+					for (unsigned int x = 0; x < 8; ++x)
+					{
+						for (unsigned int c = 0; c < 4; ++c)
+						{
+							auto Source = [&](unsigned int srcX, unsigned int srcY) { return int(pixels[(srcY * 16 + srcX) * 4 + c]); };
+
+							float expected = (Source(x * 2, y * 2) + Source(x * 2 + 1, y * 2) + Source(x * 2, y * 2 + 1) + Source(x * 2 + 1, y * 2 + 1)) / 4.f;
+							CHECK(std::abs(level[(y * 8 + x) * 4 + c] - expected) <= 0.5f);
+						}
+					}
+				}
+			}
+		}
+
+		WHEN("We resize it")
+		{
+			REQUIRE(image.Resize(Nz::Vector3ui(5, 12, 1)));
+
+			THEN("It has the new size")
+			{
+				CHECK(image.GetSize() == Nz::Vector3ui(5, 12, 1));
+				CHECK(image.GetMemoryUsage() == 5 * 12 * 4);
+			}
+		}
+
+		WHEN("We try to give it a depth")
+		{
+			Nz::ErrorFlags errFlags(Nz::ErrorMode::Silent);
+
+			CHECK_FALSE(image.Resize(Nz::Vector3ui(16, 8, 2)));
+			CHECK(image.GetSize() == Nz::Vector3ui(16, 8, 1));
+		}
+	}
+
+	GIVEN("An uniform image")
+	{
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGB8, 13, 7);
+
+		std::vector<Nz::UInt8> pixels(image.GetMemoryUsage(), 42);
+		REQUIRE(image.Update(pixels.data()));
+
+		THEN("Resampling it with any filter keeps it uniform")
+		{
+			for (Nz::ImageFilter filter : { Nz::ImageFilter::Box, Nz::ImageFilter::Kaiser, Nz::ImageFilter::Triangle })
+			{
+				Nz::Image copy(image);
+				REQUIRE(copy.GenerateMipmaps(filter));
+				REQUIRE(copy.GetLevelCount() == 4);
+				for (Nz::UInt8 level = 0; level < copy.GetLevelCount(); ++level)
+					CHECK(IsFilledWith(copy, level, 42));
+
+				REQUIRE(copy.Resize(Nz::Vector3ui(31, 3, 1), filter));
+				CHECK(copy.GetLevelCount() == 4);
+				for (Nz::UInt8 level = 0; level < copy.GetLevelCount(); ++level)
+					CHECK(IsFilledWith(copy, level, 42));
+			}
+
+			// The original image is left untouched
+			CHECK(image.GetLevelCount() == 1);
+			CHECK(image.GetSize() == Nz::Vector3ui(13, 7, 1));
+		}
+	}
+
+	GIVEN("A black and white image")
+	{
+		std::array<Nz::UInt8, 8> pixels = { 0, 0, 0, 0, 255, 255, 255, 255 };
+
+		WHEN("It is stored in linear space")
+		{
+			Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8, 2, 1);
+			REQUIRE(image.Update(pixels.data()));
+			REQUIRE(image.GenerateMipmaps());
+
+			THEN("Its smallest level is middle gray")
+			{
+				const Nz::UInt8* level = image.GetConstPixels(0, 0, 0, 1);
+				CHECK(std::array<Nz::UInt8, 4>{ level[0], level[1], level[2], level[3] } == std::array<Nz::UInt8, 4>{ 128, 128, 128, 128 });
+			}
+		}
+
+		WHEN("It is stored in sRGB space")
+		{
+			Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8_SRGB, 2, 1);
+			REQUIRE(image.Update(pixels.data()));
+			REQUIRE(image.GenerateMipmaps());
+
+			THEN("Colors are averaged in linear space but alpha is not")
+			{
+				const Nz::UInt8* level = image.GetConstPixels(0, 0, 0, 1);
+				CHECK(std::array<Nz::UInt8, 4>{ level[0], level[1], level[2], level[3] } == std::array<Nz::UInt8, 4>{ 188, 188, 188, 128 });
+			}
+		}
+	}
+
+	GIVEN("A gradient")
+	{
+		Nz::Image image(Nz::ImageType::E1D, Nz::PixelFormat::R32F, 2, 1);
+
+		std::array<float, 2> pixels = { 0.f, 1.f };
+		REQUIRE(image.Update(reinterpret_cast<const Nz::UInt8*>(pixels.data())));
+
+		WHEN("We upscale it using a triangle filter")
+		{
+			REQUIRE(image.Resize(Nz::Vector3ui(4, 1, 1), Nz::ImageFilter::Triangle));
+
+			THEN("Values are linearly interpolated")
+			{
+				std::array<float, 4> values;
+				std::memcpy(values.data(), image.GetConstPixels(), sizeof(values));
+
+				CHECK(values[0] == Approx(0.f).margin(0.0001f));
+				CHECK(values[1] == Approx(0.25f));
+				CHECK(values[2] == Approx(0.75f));
+				CHECK(values[3] == Approx(1.f));
+			}
+		}
+	}
+
+	GIVEN("A 3D image")
+	{
+		Nz::Image image(Nz::ImageType::E3D, Nz::PixelFormat::L8, 2, 2, 2);
+
+		std::array<Nz::UInt8, 8> pixels = { 0, 10, 20, 30, 40, 50, 60, 70 };
+		REQUIRE(image.Update(pixels.data()));
+
+		WHEN("We generate its mipmaps")
+		{
+			REQUIRE(image.GenerateMipmaps());
+
+			THEN("Its slices have been blended together")
+			{
+				REQUIRE(image.GetLevelCount() == 2);
+				CHECK(image.GetSize(1) == Nz::Vector3ui(1, 1, 1));
+				CHECK(*image.GetConstPixels(0, 0, 0, 1) == 35);
+			}
+		}
+	}
+
+	GIVEN("A 2D array image with uniform layers")
+	{
+		Nz::Image image(Nz::ImageType::E2D_Array, Nz::PixelFormat::L8, 4, 4, 4);
+
+		for (unsigned int layer = 0; layer < 4; ++layer)
+			std::memset(image.GetPixels(0, 0, layer), layer * 50, 4 * 4);
+
+		WHEN("We try to generate its mipmaps")
+		{
+			THEN("It fails without dropping layers")
+			{
+				Nz::ErrorFlags errFlags(Nz::ErrorMode::Silent);
+				CHECK_FALSE(image.GenerateMipmaps());
+				CHECK(image.GetLevelCount() == 1);
+				CHECK(image.GetSize() == Nz::Vector3ui(4, 4, 4));
+			}
+		}
+
+		WHEN("We resize it")
+		{
+			REQUIRE(image.Resize(Nz::Vector3ui(2, 2, 4)));
+
+			THEN("Every layer is kept")
+			{
+				CHECK(image.GetSize() == Nz::Vector3ui(2, 2, 4));
+				for (unsigned int layer = 0; layer < 4; ++layer)
+				{
+					const Nz::UInt8* layerPixels = image.GetConstPixels(0, 0, layer);
+					CHECK(std::all_of(layerPixels, layerPixels + 2 * 2, [&](Nz::UInt8 value) { return value == layer * 50; }));
+				}
+			}
+		}
+	}
+
+	GIVEN("A cubemap with uniform faces")
+	{
+		Nz::Image image(Nz::ImageType::Cubemap, Nz::PixelFormat::RGBA8, 8, 8);
+
+		std::size_t faceSize = image.GetMemoryUsage() / 6;
+		for (unsigned int face = 0; face < 6; ++face)
+			std::memset(image.GetPixels(0, 0, face), face * 40, faceSize);
+
+		WHEN("We generate its mipmaps")
+		{
+			REQUIRE(image.GenerateMipmaps(Nz::ImageFilter::Kaiser));
+
+			THEN("Faces do not bleed into each other")
+			{
+				REQUIRE(image.GetLevelCount() == 4);
+				for (Nz::UInt8 level = 1; level < image.GetLevelCount(); ++level)
+				{
+					std::size_t levelFaceSize = image.GetMemoryUsage(level) / 6;
+					for (unsigned int face = 0; face < 6; ++face)
+					{
+						const Nz::UInt8* facePixels = image.GetConstPixels(0, 0, face, level);
+						CHECK(std::all_of(facePixels, facePixels + levelFaceSize, [&](Nz::UInt8 byte) { return byte == face * 40; }));
+					}
+				}
+			}
+		}
+	}
+
+	GIVEN("A two-colored RGBA8 image")
+	{
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8, 8, 4);
+
+		std::vector<Nz::UInt8> pixels(image.GetMemoryUsage());
+		for (std::size_t i = 0; i < 32; ++i)
+		{
+			bool red = ((i * 7) % 3) == 0;
+			pixels[i * 4 + 0] = (red) ? 255 : 0;
+			pixels[i * 4 + 1] = 0;
+			pixels[i * 4 + 2] = (red) ? 0 : 255;
+			pixels[i * 4 + 3] = (red) ? 255 : 0;
+		}
+
+		REQUIRE(image.Update(pixels.data()));
+
+		THEN("It is losslessly compressed to DXT5")
+		{
+			REQUIRE(image.Convert(Nz::PixelFormat::DXT5));
+			CHECK(image.GetMemoryUsage() == 2 * 16);
+
+			REQUIRE(image.Convert(Nz::PixelFormat::RGBA8));
+			CHECK(ComputeMaxError(image, pixels) == std::array<int, 4>{ 0, 0, 0, 0 });
+		}
+
+		THEN("Its transparent pixels are kept by DXT1")
+		{
+			REQUIRE(image.Convert(Nz::PixelFormat::DXT1));
+			CHECK(image.GetMemoryUsage() == 2 * 8);
+
+			REQUIRE(image.Convert(Nz::PixelFormat::RGBA8));
+
+			const Nz::UInt8* decompressed = image.GetConstPixels();
+			for (std::size_t i = 0; i < 32; ++i)
+			{
+				CHECK(decompressed[i * 4 + 3] == pixels[i * 4 + 3]);
+				if (pixels[i * 4 + 3] == 255)
+					CHECK(std::array<Nz::UInt8, 3>{ decompressed[i * 4 + 0], decompressed[i * 4 + 1], decompressed[i * 4 + 2] } == std::array<Nz::UInt8, 3>{ 255, 0, 0 });
+			}
+		}
+	}
+
+	GIVEN("A smooth RGBA8 image")
+	{
+		// 13x9 to have partial blocks on the borders
+		Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGBA8, 13, 9);
+
+		std::vector<Nz::UInt8> pixels(image.GetMemoryUsage());
+		for (unsigned int y = 0; y < 9; ++y)
+		{
+			for (unsigned int x = 0; x < 13; ++x)
+			{
+				Nz::UInt8* pixel = &pixels[(y * 13 + x) * 4];
+				pixel[0] = static_cast<Nz::UInt8>(x * 19);
+				pixel[1] = static_cast<Nz::UInt8>(y * 28);
+				pixel[2] = static_cast<Nz::UInt8>((x + y) * 11);
+				pixel[3] = static_cast<Nz::UInt8>(255 - x * 7 - y * 5);
+			}
+		}
+
+		REQUIRE(image.Update(pixels.data()));
+
+		THEN("Block compressed formats approximate it closely")
+		{
+			Nz::Image dxt1(image);
+			REQUIRE(dxt1.Convert(Nz::PixelFormat::DXT1));
+			CHECK(dxt1.GetMemoryUsage() == 4 * 3 * 8);
+			REQUIRE(dxt1.Convert(Nz::PixelFormat::RGBA8));
+
+			// Colors vary along two axes inside blocks, which can't be exactly represented by the four colors line of DXT1
+			std::array<int, 4> dxt1Error = ComputeMaxError(dxt1, pixels);
+			CHECK(dxt1Error[0] <= 40);
+			CHECK(dxt1Error[1] <= 40);
+			CHECK(dxt1Error[2] <= 40);
+
+			Nz::Image dxt3(image);
+			REQUIRE(dxt3.Convert(Nz::PixelFormat::DXT3));
+			REQUIRE(dxt3.Convert(Nz::PixelFormat::RGBA8));
+			CHECK(ComputeMaxError(dxt3, pixels)[3] <= 9);
+
+			Nz::Image dxt5(image);
+			REQUIRE(dxt5.Convert(Nz::PixelFormat::DXT5));
+			REQUIRE(dxt5.Convert(Nz::PixelFormat::RGBA8));
+			CHECK(ComputeMaxError(dxt5, pixels)[3] <= 3);
+
+			Nz::Image bc4(image);
+			REQUIRE(bc4.Convert(Nz::PixelFormat::BC4));
+			CHECK(bc4.GetMemoryUsage() == 4 * 3 * 8);
+			REQUIRE(bc4.Convert(Nz::PixelFormat::RGBA8));
+			CHECK(ComputeMaxError(bc4, pixels)[0] <= 4);
+
+			Nz::Image bc5(image);
+			REQUIRE(bc5.Convert(Nz::PixelFormat::BC5));
+			CHECK(bc5.GetMemoryUsage() == 4 * 3 * 16);
+			REQUIRE(bc5.Convert(Nz::PixelFormat::RGBA8));
+
+			std::array<int, 4> bc5Error = ComputeMaxError(bc5, pixels);
+			CHECK(bc5Error[0] <= 4);
+			CHECK(bc5Error[1] <= 4);
+
+			const Nz::UInt8* bc5Pixels = bc5.GetConstPixels();
+			CHECK(std::array<Nz::UInt8, 2>{ bc5Pixels[2], bc5Pixels[3] } == std::array<Nz::UInt8, 2>{ 0, 255 });
+		}
+
+		WHEN("We compress it with its mipmaps")
+		{
+			REQUIRE(image.GenerateMipmaps());
+			REQUIRE(image.Convert(Nz::PixelFormat::DXT5));
+
+			THEN("Every level is compressed")
+			{
+				REQUIRE(image.GetLevelCount() == 4);
+				CHECK(image.GetMemoryUsage(0) == 4 * 3 * 16);
+				CHECK(image.GetMemoryUsage(1) == 2 * 16);
+				CHECK(image.GetMemoryUsage(2) == 16);
+				CHECK(image.GetMemoryUsage(3) == 16);
+
+				// Pixels are addressed through the block containing them
+				const Nz::UInt8* blocks = image.GetConstPixels();
+				CHECK(image.GetConstPixels(5, 0) == blocks + 16);
+				CHECK(image.GetConstPixels(6, 7) == blocks + 5 * 16);
+			}
+
+			THEN("It can be saved and loaded back as DDS")
+			{
+				Nz::ByteArray data;
+				Nz::MemoryStream stream(&data);
+				REQUIRE(image.SaveToStream(stream, "dds"));
+
+				stream.SetCursorPos(0);
+				std::shared_ptr<Nz::Image> loadedImage = Nz::Image::LoadFromStream(stream);
+				REQUIRE(loadedImage);
+				CHECK(loadedImage->GetFormat() == Nz::PixelFormat::DXT5);
+				CHECK(loadedImage->GetSize() == image.GetSize());
+				REQUIRE(loadedImage->GetLevelCount() == image.GetLevelCount());
+				for (Nz::UInt8 level = 0; level < image.GetLevelCount(); ++level)
+					CHECK(std::memcmp(loadedImage->GetConstPixels(0, 0, 0, level), image.GetConstPixels(0, 0, 0, level), image.GetMemoryUsage(level)) == 0);
+			}
+		}
+	}
+
+	GIVEN("A BC5 cubemap")
+	{
+		Nz::Image image(Nz::ImageType::Cubemap, Nz::PixelFormat::RGBA8, 8, 8);
+
+		std::size_t faceSize = image.GetMemoryUsage() / 6;
+		for (unsigned int face = 0; face < 6; ++face)
+			std::memset(image.GetPixels(0, 0, face), face * 40, faceSize);
+
+		REQUIRE(image.GenerateMipmaps());
+		REQUIRE(image.Convert(Nz::PixelFormat::BC5));
+
+		WHEN("We save it and load it back as DDS")
+		{
+			Nz::ByteArray data;
+			Nz::MemoryStream stream(&data);
+			REQUIRE(image.SaveToStream(stream, "dds"));
+
+			stream.SetCursorPos(0);
+			std::shared_ptr<Nz::Image> loadedImage = Nz::Image::LoadFromStream(stream);
+
+			THEN("Its faces and levels are preserved")
+			{
+				REQUIRE(loadedImage);
+				CHECK(loadedImage->GetType() == Nz::ImageType::Cubemap);
+				CHECK(loadedImage->GetFormat() == Nz::PixelFormat::BC5);
+				REQUIRE(loadedImage->GetLevelCount() == 4);
+				for (Nz::UInt8 level = 0; level < image.GetLevelCount(); ++level)
+					CHECK(std::memcmp(loadedImage->GetConstPixels(0, 0, 0, level), image.GetConstPixels(0, 0, 0, level), image.GetMemoryUsage(level)) == 0);
+
+				REQUIRE(loadedImage->Convert(Nz::PixelFormat::RGBA8));
+				for (unsigned int face = 0; face < 6; ++face)
+				{
+					const Nz::UInt8* pixel = loadedImage->GetConstPixels(0, 0, face, 3);
+					CHECK(std::array<Nz::UInt8, 4>{ pixel[0], pixel[1], pixel[2], pixel[3] } == std::array<Nz::UInt8, 4>{ Nz::UInt8(face * 40), Nz::UInt8(face * 40), 0, 255 });
+				}
+			}
+		}
+	}
+
+	GIVEN("DDS files storing texture arrays")
+	{
+		auto IsLayerFilledWith = [](const Nz::UInt8* layerPixels, std::size_t layerSize, Nz::UInt8 value)
+		{
+			return std::all_of(layerPixels, layerPixels + layerSize, [&](Nz::UInt8 byte) { return byte == value; });
+		};
+
+		WHEN("We load a 2D array")
+		{
+			Nz::ByteArray data = BuildDDSArray(Nz::D3D10_RESOURCE_DIMENSION_TEXTURE2D, 4, 4, 3, 1);
+			std::shared_ptr<Nz::Image> image = Nz::Image::LoadFromMemory(data.GetConstBuffer(), data.GetSize());
+
+			THEN("Its layers are the slices of the image")
+			{
+				REQUIRE(image);
+				CHECK(image->GetType() == Nz::ImageType::E2D_Array);
+				CHECK(image->GetSize() == Nz::Vector3ui(4, 4, 3));
+				for (unsigned int layer = 0; layer < 3; ++layer)
+					CHECK(IsLayerFilledWith(image->GetConstPixels(0, 0, layer), 4 * 4 * 4, Nz::UInt8(layer * 16)));
+			}
+		}
+
+		WHEN("We load a 1D array")
+		{
+			Nz::ByteArray data = BuildDDSArray(Nz::D3D10_RESOURCE_DIMENSION_TEXTURE1D, 8, 1, 3, 1);
+			std::shared_ptr<Nz::Image> image = Nz::Image::LoadFromMemory(data.GetConstBuffer(), data.GetSize());
+
+			THEN("Its layers are the rows of the image")
+			{
+				REQUIRE(image);
+				CHECK(image->GetType() == Nz::ImageType::E1D_Array);
+				CHECK(image->GetSize() == Nz::Vector3ui(8, 3, 1));
+				for (unsigned int layer = 0; layer < 3; ++layer)
+					CHECK(IsLayerFilledWith(image->GetConstPixels(0, layer), 8 * 4, Nz::UInt8(layer * 16)));
+			}
+		}
+
+		WHEN("We load a 2D array with mipmaps")
+		{
+			Nz::ByteArray data = BuildDDSArray(Nz::D3D10_RESOURCE_DIMENSION_TEXTURE2D, 4, 4, 3, 3);
+
+			THEN("It fails, as image levels can't hold every layer")
+			{
+				Nz::ErrorFlags errFlags(Nz::ErrorMode::Silent);
+				CHECK_FALSE(Nz::Image::LoadFromMemory(data.GetConstBuffer(), data.GetSize()));
+			}
+
+			AND_WHEN("We only load its first level")
+			{
+				Nz::ImageParams params;
+				params.levelCount = 1;
+
+				std::shared_ptr<Nz::Image> image = Nz::Image::LoadFromMemory(data.GetConstBuffer(), data.GetSize(), params);
+
+				THEN("Mipmaps of every layer are skipped")
+				{
+					REQUIRE(image);
+					CHECK(image->GetLevelCount() == 1);
+					CHECK(image->GetSize() == Nz::Vector3ui(4, 4, 3));
+					for (unsigned int layer = 0; layer < 3; ++layer)
+						CHECK(IsLayerFilledWith(image->GetConstPixels(0, 0, layer), 4 * 4 * 4, Nz::UInt8(layer * 16)));
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,253 @@
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/Primitive.hpp>
+#include <Nazara/Utility/IndexBuffer.hpp>
+#include <Nazara/Utility/Joint.hpp>
+#include <Nazara/Utility/Mesh.hpp>
+#include <Nazara/Utility/SkeletalMesh.hpp>
+#include <Nazara/Utility/Skeleton.hpp>
+#include <Nazara/Utility/StaticMesh.hpp>
+#include <Nazara/Utility/VertexBuffer.hpp>
+#include <Nazara/Utility/VertexMapper.hpp>
+#include <catch2/catch.hpp>
+#include <cstring>
+#include <random>
+
+namespace
+{
+	const Nz::VertexBuffer& GetVertexBuffer(const Nz::SubMesh& subMesh)
+	{
+		if (subMesh.GetAnimationType() == Nz::AnimationType::Skeletal)
+			return *static_cast<const Nz::SkeletalMesh&>(subMesh).GetVertexBuffer();
+		else
+			return *static_cast<const Nz::StaticMesh&>(subMesh).GetVertexBuffer();
+	}
+
+	bool HasSameContent(const Nz::VertexBuffer& lhs, const Nz::VertexBuffer& rhs)
+	{
+		if (lhs.GetVertexCount() != rhs.GetVertexCount() || lhs.GetStride() != rhs.GetStride())
+			return false;
+
+		bool result = std::memcmp(lhs.MapRaw(Nz::BufferAccess::ReadOnly), rhs.MapRaw(Nz::BufferAccess::ReadOnly), lhs.GetVertexCount() * lhs.GetStride()) == 0;
+		lhs.Unmap();
+		rhs.Unmap();
+
+		return result;
+	}
+
+	bool HasSameContent(const Nz::IndexBuffer& lhs, const Nz::IndexBuffer& rhs)
+	{
+		if (lhs.GetIndexCount() != rhs.GetIndexCount() || lhs.HasLargeIndices() != rhs.HasLargeIndices())
+			return false;
+
+		bool result = std::memcmp(lhs.MapRaw(Nz::BufferAccess::ReadOnly), rhs.MapRaw(Nz::BufferAccess::ReadOnly), lhs.GetIndexCount() * lhs.GetStride()) == 0;
+		lhs.Unmap();
+		rhs.Unmap();
+
+		return result;
+	}
+
+	void CheckSameMesh(const Nz::Mesh& mesh, const Nz::Mesh& loadedMesh)
+	{
+		CHECK(loadedMesh.GetAnimationType() == mesh.GetAnimationType());
+		CHECK(loadedMesh.GetAABB() == mesh.GetAABB());
+
+		REQUIRE(loadedMesh.GetMaterialCount() == mesh.GetMaterialCount());
+		REQUIRE(loadedMesh.GetSubMeshCount() == mesh.GetSubMeshCount());
+		for (std::size_t i = 0; i < mesh.GetSubMeshCount(); ++i)
+		{
+			const Nz::SubMesh& subMesh = *mesh.GetSubMesh(i);
+			const Nz::SubMesh& loadedSubMesh = *loadedMesh.GetSubMesh(i);
+
+			CHECK(loadedSubMesh.GetAABB() == subMesh.GetAABB());
+			CHECK(loadedSubMesh.GetMaterialIndex() == subMesh.GetMaterialIndex());
+
+			// Predefined declarations are shared
+			CHECK(GetVertexBuffer(loadedSubMesh).GetVertexDeclaration() == GetVertexBuffer(subMesh).GetVertexDeclaration());
+			CHECK(HasSameContent(GetVertexBuffer(loadedSubMesh), GetVertexBuffer(subMesh)));
+
+			REQUIRE(loadedSubMesh.GetIndexBuffer());
+			CHECK(HasSameContent(*loadedSubMesh.GetIndexBuffer(), *subMesh.GetIndexBuffer()));
+		}
+	}
+}
+
+SCENARIO("Mesh", "[UTILITY][MESH]")
+{
+	Nz::MeshParams params;
+	params.storage = Nz::DataStorage::Software;
+
+	GIVEN("A static mesh with two submeshes and materials")
+	{
+		Nz::Mesh mesh;
+		mesh.CreateStatic();
+		mesh.BuildSubMesh(Nz::Primitive::Box(Nz::Vector3f(1.f, 2.f, 3.f), Nz::Vector3ui(2U)), params);
+		mesh.BuildSubMesh(Nz::Primitive::IcoSphere(5.f, 3, Nz::Vector3f(10.f, 0.f, 0.f)), params)->SetMaterialIndex(1);
+
+		mesh.SetMaterialCount(2);
+		mesh.GetMaterialData(0).SetParameter("DiffuseTexturePath", "textures/diffuse.png");
+		mesh.GetMaterialData(0).SetParameter("Shininess", 42.0);
+		mesh.GetMaterialData(1).SetParameter("DiffuseColor", Nz::Color::Red);
+		mesh.GetMaterialData(1).SetParameter("FaceCulling", false);
+		mesh.GetMaterialData(1).SetParameter("Pass", 3LL);
+
+		WHEN("We save it and load it back as NMF")
+		{
+			Nz::ByteArray data;
+			Nz::MemoryStream stream(&data);
+			REQUIRE(mesh.SaveToStream(stream, "nmf", params));
+
+			stream.SetCursorPos(0);
+			std::shared_ptr<Nz::Mesh> loadedMesh = Nz::Mesh::LoadFromStream(stream, params);
+
+			THEN("Its buffers and materials are preserved")
+			{
+				REQUIRE(loadedMesh);
+				CheckSameMesh(mesh, *loadedMesh);
+
+				std::string path;
+				CHECK(loadedMesh->GetMaterialData(0).GetStringParameter("DiffuseTexturePath", &path));
+				CHECK(path == "textures/diffuse.png");
+
+				double shininess;
+				CHECK(loadedMesh->GetMaterialData(0).GetDoubleParameter("Shininess", &shininess));
+				CHECK(shininess == 42.0);
+
+				Nz::Color color;
+				CHECK(loadedMesh->GetMaterialData(1).GetColorParameter("DiffuseColor", &color));
+				CHECK(color == Nz::Color::Red);
+
+				bool faceCulling = true;
+				CHECK(loadedMesh->GetMaterialData(1).GetBooleanParameter("FaceCulling", &faceCulling));
+				CHECK_FALSE(faceCulling);
+
+				long long pass;
+				CHECK(loadedMesh->GetMaterialData(1).GetIntegerParameter("Pass", &pass));
+				CHECK(pass == 3);
+			}
+		}
+
+		WHEN("We save it with compression")
+		{
+			Nz::ByteArray uncompressedData;
+			Nz::MemoryStream uncompressedStream(&uncompressedData);
+			REQUIRE(mesh.SaveToStream(uncompressedStream, "nmf", params));
+
+			Nz::MeshParams saveParams = params;
+			saveParams.custom.SetParameter("NativeNMFSaver_Compress", true);
+
+			Nz::ByteArray data;
+			Nz::MemoryStream stream(&data);
+			REQUIRE(mesh.SaveToStream(stream, "nmf", saveParams));
+
+			THEN("It is smaller and loads back the same")
+			{
+				CHECK(data.GetSize() < uncompressedData.GetSize());
+
+				std::shared_ptr<Nz::Mesh> loadedMesh = Nz::Mesh::LoadFromMemory(data.GetConstBuffer(), data.GetSize(), params);
+				REQUIRE(loadedMesh);
+				CheckSameMesh(mesh, *loadedMesh);
+			}
+		}
+
+		WHEN("We load it with a transformation")
+		{
+			Nz::ByteArray data;
+			Nz::MemoryStream stream(&data);
+			REQUIRE(mesh.SaveToStream(stream, "nmf", params));
+
+			Nz::MeshParams loadParams = params;
+			loadParams.matrix = Nz::Matrix4f::Translate(Nz::Vector3f(0.f, 5.f, 0.f));
+
+			std::shared_ptr<Nz::Mesh> loadedMesh = Nz::Mesh::LoadFromMemory(data.GetConstBuffer(), data.GetSize(), loadParams);
+
+			THEN("Its vertices are moved")
+			{
+				REQUIRE(loadedMesh);
+
+				REQUIRE(loadedMesh->GetSubMeshCount() == mesh.GetSubMeshCount());
+				for (std::size_t i = 0; i < mesh.GetSubMeshCount(); ++i)
+				{
+					Nz::VertexMapper vertexMapper(*mesh.GetSubMesh(i));
+					Nz::VertexMapper loadedVertexMapper(*loadedMesh->GetSubMesh(i));
+
+					auto posPtr = vertexMapper.GetComponentPtr<Nz::Vector3f>(Nz::VertexComponent::Position);
+					auto loadedPosPtr = loadedVertexMapper.GetComponentPtr<Nz::Vector3f>(Nz::VertexComponent::Position);
+					for (std::size_t j = 0; j < loadedMesh->GetSubMesh(i)->GetVertexCount(); ++j)
+						CHECK(loadedPosPtr[j] == posPtr[j] + Nz::Vector3f(0.f, 5.f, 0.f));
+				}
+			}
+		}
+
+		WHEN("We load a truncated file")
+		{
+			Nz::ByteArray data;
+			Nz::MemoryStream stream(&data);
+			REQUIRE(mesh.SaveToStream(stream, "nmf", params));
+
+			THEN("It fails")
+			{
+				CHECK_FALSE(Nz::Mesh::LoadFromMemory(data.GetConstBuffer(), data.GetSize() - 1, params));
+			}
+		}
+	}
+
+	GIVEN("A skeletal mesh")
+	{
+		Nz::Mesh mesh;
+		mesh.CreateSkeletal(2);
+
+		Nz::Skeleton* skeleton = mesh.GetSkeleton();
+		skeleton->GetJoint(0)->SetName("root");
+		skeleton->GetJoint(1)->SetName("arm");
+		skeleton->GetJoint(1)->SetParent(skeleton->GetJoint(0));
+		skeleton->GetJoint(1)->SetPosition(Nz::Vector3f(0.f, 1.f, 0.f));
+		skeleton->GetJoint(1)->SetInverseBindMatrix(Nz::Matrix4f::Translate(Nz::Vector3f(0.f, -1.f, 0.f)));
+
+		std::shared_ptr<Nz::VertexBuffer> vertexBuffer = std::make_shared<Nz::VertexBuffer>(Nz::VertexDeclaration::Get(Nz::VertexLayout::XYZ_Normal_UV_Tangent_Skinning), 64, params.storage, params.vertexBufferFlags);
+		std::shared_ptr<Nz::IndexBuffer> indexBuffer = std::make_shared<Nz::IndexBuffer>(false, 96, params.storage, params.indexBufferFlags);
+
+		std::mt19937 randomEngine(42);
+		std::uniform_int_distribution<unsigned int> distribution(0, 255);
+
+		Nz::UInt8* vertices = static_cast<Nz::UInt8*>(vertexBuffer->MapRaw(Nz::BufferAccess::WriteOnly));
+		for (std::size_t i = 0; i < 64 * vertexBuffer->GetStride(); ++i)
+			vertices[i] = static_cast<Nz::UInt8>(distribution(randomEngine));
+		vertexBuffer->Unmap();
+
+		Nz::UInt16* indices = static_cast<Nz::UInt16*>(indexBuffer->MapRaw(Nz::BufferAccess::WriteOnly));
+		for (Nz::UInt16 i = 0; i < 96; ++i)
+			indices[i] = i % 64;
+		indexBuffer->Unmap();
+
+		std::shared_ptr<Nz::SkeletalMesh> subMesh = std::make_shared<Nz::SkeletalMesh>(vertexBuffer, indexBuffer);
+		subMesh->SetAABB(Nz::Boxf(-1.f, -1.f, -1.f, 2.f, 2.f, 2.f));
+		mesh.AddSubMesh(subMesh);
+
+		WHEN("We save it and load it back as NMF")
+		{
+			Nz::MeshParams saveParams = params;
+			saveParams.custom.SetParameter("NativeNMFSaver_Compress", true);
+
+			Nz::ByteArray data;
+			Nz::MemoryStream stream(&data);
+			REQUIRE(mesh.SaveToStream(stream, "nmf", saveParams));
+
+			std::shared_ptr<Nz::Mesh> loadedMesh = Nz::Mesh::LoadFromMemory(data.GetConstBuffer(), data.GetSize(), params);
+
+			THEN("Its skeleton is preserved")
+			{
+				REQUIRE(loadedMesh);
+				CheckSameMesh(mesh, *loadedMesh);
+
+				const Nz::Skeleton* loadedSkeleton = loadedMesh->GetSkeleton();
+				REQUIRE(loadedSkeleton->GetJointCount() == 2);
+				CHECK(loadedSkeleton->GetJoint(0)->GetName() == "root");
+				CHECK(loadedSkeleton->GetJoint(1)->GetName() == "arm");
+				CHECK(loadedSkeleton->GetJoint(1)->GetParent() == loadedSkeleton->GetJoint(0));
+				CHECK(loadedSkeleton->GetJoint(1)->GetPosition() == Nz::Vector3f(0.f, 1.f, 0.f));
+				CHECK(loadedSkeleton->GetJoint(1)->GetInverseBindMatrix() == Nz::Matrix4f::Translate(Nz::Vector3f(0.f, -1.f, 0.f)));
+			}
+		}
+	}
+}
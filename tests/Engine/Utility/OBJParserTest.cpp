@@ -0,0 +1,145 @@
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/MemoryStream.hpp>
+#include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Utility/Formats/OBJParser.hpp>
+#include <catch2/catch.hpp>
+#include <string>
+
+SCENARIO("OBJParser", "[UTILITY][OBJPARSER]")
+{
+	GIVEN("A small OBJ file using every face vertex syntax")
+	{
+		std::string content =
+			"# A comment\r\n"
+			"mtllib materials.mtl\r\n"
+			"v 0 0 0\r\n"
+			"v 1.5 0 0 # trailing comment\r\n"
+			"v 0 -2.25e1 0 0.5\r\n"
+			"v 1 1 1\r\n"
+			"vt 0.25 0.75\r\n"
+			"vn 0 1 0\r\n"
+			"\r\n"
+			"o first\r\n"
+			"usemtl red\r\n"
+			"f 1 2 3\r\n"
+			"f 1/1 2/1 3/1 4/1\r\n"
+			"usemtl blue\r\n"
+			"f 1//1 2//1 3//1\r\n"
+			"g second\r\n"
+			"f -4/-1/-1 -3/-1/-1 -2/-1/-1\r\n"
+			"s off\r\n"
+			"f 1 2 9\r\n";
+
+		Nz::MemoryView stream(content.data(), content.size());
+
+		WHEN("We parse it")
+		{
+			Nz::OBJParser parser;
+			REQUIRE(parser.Parse(stream));
+
+			THEN("Vertex data is read")
+			{
+				CHECK(parser.GetMtlLib() == "materials.mtl");
+
+				REQUIRE(parser.GetPositionCount() == 4);
+				CHECK(parser.GetPositions()[1] == Nz::Vector4f(1.5f, 0.f, 0.f, 1.f));
+				CHECK(parser.GetPositions()[2] == Nz::Vector4f(0.f, -22.5f, 0.f, 0.5f));
+
+				REQUIRE(parser.GetTexCoordCount() == 1);
+				CHECK(parser.GetTexCoords()[0] == Nz::Vector3f(0.25f, 0.75f, 0.f));
+
+				REQUIRE(parser.GetNormalCount() == 1);
+				CHECK(parser.GetNormals()[0] == Nz::Vector3f(0.f, 1.f, 0.f));
+			}
+
+			THEN("Faces are sorted by group and material")
+			{
+				REQUIRE(parser.GetMeshCount() == 3);
+
+				const Nz::OBJParser::Mesh* meshes = parser.GetMeshes();
+				CHECK(meshes[0].name == "first");
+				CHECK(parser.GetMaterials()[meshes[0].material] == "red");
+				REQUIRE(meshes[0].faces.size() == 2);
+				CHECK(meshes[0].faces[1].vertexCount == 4);
+				CHECK(meshes[0].vertices[3].position == 1);
+				CHECK(meshes[0].vertices[3].texCoord == 1);
+				CHECK(meshes[0].vertices[3].normal == 0);
+
+				CHECK(meshes[1].name == "first");
+				CHECK(parser.GetMaterials()[meshes[1].material] == "blue");
+				REQUIRE(meshes[1].faces.size() == 1);
+				CHECK(meshes[1].vertices[2].position == 3);
+				CHECK(meshes[1].vertices[2].texCoord == 0);
+				CHECK(meshes[1].vertices[2].normal == 1);
+
+				// Relative indices are resolved and out of range faces are skipped
+				CHECK(meshes[2].name == "second");
+				CHECK(parser.GetMaterials()[meshes[2].material] == "blue");
+				REQUIRE(meshes[2].faces.size() == 1);
+				CHECK(meshes[2].vertices[0].position == 1);
+				CHECK(meshes[2].vertices[2].position == 3);
+				CHECK(meshes[2].vertices[2].texCoord == 1);
+				CHECK(meshes[2].vertices[2].normal == 1);
+			}
+		}
+	}
+
+	GIVEN("A large OBJ file")
+	{
+		// Big enough to be split in several chunks, with relative indices crossing chunk boundaries
+		constexpr std::size_t quadCount = 100'000;
+
+		Nz::ByteArray content;
+		Nz::MemoryStream stream(&content);
+		for (std::size_t i = 0; i < quadCount; ++i)
+		{
+			if (i % 1000 == 0)
+				stream.Write("g group" + std::to_string(i / 50'000) + "\nusemtl mat" + std::to_string((i / 1000) % 2) + "\n");
+
+			float x = float(i);
+			stream.Write("v " + std::to_string(x) + " 0 0\nv " + std::to_string(x) + " 1 0\nv " + std::to_string(x + 1.f) + " 1 0\n");
+			if (i % 2 == 0)
+				stream.Write("v " + std::to_string(x + 1.f) + " 0.5 -1e-3\nf -4 -3 -2 -1\n");
+			else
+				stream.Write("v " + std::to_string(x + 1.f) + " 0.5 -1e-3\nf " + std::to_string(i * 4 + 1) + " " + std::to_string(i * 4 + 2) + " " + std::to_string(i * 4 + 3) + " " + std::to_string(i * 4 + 4) + "\n");
+		}
+
+		REQUIRE(content.GetSize() > 4 * 1024 * 1024);
+
+		WHEN("We parse it")
+		{
+			Nz::OBJParser parser;
+			stream.SetCursorPos(0);
+			REQUIRE(parser.Parse(stream));
+
+			THEN("Every face is read in order")
+			{
+				REQUIRE(parser.GetPositionCount() == quadCount * 4);
+				CHECK(parser.GetPositions()[quadCount * 4 - 1] == Nz::Vector4f(float(quadCount), 0.5f, -0.001f, 1.f));
+
+				REQUIRE(parser.GetMeshCount() == 4);
+
+				std::size_t faceCount = 0;
+				for (std::size_t i = 0; i < parser.GetMeshCount(); ++i)
+				{
+					const Nz::OBJParser::Mesh& mesh = parser.GetMeshes()[i];
+					CHECK(mesh.name == "group" + std::to_string(i / 2));
+
+					for (const Nz::OBJParser::Face& face : mesh.faces)
+					{
+						REQUIRE(face.vertexCount == 4);
+
+						// Faces reference their own four vertices
+						std::size_t firstPosition = mesh.vertices[face.firstVertex].position;
+						CHECK((firstPosition - 1) % 4 == 0);
+						CHECK(mesh.vertices[face.firstVertex + 3].position == firstPosition + 3);
+					}
+
+					faceCount += mesh.faces.size();
+				}
+
+				CHECK(faceCount == quadCount);
+			}
+		}
+	}
+}
@@ -0,0 +1,152 @@
+#include <Nazara/Utility/Image.hpp>
+#include <Nazara/Utility/PixelFormat.hpp>
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	std::vector<Nz::UInt8> GenerateRandomPixels(std::size_t size)
+	{
+		std::mt19937 randomEngine(42);
+		std::uniform_int_distribution<unsigned int> distribution(0, 255);
+
+		std::vector<Nz::UInt8> pixels(size);
+		for (Nz::UInt8& byte : pixels)
+			byte = static_cast<Nz::UInt8>(distribution(randomEngine));
+
+		return pixels;
+	}
+
+	std::vector<Nz::UInt8> ConvertPixelByPixel(Nz::PixelFormat srcFormat, Nz::PixelFormat dstFormat, const std::vector<Nz::UInt8>& pixels)
+	{
+		// Converting a single pixel never fills a vector, this always uses the scalar converters
+		std::size_t srcPixelSize = Nz::PixelFormatInfo::GetBytesPerPixel(srcFormat);
+		std::size_t dstPixelSize = Nz::PixelFormatInfo::GetBytesPerPixel(dstFormat);
+		std::size_t pixelCount = pixels.size() / srcPixelSize;
+
+		std::vector<Nz::UInt8> result(pixelCount * dstPixelSize);
+		for (std::size_t i = 0; i < pixelCount; ++i)
+			Nz::PixelFormatInfo::Convert(srcFormat, dstFormat, &pixels[i * srcPixelSize], &result[i * dstPixelSize]);
+
+		return result;
+	}
+}
+
+SCENARIO("PixelFormatInfo", "[UTILITY][PIXELFORMAT]")
+{
+	GIVEN("Some pixels to convert")
+	{
+		WHEN("We convert pixels using 5 and 4 bits channels")
+		{
+			std::array<Nz::UInt8, 4> white = { 0xFF, 0xFF, 0xFF, 0xFF };
+			std::array<Nz::UInt8, 4> color = { 0x80, 0x40, 0x10, 0x00 };
+
+			Nz::UInt16 pixel;
+			REQUIRE(Nz::PixelFormatInfo::Convert(Nz::PixelFormat::RGBA8, Nz::PixelFormat::RGB5A1, white.data(), &pixel));
+			CHECK(pixel == 0xFFFF);
+			REQUIRE(Nz::PixelFormatInfo::Convert(Nz::PixelFormat::RGBA8, Nz::PixelFormat::RGB5A1, color.data(), &pixel));
+			CHECK(pixel == ((15 << 11) | (7 << 6) | (1 << 1)));
+			REQUIRE(Nz::PixelFormatInfo::Convert(Nz::PixelFormat::RGBA8, Nz::PixelFormat::RGBA4, color.data(), &pixel));
+			CHECK(pixel == 0x8410);
+
+			THEN("Converting them back gives the expected values")
+			{
+				std::array<Nz::UInt8, 4> result;
+				pixel = (31 << 11) | (16 << 6) | (1 << 1) | 1;
+				REQUIRE(Nz::PixelFormatInfo::Convert(Nz::PixelFormat::RGB5A1, Nz::PixelFormat::RGBA8, &pixel, result.data()));
+				CHECK(result == std::array<Nz::UInt8, 4>{ 255, 131, 8, 255 });
+
+				pixel = 0xF18A;
+				REQUIRE(Nz::PixelFormatInfo::Convert(Nz::PixelFormat::RGBA4, Nz::PixelFormat::BGRA8, &pixel, result.data()));
+				CHECK(result == std::array<Nz::UInt8, 4>{ 0x80, 0x10, 0xF0, 0xA0 });
+			}
+		}
+
+		WHEN("We convert buffers of various sizes at once")
+		{
+			// Every conversion having a vectorized implementation, which must match the scalar one exactly
+			std::vector<std::pair<Nz::PixelFormat, Nz::PixelFormat>> conversions = {
+				{ Nz::PixelFormat::BGR8,   Nz::PixelFormat::BGRA8  },
+				{ Nz::PixelFormat::BGR8,   Nz::PixelFormat::RGBA8  },
+				{ Nz::PixelFormat::BGRA8,  Nz::PixelFormat::BGR8   },
+				{ Nz::PixelFormat::BGRA8,  Nz::PixelFormat::RGB5A1 },
+				{ Nz::PixelFormat::BGRA8,  Nz::PixelFormat::RGB8   },
+				{ Nz::PixelFormat::BGRA8,  Nz::PixelFormat::RGBA4  },
+				{ Nz::PixelFormat::BGRA8,  Nz::PixelFormat::RGBA8  },
+				{ Nz::PixelFormat::L8,     Nz::PixelFormat::BGRA8  },
+				{ Nz::PixelFormat::L8,     Nz::PixelFormat::RGBA8  },
+				{ Nz::PixelFormat::LA8,    Nz::PixelFormat::BGRA8  },
+				{ Nz::PixelFormat::LA8,    Nz::PixelFormat::RGBA8  },
+				{ Nz::PixelFormat::RGB5A1, Nz::PixelFormat::BGRA8  },
+				{ Nz::PixelFormat::RGB5A1, Nz::PixelFormat::RGBA8  },
+				{ Nz::PixelFormat::RGB8,   Nz::PixelFormat::BGRA8  },
+				{ Nz::PixelFormat::RGB8,   Nz::PixelFormat::RGBA8  },
+				{ Nz::PixelFormat::RGBA4,  Nz::PixelFormat::BGRA8  },
+				{ Nz::PixelFormat::RGBA4,  Nz::PixelFormat::RGBA8  },
+				{ Nz::PixelFormat::RGBA8,  Nz::PixelFormat::BGR8   },
+				{ Nz::PixelFormat::RGBA8,  Nz::PixelFormat::BGRA8  },
+				{ Nz::PixelFormat::RGBA8,  Nz::PixelFormat::RGB5A1 },
+				{ Nz::PixelFormat::RGBA8,  Nz::PixelFormat::RGB8   },
+				{ Nz::PixelFormat::RGBA8,  Nz::PixelFormat::RGBA4  }
+			};
+
+			THEN("Results match a pixel per pixel conversion")
+			{
+				for (auto&& [srcFormat, dstFormat] : conversions)
+				{
+					INFO(Nz::PixelFormatInfo::GetName(srcFormat) + " to " + Nz::PixelFormatInfo::GetName(dstFormat));
+
+					std::size_t srcPixelSize = Nz::PixelFormatInfo::GetBytesPerPixel(srcFormat);
+					std::size_t dstPixelSize = Nz::PixelFormatInfo::GetBytesPerPixel(dstFormat);
+
+					for (std::size_t pixelCount : { 1, 7, 15, 16, 17, 31, 33, 64, 1037 })
+					{
+						INFO(pixelCount << " pixels");
+
+						std::vector<Nz::UInt8> pixels = GenerateRandomPixels(pixelCount * srcPixelSize);
+
+						std::vector<Nz::UInt8> result(pixelCount * dstPixelSize);
+						REQUIRE(Nz::PixelFormatInfo::Convert(srcFormat, dstFormat, pixels.data(), pixels.data() + pixels.size(), result.data()));
+						CHECK(result == ConvertPixelByPixel(srcFormat, dstFormat, pixels));
+					}
+				}
+			}
+		}
+	}
+
+	GIVEN("A cubemap with mipmaps")
+	{
+		Nz::Image image(Nz::ImageType::Cubemap, Nz::PixelFormat::RGB8, 128, 128, 1, 4);
+
+		std::vector<std::vector<Nz::UInt8>> levels;
+		for (Nz::UInt8 level = 0; level < image.GetLevelCount(); ++level)
+		{
+			// Image::Update only fills the first face of a cubemap
+			levels.push_back(GenerateRandomPixels(image.GetMemoryUsage(level)));
+			std::memcpy(image.GetPixels(0, 0, 0, level), levels.back().data(), levels.back().size());
+		}
+
+		WHEN("We convert it to another format")
+		{
+			REQUIRE(image.Convert(Nz::PixelFormat::BGRA8));
+
+			THEN("Every face of every level has been converted")
+			{
+				CHECK(image.GetFormat() == Nz::PixelFormat::BGRA8);
+
+				for (Nz::UInt8 level = 0; level < image.GetLevelCount(); ++level)
+				{
+					std::vector<Nz::UInt8> expected = ConvertPixelByPixel(Nz::PixelFormat::RGB8, Nz::PixelFormat::BGRA8, levels[level]);
+
+					REQUIRE(image.GetMemoryUsage(level) == expected.size());
+					CHECK(std::equal(expected.begin(), expected.end(), image.GetConstPixels(0, 0, 0, level)));
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,188 @@
+#include <Nazara/Math/EulerAngles.hpp>
+#include <Nazara/Utility/Node.hpp>
+#include <Nazara/Utility/TransformHierarchy.hpp>
+#include <catch2/catch.hpp>
+#include <algorithm>
+
+namespace
+{
+	bool MatrixEquals(const Nz::Matrix4f& lhs, const Nz::Matrix4f& rhs)
+	{
+		for (unsigned int i = 0; i < 16; ++i)
+		{
+			if (!Nz::NumberEquals(lhs[i], rhs[i], 0.0001f))
+				return false;
+		}
+
+		return true;
+	}
+}
+
+SCENARIO("TransformHierarchy", "[UTILITY][TRANSFORMHIERARCHY]")
+{
+	GIVEN("A hierarchy of three nodes")
+	{
+		Nz::TransformHierarchy hierarchy;
+
+		std::vector<std::size_t> updatedNodes;
+		unsigned int updateCount = 0;
+		NazaraSlot(Nz::TransformHierarchy, OnTransformsUpdated, onUpdated);
+		onUpdated.Connect(hierarchy.OnTransformsUpdated, [&](Nz::TransformHierarchy* /*hierarchy*/, const std::vector<std::size_t>& nodes)
+		{
+			updatedNodes = nodes;
+			std::sort(updatedNodes.begin(), updatedNodes.end());
+			updateCount++;
+		});
+
+		std::size_t root = hierarchy.CreateNode();
+		std::size_t child = hierarchy.CreateNode(root);
+		std::size_t grandChild = hierarchy.CreateNode(child);
+
+		CHECK(hierarchy.GetNodeCount() == 3);
+		CHECK(hierarchy.GetParent(child) == root);
+		CHECK(hierarchy.GetParent(root) == Nz::TransformHierarchy::InvalidNode);
+
+		hierarchy.SetPosition(root, Nz::Vector3f::UnitX());
+		hierarchy.SetRotation(root, Nz::EulerAnglesf(0.f, 90.f, 0.f).ToQuaternion());
+		hierarchy.SetScale(root, Nz::Vector3f(2.f));
+		hierarchy.SetPosition(child, Nz::Vector3f::UnitZ());
+		hierarchy.SetPosition(grandChild, Nz::Vector3f::UnitY());
+
+		hierarchy.Update();
+		CHECK(updateCount == 1);
+		CHECK(updatedNodes.size() == 3);
+
+		// Reference computations
+		Nz::Node rootNode;
+		rootNode.SetPosition(Nz::Vector3f::UnitX());
+		rootNode.SetRotation(Nz::EulerAnglesf(0.f, 90.f, 0.f).ToQuaternion());
+		rootNode.SetScale(Nz::Vector3f(2.f));
+
+		Nz::Node childNode;
+		childNode.SetParent(rootNode);
+		childNode.SetPosition(Nz::Vector3f::UnitZ());
+
+		Nz::Node grandChildNode;
+		grandChildNode.SetParent(childNode);
+		grandChildNode.SetPosition(Nz::Vector3f::UnitY());
+
+		THEN("Global transforms match the ones of nodes")
+		{
+			CHECK(hierarchy.GetPosition(child, Nz::CoordSys::Global).Distance(childNode.GetPosition(Nz::CoordSys::Global)) < 0.0001f);
+			CHECK(hierarchy.GetRotation(child, Nz::CoordSys::Global) == childNode.GetRotation(Nz::CoordSys::Global));
+			CHECK(hierarchy.GetScale(grandChild, Nz::CoordSys::Global) == grandChildNode.GetScale(Nz::CoordSys::Global));
+			CHECK(MatrixEquals(hierarchy.GetTransformMatrix(child), childNode.GetTransformMatrix()));
+			CHECK(MatrixEquals(hierarchy.GetTransformMatrix(grandChild), grandChildNode.GetTransformMatrix()));
+		}
+
+		WHEN("We move the child")
+		{
+			hierarchy.SetPosition(child, Nz::Vector3f::UnitY());
+			childNode.SetPosition(Nz::Vector3f::UnitY());
+
+			THEN("Only the child and its children are updated")
+			{
+				hierarchy.Update();
+				CHECK(updateCount == 2);
+				CHECK(updatedNodes == std::vector<std::size_t>{ child, grandChild });
+				CHECK(MatrixEquals(hierarchy.GetTransformMatrix(grandChild), grandChildNode.GetTransformMatrix()));
+			}
+		}
+
+		WHEN("Nothing changed")
+		{
+			hierarchy.Update();
+
+			THEN("No update is signaled")
+			{
+				CHECK(updateCount == 1);
+			}
+		}
+
+		WHEN("We reparent the grand child to the root")
+		{
+			hierarchy.SetParent(grandChild, root);
+			grandChildNode.SetParent(rootNode);
+
+			hierarchy.Update();
+
+			THEN("Its global transform is computed from its new parent")
+			{
+				CHECK(hierarchy.GetParent(grandChild) == root);
+				CHECK(updatedNodes == std::vector<std::size_t>{ grandChild });
+				CHECK(MatrixEquals(hierarchy.GetTransformMatrix(grandChild), grandChildNode.GetTransformMatrix()));
+			}
+		}
+
+		WHEN("We try to make the root a child of its grand child")
+		{
+			hierarchy.SetParent(root, grandChild);
+
+			THEN("Nothing happens")
+			{
+				CHECK(hierarchy.GetParent(root) == Nz::TransformHierarchy::InvalidNode);
+			}
+		}
+
+		WHEN("We destroy the child")
+		{
+			hierarchy.DestroyNode(child);
+			grandChildNode.SetParent(nullptr);
+
+			hierarchy.Update();
+
+			THEN("Its children become root nodes")
+			{
+				CHECK_FALSE(hierarchy.IsValid(child));
+				CHECK(hierarchy.GetNodeCount() == 2);
+				CHECK(hierarchy.GetParent(grandChild) == Nz::TransformHierarchy::InvalidNode);
+				CHECK(updatedNodes == std::vector<std::size_t>{ grandChild });
+				CHECK(MatrixEquals(hierarchy.GetTransformMatrix(grandChild), grandChildNode.GetTransformMatrix()));
+			}
+
+			AND_THEN("Its identifier is reused by the next node")
+			{
+				std::size_t newNode = hierarchy.CreateNode(grandChild);
+				CHECK(newNode == child);
+				CHECK(hierarchy.GetParent(newNode) == grandChild);
+				CHECK(hierarchy.GetPosition(newNode) == Nz::Vector3f::Zero());
+			}
+		}
+	}
+
+	GIVEN("Many nodes created in no particular order")
+	{
+		Nz::TransformHierarchy hierarchy;
+		std::vector<std::size_t> nodes;
+
+		nodes.push_back(hierarchy.CreateNode());
+		for (std::size_t i = 1; i < 1000; ++i)
+		{
+			// Depth goes up and down, nodes are not created in depth order
+			std::size_t parent = (i % 7 == 0) ? Nz::TransformHierarchy::InvalidNode : nodes[i / 2];
+			nodes.push_back(hierarchy.CreateNode(parent));
+			hierarchy.SetPosition(nodes.back(), Nz::Vector3f(float(i), 0.f, 0.f));
+		}
+
+		WHEN("We update it")
+		{
+			hierarchy.Update(true);
+
+			THEN("Every node position is the sum of its ancestors ones")
+			{
+				bool success = true;
+				for (std::size_t node : nodes)
+				{
+					float expectedPosition = 0.f;
+					for (std::size_t ancestor = node; ancestor != Nz::TransformHierarchy::InvalidNode; ancestor = hierarchy.GetParent(ancestor))
+						expectedPosition += hierarchy.GetPosition(ancestor).x;
+
+					if (hierarchy.GetPosition(node, Nz::CoordSys::Global) != Nz::Vector3f(expectedPosition, 0.f, 0.f))
+						success = false;
+				}
+
+				CHECK(success);
+			}
+		}
+	}
+}
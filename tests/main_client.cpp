@@ -8,10 +8,11 @@
 #include <Nazara/Network/Network.hpp>
 #include <Nazara/Physics2D/Physics2D.hpp>
 #include <Nazara/Shader/Shader.hpp>
+#include <Nazara/Utility/Utility.hpp>
 
 int main(int argc, char* argv[])
 {
-	Nz::Modules<Nz::Audio, Nz::Network, Nz::Physics2D, Nz::Shader> nazaza;
+	Nz::Modules<Nz::Audio, Nz::Network, Nz::Physics2D, Nz::Shader, Nz::Utility> nazaza;
 
 	int result = Catch::Session().run(argc, argv);
 
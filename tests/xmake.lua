@@ -9,8 +9,9 @@ target("NazaraClientUnitTests")
 	set_group("Tests")
 	set_kind("binary")
 
-	add_deps("NazaraAudio", "NazaraCore", "NazaraNetwork", "NazaraPhysics2D", "NazaraShader")
-	add_packages("catch2")
+	add_deps("NazaraAudio", "NazaraCore", "NazaraGraphics", "NazaraNetwork", "NazaraNullRenderer", "NazaraPhysics2D", "NazaraShader", "NazaraUtility")
+	add_packages("catch2", "entt")
+	add_includedirs("../src") -- embedded resources
 
 	add_files("main_client.cpp")
 	add_files("resources.cpp")
@@ -20,8 +21,9 @@ target("NazaraUnitTests")
 	set_group("Tests")
 	set_kind("binary")
 
-	add_deps("NazaraCore", "NazaraNetwork", "NazaraPhysics2D", "NazaraShader")
-	add_packages("catch2")
+	add_deps("NazaraCore", "NazaraGraphics", "NazaraNetwork", "NazaraNullRenderer", "NazaraPhysics2D", "NazaraShader", "NazaraUtility")
+	add_packages("catch2", "entt")
+	add_includedirs("../src") -- embedded resources
 
 	add_files("main.cpp")
 	add_files("resources.cpp")
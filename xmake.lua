@@ -34,6 +34,9 @@ local modules = {
 			end
 		end
 	},
+	NullRenderer = {
+		Deps = {"NazaraRenderer"}
+	},
 	OpenGLRenderer = {
 		Deps = {"NazaraRenderer"},
 		Custom = function()
@@ -79,7 +82,7 @@ local modules = {
 	},
 	Utility = {
 		Deps = {"NazaraCore"},
-		Packages = {"entt", "freetype", "stb"}
+		Packages = {"entt", "freetype", "lz4", "stb"}
 	},
 	VulkanRenderer = {
 		Deps = {"NazaraRenderer"},
@@ -100,7 +103,7 @@ local modules = {
 
 add_repositories("local-repo xmake-repo")
 
-add_requires("chipmunk2d", "dr_wav", "entt", "freetype", "libflac", "libsdl", "minimp3", "stb")
+add_requires("chipmunk2d", "dr_wav", "entt", "freetype", "libflac", "libsdl", "lz4", "minimp3", "stb")
 add_requires("libvorbis", { configs = { with_vorbisenc = false } })
 add_requires("openal-soft", { configs = { shared = true }})
 add_requires("newtondynamics", { debug = is_plat("windows") and is_mode("debug") }) -- Newton doesn't like compiling in Debug on Linux
@@ -194,6 +197,7 @@ includes("tools/xmake.lua")
 includes("tests/xmake.lua")
 includes("plugins/*/xmake.lua")
 includes("examples/*/xmake.lua")
+includes("benchmarks/*/xmake.lua")
 
 -- Adds -d as a debug suffix
 rule("debug_suffix")